@@ -49,6 +49,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/maths/plane.h>
 #include <vsg/maths/quat.h>
 #include <vsg/maths/sample.h>
+#include <vsg/maths/simd.h>
 #include <vsg/maths/sphere.h>
 #include <vsg/maths/transform.h>
 #include <vsg/maths/vec2.h>
@@ -58,7 +59,9 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 // Node header files
 #include <vsg/nodes/AbsoluteTransform.h>
 #include <vsg/nodes/Bin.h>
+#include <vsg/nodes/CachedCommandGroup.h>
 #include <vsg/nodes/Compilable.h>
+#include <vsg/nodes/CoordinateFrame.h>
 #include <vsg/nodes/CullGroup.h>
 #include <vsg/nodes/CullNode.h>
 #include <vsg/nodes/DepthSorted.h>
@@ -72,7 +75,9 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/nodes/PagedLOD.h>
 #include <vsg/nodes/QuadGroup.h>
 #include <vsg/nodes/RegionOfInterest.h>
+#include <vsg/nodes/SpatialGroup.h>
 #include <vsg/nodes/StateGroup.h>
+#include <vsg/nodes/StreamedTextureGroup.h>
 #include <vsg/nodes/Switch.h>
 #include <vsg/nodes/TileDatabase.h>
 #include <vsg/nodes/Transform.h>
@@ -159,6 +164,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/state/InputAssemblyState.h>
 #include <vsg/state/MultisampleState.h>
 #include <vsg/state/PipelineLayout.h>
+#include <vsg/state/PipelineScheduler.h>
 #include <vsg/state/PushConstants.h>
 #include <vsg/state/QueryPool.h>
 #include <vsg/state/RasterizationState.h>
@@ -168,20 +174,25 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/state/ShaderStage.h>
 #include <vsg/state/StateCommand.h>
 #include <vsg/state/StateSwitch.h>
+#include <vsg/state/StreamedTexture.h>
 #include <vsg/state/TessellationState.h>
 #include <vsg/state/VertexInputState.h>
 #include <vsg/state/ViewDependentState.h>
 #include <vsg/state/ViewportState.h>
+#include <vsg/state/VirtualTexture.h>
 #include <vsg/state/material.h>
 
 // Threading header files
 #include <vsg/threading/ActivityStatus.h>
 #include <vsg/threading/Affinity.h>
 #include <vsg/threading/Barrier.h>
+#include <vsg/threading/DeleteQueue.h>
 #include <vsg/threading/FrameBlock.h>
+#include <vsg/threading/FrameTaskGraph.h>
 #include <vsg/threading/Latch.h>
 #include <vsg/threading/OperationQueue.h>
 #include <vsg/threading/OperationThreads.h>
+#include <vsg/threading/SpinWait.h>
 #include <vsg/threading/atomics.h>
 
 // User Interface abstraction header files
@@ -214,6 +225,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/app/RenderGraph.h>
 #include <vsg/app/SecondaryCommandGraph.h>
 #include <vsg/app/Trackball.h>
+#include <vsg/app/TextureStreaming.h>
 #include <vsg/app/TransferTask.h>
 #include <vsg/app/UpdateOperations.h>
 #include <vsg/app/View.h>
@@ -238,6 +250,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/vk/Framebuffer.h>
 #include <vsg/vk/Instance.h>
 #include <vsg/vk/InstanceExtensions.h>
+#include <vsg/vk/MemoryBudget.h>
 #include <vsg/vk/MemoryBufferPools.h>
 #include <vsg/vk/PhysicalDevice.h>
 #include <vsg/vk/Queue.h>
@@ -265,6 +278,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/io/Output.h>
 #include <vsg/io/Path.h>
 #include <vsg/io/ReaderWriter.h>
+#include <vsg/io/TileCache.h>
 #include <vsg/io/VSG.h>
 #include <vsg/io/convert_utf.h>
 #include <vsg/io/glsl.h>
@@ -278,18 +292,23 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/io/write.h>
 
 // Utility header files
+#include <vsg/utils/BlockCompression.h>
 #include <vsg/utils/Builder.h>
 #include <vsg/utils/CommandLine.h>
 #include <vsg/utils/ComputeBounds.h>
 #include <vsg/utils/FindDynamicObjects.h>
+#include <vsg/utils/GenerateMipmaps.h>
 #include <vsg/utils/GpuAnnotation.h>
 #include <vsg/utils/GraphicsPipelineConfigurator.h>
+#include <vsg/utils/InstanceRepeatedSubgraphs.h>
 #include <vsg/utils/Instrumentation.h>
 #include <vsg/utils/Intersector.h>
 #include <vsg/utils/LineSegmentIntersector.h>
 #include <vsg/utils/LoadPagedLOD.h>
+#include <vsg/utils/PageTable.h>
 #include <vsg/utils/Profiler.h>
 #include <vsg/utils/PropagateDynamicObjects.h>
+#include <vsg/utils/RefitBounds.h>
 #include <vsg/utils/ShaderCompiler.h>
 #include <vsg/utils/ShaderSet.h>
 #include <vsg/utils/SharedObjects.h>
@@ -61,6 +61,9 @@ namespace vsg
         /// assign Instrumentation to all CompileTraversal and their associated Context
         void assignInstrumentation(ref_ptr<Instrumentation> in_instrumentation);
 
+        /// assign PipelineScheduler to all CompileTraversal and their associated Context to enable background creation of GraphicsPipeline
+        void assignPipelineScheduler(ref_ptr<PipelineScheduler> in_pipelineScheduler);
+
         using ContextSelectionFunction = std::function<bool(vsg::Context&)>;
 
         /// compile object
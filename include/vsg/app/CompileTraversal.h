@@ -49,6 +49,9 @@ namespace vsg
         /// Hook for assigning Instrumentation to enable profiling
         ref_ptr<Instrumentation> instrumentation;
 
+        /// optional PipelineScheduler assigned to Context to enable background creation of GraphicsPipeline
+        ref_ptr<PipelineScheduler> pipelineScheduler;
+
         /// add a compile Context for device
         void add(ref_ptr<Device> device, const ResourceRequirements& resourceRequirements = {});
 
@@ -67,6 +70,9 @@ namespace vsg
         /// assign Instrumentation to all Context
         void assignInstrumentation(ref_ptr<Instrumentation> in_instrumentation);
 
+        /// assign PipelineScheduler to all Context
+        void assignPipelineScheduler(ref_ptr<PipelineScheduler> in_pipelineScheduler);
+
         Instrumentation* getInstrumentation() override { return instrumentation.get(); }
 
         virtual bool record();
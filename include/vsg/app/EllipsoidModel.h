@@ -48,6 +48,14 @@ namespace vsg
         /// latitude and longitude in degrees, altitude in metres, ECEF coords in metres.
         dvec3 convertLatLongAltitudeToECEF(const dvec3& lla) const;
 
+        /// batched conversion of count latitude, longitude (degrees), altitude (metres) positions to ECEF coords in metres.
+        void convertLatLongAltitudeToECEF(const dvec3* lla, dvec3* ecef, size_t count) const;
+
+        /// convert a regular grid of latitudes and longitudes (degrees) to ECEF coords in metres, written row by row to ecef[row * numLongitudes + column].
+        /// altitudes, if non null, provides an altitude per grid point in the same row major order, otherwise an altitude of 0 is used.
+        /// The trigonometric terms are computed once per row and column so the per point work is just multiply/adds.
+        void convertLatLongGridToECEF(const double* latitudes, size_t numLatitudes, const double* longitudes, size_t numLongitudes, const double* altitudes, dvec3* ecef) const;
+
         /// latitude and longitude in degrees, altitude in metres, ECEF coords in metres.
         dvec3 convertECEFToLatLongAltitude(const dvec3& ecef) const;
 
@@ -30,12 +30,17 @@ namespace vsg
     class LOD;
     class PagedLOD;
     class StateGroup;
+    class StreamedTextureGroup;
+    class CachedCommandGroup;
+    struct CachedCommandDependencies;
     class CullGroup;
     class CullNode;
+    class SpatialGroup;
     class DepthSorted;
     class Layer;
     class Transform;
     class MatrixTransform;
+    class CoordinateFrame;
     class Joint;
     class TileDatabase;
     class VertexDraw;
@@ -43,6 +48,8 @@ namespace vsg
     class Geometry;
     class Command;
     class Commands;
+    class NextSubPass;
+    class ExecuteCommands;
     class CommandBuffer;
     class State;
     class DatabasePager;
@@ -115,6 +122,7 @@ namespace vsg
         void apply(const TileDatabase& tileDatabase);
         void apply(const CullGroup& cullGroup);
         void apply(const CullNode& cullNode);
+        void apply(const SpatialGroup& spatialGroup);
         void apply(const DepthSorted& depthSorted);
         void apply(const Layer& layer);
         void apply(const Switch& sw);
@@ -135,16 +143,21 @@ namespace vsg
         // transform nodes
         void apply(const Transform& transform);
         void apply(const MatrixTransform& mt);
+        void apply(const CoordinateFrame& cf);
 
         // Animation nodes
         void apply(const Joint& joint);
 
         // Vulkan nodes
         void apply(const StateGroup& object);
+        void apply(const StreamedTextureGroup& group);
+        void apply(const CachedCommandGroup& group);
 
         // Commands
         void apply(const Commands& commands);
         void apply(const Command& command);
+        void apply(const NextSubPass& nextSubPass);
+        void apply(const ExecuteCommands& executeCommands);
 
         // Viewer level nodes
         void apply(const Bin& bin);
@@ -153,6 +166,17 @@ namespace vsg
 
         void addToBin(int32_t binNumber, double value, const Node* node);
 
+        /// called by RenderGraph after vkCmdBeginRenderPass and by NextSubPass after vkCmdNextSubpass. Vulkan doesn't permit commands to be recorded directly into a subpass
+        /// with VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS contents, so for such subpasses all subsequent commands are recorded into secondary CommandBuffer
+        /// that are executed, along with those passed to executeCommands(), from the primary CommandBuffer by endSubpass().
+        void beginSubpass();
+
+        /// called by RenderGraph before vkCmdEndRenderPass and by NextSubPass before vkCmdNextSubpass, executes the secondary CommandBuffer recorded for the current subpass.
+        void endSubpass();
+
+        /// execute a recorded secondary CommandBuffer in order with the rest of the commands recorded for the current subpass, used by CachedCommandGroup.
+        void executeCommands(ref_ptr<CommandBuffer> secondaryCommandBuffer);
+
         // clear the bins to record a new frame.
         void clearBins();
 
@@ -172,6 +196,31 @@ namespace vsg
         int32_t _minimumBinNumber = 0;
         std::vector<ref_ptr<Bin>> _bins;
         ref_ptr<ViewDependentState> _viewDependentState;
+
+        // collects the nodes that a CachedCommandGroup's recorded commands depend upon
+        CachedCommandDependencies* _cachedCommandDependencies = nullptr;
+
+        // primary CommandBuffer of the current subpass when its commands are recorded into secondary CommandBuffer
+        ref_ptr<CommandBuffer> _subpassPrimaryCommandBuffer;
+
+        struct SubpassCommands
+        {
+            ref_ptr<CommandBuffer> commandBuffer;
+            const ExecuteCommands* executeCommands = nullptr;
+            bool recording = false;
+        };
+        std::vector<SubpassCommands> _subpassCommands;
+        std::vector<ref_ptr<CommandBuffer>> _subpassCommandBuffers;
+
+        void _beginSubpassCommandBuffer();
+
+        // number of CullNode, CullGroup and LOD subgraphs culled by the current View's small feature culling
+        uint32_t _numSmallFeaturesCulled = 0;
+
+        // number of CachedCommandGroup replayed, recorded and recorded inline in the current View, reported as a hit ratio through instrumentation
+        uint32_t _numCachedCommandHits = 0;
+        uint32_t _numCachedCommandMisses = 0;
+        uint32_t _numCachedCommandInlined = 0;
     };
 
 } // namespace vsg
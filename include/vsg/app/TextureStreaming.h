@@ -0,0 +1,151 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2025 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/app/CompileManager.h>
+#include <vsg/state/StreamedTexture.h>
+#include <vsg/threading/OperationThreads.h>
+#include <vsg/utils/Instrumentation.h>
+#include <vsg/vk/MemoryBudget.h>
+
+#include <list>
+
+namespace vsg
+{
+
+    // forward declare
+    class FrameStamp;
+
+    /// TextureStreaming manages which mip levels of a collection of StreamedTexture are resident on the GPU.
+    /// Each frame the screen space feedback recorded by StreamedTextureGroup nodes is converted into the mip level
+    /// each texture requires, the requirements are fitted within the memory budget and the textures whose residency
+    /// changes have their new mip levels prepared, compiled and merged, with the previous bindings retained until any
+    /// command buffers that may still reference them have completed. Downgrades are extracted from the resident mip levels,
+    /// upgrades from the source image, with recently decoded file sourced images cached within sourceCacheBudget.
+    class VSG_DECLSPEC TextureStreaming : public Inherit<Object, TextureStreaming>
+    {
+    public:
+        TextureStreaming();
+
+        TextureStreaming(const TextureStreaming&) = delete;
+        TextureStreaming& operator=(const TextureStreaming& rhs) = delete;
+
+        /// maximum number of bytes that the resident mip levels of all the streamed textures should occupy.
+        VkDeviceSize budget = 256 * 1024 * 1024;
+
+        /// memory pressure on the device, assigned by Viewer::update() from Device::memoryBudget, high pressure reduces the effective budget.
+        std::atomic<MemoryPressure> memoryPressure{MEMORY_PRESSURE_NONE};
+
+        /// height in pixels used to convert the screen height ratios reported by StreamedTextureGroup into a screen footprint.
+        double screenHeight = 1080.0;
+
+        /// bias, in mip levels, added to the required levels, positive values favour lower resolution mip levels.
+        int32_t levelBias = 0;
+
+        /// mip levels no larger than this dimension are always kept resident.
+        uint32_t residentTailDimension = 64;
+
+        /// number of frames that a texture must go without requiring its resident level before it is downgraded.
+        uint32_t downgradeDelay = 60;
+
+        /// maximum number of bytes of decoded images, read from StreamedTexture::filename, cached so upgrades don't re-read and re-decode them, 0 disables caching.
+        VkDeviceSize sourceCacheBudget = 64 * 1024 * 1024;
+
+        /// number of frames that replaced bindings are retained for, should be no less than the number of frames in flight.
+        uint32_t retainFrames = 4;
+
+        /// maximum number of textures that may be preparing new mip levels at one time.
+        uint32_t maxPendingChanges = 8;
+
+        /// compile manager used to compile new bindings, changes are only prepared once it is assigned, Viewer::compile() assigns the Viewer's CompileManager.
+        ref_ptr<CompileManager> compileManager;
+
+        /// optional threads used to read and compile new mip levels, if null the work is done in updateSceneGraph().
+        ref_ptr<OperationThreads> operationThreads;
+
+        /// Hook for assigning Instrumentation to enable profiling
+        ref_ptr<Instrumentation> instrumentation;
+
+        /// add texture to be managed, initializing it if required.
+        virtual bool add(ref_ptr<StreamedTexture> texture);
+
+        /// remove texture from management.
+        virtual void remove(ref_ptr<StreamedTexture> texture);
+
+        struct Change
+        {
+            ref_ptr<StreamedTexture> texture;
+            uint32_t level = 0;
+        };
+        using Changes = std::vector<Change>;
+
+        /// compute the changes in residency required for the feedback recorded up to frameCount.
+        /// Updates each texture's bookkeeping but doesn't touch the GPU, so can be used to test the streaming policy on the CPU.
+        virtual Changes plan(uint64_t frameCount);
+
+        /// merge any completed changes, release expired bindings and start preparing the next set of changes, called once per frame from Viewer::update().
+        virtual void updateSceneGraph(FrameStamp* frameStamp, CompileResult& cr);
+
+        /// read and compile the mip levels for change, the result is merged by the next updateSceneGraph() call.
+        virtual void prepare(const Change& change);
+
+        /// return the decoded source image of texture, from the source image cache if it has been recently read, thread safe.
+        virtual ref_ptr<Data> readSource(StreamedTexture& texture);
+
+        /// total bytes of the mip levels currently resident.
+        VkDeviceSize residentSize() const;
+
+        /// stats
+        uint64_t numUpgrades = 0;
+        uint64_t numDowngrades = 0;
+
+    protected:
+        virtual ~TextureStreaming();
+
+        struct Prepared
+        {
+            ref_ptr<StreamedTexture> texture;
+            uint32_t level = 0;
+            ref_ptr<Data> image;
+            ref_ptr<BindDescriptorSet> bindDescriptorSet;
+            CompileResult compileResult;
+        };
+
+        struct CachedSource
+        {
+            ref_ptr<StreamedTexture> texture;
+            ref_ptr<Data> image;
+            VkDeviceSize size = 0;
+        };
+
+        struct Retired
+        {
+            uint64_t frameCount = 0;
+            ref_ptr<BindDescriptorSet> bindDescriptorSet;
+        };
+
+        std::vector<ref_ptr<StreamedTexture>> _textures;
+
+        std::mutex _preparedMutex;
+        std::list<Prepared> _prepared;
+
+        std::list<Retired> _retired;
+
+        // most recently used first
+        std::mutex _sourceCacheMutex;
+        std::list<CachedSource> _sourceCache;
+        VkDeviceSize _sourceCacheSize = 0;
+    };
+    VSG_type_name(vsg::TextureStreaming);
+
+} // namespace vsg
@@ -86,6 +86,19 @@ namespace vsg
         /// override states for customization of graphics pipelines for this view
         GraphicsPipelineStates overridePipelineStates;
 
+        /// minimum projected diameter, in pixels, of CullNode, CullGroup and LOD bounding spheres for their subgraphs to be recorded,
+        /// 0.0 disables small feature culling. The threshold is relative to the height of the camera's viewport. Not serialized.
+        double smallFeatureCullingPixelSize = 0.0;
+
+        /// hysteresis band applied to LOD and PagedLOD child selection, as a ratio of each child's cutoff distance, to prevent children toggling frame to frame when the viewpoint hovers near a cutoff.
+        /// A child that isn't active requires a projected size (1.0 + lodHysteresis) times its minimumScreenHeightRatio to be selected, the active child remains selected until its size drops below (1.0 - lodHysteresis) times.
+        /// 0.0 disables hysteresis. Not serialized.
+        double lodHysteresis = 0.0;
+
+        /// when true, CoordinateFrame nodes positioned in world coordinates have the eye position subtracted from their origin in double precision
+        /// before the view rotation is applied, so only eye relative offsets reach the float modelview matrices of their subgraphs. Not serialized.
+        bool cameraRelative = false;
+
     protected:
         virtual ~View();
     };
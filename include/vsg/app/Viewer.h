@@ -16,12 +16,15 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/app/CompileManager.h>
 #include <vsg/app/Presentation.h>
 #include <vsg/app/RecordAndSubmitTask.h>
+#include <vsg/app/TextureStreaming.h>
 #include <vsg/app/UpdateOperations.h>
 #include <vsg/app/Window.h>
 #include <vsg/threading/Barrier.h>
 #include <vsg/threading/FrameBlock.h>
+#include <vsg/threading/FrameTaskGraph.h>
 #include <vsg/utils/Instrumentation.h>
 
+#include <exception>
 #include <map>
 
 namespace vsg
@@ -87,12 +90,20 @@ namespace vsg
             updateOperations->add(op, runBehavior);
         }
 
+        /// thread safe container for update operations that are run by Viewer::update(), or by the frameTaskGraph when assigned, before the updateOperations.
+        /// When pipelineFrames is enabled they run in parallel with the recording and submission of the previous frame, so they must not modify the scene graph directly,
+        /// instead they should compute their results and pass any changes to the scene graph to addUpdateOperation() so they are committed at the frame boundary.
+        ref_ptr<UpdateOperations> concurrentUpdateOperations;
+
         /// manager for starting and running animations
         ref_ptr<AnimationManager> animationManager;
 
         /// compile manager provides thread safe support for compiling subgraphs
         ref_ptr<CompileManager> compileManager;
 
+        /// optional manager for the resident mip levels of StreamedTexture, updated each frame in Viewer::update().
+        ref_ptr<TextureStreaming> textureStreaming;
+
         /// hint for setting the FrameStamp::simulationTime to time since start_point()
         static constexpr double UseTimeSinceStartPoint = std::numeric_limits<double>::max();
 
@@ -129,9 +140,26 @@ namespace vsg
         ref_ptr<ActivityStatus> status;
         std::list<std::thread> threads;
 
+        /// enable pipelined frames, where recordAndSubmit() returns once the frame has been passed to a frame thread that records, submits and presents it,
+        /// so the application, event handling and concurrentUpdateOperations of the next frame run in parallel with the recording and submission of the current frame.
+        /// The writes to the scene graph made by event handlers, DatabasePager and TextureStreaming merges, updateOperations and animations are deferred
+        /// and committed at the frame boundary at the start of the next recordAndSubmit(), once the previous frame has completed, so the recording never sees partial updates.
+        /// Viewer::present() does no work in pipelined mode as the frame thread presents each frame once submitted.
+        /// Pipelined frames aren't supported in combination with a frameTaskGraph, pipelineFrames is reset to false with a warning when both are set.
+        bool pipelineFrames = false;
+
         void setupThreading();
         void stopThreading();
 
+        /// optional task graph that runs the update, record, transfer and submission work of each frame, set up by setupFrameTaskGraph().
+        /// When assigned, Viewer::update() does no work of its own and Viewer::recordAndSubmit() runs the whole graph.
+        ref_ptr<FrameTaskGraph> frameTaskGraph;
+
+        /// set up the frameTaskGraph for the current RecordAndSubmitTasks, replacing the per CommandGraph threads created by setupThreading().
+        /// Tasks are run on the operationThreads worker pool, if none is provided one is created with a thread for each additional core.
+        /// Independent work such as DatabasePager merges, waiting on each task's fence and recording of each CommandGraph runs in parallel.
+        virtual void setupFrameTaskGraph(ref_ptr<OperationThreads> operationThreads = {});
+
         virtual void update();
 
         virtual void recordAndSubmit();
@@ -161,6 +189,18 @@ namespace vsg
         UIEvents _events;
         EventHandlers _eventHandlers;
 
+        void _updateMemoryPressure();
+        void _updateSceneGraph();
+        void _dispatchEvents();
+        void _recordAndSubmit(ref_ptr<FrameStamp> frameStamp);
+        void _recordAndSubmitPipelined();
+        void _waitForPipelinedFrame() const;
+
+        bool _eventsDeferred = false;
+        ref_ptr<OperationThreads> _frameThread;
+        ref_ptr<Latch> _frameCompleted;
+        std::exception_ptr _frameException;
+
         bool _threading = false;
         ref_ptr<FrameBlock> _frameBlock;
         ref_ptr<Barrier> _submissionCompleted;
@@ -34,7 +34,9 @@ namespace vsg
     class StateGroup;
     class CullGroup;
     class CullNode;
+    class SpatialGroup;
     class MatrixTransform;
+    class CoordinateFrame;
     class Transform;
     class Geometry;
     class VertexDraw;
@@ -323,7 +325,9 @@ namespace vsg
         virtual void apply(const StateGroup&);
         virtual void apply(const CullGroup&);
         virtual void apply(const CullNode&);
+        virtual void apply(const SpatialGroup&);
         virtual void apply(const MatrixTransform&);
+        virtual void apply(const CoordinateFrame&);
         virtual void apply(const Transform&);
         virtual void apply(const Geometry&);
         virtual void apply(const VertexDraw&);
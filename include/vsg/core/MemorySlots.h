@@ -51,6 +51,15 @@ namespace vsg
         size_t totalReservedSize() const;
         size_t totalMemorySize() const { return _totalMemorySize; }
 
+        size_t numAvailableSlots() const { return _offsetSizes.size(); }
+        size_t numReservedSlots() const { return _reservedMemory.size(); }
+
+        /// map of offset to size of the reserved slots
+        const std::map<size_t, size_t>& reservedSlots() const { return _reservedMemory; }
+
+        /// fragmentation of the available memory, 0.0 when all the available memory is in one contiguous slot, approaching 1.0 as it is split into many small slots.
+        double fragmentation() const;
+
         // debug facilities
         void report(std::ostream& out) const;
         bool check() const;
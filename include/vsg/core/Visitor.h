@@ -34,7 +34,9 @@ namespace vsg
     class StateGroup;
     class CullGroup;
     class CullNode;
+    class SpatialGroup;
     class MatrixTransform;
+    class CoordinateFrame;
     class Transform;
     class Geometry;
     class VertexDraw;
@@ -323,7 +325,9 @@ namespace vsg
         virtual void apply(StateGroup&);
         virtual void apply(CullGroup&);
         virtual void apply(CullNode&);
+        virtual void apply(SpatialGroup&);
         virtual void apply(MatrixTransform&);
+        virtual void apply(CoordinateFrame&);
         virtual void apply(Transform&);
         virtual void apply(Geometry&);
         virtual void apply(VertexDraw&);
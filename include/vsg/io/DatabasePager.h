@@ -19,7 +19,9 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/io/Options.h>
 #include <vsg/nodes/PagedLOD.h>
 #include <vsg/threading/ActivityStatus.h>
+#include <vsg/threading/DeleteQueue.h>
 #include <vsg/utils/Instrumentation.h>
+#include <vsg/vk/MemoryBudget.h>
 
 #include <condition_variable>
 #include <list>
@@ -104,10 +106,20 @@ namespace vsg
         /// for systems with smaller GPU memory limits you may need to reduce the targetMaxNumPagedLODWithHighResSubgraphs to keep memory usage within available limits.
         uint32_t targetMaxNumPagedLODWithHighResSubgraphs = 1500;
 
+        /// minimum number of frames a merged high res subgraph is kept before it may be pruned, avoiding reloads when the viewpoint oscillates about a PagedLOD's cutoff.
+        uint64_t minimumHighResResidency = 0;
+
+        /// memory pressure on the device, assigned by Viewer::update() from Device::memoryBudget, high pressure reduces the targetMaxNumPagedLODWithHighResSubgraphs so subgraphs are expired sooner.
+        std::atomic<MemoryPressure> memoryPressure{MEMORY_PRESSURE_NONE};
+
         std::mutex pendingPagedLODMutex;
 
         ref_ptr<PagedLODContainer> pagedLODContainer;
 
+        /// queue of expired high res subgraphs that are deleted by a background thread once the frames in flight that may reference them have completed.
+        /// If set to null before start() is called expired subgraphs are deleted immediately by updateSceneGraph().
+        ref_ptr<DeleteQueue> deleteQueue;
+
         /// Hook for assigning Instrumentation to enable profiling
         ref_ptr<Instrumentation> instrumentation;
 
@@ -125,6 +137,7 @@ namespace vsg
         ref_ptr<DatabaseQueue> _toMergeQueue;
 
         std::list<std::thread> _readThreads;
+        std::thread _deleteThread;
     };
     VSG_type_name(vsg::DatabasePager);
 
@@ -0,0 +1,107 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2025 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/core/Data.h>
+#include <vsg/io/Path.h>
+#include <vsg/utils/BlockCompression.h>
+
+#include <list>
+#include <map>
+#include <mutex>
+
+namespace vsg
+{
+    class Options;
+
+    /// TileCache provides a persistent local disk cache of decoded tile Data, keyed on the tile's layer, level, x and y.
+    /// Tiles are stored in the native .vsgb format so cached tiles are read back in the GPU ready format they were decoded to,
+    /// with the least recently used tiles evicted to keep the cache within its byte budget.
+    /// Thread safe, so may be shared between the DatabasePager's reading threads and seeding threads.
+    class VSG_DECLSPEC TileCache : public Inherit<Object, TileCache>
+    {
+    public:
+        explicit TileCache(const Path& in_directory, uint64_t in_maxSize = 1024 * 1024 * 1024);
+
+        TileCache(const TileCache&) = delete;
+        TileCache& operator=(const TileCache&) = delete;
+
+        /// directory that the cached tiles and cache index are stored in
+        const Path directory;
+
+        /// maximum total size in bytes of the tiles stored in the cache
+        uint64_t maxSize;
+
+        /// optional settings for block compressing image tiles with encode(..) so they are stored and uploaded in a GPU compressed format.
+        ref_ptr<BlockCompressionSettings> compressionSettings;
+
+        /// return data block compressed according to compressionSettings, or data unchanged if compression isn't enabled or not supported for the data's format.
+        /// If compressionSettings has no mipmapSettings and the data has no mipmaps then the full mipmap chain is generated with default MipmapSettings.
+        ref_ptr<Data> encode(ref_ptr<Data> data) const;
+
+        /// return the cached tile Data, or null if the tile isn't in the cache
+        ref_ptr<Data> read(const Path& layer, uint32_t x, uint32_t y, uint32_t level);
+
+        /// write tile Data to the cache, evicting least recently used tiles if required to stay within maxSize
+        bool write(const Path& layer, uint32_t x, uint32_t y, uint32_t level, ref_ptr<Data> data);
+
+        /// return true if the tile is in the cache
+        bool contains(const Path& layer, uint32_t x, uint32_t y, uint32_t level) const;
+
+        /// return the file path used to store the tile
+        Path getTilePath(const Path& layer, uint32_t x, uint32_t y, uint32_t level) const;
+
+        /// evict least recently used tiles until the total size is within maxSize
+        void prune();
+
+        /// remove all tiles from the cache
+        void clear();
+
+        /// write the cache index, recording the tiles' usage order for subsequent sessions. Called automatically on destruction.
+        bool flush();
+
+        struct Statistics
+        {
+            uint64_t numTiles = 0;
+            uint64_t totalSize = 0;
+            uint64_t numHits = 0;
+            uint64_t numMisses = 0;
+            uint64_t numWrites = 0;
+            uint64_t numEvictions = 0;
+        };
+
+        Statistics getStatistics() const;
+
+    protected:
+        virtual ~TileCache();
+
+        void _readIndex();
+        void _touch(const Path& filename);
+        void _prune();
+
+        struct Entry
+        {
+            uint64_t size = 0;
+            std::list<Path>::iterator position;
+        };
+
+        ref_ptr<Options> _writeOptions;
+
+        mutable std::mutex _mutex;
+        std::list<Path> _usageOrder; // least recently used at front
+        std::map<Path, Entry> _entries;
+        Statistics _statistics;
+    };
+    VSG_type_name(vsg::TileCache);
+
+} // namespace vsg
@@ -12,11 +12,13 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 </editor-fold> */
 
+#include <vsg/commands/BindIndexBuffer.h>
 #include <vsg/io/ReaderWriter.h>
 #include <vsg/nodes/TileDatabase.h>
 #include <vsg/state/GraphicsPipeline.h>
 #include <vsg/utils/GraphicsPipelineConfigurator.h>
 #include <vsg/utils/ShaderSet.h>
+#include <vsg/utils/SharedObjects.h>
 
 namespace vsg
 {
@@ -36,6 +38,10 @@ namespace vsg
         /// read the tile
         ref_ptr<Object> read(const Path& filename, ref_ptr<const Options> options = {}) const override;
 
+        /// fill the settings->tileCache with the imagery and elevation tiles that overlap region, in the settings->extents coordinate frame, for levels minLevel to maxLevel inclusive.
+        /// Tiles are fetched in parallel using numThreads threads, tiles already in the cache are skipped. Returns the number of tiles fetched.
+        uint64_t seedCache(const dbox& region, uint32_t minLevel, uint32_t maxLevel, ref_ptr<const Options> options, uint32_t numThreads = 4) const;
+
         // timing stats
         mutable std::mutex statsMutex;
         mutable uint64_t numTilesRead{0};
@@ -49,20 +55,39 @@ namespace vsg
         dbox computeTileExtents(uint32_t x, uint32_t y, uint32_t level) const;
         Path getTilePath(const Path& src, uint32_t x, uint32_t y, uint32_t level) const;
 
+        /// read the tile from the specified layer, checking the settings->tileCache first and adding the tile to the cache when read from the source.
+        ref_ptr<Data> readTileData(const Path& layer, uint32_t x, uint32_t y, uint32_t level, ref_ptr<const Options> options) const;
+
         ref_ptr<Object> read_root(ref_ptr<const Options> options = {}) const;
         ref_ptr<Object> read_subtile(uint32_t x, uint32_t y, uint32_t lod, ref_ptr<const Options> options = {}) const;
 
-        ref_ptr<Node> createTile(const dbox& tile_extents, ref_ptr<Data> sourceData) const;
-        ref_ptr<Node> createECEFTile(const dbox& tile_extents, ref_ptr<Data> sourceData) const;
-        ref_ptr<Node> createTextureQuad(const dbox& tile_extents, ref_ptr<Data> sourceData) const;
+        /// create the tile subgraph, using the optional elevationData heightfield to displace ECEF tiles, and set bound to the tile's bounding sphere.
+        ref_ptr<Node> createTile(const dbox& tile_extents, ref_ptr<Data> sourceData, ref_ptr<Data> elevationData, const PageTable::Key& key, dsphere& bound) const;
+        ref_ptr<Node> createECEFTile(const dbox& tile_extents, ref_ptr<Data> sourceData, ref_ptr<Data> elevationData, const PageTable::Key& key, dsphere& bound) const;
+        ref_ptr<Node> createTextureQuad(const dbox& tile_extents, ref_ptr<Data> sourceData, const PageTable::Key& key = {}) const;
+
+        /// create the state command binding the tile's texture, using the settings->virtualTexture page cache when the imagery is compatible with it.
+        ref_ptr<StateCommand> createTextureBinding(ref_ptr<Data> textureData, const PageTable::Key& key, const Descriptors& descriptors) const;
 
         ref_ptr<StateGroup> createRoot() const;
 
+        /// bilinear sample the elevationData heightfield at each vertex of a numRows x numCols grid, return false if the data type isn't supported.
+        bool sampleElevations(const Data& elevationData, uint32_t numRows, uint32_t numCols, std::vector<double>& altitudes) const;
+
+        /// get the index buffer binding for a gridSize x gridSize vertex grid, with optional skirt around the edges,
+        /// created once per grid size and shared between all tiles so the indices are only uploaded once.
+        ref_ptr<BindIndexBuffer> getOrCreateGridIndices(uint32_t gridSize, bool skirt = false) const;
+
         ref_ptr<ShaderSet> _shaderSet;
         ref_ptr<GraphicsPipelineConfigurator> _graphicsPipelineConfig;
         uint32_t _materialSetIndex = 1;
         ref_ptr<Sampler> _sampler;
         ref_ptr<DescriptorBuffer> _material;
+        ref_ptr<SharedObjects> _sharedObjects;
+
+        mutable std::mutex _gridIndicesMutex;
+        using GridIndicesKey = std::pair<uint32_t, bool>;
+        mutable std::map<GridIndicesKey, ref_ptr<BindIndexBuffer>> _gridIndices;
     };
     VSG_type_name(vsg::tile);
 
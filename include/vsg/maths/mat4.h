@@ -240,3 +240,5 @@ namespace vsg
     }
 
 } // namespace vsg
+
+#include <vsg/maths/simd.h>
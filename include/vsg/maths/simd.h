@@ -0,0 +1,270 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2025 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/core/Version.h>
+#include <vsg/maths/mat4.h>
+
+// SIMD implementations of the 4x4 matrix products are opt in with the VSG_SUPPORTS_SIMD CMake option, with the instruction set selected
+// by the configured value in vsg/core/Version.h rather than the compiler flags of each translation unit, so that every translation unit sees the same inline definitions.
+// 1 selects SSE2 on x86-64 and NEON on 64 bit ARM, both part of the base instruction set, and 2 adds AVX on x86-64, with CMake adding -mavx or /arch:AVX to the vsg target's public compile options.
+// The products are computed in the same order as the scalar templates in mat4.h, without fused multiply-adds, so the results are bit identical.
+#if VSG_SUPPORTS_SIMD
+#    if defined(__x86_64__) || defined(_M_X64)
+#        define VSG_SIMD_SSE2 1
+#        include <emmintrin.h>
+#        if VSG_SUPPORTS_SIMD >= 2
+#            if !defined(__AVX__)
+#                error "VulkanSceneGraph was built with VSG_SUPPORTS_SIMD=2 so code using it must be compiled with AVX enabled, e.g. -mavx or /arch:AVX."
+#            endif
+#            define VSG_SIMD_AVX 1
+#            include <immintrin.h>
+#        endif
+#    elif defined(__aarch64__) || defined(_M_ARM64)
+#        define VSG_SIMD_NEON 1
+#        include <arm_neon.h>
+#    endif
+#endif
+
+namespace vsg
+{
+
+#if defined(VSG_SIMD_SSE2)
+
+    /// lhs * column, with the column's components broadcast using shuffles.
+    inline __m128 simd_multiply(const mat4& lhs, __m128 v)
+    {
+        __m128 r = _mm_mul_ps(_mm_loadu_ps(lhs[0].data()), _mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0)));
+        r = _mm_add_ps(r, _mm_mul_ps(_mm_loadu_ps(lhs[1].data()), _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1))));
+        r = _mm_add_ps(r, _mm_mul_ps(_mm_loadu_ps(lhs[2].data()), _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2))));
+        return _mm_add_ps(r, _mm_mul_ps(_mm_loadu_ps(lhs[3].data()), _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3))));
+    }
+
+#    if defined(VSG_SIMD_AVX)
+
+    /// lhs * two adjacent columns, with lhs's columns duplicated into both 128 bit lanes.
+    inline __m256 simd_multiply(const mat4& lhs, __m256 v)
+    {
+        __m256 r = _mm256_mul_ps(_mm256_broadcast_ps(reinterpret_cast<const __m128*>(lhs[0].data())), _mm256_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0)));
+        r = _mm256_add_ps(r, _mm256_mul_ps(_mm256_broadcast_ps(reinterpret_cast<const __m128*>(lhs[1].data())), _mm256_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1))));
+        r = _mm256_add_ps(r, _mm256_mul_ps(_mm256_broadcast_ps(reinterpret_cast<const __m128*>(lhs[2].data())), _mm256_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2))));
+        return _mm256_add_ps(r, _mm256_mul_ps(_mm256_broadcast_ps(reinterpret_cast<const __m128*>(lhs[3].data())), _mm256_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3))));
+    }
+
+    inline mat4 operator*(const mat4& lhs, const mat4& rhs)
+    {
+        // compute all the columns before storing as the result may alias lhs or rhs
+        __m256 r01 = simd_multiply(lhs, _mm256_loadu_ps(rhs[0].data()));
+        __m256 r23 = simd_multiply(lhs, _mm256_loadu_ps(rhs[2].data()));
+
+        mat4 result;
+        _mm256_storeu_ps(result[0].data(), r01);
+        _mm256_storeu_ps(result[2].data(), r23);
+        return result;
+    }
+
+#    else
+
+    inline mat4 operator*(const mat4& lhs, const mat4& rhs)
+    {
+        // compute all the columns before storing as the result may alias lhs or rhs
+        __m128 r0 = simd_multiply(lhs, _mm_loadu_ps(rhs[0].data()));
+        __m128 r1 = simd_multiply(lhs, _mm_loadu_ps(rhs[1].data()));
+        __m128 r2 = simd_multiply(lhs, _mm_loadu_ps(rhs[2].data()));
+        __m128 r3 = simd_multiply(lhs, _mm_loadu_ps(rhs[3].data()));
+
+        mat4 result;
+        _mm_storeu_ps(result[0].data(), r0);
+        _mm_storeu_ps(result[1].data(), r1);
+        _mm_storeu_ps(result[2].data(), r2);
+        _mm_storeu_ps(result[3].data(), r3);
+        return result;
+    }
+
+#    endif
+
+    inline vec4 operator*(const mat4& lhs, const vec4& rhs)
+    {
+        vec4 result;
+        _mm_storeu_ps(result.data(), simd_multiply(lhs, _mm_loadu_ps(rhs.data())));
+        return result;
+    }
+
+    inline vec3 operator*(const mat4& lhs, const vec3& rhs)
+    {
+        __m128 r = _mm_mul_ps(_mm_loadu_ps(lhs[0].data()), _mm_set1_ps(rhs[0]));
+        r = _mm_add_ps(r, _mm_mul_ps(_mm_loadu_ps(lhs[1].data()), _mm_set1_ps(rhs[1])));
+        r = _mm_add_ps(r, _mm_mul_ps(_mm_loadu_ps(lhs[2].data()), _mm_set1_ps(rhs[2])));
+        r = _mm_add_ps(r, _mm_loadu_ps(lhs[3].data()));
+
+        vec4 v;
+        _mm_storeu_ps(v.data(), r);
+        float inv = 1.0f / v.w;
+        return vec3(v.x * inv, v.y * inv, v.z * inv);
+    }
+
+    // without AVX the dmat4 products use the scalar templates, as compilers vectorize these as well as hand written SSE2 code
+#    if defined(VSG_SIMD_AVX)
+
+    /// lhs * column, with the column passed as its scalar components.
+    inline __m256d simd_multiply(const dmat4& lhs, double x, double y, double z, double w)
+    {
+        __m256d r = _mm256_mul_pd(_mm256_loadu_pd(lhs[0].data()), _mm256_set1_pd(x));
+        r = _mm256_add_pd(r, _mm256_mul_pd(_mm256_loadu_pd(lhs[1].data()), _mm256_set1_pd(y)));
+        r = _mm256_add_pd(r, _mm256_mul_pd(_mm256_loadu_pd(lhs[2].data()), _mm256_set1_pd(z)));
+        return _mm256_add_pd(r, _mm256_mul_pd(_mm256_loadu_pd(lhs[3].data()), _mm256_set1_pd(w)));
+    }
+
+    inline dmat4 operator*(const dmat4& lhs, const dmat4& rhs)
+    {
+        // compute all the columns before storing as the result may alias lhs or rhs
+        __m256d r0 = simd_multiply(lhs, rhs[0][0], rhs[0][1], rhs[0][2], rhs[0][3]);
+        __m256d r1 = simd_multiply(lhs, rhs[1][0], rhs[1][1], rhs[1][2], rhs[1][3]);
+        __m256d r2 = simd_multiply(lhs, rhs[2][0], rhs[2][1], rhs[2][2], rhs[2][3]);
+        __m256d r3 = simd_multiply(lhs, rhs[3][0], rhs[3][1], rhs[3][2], rhs[3][3]);
+
+        dmat4 result;
+        _mm256_storeu_pd(result[0].data(), r0);
+        _mm256_storeu_pd(result[1].data(), r1);
+        _mm256_storeu_pd(result[2].data(), r2);
+        _mm256_storeu_pd(result[3].data(), r3);
+        return result;
+    }
+
+    inline dvec4 operator*(const dmat4& lhs, const dvec4& rhs)
+    {
+        dvec4 result;
+        _mm256_storeu_pd(result.data(), simd_multiply(lhs, rhs[0], rhs[1], rhs[2], rhs[3]));
+        return result;
+    }
+
+    inline dvec3 operator*(const dmat4& lhs, const dvec3& rhs)
+    {
+        __m256d r = _mm256_mul_pd(_mm256_loadu_pd(lhs[0].data()), _mm256_set1_pd(rhs[0]));
+        r = _mm256_add_pd(r, _mm256_mul_pd(_mm256_loadu_pd(lhs[1].data()), _mm256_set1_pd(rhs[1])));
+        r = _mm256_add_pd(r, _mm256_mul_pd(_mm256_loadu_pd(lhs[2].data()), _mm256_set1_pd(rhs[2])));
+        r = _mm256_add_pd(r, _mm256_loadu_pd(lhs[3].data()));
+
+        dvec4 v;
+        _mm256_storeu_pd(v.data(), r);
+        double inv = 1.0 / v.w;
+        return dvec3(v.x * inv, v.y * inv, v.z * inv);
+    }
+
+#    endif
+
+#elif defined(VSG_SIMD_NEON)
+
+    // separate multiply and add are used rather than vmlaq/vfmaq to match the rounding of the scalar implementation
+
+    inline float32x4_t simd_multiply(const mat4& lhs, float32x4_t v)
+    {
+        float32x4_t r = vmulq_laneq_f32(vld1q_f32(lhs[0].data()), v, 0);
+        r = vaddq_f32(r, vmulq_laneq_f32(vld1q_f32(lhs[1].data()), v, 1));
+        r = vaddq_f32(r, vmulq_laneq_f32(vld1q_f32(lhs[2].data()), v, 2));
+        return vaddq_f32(r, vmulq_laneq_f32(vld1q_f32(lhs[3].data()), v, 3));
+    }
+
+    inline mat4 operator*(const mat4& lhs, const mat4& rhs)
+    {
+        // compute all the columns before storing as the result may alias lhs or rhs
+        float32x4_t r0 = simd_multiply(lhs, vld1q_f32(rhs[0].data()));
+        float32x4_t r1 = simd_multiply(lhs, vld1q_f32(rhs[1].data()));
+        float32x4_t r2 = simd_multiply(lhs, vld1q_f32(rhs[2].data()));
+        float32x4_t r3 = simd_multiply(lhs, vld1q_f32(rhs[3].data()));
+
+        mat4 result;
+        vst1q_f32(result[0].data(), r0);
+        vst1q_f32(result[1].data(), r1);
+        vst1q_f32(result[2].data(), r2);
+        vst1q_f32(result[3].data(), r3);
+        return result;
+    }
+
+    inline vec4 operator*(const mat4& lhs, const vec4& rhs)
+    {
+        vec4 result;
+        vst1q_f32(result.data(), simd_multiply(lhs, vld1q_f32(rhs.data())));
+        return result;
+    }
+
+    inline vec3 operator*(const mat4& lhs, const vec3& rhs)
+    {
+        float32x4_t r = vmulq_n_f32(vld1q_f32(lhs[0].data()), rhs[0]);
+        r = vaddq_f32(r, vmulq_n_f32(vld1q_f32(lhs[1].data()), rhs[1]));
+        r = vaddq_f32(r, vmulq_n_f32(vld1q_f32(lhs[2].data()), rhs[2]));
+        r = vaddq_f32(r, vld1q_f32(lhs[3].data()));
+
+        vec4 v;
+        vst1q_f32(v.data(), r);
+        float inv = 1.0f / v.w;
+        return vec3(v.x * inv, v.y * inv, v.z * inv);
+    }
+
+    /// the double columns are computed as xy and zw halves, h selecting which half.
+    inline float64x2_t simd_multiply(const dmat4& lhs, int h, double x, double y, double z, double w)
+    {
+        float64x2_t r = vmulq_n_f64(vld1q_f64(lhs[0].data() + h), x);
+        r = vaddq_f64(r, vmulq_n_f64(vld1q_f64(lhs[1].data() + h), y));
+        r = vaddq_f64(r, vmulq_n_f64(vld1q_f64(lhs[2].data() + h), z));
+        return vaddq_f64(r, vmulq_n_f64(vld1q_f64(lhs[3].data() + h), w));
+    }
+
+    inline dmat4 operator*(const dmat4& lhs, const dmat4& rhs)
+    {
+        // compute all the columns before storing as the result may alias lhs or rhs
+        float64x2_t r[8];
+        for (int c = 0; c < 4; ++c)
+        {
+            r[c * 2] = simd_multiply(lhs, 0, rhs[c][0], rhs[c][1], rhs[c][2], rhs[c][3]);
+            r[c * 2 + 1] = simd_multiply(lhs, 2, rhs[c][0], rhs[c][1], rhs[c][2], rhs[c][3]);
+        }
+
+        dmat4 result;
+        for (int c = 0; c < 4; ++c)
+        {
+            vst1q_f64(result[c].data(), r[c * 2]);
+            vst1q_f64(result[c].data() + 2, r[c * 2 + 1]);
+        }
+        return result;
+    }
+
+    inline dvec4 operator*(const dmat4& lhs, const dvec4& rhs)
+    {
+        float64x2_t xy = simd_multiply(lhs, 0, rhs[0], rhs[1], rhs[2], rhs[3]);
+        float64x2_t zw = simd_multiply(lhs, 2, rhs[0], rhs[1], rhs[2], rhs[3]);
+
+        dvec4 result;
+        vst1q_f64(result.data(), xy);
+        vst1q_f64(result.data() + 2, zw);
+        return result;
+    }
+
+    inline dvec3 operator*(const dmat4& lhs, const dvec3& rhs)
+    {
+        dvec4 v;
+        for (int h = 0; h < 4; h += 2)
+        {
+            float64x2_t r = vmulq_n_f64(vld1q_f64(lhs[0].data() + h), rhs[0]);
+            r = vaddq_f64(r, vmulq_n_f64(vld1q_f64(lhs[1].data() + h), rhs[1]));
+            r = vaddq_f64(r, vmulq_n_f64(vld1q_f64(lhs[2].data() + h), rhs[2]));
+            r = vaddq_f64(r, vld1q_f64(lhs[3].data() + h));
+            vst1q_f64(v.data() + h, r);
+        }
+        double inv = 1.0 / v.w;
+        return dvec3(v.x * inv, v.y * inv, v.z * inv);
+    }
+
+#endif
+
+} // namespace vsg
@@ -235,6 +235,19 @@ namespace vsg
     /// compute the bounding sphere that encloses a frustum defined by specified double ModelViewMatrixProjection
     extern VSG_DECLSPEC dsphere computeFrustumBound(const dmat4& m);
 
+    /// transform the vertices of a float array in place, applying the perspective divide as per matrix * vec3.
+    /// uses the SIMD matrix products when VSG_SUPPORTS_SIMD is enabled, with results identical to the scalar implementation.
+    extern VSG_DECLSPEC void transform(const mat4& matrix, vec3Array& array);
+
+    /// transform the vertices of a double array in place, applying the perspective divide as per matrix * dvec3.
+    extern VSG_DECLSPEC void transform(const dmat4& matrix, dvec3Array& array);
+
+    /// transform the homogeneous coordinates of a float array in place.
+    extern VSG_DECLSPEC void transform(const mat4& matrix, vec4Array& array);
+
+    /// transform the homogeneous coordinates of a double array in place.
+    extern VSG_DECLSPEC void transform(const dmat4& matrix, dvec4Array& array);
+
     /// visitor that computes a transform matrix, accumulating the result in order of objects visited
     /// usage:  auto matrix = vsg::visit<vsg::ComputeTransform>(nodePath).matrix;
     struct VSG_DECLSPEC ComputeTransform : public ConstVisitor
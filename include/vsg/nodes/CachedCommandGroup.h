@@ -0,0 +1,142 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2025 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+
+#include <vsg/nodes/Group.h>
+#include <vsg/vk/CommandBuffer.h>
+#include <vsg/vk/State.h>
+
+#include <map>
+
+namespace vsg
+{
+
+    // forward declare
+    class Switch;
+    class MatrixTransform;
+    class CoordinateFrame;
+
+    /// CachedCommandDependencies collects the nodes, encountered while recording the subgraph of a CachedCommandGroup, whose state the recorded commands depend upon.
+    struct VSG_DECLSPEC CachedCommandDependencies
+    {
+        /// set to false when the subgraph contains nodes that have to be traversed every frame, such as PagedLOD, DepthSorted or lights.
+        bool cacheable = true;
+
+        /// set to true when the recorded commands depend upon the modelview matrix, such as LOD selection or matrices pushed for pipelines that don't use transform indexing,
+        /// so the recording is only replayed while the modelview matrix is unchanged.
+        bool viewDependent = false;
+
+        std::vector<ref_ptr<const Switch>> switches;
+        std::vector<ref_ptr<const MatrixTransform>> transforms;
+        std::vector<ref_ptr<const CoordinateFrame>> coordinateFrames;
+
+        void clear();
+
+        /// hash of the Switch children masks, MatrixTransform matrices and CoordinateFrame origins and rotations.
+        uint64_t hash() const;
+    };
+
+    /// CachedCommandGroup is a Group node that records its subgraph into a secondary CommandBuffer and replays it with vkCmdExecuteCommands in later frames.
+    /// The subgraph is only re-recorded when the inputs to the recording change, these are the projection matrix, the inherited state, the traversal masks,
+    /// the children masks of Switch nodes and matrices of MatrixTransform and CoordinateFrame nodes within the subgraph, or when dirty() is called.
+    /// In Views with ViewDependentState::transformData enabled the modelview matrices of pipelines using transform indexing are read from entries of transformData
+    /// reserved for the recording and refilled each frame, so the recording is replayed as the camera moves. Such recordings are made without view frustum culling,
+    /// subgraphs containing LOD or Transform nodes, or pipelines that don't use transform indexing, and all recordings in Views without transformData,
+    /// also depend upon the modelview matrix so are re-recorded when it changes.
+    /// Secondary CommandBuffers can only be executed within a subpass with VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS contents, set via RenderGraph::contents or
+    /// NextSubPass::contents, in which the RecordTraversal records all the other commands of the subpass into secondary CommandBuffer as well, otherwise the subgraph
+    /// is recorded inline as a normal Group. Subgraphs containing PagedLOD, TileDatabase, DepthSorted, Layer, lights,
+    /// RegionOfInterest or StreamedTextureGroup nodes are re-recorded every frame as these nodes need to be traversed each frame.
+    class VSG_DECLSPEC CachedCommandGroup : public Inherit<Group, CachedCommandGroup>
+    {
+    public:
+        explicit CachedCommandGroup(size_t numChildren = 0);
+        CachedCommandGroup(const CachedCommandGroup& rhs, const CopyOp& copyop = {});
+
+        /// number of frames a replaced CommandBuffer is retained before it is reused, should be no less than the number of frames in flight.
+        uint32_t retainFrames = 4;
+
+        /// request that the subgraph is re-recorded, call after changes to the subgraph that aren't tracked automatically, such as adding/removing children or changing geometry.
+        void dirty() { ++_modifiedCount; }
+
+        struct Statistics
+        {
+            uint64_t numHits = 0;     // frames the cached CommandBuffer was replayed
+            uint64_t numMisses = 0;   // frames the subgraph was recorded into a secondary CommandBuffer
+            uint64_t numInlined = 0;  // frames the subgraph was recorded inline as secondary CommandBuffers couldn't be used
+
+            double hitRatio() const;
+        };
+
+        /// usage statistics of this node, RecordTraversal also reports the hit ratio of all the CachedCommandGroup in each View through Instrumentation::plot().
+        Statistics getStatistics() const;
+        void resetStatistics();
+
+        /// release all the cached CommandBuffers.
+        void release();
+
+        /// per device and view recording, used by RecordTraversal.
+        struct Recording
+        {
+            uint64_t key = 0;
+            uint64_t dependenciesKey = 0;
+            CachedCommandDependencies dependencies;
+
+            /// transformData entries reserved for the matrices recorded in Views with ViewDependentState::transformData.
+            TransformSlots transformSlots;
+
+            ref_ptr<CommandBuffer> commandBuffer;
+            uint64_t frameLastUsed = 0;
+
+            struct Retired
+            {
+                ref_ptr<CommandBuffer> commandBuffer;
+                uint64_t frameLastUsed = 0;
+            };
+            std::vector<Retired> retired;
+        };
+
+        /// get or create the Recording for the specified device and view, used by RecordTraversal.
+        Recording& getRecording(uint32_t deviceID, uint32_t viewID) const;
+
+        /// hash of the inputs to the recording inherited from the RecordTraversal, the modelview matrix is only included when viewDependent is true.
+        uint64_t computeKey(RecordTraversal& recordTraversal, bool viewDependent) const;
+
+        /// called by RecordTraversal to record usage statistics.
+        void hit() const { ++_numHits; }
+        void miss() const { ++_numMisses; }
+        void inlined() const { ++_numInlined; }
+
+    public:
+        ref_ptr<Object> clone(const CopyOp& copyop = {}) const override { return CachedCommandGroup::create(*this, copyop); }
+        int compare(const Object& rhs) const override;
+
+        void read(Input& input) override;
+        void write(Output& output) const override;
+
+    protected:
+        virtual ~CachedCommandGroup();
+
+        std::atomic_uint64_t _modifiedCount{0};
+
+        mutable std::atomic_uint64_t _numHits{0};
+        mutable std::atomic_uint64_t _numMisses{0};
+        mutable std::atomic_uint64_t _numInlined{0};
+
+        mutable std::mutex _mutex;
+        mutable std::map<std::pair<uint32_t, uint32_t>, Recording> _recordings;
+    };
+    VSG_type_name(vsg::CachedCommandGroup);
+
+} // namespace vsg
@@ -0,0 +1,61 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2025 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/maths/quat.h>
+#include <vsg/nodes/Transform.h>
+
+namespace vsg
+{
+
+    /// CoordinateFrame is a transform node that positions a subgraph at a double precision origin with an optional rotation,
+    /// used as an anchor for subgraphs whose vertex data is stored in float relative to a local origin such as a tile centre.
+    /// When View::cameraRelative is enabled and the CoordinateFrame is positioned directly in world coordinates, the RecordTraversal
+    /// subtracts the eye position from the origin in double precision before applying the view rotation, so the modelview matrix
+    /// pushed for the subgraph only holds eye relative offsets.
+    class VSG_DECLSPEC CoordinateFrame : public Inherit<Transform, CoordinateFrame>
+    {
+    public:
+        CoordinateFrame();
+        CoordinateFrame(const CoordinateFrame& rhs, const CopyOp& copyop = {});
+        explicit CoordinateFrame(const dvec3& in_origin, const dquat& in_rotation = {});
+
+        std::string name;
+        dvec3 origin;
+        dquat rotation;
+
+        dmat4 transform(const dmat4& mv) const override { return mv * matrix(origin); }
+
+        /// return the modelview matrix relative to the eye, where viewRotation is the view matrix without its translation.
+        dmat4 transform(const dmat4& viewRotation, const dvec3& eye) const { return viewRotation * matrix(origin - eye); }
+
+        /// return the local matrix, equivalent to translate(translation) * rotate(rotation)
+        dmat4 matrix(const dvec3& translation) const
+        {
+            auto m = rotate(rotation);
+            m[3].set(translation.x, translation.y, translation.z, 1.0);
+            return m;
+        }
+
+    public:
+        ref_ptr<Object> clone(const CopyOp& copyop = {}) const override { return CoordinateFrame::create(*this, copyop); }
+        int compare(const Object& rhs) const override;
+
+        void read(Input& input) override;
+        void write(Output& output) const override;
+
+    protected:
+    };
+    VSG_type_name(vsg::CoordinateFrame);
+
+} // namespace vsg
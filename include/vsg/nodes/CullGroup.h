@@ -28,6 +28,9 @@ namespace vsg
 
         dsphere bound;
 
+        /// when false the subgraph is exempt from View::smallFeatureCullingPixelSize culling, for features that must remain visible however small. Not serialized.
+        bool smallFeatureCulling = true;
+
     public:
         ref_ptr<Object> clone(const CopyOp& copyop = {}) const override { return CullGroup::create(*this, copyop); }
         int compare(const Object& rhs) const override;
@@ -31,6 +31,9 @@ namespace vsg
         dsphere bound;
         ref_ptr<vsg::Node> child;
 
+        /// when false the subgraph is exempt from View::smallFeatureCullingPixelSize culling, for features that must remain visible however small. Not serialized.
+        bool smallFeatureCulling = true;
+
     public:
         ref_ptr<Object> clone(const CopyOp& copyop = {}) const override { return CullNode::create(*this, copyop); }
         int compare(const Object& rhs) const override;
@@ -18,6 +18,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 
 namespace vsg
 {
@@ -46,6 +47,21 @@ namespace vsg
         dsphere bound;
         Children children;
 
+        /// when false the subgraph is exempt from View::smallFeatureCullingPixelSize culling, for features that must remain visible however small. Not serialized.
+        bool smallFeatureCulling = true;
+
+        /// number of viewIDs for which the active child is tracked, views with a viewID at or above this select children without View::lodHysteresis.
+        static constexpr uint32_t maxActiveChildViews = 16;
+
+        /// return the index of the child traversed by the last record traversal of the specified view, children.size() or greater when no child was traversed. Used to apply View::lodHysteresis.
+        uint32_t getActiveChild(uint32_t viewID) const { return (viewID < maxActiveChildViews) ? _activeChildren[viewID].load(std::memory_order_relaxed) : ~0u; }
+
+        /// set the index of the child traversed by the record traversal of the specified view, ignored for viewIDs at or above maxActiveChildViews.
+        void setActiveChild(uint32_t viewID, uint32_t index) const
+        {
+            if (viewID < maxActiveChildViews) _activeChildren[viewID].store(index, std::memory_order_relaxed);
+        }
+
         void addChild(const Child& lodChild) { children.push_back(lodChild); }
 
     public:
@@ -67,6 +83,8 @@ namespace vsg
 
     protected:
         virtual ~LOD();
+
+        mutable std::array<std::atomic_uint32_t, maxActiveChildViews> _activeChildren;
     };
     VSG_type_name(vsg::LOD);
 
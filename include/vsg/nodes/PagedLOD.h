@@ -87,6 +87,9 @@ namespace vsg
         mutable std::atomic<double> priority{0.0};
 
         mutable std::atomic_uint64_t frameHighResLastUsed{0};
+
+        // frame that the high res child was last merged, used by DatabasePager::minimumHighResResidency.
+        mutable uint64_t frameHighResMerged = 0;
         mutable std::atomic_uint requestCount{0};
 
         enum RequestStatus : unsigned int
@@ -126,6 +129,7 @@ namespace vsg
             uint32_t next = 0;
             ref_ptr<PagedLOD> plod;
             List* list = nullptr;
+            uint64_t expiryFrame = 0; // frame that an element on the activeList is next due to be checked by expire(), 0 when not scheduled.
         };
 
         using Elements = std::vector<Element>;
@@ -135,13 +139,25 @@ namespace vsg
         List inactiveList;
         List activeList;
 
+        /// number of frames after the high res child was last used before an active PagedLOD is moved to the inactiveList.
+        uint64_t inactiveAge = 3;
+
+        /// expiry wheel of activeList element indices bucketed on the frame they are next due to be checked,
+        /// so that expire() only visits the elements whose high res child may have aged out rather than walking the whole activeList.
+        std::vector<std::vector<uint32_t>> expiryWheel;
+        uint64_t expiryFrameCount = 0;
+
         void resize(uint32_t new_size);
         void resize();
         void inactive(const PagedLOD* plod);
         void active(const PagedLOD* plod);
         void remove(PagedLOD* plod);
 
+        /// move the active PagedLOD whose high res child hasn't been used within inactiveAge frames of frameCount to the inactiveList.
+        void expire(uint64_t frameCount);
+
         void _move(const PagedLOD* plod, List* targetList);
+        void _schedule(uint32_t index);
 
         bool check();
         bool check(const List& list);
@@ -0,0 +1,151 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2025 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/maths/sphere.h>
+#include <vsg/nodes/Group.h>
+
+#include <unordered_map>
+
+namespace vsg
+{
+
+    /// SpatialGroup is a Group that organizes its children into a loose octree, so that view frustum culling and intersection tests can reject
+    /// whole regions of children at a time rather than testing every child's bound, suited to groups with very large numbers of children.
+    /// Each child is culled against its own bounding sphere as if it were the child of a CullNode.
+    /// The octree is stored as a flat list of nodes and supports incremental insertion, removal and updating of children, so may be used for moving objects.
+    /// Call build() after modifying the children list directly, until then the children are traversed as a normal Group. The order of children is not preserved by remove().
+    class VSG_DECLSPEC SpatialGroup : public Inherit<Group, SpatialGroup>
+    {
+    public:
+        explicit SpatialGroup(size_t numChildren = 0);
+        SpatialGroup(const SpatialGroup& rhs, const CopyOp& copyop = {});
+
+        /// maximum number of children held by an octree leaf before it is subdivided.
+        uint32_t maxChildrenPerNode = 16;
+
+        /// maximum depth of the octree.
+        uint32_t maxDepth = 12;
+
+        /// when false the children are exempt from View::smallFeatureCullingPixelSize culling, for features that must remain visible however small. Not serialized.
+        bool smallFeatureCulling = true;
+
+        /// rebuild the octree from the current children, computing each child's bound.
+        void build();
+
+        /// add child, and its bound, to the children list and octree.
+        void insert(ref_ptr<Node> child, const dsphere& bound);
+
+        /// add child to the children list and octree, computing its bound.
+        void insert(ref_ptr<Node> child);
+
+        /// remove child from the children list and octree, moving the last child into its place. Returns false if child isn't a child of this group.
+        bool remove(const Node* child);
+
+        /// update the bound of a child that has moved or changed, relocating it within the octree if required.
+        bool update(const Node* child, const dsphere& bound);
+
+        /// recompute the bound of child and update its position within the octree.
+        bool update(const Node* child);
+
+        /// return true if the octree matches the children list.
+        bool valid() const { return !_nodes.empty() && _childBounds.size() == children.size(); }
+
+        /// return the bound of the child at specified index.
+        const dsphere& childBound(size_t index) const { return _childBounds[index]; }
+
+        /// call visit(child) for each child whose bound passes intersect(bound), rejecting octree nodes whose loose bounds fail intersect(bound).
+        /// Used by RecordTraversal and Intersector, falls back to visiting all children when the octree is not valid().
+        template<class Intersect, class Visit>
+        void cull(Intersect intersect, Visit visit) const
+        {
+            if (!valid())
+            {
+                for (auto& child : children) visit(*child);
+                return;
+            }
+
+            uint32_t stack[256];
+            uint32_t stackSize = 0;
+            stack[stackSize++] = 0;
+            while (stackSize > 0)
+            {
+                auto& node = _nodes[stack[--stackSize]];
+                if (node.numChildren == 0) continue;
+
+                // the root node also holds children outside its bounds so is always traversed
+                if (&node != _nodes.data() && !intersect(node.looseBound())) continue;
+
+                for (auto index : node.children)
+                {
+                    auto& bound = _childBounds[index];
+                    if (bound.radius < 0.0 || intersect(bound)) visit(*children[index]);
+                }
+
+                if (node.firstChild != 0 && stackSize <= 248)
+                {
+                    for (uint32_t i = 0; i < 8; ++i) stack[stackSize++] = node.firstChild + i;
+                }
+            }
+        }
+
+        struct Statistics
+        {
+            uint32_t numNodes = 0;
+            uint32_t numLeaves = 0;
+            uint32_t depth = 0;
+            uint32_t maxChildrenInNode = 0;
+        };
+
+        Statistics getStatistics() const;
+
+    public:
+        ref_ptr<Object> clone(const CopyOp& copyop = {}) const override { return SpatialGroup::create(*this, copyop); }
+        int compare(const Object& rhs) const override;
+
+        void read(Input& input) override;
+        void write(Output& output) const override;
+
+    protected:
+        virtual ~SpatialGroup();
+
+        struct OctreeNode
+        {
+            dvec3 center;
+            double halfSize = 0.0;
+            uint32_t depth = 0;
+            uint32_t parent = 0;
+            uint32_t firstChild = 0;  // index of the first of 8 consecutive child nodes, 0 for leaves
+            uint32_t numChildren = 0; // number of scene graph children in this node's subtree
+            std::vector<uint32_t> children;
+
+            /// loose bound encloses any child whose center is within the node's cube and whose radius is no more than halfSize
+            dsphere looseBound() const { return dsphere(center, halfSize * 2.7320508075688772); }
+        };
+
+        static dsphere _computeBound(const Node& node);
+        bool _fits(const OctreeNode& node, const dsphere& bound) const;
+        void _insert(uint32_t nodeIndex, uint32_t childIndex);
+        void _detach(uint32_t childIndex);
+        void _subdivide(uint32_t nodeIndex);
+        void _rebuild();
+
+        std::vector<OctreeNode> _nodes;
+        std::vector<dsphere> _childBounds;
+        std::vector<uint32_t> _childNodes;
+        std::unordered_map<const Node*, uint32_t> _childIndices;
+        uint32_t _numOutsideRoot = 0;
+    };
+    VSG_type_name(vsg::SpatialGroup);
+
+} // namespace vsg
@@ -17,6 +17,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/state/StateCommand.h>
 
 #include <algorithm>
+#include <atomic>
 
 namespace vsg
 {
@@ -39,6 +40,10 @@ namespace vsg
         /// if the shaders associated with GraphicsPipeline don't treat the array 0 as xyz vertex then provide an ArrayState prototype to provide custom mapping of arrays to vertices.
         ref_ptr<ArrayState> prototypeArrayState;
 
+        /// bit mask of the viewIDs, below 32, for which all stateCommands have reported ready(viewID), so the RecordTraversal can skip checking them each frame.
+        /// Reset by add()/remove(), reset to 0 if stateCommands is modified directly. Not serialized.
+        mutable std::atomic_uint32_t readyViewMask{0};
+
         template<class T>
         bool contains(const T value) const
         {
@@ -48,6 +53,7 @@ namespace vsg
         void add(ref_ptr<StateCommand> stateCommand)
         {
             stateCommands.push_back(stateCommand);
+            readyViewMask = 0;
         }
 
         template<class T>
@@ -56,6 +62,7 @@ namespace vsg
             if (auto itr = std::find(stateCommands.begin(), stateCommands.end(), value); itr != stateCommands.end())
             {
                 stateCommands.erase(itr);
+                readyViewMask = 0;
             }
         }
 
@@ -0,0 +1,61 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2025 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/maths/sphere.h>
+#include <vsg/nodes/Group.h>
+#include <vsg/state/StreamedTexture.h>
+
+namespace vsg
+{
+
+    /// StreamedTextureGroup is a Group node that binds a StreamedTexture's current BindDescriptorSet for its subgraph.
+    /// During the RecordTraversal the bound is culled against the view frustum and, if visible, the screen height ratio it
+    /// covers is reported to the StreamedTexture so that vsg::TextureStreaming can select the mip levels to keep resident.
+    class VSG_DECLSPEC StreamedTextureGroup : public Inherit<Group, StreamedTextureGroup>
+    {
+    public:
+        StreamedTextureGroup();
+        StreamedTextureGroup(const StreamedTextureGroup& rhs, const CopyOp& copyop = {});
+        StreamedTextureGroup(const dsphere& in_bound, ref_ptr<StreamedTexture> in_texture);
+
+        dsphere bound;
+        ref_ptr<StreamedTexture> texture;
+
+    public:
+        ref_ptr<Object> clone(const CopyOp& copyop = {}) const override { return StreamedTextureGroup::create(*this, copyop); }
+        int compare(const Object& rhs) const override;
+
+        template<class N, class V>
+        static void t_traverse(N& node, V& visitor)
+        {
+            if (node.texture) node.texture->accept(visitor);
+            for (auto& child : node.children) child->accept(visitor);
+        }
+
+        void traverse(Visitor& visitor) override { t_traverse(*this, visitor); }
+        void traverse(ConstVisitor& visitor) const override { t_traverse(*this, visitor); }
+        void traverse(RecordTraversal& visitor) const override
+        {
+            for (auto& child : children) child->accept(visitor);
+        }
+
+        void read(Input& input) override;
+        void write(Output& output) const override;
+
+    protected:
+        virtual ~StreamedTextureGroup();
+    };
+    VSG_type_name(vsg::StreamedTextureGroup);
+
+} // namespace vsg
@@ -14,10 +14,12 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 #include <vsg/app/EllipsoidModel.h>
 #include <vsg/io/ReaderWriter.h>
+#include <vsg/io/TileCache.h>
 #include <vsg/nodes/Node.h>
 #include <vsg/state/DescriptorSetLayout.h>
 #include <vsg/state/PipelineLayout.h>
 #include <vsg/state/Sampler.h>
+#include <vsg/state/VirtualTexture.h>
 #include <vsg/utils/ShaderSet.h>
 
 namespace vsg
@@ -51,6 +53,28 @@ namespace vsg
         /// optional shaderSet to use for setting up shaders, if left null use vsg::createTileShaderSet().
         ref_ptr<ShaderSet> shaderSet;
 
+        /// optional VirtualTexture used to page tile imagery into a shared physical page cache rather than creating a texture per tile.
+        /// Tiles whose imagery doesn't match the page dimensions and format fall back to a texture per tile. Not serialized.
+        ref_ptr<VirtualTexture> virtualTexture;
+
+        /// optional local disk cache of decoded tiles, checked before reading tiles from the imageLayer and terrainLayer. Not serialized.
+        ref_ptr<TileCache> tileCache;
+
+        /// number of vertex rows and columns used for each ECEF tile mesh, clamped to the range [2, 256]. Not serialized.
+        uint32_t gridSize = 32;
+
+        /// optional per level grid sizes, gridSizePerLevel[lod] overrides gridSize for levels within the vector's range. Not serialized.
+        std::vector<uint32_t> gridSizePerLevel;
+
+        /// scale applied to the values read from terrainLayer elevation tiles to convert them to metres. Not serialized.
+        double elevationScale = 1.0;
+
+        /// depth of the skirts added around the edges of tiles with elevation, as a ratio of the tile width, 0 disables skirts. Not serialized.
+        double skirtRatio = 0.02;
+
+        /// return the grid size to use for tiles of specified level
+        uint32_t gridSizeForLevel(uint32_t level) const;
+
     public:
         ref_ptr<Object> clone(const CopyOp& copyop = {}) const override { return TileDatabaseSettings::create(*this, copyop); }
         int compare(const Object& rhs) const override;
@@ -49,6 +49,9 @@ namespace vsg
         size_t totalAvailableSize() const;
         size_t totalReservedSize() const;
 
+        /// return a copy of the MemorySlots used to track the reserved and available regions of the Buffer.
+        MemorySlots getMemorySlots() const;
+
         VkMemoryRequirements getMemoryRequirements(uint32_t deviceID) const;
 
         DeviceMemory* getDeviceMemory(uint32_t deviceID) { return _vulkanData[deviceID].deviceMemory; }
@@ -54,6 +54,9 @@ namespace vsg
         ref_ptr<Data> data;
         ref_ptr<BufferInfo> parent;
 
+        /// when non zero, the number of bytes from the start of data that TransferTask copies for dynamic data updates, for data that is only partially filled each frame. 0 copies the whole range.
+        VkDeviceSize transferRange = 0;
+
         /// return true if the BufferInfo's data has been modified and should be copied to the buffer
         bool requiresCopy(uint32_t deviceID) const
         {
@@ -21,6 +21,7 @@ namespace vsg
 {
     // forward declare
     class Context;
+    class PipelineRequest;
 
     /// Base class for setting up the various pipeline states with the VkGraphicsPipelineCreateInfo
     /// Subclasses are ColorBlendState, DepthStencilState, DynamicState, InputAssemblyState,
@@ -71,28 +72,50 @@ namespace vsg
         ref_ptr<PipelineLayout> layout;
         uint32_t subpass;
 
+        /// optional pipeline, compatible with the same PipelineLayout, vertex inputs and RenderPass, that is bound in place of this pipeline while it's created in the background by the Device's PipelineScheduler.
+        /// If not assigned, subgraphs using this pipeline aren't recorded until it has been created. Not serialized.
+        ref_ptr<GraphicsPipeline> fallback;
+
+        /// return true if the pipeline for the specified view has been created, adopting the result of any completed background creation.
+        bool ready(uint32_t viewID) const
+        {
+            return (viewID < _implementation.size() && _implementation[viewID]) || _completeRequest(viewID);
+        }
+
+        /// return true if the shaders were compiled with the VSG_TRANSFORM_DATA define, so read their modelview matrix from ViewDependentState::transformData using an index push constant.
+        bool transformIndexing() const { return _transformIndexing; }
+
+        /// return the pipeline to bind for the specified view, this pipeline if ready, otherwise the fallback if it's ready, or nullptr if neither is available.
+        const GraphicsPipeline* active(uint32_t viewID) const
+        {
+            if (ready(viewID)) return this;
+            return (fallback && fallback->ready(viewID)) ? fallback.get() : nullptr;
+        }
+
+        /// block till any background creation of the pipeline for the specified view has completed, then return active(viewID).
+        const GraphicsPipeline* wait(uint32_t viewID) const;
+
         int compare(const Object& rhs_object) const override;
 
         void read(Input& input) override;
         void write(Output& output) const override;
 
         // compile the Vulkan object, context parameter used for Device
+        // if the Device has a PipelineScheduler assigned the VkPipeline is created in the background, with ready(viewID) reporting when it's available.
         void compile(Context& context);
 
         // remove the local reference to the Vulkan implementation
-        void release(uint32_t viewID)
-        {
-            if (viewID < static_cast<uint32_t>(_implementation.size())) _implementation[viewID] = {};
-        }
-        void release() { _implementation.clear(); }
+        void release(uint32_t viewID);
+        void release();
 
-    protected:
-        virtual ~GraphicsPipeline();
-
-        struct Implementation : public Inherit<Object, Implementation>
+        /// Implementation is public so that PipelineFactory can create and share them between GraphicsPipeline.
+        struct VSG_DECLSPEC Implementation : public Inherit<Object, Implementation>
         {
             Implementation(Context& context, Device* device, const RenderPass* renderPass, const PipelineLayout* pipelineLayout, const ShaderStages& shaderStages, const GraphicsPipelineStates& pipelineStates, uint32_t subpass);
 
+            /// adopt an existing VkPipeline, destroyed when the Implementation is deleted if device is set.
+            Implementation(Device* device, VkPipeline pipeline);
+
             virtual ~Implementation();
 
             VkPipeline _pipeline;
@@ -100,7 +123,15 @@ namespace vsg
             ref_ptr<Device> _device;
         };
 
-        std::vector<ref_ptr<Implementation>> _implementation;
+    protected:
+        virtual ~GraphicsPipeline();
+
+        void _compile(Context& context, bool allowBackgroundCreation);
+        bool _completeRequest(uint32_t viewID) const;
+
+        mutable std::vector<ref_ptr<Implementation>> _implementation;
+        mutable std::vector<ref_ptr<PipelineRequest>> _requests;
+        bool _transformIndexing = false;
     };
     VSG_type_name(vsg::GraphicsPipeline);
 
@@ -120,6 +151,9 @@ namespace vsg
 
         void record(CommandBuffer& commandBuffer) const override;
 
+        bool ready(uint32_t viewID) const override { return !pipeline || pipeline->ready(viewID); }
+        bool recordable(uint32_t viewID) const override { return !pipeline || pipeline->active(viewID) != nullptr; }
+
         // compile the Vulkan object, context parameter used for Device
         void compile(Context& context) override;
 
@@ -0,0 +1,157 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2025 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+
+#include <vsg/core/observer_ptr.h>
+#include <vsg/state/GraphicsPipeline.h>
+#include <vsg/threading/Latch.h>
+#include <vsg/threading/OperationThreads.h>
+
+#include <chrono>
+#include <map>
+#include <mutex>
+
+namespace vsg
+{
+
+    // forward declare
+    class PipelineScheduler;
+
+    /// PipelineKey captures all the settings that determine the VkPipeline created for a GraphicsPipeline in a particular Context,
+    /// so that GraphicsPipeline with matching settings can share a single GraphicsPipeline::Implementation.
+    struct VSG_DECLSPEC PipelineKey
+    {
+        uint32_t deviceID = 0;
+        Mask mask = MASK_ALL;
+        ref_ptr<RenderPass> renderPass;
+        uint32_t subpass = 0;
+        ref_ptr<PipelineLayout> layout;
+        ShaderStages stages;
+        GraphicsPipelineStates pipelineStates;
+
+        int compare(const PipelineKey& rhs) const;
+
+        bool operator<(const PipelineKey& rhs) const { return compare(rhs) < 0; }
+    };
+
+    /// PipelineFactory creates the GraphicsPipeline::Implementation for a PipelineKey.
+    /// Subclass to provide alternate creation, such as a mock factory for testing the scheduling without a GPU.
+    class VSG_DECLSPEC PipelineFactory : public Inherit<Object, PipelineFactory>
+    {
+    public:
+        /// create the Implementation, returning null or throwing vsg::Exception on failure. May be called from a background thread with a Context dedicated to that call.
+        virtual ref_ptr<GraphicsPipeline::Implementation> createPipeline(const PipelineKey& key, Context& context);
+    };
+    VSG_type_name(vsg::PipelineFactory);
+
+    /// PipelineRequest provides the completion future of a pipeline scheduled for creation by PipelineScheduler.
+    class VSG_DECLSPEC PipelineRequest : public Inherit<Object, PipelineRequest>
+    {
+    public:
+        using clock = std::chrono::steady_clock;
+
+        explicit PipelineRequest(const PipelineKey& in_key, uint32_t in_attempt = 0);
+
+        const PipelineKey key;
+
+        /// number of earlier failed attempts to create the pipeline for key.
+        const uint32_t attempt;
+
+        /// scheduler and dedicated Context used to retry creation if this request fails, assigned by PipelineScheduler.
+        observer_ptr<PipelineScheduler> scheduler;
+        ref_ptr<Context> context;
+
+        /// return true if creation has finished, successfully or not.
+        bool completed() const { return _latch->is_ready(); }
+
+        /// return true if creation has finished without creating a pipeline.
+        bool failed() const { return completed() && !_implementation; }
+
+        /// block till creation has finished.
+        void wait() { _latch->wait(); }
+
+        /// return the created Implementation, null if creation hasn't completed or has failed.
+        ref_ptr<GraphicsPipeline::Implementation> implementation() const { return completed() ? _implementation : ref_ptr<GraphicsPipeline::Implementation>{}; }
+
+        /// return the time that creation finished, only valid once completed() returns true.
+        clock::time_point completionTime() const { return _completionTime; }
+
+        /// assign the result and signal completion, called once by PipelineScheduler.
+        void complete(ref_ptr<GraphicsPipeline::Implementation> in_implementation);
+
+    protected:
+        virtual ~PipelineRequest();
+
+        ref_ptr<Latch> _latch;
+        ref_ptr<GraphicsPipeline::Implementation> _implementation;
+        clock::time_point _completionTime;
+    };
+    VSG_type_name(vsg::PipelineRequest);
+
+    /// PipelineScheduler creates GraphicsPipeline::Implementation on background threads so that compile traversals don't stall on driver pipeline compilation.
+    /// Requests are deduplicated by PipelineKey so GraphicsPipeline with the same settings, compiled through different Context, share one VkPipeline.
+    /// Assign to CompileTraversal/CompileManager via assignPipelineScheduler(..) to enable, GraphicsPipeline::fallback is then used until the requested pipeline is ready.
+    class VSG_DECLSPEC PipelineScheduler : public Inherit<Object, PipelineScheduler>
+    {
+    public:
+        /// create scheduler with numThreads background threads, 0 creates pipelines synchronously in schedule(..)
+        explicit PipelineScheduler(uint32_t numThreads = 1);
+
+        PipelineScheduler(const PipelineScheduler&) = delete;
+        PipelineScheduler& operator=(const PipelineScheduler& rhs) = delete;
+
+        ref_ptr<PipelineFactory> factory;
+        ref_ptr<OperationThreads> operationThreads;
+
+        /// delay in seconds before a failed request is retried, doubled after each consecutive failure of the same key up to maximumRetryDelay.
+        double retryDelay = 1.0;
+        double maximumRetryDelay = 60.0;
+
+        /// return the request for key, scheduling creation of a new pipeline if no matching request exists, or if the matching request failed and its retry delay has elapsed.
+        ref_ptr<PipelineRequest> schedule(const PipelineKey& key, ref_ptr<Context> context);
+
+        /// return the request to use in place of a failed request, a new request once the retry delay has elapsed, otherwise the failed request.
+        ref_ptr<PipelineRequest> retry(ref_ptr<PipelineRequest> failedRequest);
+
+        /// block till all scheduled requests have completed.
+        void wait();
+
+        /// remove completed requests whose pipelines are no longer used outside the scheduler, return the number removed.
+        size_t prune();
+
+        struct Statistics
+        {
+            size_t numRequests = 0;  // number of calls to schedule(..)
+            size_t numShared = 0;    // number of calls that returned an existing request
+            size_t numPending = 0;   // number of requests still being created
+            size_t numCompleted = 0; // number of requests with a created pipeline
+            size_t numFailed = 0;    // number of requests that failed to create a pipeline
+        };
+
+        Statistics getStatistics() const;
+
+    protected:
+        virtual ~PipelineScheduler();
+
+        bool _retryDue(const PipelineRequest& request) const;
+        void _create(ref_ptr<PipelineRequest> request, const Context& context);
+
+        mutable std::mutex _mutex;
+        std::map<PipelineKey, ref_ptr<PipelineRequest>> _requests;
+        size_t _numRequests = 0;
+        size_t _numShared = 0;
+    };
+    VSG_type_name(vsg::PipelineScheduler);
+
+} // namespace vsg
@@ -33,6 +33,12 @@ namespace vsg
         void read(Input& input) override;
         void write(Output& output) const override;
 
+        /// return true if the Vulkan objects required to record this StateCommand for the specified view have been created.
+        virtual bool ready(uint32_t /*viewID*/) const { return true; }
+
+        /// return true if this StateCommand can be recorded for the specified view, either directly or through a substitute such as a fallback pipeline.
+        virtual bool recordable(uint32_t viewID) const { return ready(viewID); }
+
         uint32_t slot = 0;
 
     protected:
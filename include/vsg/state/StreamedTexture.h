@@ -0,0 +1,124 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2025 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/io/Path.h>
+#include <vsg/state/BindDescriptorSet.h>
+#include <vsg/state/Sampler.h>
+#include <vsg/utils/BlockCompression.h>
+
+#include <atomic>
+
+namespace vsg
+{
+
+    // forward declare
+    class Options;
+
+    /// StreamedTexture holds the CPU side state of a texture whose resident mip levels are managed by vsg::TextureStreaming.
+    /// Only the mip levels from residentLevel down to the coarsest level are uploaded to the GPU, the StreamedTextureGroup node
+    /// records the texture's screen space footprint during the RecordTraversal and TextureStreaming uses this feedback to decide
+    /// which levels should be resident, replacing bindDescriptorSet with one bound to the new mip range when the residency changes.
+    class VSG_DECLSPEC StreamedTexture : public Inherit<Object, StreamedTexture>
+    {
+    public:
+        StreamedTexture();
+        StreamedTexture(ref_ptr<Data> in_source, ref_ptr<Sampler> in_sampler, ref_ptr<BindDescriptorSet> in_bindDescriptorSet, uint32_t in_dstBinding = 0);
+        StreamedTexture(const Path& in_filename, ref_ptr<const Options> in_options, ref_ptr<Sampler> in_sampler, ref_ptr<BindDescriptorSet> in_bindDescriptorSet, uint32_t in_dstBinding = 0);
+
+        StreamedTexture(const StreamedTexture&) = delete;
+        StreamedTexture& operator=(const StreamedTexture& rhs) = delete;
+
+        /// source image, if null the image is read from filename when finer mip levels are required, see TextureStreaming::sourceCacheBudget.
+        ref_ptr<Data> source;
+        Path filename;
+        ref_ptr<const Options> options;
+
+        /// when the source image has no mipmaps they are generated on the CPU using these settings.
+        ref_ptr<MipmapSettings> mipmapSettings;
+
+        /// optional settings for block compressing uncompressed source images before they are uploaded.
+        ref_ptr<BlockCompressionSettings> compressionSettings;
+
+        ref_ptr<Sampler> sampler;
+        VkImageLayout imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+
+        /// BindDescriptorSet recorded by StreamedTextureGroup, the DescriptorImage with a matching dstBinding is replaced with one referencing the resident mip levels.
+        ref_ptr<BindDescriptorSet> bindDescriptorSet;
+        uint32_t dstBinding = 0;
+
+        /// dimensions, in texels, of mip level 0.
+        uint32_t width = 0;
+        uint32_t height = 0;
+
+        /// size in bytes of each mip level, set up by init().
+        std::vector<VkDeviceSize> levelSizes;
+
+        /// finest mip level currently resident on the GPU.
+        uint32_t residentLevel = 0;
+
+        /// mip levels from residentLevel down to the coarsest level, downgrades are extracted from it rather than from the source image.
+        ref_ptr<Data> residentImage;
+
+        /// true while TextureStreaming is preparing a new set of resident mip levels.
+        bool pending = false;
+
+        /// frame that residentLevel, or a finer level, was last required, used by TextureStreaming to delay downgrades.
+        uint64_t frameResidentLevelLastRequired = 0;
+
+        uint32_t numMipLevels() const { return static_cast<uint32_t>(levelSizes.size()); }
+
+        /// return the finest mip level whose dimensions are no larger than maxDimension, used as the always resident mip tail.
+        uint32_t coarsestLevel(uint32_t maxDimension) const;
+
+        /// return the number of bytes required to hold the mip levels from level down to the coarsest level.
+        VkDeviceSize residentSize(uint32_t level) const;
+
+        /// return the finest mip level required to texture an object covering screenPixels without magnification.
+        uint32_t requiredLevel(double screenPixels) const;
+
+        /// record that the texture covers the specified ratio of the screen height in frame, thread safe so may be called from multiple RecordTraversal.
+        /// Requests for the same frame keep the largest ratio, requests from a later frame replace earlier ones.
+        void request(double screenHeightRatio, uint64_t frameCount);
+
+        /// return the frame and the largest screen height ratio of the most recent request.
+        std::pair<uint64_t, double> lastRequest() const;
+
+        /// read the source image, generating mipmaps and compressing it if required, and set up width, height and levelSizes.
+        /// Assigns bindDescriptorSet to one referencing the mip levels from initialLevel, returns false if the source image can't be read.
+        bool init(uint32_t initialLevel = ~0u);
+
+        /// read the source image with any required mipmap generation and compression applied.
+        ref_ptr<Data> readSource() const;
+
+        /// create a copy of the mip levels from level down to the coarsest level of image.
+        static ref_ptr<Data> extractMipmaps(const Data& image, uint32_t level);
+
+        /// create a BindDescriptorSet based on bindDescriptorSet with the dstBinding DescriptorImage referencing the specified image.
+        ref_ptr<BindDescriptorSet> createBindDescriptorSet(ref_ptr<Data> image) const;
+
+        void traverse(Visitor& visitor) override;
+        void traverse(ConstVisitor& visitor) const override;
+
+        void read(Input& input) override;
+        void write(Output& output) const override;
+
+    protected:
+        virtual ~StreamedTexture();
+
+        // frame count in the upper 32 bits, bits of the float screen height ratio in the lower 32 bits.
+        std::atomic_uint64_t _request{0};
+    };
+    VSG_type_name(vsg::StreamedTexture);
+
+} // namespace vsg
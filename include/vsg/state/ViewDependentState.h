@@ -20,6 +20,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/state/BindDescriptorSet.h>
 #include <vsg/state/DescriptorBuffer.h>
 #include <vsg/state/DescriptorImage.h>
+#include <vsg/vk/State.h>
 
 namespace vsg
 {
@@ -142,6 +143,15 @@ namespace vsg
         ref_ptr<vec4Array> viewportData;
         ref_ptr<BufferInfo> viewportDataBufferInfo;
 
+        /// per frame modelview matrices, filled in by RecordTraversal for pipelines compiled with the VSG_TRANSFORM_DATA define, such as those using createFlatShadedShaderSet().
+        /// Opt in by setting maxTransformData, the number of matrices held, before the View is compiled. Bound at the shaderSet's "transformData" descriptor binding,
+        /// or set 0 binding 5 used by the built-in shaders if shaderSet doesn't provide one. Only the matrices recorded each frame are transferred.
+        /// Up to half the entries may be reserved by CachedCommandGroup recordings so they can be replayed with their matrices refilled each frame.
+        uint32_t maxTransformData = 0;
+        ref_ptr<mat4Array> transformData;
+        ref_ptr<BufferInfo> transformDataBufferInfo;
+        ref_ptr<ReservedTransforms> reservedTransforms;
+
         ref_ptr<Image> shadowDepthImage;
 
         ref_ptr<DescriptorSetLayout> descriptorSetLayout;
@@ -0,0 +1,141 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2025 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+
+#include <vsg/state/BindDescriptorSet.h>
+#include <vsg/state/ImageInfo.h>
+#include <vsg/state/StateCommand.h>
+#include <vsg/threading/OperationThreads.h>
+#include <vsg/utils/PageTable.h>
+
+#include <map>
+#include <mutex>
+
+namespace vsg
+{
+
+    // forward declare
+    class BindVirtualTextureTile;
+    class CompileManager;
+
+    /// VirtualTexture provides a physical page cache for tile imagery so that paged databases share a single 2D array Image
+    /// and a fixed set of descriptor sets rather than allocating an Image, DescriptorPool entry and DescriptorSet per tile.
+    /// The PageTable maps the (level, x, y) of each tile to a page, i.e. an array layer of the image, with least recently used
+    /// pages replaced when the cache is full. Page 0 is reserved for fallback imagery used while a tile's page is reloaded.
+    /// A VirtualTexture should only be shared by tiles with unique keys, i.e. one VirtualTexture per TileDatabase.
+    class VSG_DECLSPEC VirtualTexture : public Inherit<Object, VirtualTexture>
+    {
+    public:
+        VirtualTexture(uint32_t in_pageWidth = 256, uint32_t in_pageHeight = 256, uint32_t in_numPages = 256, VkFormat in_format = VK_FORMAT_R8G8B8A8_UNORM);
+
+        VirtualTexture(const VirtualTexture&) = delete;
+        VirtualTexture& operator=(const VirtualTexture& rhs) = delete;
+
+        /// dimensions and format of each page, tile imagery must match these to be placed in the cache.
+        uint32_t pageWidth = 256;
+        uint32_t pageHeight = 256;
+        uint32_t numPages = 256;
+        VkFormat format = VK_FORMAT_R8G8B8A8_UNORM;
+
+        /// number of mip levels of each page, mip levels are generated on upload. Defaults to the full mip chain.
+        uint32_t mipLevels = 1;
+
+        /// maximum number of evicted tiles to reload each frame.
+        uint32_t maxReloadsPerFrame = 16;
+
+        /// imagery assigned to page 0, if not set a mid grey image is created for 8 bit RGBA formats.
+        ref_ptr<Data> fallback;
+
+        /// set up on init()
+        ref_ptr<PageTable> pageTable;
+        ref_ptr<Image> image;
+        std::vector<ref_ptr<ImageInfo>> pageImageInfos;
+        std::vector<ref_ptr<BindDescriptorSet>> pageBindings;
+
+        /// compile manager used to reload evicted pages, assigned by RecordTraversal from the DatabasePager if not already set.
+        ref_ptr<CompileManager> compileManager;
+
+        /// thread used to reload evicted pages, created on demand.
+        ref_ptr<OperationThreads> operationThreads;
+
+        /// return true if data can be placed in a page.
+        bool compatible(const Data& data) const;
+
+        /// set up the image, per page image views and bindings. The descriptors are added to each page's DescriptorSet alongside the page's DescriptorImage.
+        void init(ref_ptr<Sampler> sampler, ref_ptr<PipelineLayout> layout, uint32_t firstSet, uint32_t dstBinding, const Descriptors& descriptors = {});
+
+        /// compile the image and bindings, uploading the fallback page, for the context's device.
+        void compile(Context& context);
+
+        /// assign a page to key and copy data to it via context. Returns 0 if no page is available.
+        uint32_t load(const PageTable::Key& key, ref_ptr<Data> data, Context& context, bool in_ready = true);
+
+        /// mark a page as having had its data transferred so that it may be bound.
+        void ready(uint32_t page);
+
+        /// return the page to bind for tile, returning 0 and queuing a reload if the tile's page has been evicted.
+        uint32_t use(const BindVirtualTextureTile& tile);
+
+        /// advance the frame count used for least recently used replacement and dispatch any pending reloads.
+        void advance(uint64_t frameCount, ref_ptr<CompileManager> in_compileManager = {});
+
+        /// reload the pages for the queued tiles, called from the operationThreads.
+        void reload(std::vector<ref_ptr<const BindVirtualTextureTile>> tiles);
+
+        uint64_t frameCount() const { return _frameCount; }
+
+        /// stats
+        uint64_t numLoads = 0;
+        uint64_t numReloads = 0;
+
+        void read(Input& input) override;
+        void write(Output& output) const override;
+
+    protected:
+        virtual ~VirtualTexture();
+
+        mutable std::mutex _mutex;
+        uint64_t _frameCount = 0;
+        std::vector<uint8_t> _pageReady;
+        std::vector<bool> _compiled;
+        std::map<PageTable::Key, ref_ptr<const BindVirtualTextureTile>> _reloadRequests;
+        bool _reloading = false;
+    };
+    VSG_type_name(vsg::VirtualTexture);
+
+    /// BindVirtualTextureTile is the per tile state of a VirtualTexture, binding the descriptor set of the page that the tile's imagery is loaded into.
+    class VSG_DECLSPEC BindVirtualTextureTile : public Inherit<StateCommand, BindVirtualTextureTile>
+    {
+    public:
+        BindVirtualTextureTile();
+        BindVirtualTextureTile(ref_ptr<VirtualTexture> in_virtualTexture, const PageTable::Key& in_key, ref_ptr<Data> in_data, uint32_t in_slot);
+
+        ref_ptr<VirtualTexture> virtualTexture;
+        PageTable::Key key;
+        ref_ptr<Data> data;
+
+        int compare(const Object& rhs_object) const override;
+
+        void read(Input& input) override;
+        void write(Output& output) const override;
+
+        void compile(Context& context) override;
+        void record(CommandBuffer& commandBuffer) const override;
+
+    protected:
+        virtual ~BindVirtualTextureTile();
+    };
+    VSG_type_name(vsg::BindVirtualTextureTile);
+
+} // namespace vsg
@@ -13,6 +13,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 </editor-fold> */
 
 #include <vsg/core/Inherit.h>
+#include <vsg/threading/SpinWait.h>
 
 #include <condition_variable>
 
@@ -38,12 +39,17 @@ namespace vsg
             if (++_num_arrived == _num_threads)
             {
                 _release();
+                return;
             }
-            else
-            {
-                auto my_phase = _phase;
-                _cv.wait(lock, [this, my_phase]() { return this->_phase != my_phase; });
-            }
+
+            auto my_phase = _phase.load();
+            lock.unlock();
+
+            // spin briefly before parking as the wake-up of a parked thread adds latency
+            if (spinWait.spin([this, my_phase]() { return _phase != my_phase; })) return;
+
+            lock.lock();
+            _cv.wait(lock, [this, my_phase]() { return this->_phase != my_phase; });
         }
 
         /// increment the arrived count and release the barrier if count matches number of threads to arrive, return immediately without waiting for release condition
@@ -56,6 +62,9 @@ namespace vsg
             }
         }
 
+        /// adaptive spin-wait used by arrive_and_wait() before parking the thread
+        SpinWait spinWait;
+
     protected:
         virtual ~Barrier() {}
 
@@ -68,7 +77,7 @@ namespace vsg
 
         const uint32_t _num_threads;
         uint32_t _num_arrived;
-        uint32_t _phase;
+        std::atomic_uint32_t _phase;
 
         std::mutex _mutex;
         std::condition_variable _cv;
@@ -0,0 +1,83 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2025 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/core/Inherit.h>
+#include <vsg/threading/ActivityStatus.h>
+
+#include <condition_variable>
+#include <list>
+
+namespace vsg
+{
+
+    /// DeleteQueue defers the deletion of objects removed from the scene graph, such as expired PagedLOD subgraphs, to a background thread,
+    /// avoiding frame time spikes from releasing large subgraphs and their Vulkan resources on the update thread.
+    /// Objects are retained for retainFrames frames so that command buffers still in flight that reference them have completed before they are deleted,
+    /// and the deletion thread limits the time it spends deleting objects each frame to timeBudget, leaving the remainder to later frames.
+    /// Vulkan resources and memory sub-allocations are returned to their pools by the deletion thread, as the DeviceMemory, MemoryBufferPools and DescriptorPool are thread safe.
+    class VSG_DECLSPEC DeleteQueue : public Inherit<Object, DeleteQueue>
+    {
+    public:
+        explicit DeleteQueue(ref_ptr<ActivityStatus> status);
+
+        DeleteQueue(const DeleteQueue&) = delete;
+        DeleteQueue& operator=(const DeleteQueue& rhs) = delete;
+
+        /// number of frames that objects are retained before they are deleted, should be no less than the number of frames in flight.
+        uint64_t retainFrames = 4;
+
+        /// maximum time, in milliseconds, that wait_then_clear() spends deleting objects each frame, 0.0 for no limit.
+        /// Each object is deleted as a whole so a single large subgraph may exceed the budget.
+        double timeBudget = 2.0;
+
+        ActivityStatus* getStatus() { return _status; }
+        const ActivityStatus* getStatus() const { return _status; }
+
+        /// advance to a new frame, making the objects added retainFrames ago available for deletion.
+        void advance(uint64_t frameCount);
+
+        /// add an object to be deleted once retainFrames frames have passed.
+        void add(ref_ptr<Object> object);
+
+        /// wait until objects are available for deletion then delete them, stopping once the timeBudget for the current frame is used up.
+        /// Returns the number of objects deleted. Called from the deletion thread.
+        size_t wait_then_clear();
+
+        /// delete all the objects immediately, regardless of the frame they were added.
+        void clear();
+
+        /// return the number of objects waiting to be deleted.
+        size_t size() const;
+
+    protected:
+        virtual ~DeleteQueue();
+
+        struct ObjectToDelete
+        {
+            uint64_t frameCount = 0;
+            ref_ptr<Object> object;
+        };
+
+        mutable std::mutex _mutex;
+        std::condition_variable _cv;
+        std::list<ObjectToDelete> _objectsToDelete;
+        ref_ptr<ActivityStatus> _status;
+
+        uint64_t _frameCount = 0;
+        uint64_t _budgetFrameCount = 0;
+        double _budgetUsed = 0.0;
+    };
+    VSG_type_name(vsg::DeleteQueue);
+
+} // namespace vsg
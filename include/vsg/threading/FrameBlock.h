@@ -13,6 +13,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 </editor-fold> */
 
 #include <vsg/threading/ActivityStatus.h>
+#include <vsg/threading/SpinWait.h>
 #include <vsg/ui/ApplicationEvent.h>
 
 namespace vsg
@@ -35,6 +36,7 @@ namespace vsg
         {
             std::scoped_lock lock(_mutex);
             _value = frameStamp;
+            ++_version;
             _cv.notify_all();
         }
 
@@ -49,12 +51,22 @@ namespace vsg
         void wake()
         {
             std::scoped_lock lock(_mutex);
+            ++_version;
             _cv.notify_all();
         }
 
         bool wait_for_change(ref_ptr<FrameStamp>& value)
         {
             std::unique_lock lock(_mutex);
+            if (_value == value && _status->active())
+            {
+                // spin briefly before parking as the wake-up of a parked thread adds latency
+                auto version = _version.load();
+                lock.unlock();
+                spinWait.spin([this, version]() { return _version != version || !_status->active(); });
+                lock.lock();
+            }
+
             while (_value == value && _status->active())
             {
                 _cv.wait(lock);
@@ -64,9 +76,13 @@ namespace vsg
             return _status->active();
         }
 
+        /// adaptive spin-wait used by wait_for_change() before parking the thread
+        SpinWait spinWait;
+
     protected:
         virtual ~FrameBlock() {}
 
+        std::atomic_uint64_t _version{0};
         std::mutex _mutex;
         std::condition_variable _cv;
         ref_ptr<FrameStamp> _value;
@@ -0,0 +1,94 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2025 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/threading/Latch.h>
+#include <vsg/threading/OperationThreads.h>
+#include <vsg/ui/UIEvent.h>
+
+#include <functional>
+#include <memory>
+#include <ostream>
+
+namespace vsg
+{
+
+    /// FrameTaskGraph runs a set of tasks with explicit dependencies between them, each task starting as soon as all the tasks it depends upon have completed.
+    /// Independent tasks are run in parallel on the OperationThreads worker pool, with the thread calling run() also running tasks.
+    /// The start and end time of each task is recorded on each run() so that the critical path of the frame can be reported.
+    class VSG_DECLSPEC FrameTaskGraph : public Inherit<Object, FrameTaskGraph>
+    {
+    public:
+        explicit FrameTaskGraph(ref_ptr<OperationThreads> in_operationThreads = {});
+
+        FrameTaskGraph(const FrameTaskGraph&) = delete;
+        FrameTaskGraph& operator=(const FrameTaskGraph& rhs) = delete;
+
+        using Function = std::function<void()>;
+        using Indices = std::vector<uint32_t>;
+
+        struct Task
+        {
+            std::string name;
+            Function function;
+            Indices dependencies;
+            Indices dependents;
+
+            // timing of the task on the most recent run()
+            time_point start = {};
+            time_point end = {};
+        };
+
+        using Tasks = std::vector<Task>;
+        Tasks tasks;
+
+        /// worker threads used to run tasks in parallel, if null all tasks are run in order on the thread calling run().
+        ref_ptr<OperationThreads> operationThreads;
+
+        /// add a task that can only start once the tasks it depends upon have completed, return the index of the new task.
+        /// Dependencies must refer to tasks that have already been added, so the graph can never contain a cycle.
+        uint32_t add(const std::string& name, Function function, const Indices& dependencies = {});
+
+        /// remove all the tasks
+        void clear();
+
+        /// run all the tasks, returning once they have all completed.
+        void run();
+
+        /// time the most recent run() started and ended
+        time_point start = {};
+        time_point end = {};
+
+        /// return the duration, in milliseconds, of the specified task on the most recent run()
+        double duration(uint32_t index) const;
+
+        /// return the tasks on the longest chain of dependent tasks on the most recent run(), this is the lower bound on the time the frame can take however many threads are used.
+        Indices criticalPath() const;
+
+        /// print the timing of all the tasks on the most recent run() along with the critical path
+        void report(std::ostream& out) const;
+
+    protected:
+        virtual ~FrameTaskGraph();
+
+        void _schedule(uint32_t index);
+        void _run(uint32_t index);
+
+        std::unique_ptr<std::atomic_uint32_t[]> _pending;
+        std::vector<ref_ptr<Operation>> _operations;
+        ref_ptr<Latch> _latch;
+        size_t _compiledSize = 0;
+    };
+    VSG_type_name(vsg::FrameTaskGraph);
+
+} // namespace vsg
@@ -13,6 +13,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 </editor-fold> */
 
 #include <vsg/core/Inherit.h>
+#include <vsg/threading/SpinWait.h>
 
 #include <condition_variable>
 #include <mutex>
@@ -68,25 +69,37 @@ namespace vsg
 
         void wait()
         {
+            // spin briefly before parking as the wake-up of a parked thread adds latency
+            if (spinWait.spin([this]() { return _count <= 0; })) return;
+
             std::unique_lock lock(_mutex);
+            ++_numParked;
             while (_count > 0)
             {
                 _cv.wait(lock);
             }
+            --_numParked;
         }
 
         virtual void release()
         {
+            // only need to wake threads that have parked, threads still spinning will see the count change
+            if (_numParked == 0) return;
+
             std::unique_lock lock(_mutex);
             _cv.notify_all();
         }
 
         int count() const { return _count.load(); }
 
+        /// adaptive spin-wait used by wait() before parking the thread
+        SpinWait spinWait;
+
     protected:
         virtual ~Latch() {}
 
         std::atomic_int _count;
+        std::atomic_int _numParked{0};
         std::mutex _mutex;
         std::condition_variable _cv;
     };
@@ -0,0 +1,102 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2025 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/core/Export.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#    include <intrin.h>
+#endif
+
+namespace vsg
+{
+
+    /// hint to the CPU that the calling thread is in a spin-wait loop
+    inline void cpu_relax()
+    {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+        _mm_pause();
+#elif defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+        __asm__ __volatile__("yield");
+#else
+        std::this_thread::yield();
+#endif
+    }
+
+    /// SpinWait provides the adaptive spin phase used by FrameBlock, Barrier and Latch before they park the waiting thread on their condition variable.
+    /// Spinning avoids the wake-up latency of parked threads when the wait is satisfied shortly after it starts.
+    /// The spin time adapts between minimumSpinTime and maximumSpinTime, growing when spins succeed and halving when the thread has to park,
+    /// so threads that are routinely woken long after they start waiting quickly stop using CPU time.
+    /// Spinning is disabled on systems with a single core, where the spinning thread would only delay the thread it's waiting on.
+    class SpinWait
+    {
+    public:
+        SpinWait() = default;
+        SpinWait(const SpinWait&) = delete;
+        SpinWait& operator=(const SpinWait&) = delete;
+
+        /// longest time, in nanoseconds, spent spinning before parking, 0 disables spinning.
+        int64_t maximumSpinTime = 50000;
+
+        /// shortest time, in nanoseconds, spent spinning so that the spin time can grow again once waits are satisfied quickly.
+        int64_t minimumSpinTime = 1000;
+
+        /// spin until the predicate returns true or the current spin time has elapsed, return the final value of the predicate.
+        template<typename Predicate>
+        bool spin(Predicate predicate)
+        {
+            if (predicate()) return true;
+
+            static const bool multipleCores = std::thread::hardware_concurrency() > 1;
+            if (!multipleCores || maximumSpinTime <= 0) return false;
+
+            int64_t spinTime = std::clamp(_spinTime.load(std::memory_order_relaxed), minimumSpinTime, maximumSpinTime);
+
+            auto start = std::chrono::steady_clock::now();
+            for (;;)
+            {
+                for (int i = 0; i < 16; ++i)
+                {
+                    cpu_relax();
+                    if (predicate())
+                    {
+                        // move the spin time towards twice the time this wait took
+                        int64_t elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+                        _spinTime.store(spinTime + (2 * elapsed - spinTime) / 8, std::memory_order_relaxed);
+                        return true;
+                    }
+                }
+
+                if (std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count() >= spinTime) break;
+            }
+
+            // spinning failed so back off
+            _spinTime.store(spinTime / 2, std::memory_order_relaxed);
+            return false;
+        }
+
+        /// current adaptive spin time in nanoseconds
+        int64_t spinTime() const { return _spinTime.load(std::memory_order_relaxed); }
+
+    protected:
+        std::atomic_int64_t _spinTime{10000};
+    };
+
+} // namespace vsg
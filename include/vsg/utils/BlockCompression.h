@@ -0,0 +1,61 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2025 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/utils/GenerateMipmaps.h>
+
+namespace vsg
+{
+
+    /// BlockCompressionSettings provides the settings used by vsg::compressImage(..) to guide the encoding of image data to block compressed formats.
+    class VSG_DECLSPEC BlockCompressionSettings : public Inherit<Object, BlockCompressionSettings>
+    {
+    public:
+        enum Quality
+        {
+            FASTEST,  /// bounding box endpoints, single pass encoding.
+            BALANCED, /// principal axis endpoints, both ETC2 sub-block orientations.
+            HIGHEST   /// principal axis endpoints with least squares refinement and wider BC4/ETC2/EAC searches.
+        };
+
+        /// block compressed format to encode to, VK_FORMAT_UNDEFINED selects a format based on the source data's format.
+        VkFormat format = VK_FORMAT_UNDEFINED;
+
+        Quality quality = BALANCED;
+
+        /// when selecting the format automatically use ETC2/EAC formats rather than BCn, suitable for mobile targets.
+        bool preferETC2 = false;
+
+        /// alpha values below this threshold are encoded as transparent when using BC1 with punch through alpha.
+        uint8_t alphaThreshold = 128;
+
+        /// optional settings for generating mipmaps on the CPU when the source image doesn't provide its own, block compressed images can't have their mipmaps generated on the GPU.
+        ref_ptr<MipmapSettings> mipmapSettings;
+
+        /// optional threads to use to compress the blocks in parallel.
+        ref_ptr<OperationThreads> operationThreads;
+    };
+    VSG_type_name(vsg::BlockCompressionSettings);
+
+    /// return true if vsg::compressImage(..) supports encoding to the specified format.
+    extern VSG_DECLSPEC bool supportsBlockCompression(VkFormat format);
+
+    /// return the block compressed format suitable for encoding data of the specified sourceFormat, returns VK_FORMAT_UNDEFINED if source format is not supported.
+    extern VSG_DECLSPEC VkFormat selectBlockCompressedFormat(VkFormat sourceFormat, const BlockCompressionSettings& settings);
+
+    /// compress 8 bit per component image data, including any mipmaps, to a BC1, BC3, BC4, BC5, BC7, ETC2 RGB8 or ETC2 RGBA8 format.
+    /// Supports R8, R8G8, R8G8B8, B8G8R8, R8G8B8A8 and B8G8R8A8 source formats held in Array2D/Array3D, with the result returned as a block64/block128 Array2D/Array3D.
+    /// Returns null if the source data or target format are not supported.
+    extern VSG_DECLSPEC ref_ptr<Data> compressImage(ref_ptr<const Data> image, ref_ptr<const BlockCompressionSettings> settings = {});
+
+} // namespace vsg
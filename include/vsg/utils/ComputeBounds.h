@@ -14,10 +14,77 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 #include <vsg/maths/box.h>
 #include <vsg/state/ArrayState.h>
+#include <vsg/threading/OperationThreads.h>
+
+#include <map>
+#include <mutex>
 
 namespace vsg
 {
 
+    /// BoundsCache caches the bounds computed for vertex arrays by ComputeBounds so that repeated traversals of unchanged geometry don't revisit the vertices.
+    /// Entries are keyed on the vertex and index arrays, the draw range and the transform, and are ignored once either array's ModifiedCount changes.
+    /// The cache holds references to the arrays, call prune() to release arrays that are no longer referenced elsewhere. Thread safe.
+    class VSG_DECLSPEC BoundsCache : public Inherit<Object, BoundsCache>
+    {
+    public:
+        BoundsCache();
+
+        struct Key
+        {
+            const Data* vertices = nullptr;
+            const Data* indices = nullptr;
+            uint32_t first = 0;
+            uint32_t count = 0;
+            dmat4 matrix;
+
+            bool operator<(const Key& rhs) const
+            {
+                if (vertices != rhs.vertices) return vertices < rhs.vertices;
+                if (indices != rhs.indices) return indices < rhs.indices;
+                if (first != rhs.first) return first < rhs.first;
+                if (count != rhs.count) return count < rhs.count;
+                return matrix < rhs.matrix;
+            }
+        };
+
+        /// get the cached bounds for key, returning false if there is no entry or the arrays have been modified since it was computed.
+        bool get(const Key& key, dbox& bounds) const;
+
+        /// cache the bounds computed for key.
+        void set(const Key& key, const dbox& bounds);
+
+        /// remove the entries whose arrays are only referenced by the cache.
+        void prune();
+
+        void clear();
+
+        size_t size() const;
+
+        mutable std::atomic_uint64_t hits{0};
+        mutable std::atomic_uint64_t misses{0};
+
+    protected:
+        virtual ~BoundsCache();
+
+        struct Entry
+        {
+            ref_ptr<const Data> vertices;
+            ref_ptr<const Data> indices;
+            ModifiedCount verticesModifiedCount;
+            ModifiedCount indicesModifiedCount;
+            dbox bounds;
+        };
+
+        mutable std::mutex _mutex;
+        std::map<Key, Entry> _entries;
+    };
+    VSG_type_name(vsg::BoundsCache);
+
+    /// compute the bounding box of an array of vertices, using a min/max reduction that the compiler can vectorize.
+    extern VSG_DECLSPEC dbox computeBounds(const vec3Array& vertices);
+    extern VSG_DECLSPEC dbox computeBounds(const dvec3Array& vertices);
+
     /// ComputeBounds traverses a scene graph computing an overall bounding box that encloses all the geometry in that scene graph.
     class VSG_DECLSPEC ComputeBounds : public Inherit<ConstVisitor, ComputeBounds>
     {
@@ -40,7 +107,16 @@ namespace vsg
         ref_ptr<const ushortArray> ushort_indices;
         ref_ptr<const uintArray> uint_indices;
 
+        /// optional cache of vertex array bounds, share between ComputeBounds traversals to avoid recomputing the bounds of unchanged geometry.
+        ref_ptr<BoundsCache> boundsCache;
+
+        /// optional threads used to traverse the children of Groups with at least minimumParallelChildren children in parallel.
+        /// The children are traversed by ComputeBounds instances so subclasses that override apply() methods should leave operationThreads unassigned.
+        ref_ptr<OperationThreads> operationThreads;
+        uint32_t minimumParallelChildren = 16;
+
         void apply(const Object& node) override;
+        void apply(const Group& group) override;
         void apply(const StateGroup& stategroup) override;
         void apply(const Transform& transform) override;
         void apply(const MatrixTransform& transform) override;
@@ -0,0 +1,49 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2025 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/core/Data.h>
+#include <vsg/core/Inherit.h>
+#include <vsg/threading/OperationThreads.h>
+
+namespace vsg
+{
+
+    /// MipmapSettings provides the settings used by vsg::generateMipmaps(..) to guide the CPU generation of mipmap chains.
+    class VSG_DECLSPEC MipmapSettings : public Inherit<Object, MipmapSettings>
+    {
+    public:
+        enum Filter
+        {
+            BOX,   /// 2x2(x2) average of the parent level.
+            KAISER /// Kaiser windowed sinc, sharper result than box at a higher computational cost.
+        };
+
+        Filter filter = BOX;
+
+        /// maximum number of mipmap levels including the base level, 0 for the full mipmap chain.
+        uint32_t maxNumMipmaps = 0;
+
+        /// alpha test reference value used to preserve the proportion of texels that pass the alpha test at each level, a negative value disables alpha coverage preservation.
+        float alphaCoverageReference = -1.0f;
+
+        /// optional threads to use to filter the rows of each level in parallel.
+        ref_ptr<OperationThreads> operationThreads;
+    };
+    VSG_type_name(vsg::MipmapSettings);
+
+    /// generate a mipmap chain for Array2D or 3D volume Array3D image data with 8 or 16 bit unorm or 32 bit float components, returning a new Data with the mipmaps laid out as computeMipmapOffsets() expects.
+    /// sRGB formats are filtered in linear space. Returns null if the source data is not supported.
+    extern VSG_DECLSPEC ref_ptr<Data> generateMipmaps(ref_ptr<const Data> image, ref_ptr<const MipmapSettings> settings = {});
+
+} // namespace vsg
@@ -0,0 +1,85 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2025 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+
+#include <vsg/core/Visitor.h>
+#include <vsg/maths/mat4.h>
+#include <vsg/maths/sphere.h>
+#include <vsg/nodes/Group.h>
+#include <vsg/state/GraphicsPipeline.h>
+#include <vsg/utils/ShaderSet.h>
+
+#include <map>
+#include <set>
+
+namespace vsg
+{
+
+    // forward declare
+    class MatrixTransform;
+    class StateGroup;
+
+    /// InstanceRepeatedSubgraphs replaces MatrixTransforms that share the same leaf subgraph with instanced draws of that subgraph.
+    /// Candidate leaf subgraphs are a StateGroup containing a BindGraphicsPipeline and a single VertexIndexDraw/VertexDraw, with a pipeline whose shaders have source so they can be recompiled.
+    /// Transforms that differ only in translation become per instance positions using the ShaderSet's "vsg_position" attribute, the same path used by Builder's StateInfo::instance_positions_vec3.
+    /// Instances are split spatially into batches of up to maxInstancesPerBatch, each placed under a MatrixTransform holding the common rotation/scale and the batch's center,
+    /// so the float instance positions are relative to a local origin, and a CullNode so view frustum culling remains effective.
+    /// The instanced StateGroup's prototypeArrayState is assigned a PositionArrayState so ComputeBounds and LineSegmentIntersector account for the instance positions.
+    class VSG_DECLSPEC InstanceRepeatedSubgraphs : public Inherit<Visitor, InstanceRepeatedSubgraphs>
+    {
+    public:
+        explicit InstanceRepeatedSubgraphs(ref_ptr<ShaderSet> in_shaderSet = {});
+
+        /// ShaderSet providing the "vsg_position" instance attribute location, format and define, defaults to the PBR ShaderSet
+        ref_ptr<ShaderSet> shaderSet;
+
+        /// minimum number of transforms sharing a subgraph before they are replaced by instanced draws
+        uint32_t minimumInstances = 4;
+
+        /// maximum number of instances in each instanced draw
+        uint32_t maxInstancesPerBatch = 1024;
+
+        /// statistics of the draws replaced
+        uint32_t numDrawsReplaced = 0;
+        uint32_t numInstancedDraws = 0;
+
+        /// fraction of the replaced draws that have been removed
+        double drawCallReduction() const { return numDrawsReplaced > 0 ? 1.0 - static_cast<double>(numInstancedDraws) / static_cast<double>(numDrawsReplaced) : 0.0; }
+
+        void apply(Object& object) override;
+        void apply(Group& group) override;
+
+    protected:
+        struct Prototype
+        {
+            ref_ptr<StateGroup> stateGroup;
+            ref_ptr<BindGraphicsPipeline> bindInstancedPipeline;
+            dsphere bound;
+            explicit operator bool() const noexcept { return bindInstancedPipeline.valid(); }
+        };
+
+        using Instances = std::vector<ref_ptr<MatrixTransform>>;
+
+        const Prototype& prototype(Node* node);
+        ref_ptr<GraphicsPipeline> instancedPipeline(GraphicsPipeline* pipeline);
+        ref_ptr<Node> createInstancedDraw(const Prototype& prototype, const std::vector<vec3>& positions);
+        void instance(Group& group, const Prototype& prototype, const dmat4& linear, const Instances& instances);
+
+        std::set<Group*> _visited;
+        std::map<Node*, Prototype> _prototypes;
+        std::map<GraphicsPipeline*, ref_ptr<GraphicsPipeline>> _instancedPipelines;
+    };
+    VSG_type_name(vsg::InstanceRepeatedSubgraphs);
+
+} // namespace vsg
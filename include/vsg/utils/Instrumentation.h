@@ -68,6 +68,9 @@ namespace vsg
         virtual void enter(const SourceLocation* /*sl*/, uint64_t& /*reference*/, CommandBuffer& /*commandBuffer*/, const Object* /*object*/ = nullptr) const {};
         virtual void leave(const SourceLocation* /*sl*/, uint64_t& /*reference*/, CommandBuffer& /*commandBuffer*/, const Object* /*object*/ = nullptr) const {};
 
+        /// report a named value, such as a cache hit ratio, for plotting over time.
+        virtual void plot(const char* /*name*/, double /*value*/) const {};
+
         virtual void finish() const {};
 
     protected:
@@ -38,6 +38,7 @@ namespace vsg
         void apply(const PagedLOD& plod) override;
         void apply(const CullNode& cn) override;
         void apply(const CullGroup& cn) override;
+        void apply(const SpatialGroup& sg) override;
         void apply(const DepthSorted& cn) override;
 
         void apply(const VertexDraw& vid) override;
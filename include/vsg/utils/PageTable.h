@@ -0,0 +1,108 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2025 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+
+#include <vsg/core/Inherit.h>
+
+#include <map>
+#include <vector>
+
+namespace vsg
+{
+
+    /// PageTable maps the (level, x, y) keys of tiles onto the pages of a fixed size physical page cache, using least recently used replacement.
+    /// Pages below numReservedPages are never assigned so page 0 can be used for fallback content and as the end marker of the internal lists.
+    /// PageTable only does the bookkeeping, it has no GPU dependencies and is not thread safe, callers that share it across threads must serialize access.
+    class VSG_DECLSPEC PageTable : public Inherit<Object, PageTable>
+    {
+    public:
+        explicit PageTable(uint32_t in_numPages = 256, uint32_t in_numReservedPages = 1);
+
+        struct Key
+        {
+            uint32_t level = 0;
+            uint32_t x = 0;
+            uint32_t y = 0;
+
+            bool operator<(const Key& rhs) const
+            {
+                if (level != rhs.level) return level < rhs.level;
+                if (y != rhs.y) return y < rhs.y;
+                return x < rhs.x;
+            }
+            bool operator==(const Key& rhs) const { return level == rhs.level && x == rhs.x && y == rhs.y; }
+            bool operator!=(const Key& rhs) const { return !(*this == rhs); }
+        };
+
+        /// number of frames that a page must go unused before it may be replaced, should be no less than the number of frames in flight.
+        uint64_t retainFrames = 3;
+
+        /// return the page assigned to key, or 0 if key isn't resident.
+        uint32_t find(const Key& key) const;
+
+        /// return the page assigned to key and mark it as used in frameCount, or 0 if key isn't resident.
+        uint32_t touch(const Key& key, uint64_t frameCount);
+
+        /// assign a page to key, replacing the least recently used page if no free pages are available.
+        /// Returns the page, and true if the page was newly assigned so its contents need to be loaded.
+        /// Returns {0, false} if every page has been used within the last retainFrames frames.
+        std::pair<uint32_t, bool> acquire(const Key& key, uint64_t frameCount);
+
+        /// release the page assigned to key, making it the first to be reused.
+        void release(const Key& key);
+
+        /// release all pages.
+        void clear();
+
+        /// return true if page is assigned, setting key to the key assigned to it.
+        bool assigned(uint32_t page, Key& key) const;
+
+        uint32_t numPages() const { return static_cast<uint32_t>(_pages.size()); }
+        uint32_t numReservedPages() const { return _numReservedPages; }
+        uint32_t numResidentPages() const { return static_cast<uint32_t>(_keyToPage.size()); }
+
+        /// stats
+        uint64_t numHits = 0;
+        uint64_t numMisses = 0;
+        uint64_t numEvictions = 0;
+        uint64_t numFailures = 0;
+
+        /// check the consistency of the internal lists, returns false if they are corrupt.
+        bool check() const;
+
+    protected:
+        struct Page
+        {
+            uint32_t previous = 0;
+            uint32_t next = 0;
+            bool assigned = false;
+            uint64_t frameLastUsed = 0;
+            Key key;
+        };
+
+        void _unlink(uint32_t page);
+        void _pushFront(uint32_t page);
+        void _pushBack(uint32_t page);
+
+        uint32_t _numReservedPages = 1;
+        std::vector<Page> _pages;
+        std::map<Key, uint32_t> _keyToPage;
+
+        // least recently used at the head, most recently used at the tail.
+        uint32_t _head = 0;
+        uint32_t _tail = 0;
+    };
+    VSG_type_name(vsg::PageTable);
+
+} // namespace vsg
@@ -0,0 +1,96 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2025 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/utils/ComputeBounds.h>
+
+namespace vsg
+{
+
+    // forward declare
+    class SpatialGroup;
+    class Transform;
+    class CollectRefitBounds;
+
+    /// RefitBounds incrementally updates the bounding spheres of the CullGroup, CullNode and LOD nodes in a scene graph as the transforms and vertex data beneath them change,
+    /// avoiding the need to recompute the bounds of the whole scene graph with ComputeBounds each time objects move.
+    /// build() records the bound nodes along with the transforms and vertex arrays that each bound depends upon. Each frame refit() then recomputes just the bounds
+    /// whose transforms have changed, whose arrays' ModifiedCount has changed or that have been marked with dirty(), working bottom-up so that enclosing bounds are only refit
+    /// when a nested bound changes. Nested bounds are refit in parallel when operationThreads is assigned.
+    /// Call build() again after adding or removing nodes. The subgraphs of PagedLOD nodes aren't tracked as the PagedLOD bound is provided by the database.
+    /// refit() modifies the bounds in place so should be called during the update phase of the frame, before the RecordTraversal.
+    class VSG_DECLSPEC RefitBounds : public Inherit<Object, RefitBounds>
+    {
+    public:
+        RefitBounds();
+
+        /// optional cache of vertex array bounds, shared by the ComputeBounds traversals used to refit each bound.
+        ref_ptr<BoundsCache> boundsCache;
+
+        /// optional threads used to refit the dirty bounds at each depth in parallel, when there are at least minimumParallelBounds of them.
+        ref_ptr<OperationThreads> operationThreads;
+        uint32_t minimumParallelBounds = 16;
+
+        /// record the bound nodes in the subgraph and the transforms and arrays they depend upon, replacing any previously built state.
+        void build(ref_ptr<Node> node);
+
+        /// mark the bounds that depend upon object, a bound node, transform or array, as requiring a refit.
+        /// Use for changes that refit() can't detect, such as modifying the children of a Switch or the contents of a Text.
+        void dirty(const Object* object);
+
+        /// refit the bounds affected by changes since the previous call, returning the number of bounds recomputed.
+        uint32_t refit();
+
+        /// return the number of bounds tracked.
+        size_t size() const { return _bounds.size(); }
+
+    protected:
+        virtual ~RefitBounds();
+
+        struct TransformDependency
+        {
+            ref_ptr<const Transform> transform;
+            const dmat4* matrix = nullptr; // MatrixTransform::matrix, compared directly rather than via Transform::transform()
+            dmat4 previous;
+        };
+
+        struct ArrayDependency
+        {
+            ref_ptr<const Data> data;
+            ModifiedCount previous;
+        };
+
+        struct Bound
+        {
+            ref_ptr<Node> node;
+            dsphere* bound = nullptr;
+            int32_t parent = -1;
+            ref_ptr<SpatialGroup> spatialGroup; // parent SpatialGroup whose octree holds node's bound
+            ref_ptr<ArrayState> arrayState;     // ArrayState inherited from above node
+            std::vector<TransformDependency> transforms;
+            std::vector<ArrayDependency> arrays;
+            bool dirty = false;
+        };
+
+        std::vector<Bound> _bounds;
+        std::vector<std::vector<uint32_t>> _levels;
+        std::map<const Object*, std::vector<uint32_t>> _dependents;
+
+        bool _changed(Bound& bound);
+        dsphere _compute(const Bound& bound) const;
+
+        friend CollectRefitBounds;
+    };
+    VSG_type_name(vsg::RefitBounds);
+
+} // namespace vsg
@@ -38,6 +38,11 @@ namespace vsg
         Mask overrideMask = MASK_OFF;
         ViewDependentState* viewDependentState = nullptr;
 
+        /// render pass, subpass and subpass contents of the active render pass instance, assigned by RenderGraph and NextSubPass, used when recording secondary CommandBuffer that continue the render pass.
+        VkRenderPass renderPass = VK_NULL_HANDLE;
+        uint32_t subpass = 0;
+        VkSubpassContents subpassContents = VK_SUBPASS_CONTENTS_INLINE;
+
         VkCommandBufferLevel level() const { return _level; }
 
         /// reset the CommandBuffer for the new frame.
@@ -49,17 +54,20 @@ namespace vsg
         CommandPool* getCommandPool() { return _commandPool; }
         const CommandPool* getCommandPool() const { return _commandPool; }
 
-        void setCurrentPipelineLayout(const PipelineLayout* pipelineLayout)
+        /// set the current pipeline layout, transformIndexing signals that the pipeline's shaders read the modelview matrix from the ViewDependentState::transformData using an index push constant.
+        void setCurrentPipelineLayout(const PipelineLayout* pipelineLayout, bool transformIndexing = false)
         {
             _currentPipelineLayout = pipelineLayout->vk(deviceID);
             if (pipelineLayout->pushConstantRanges.empty())
                 _currentPushConstantStageFlags = 0;
             else
                 _currentPushConstantStageFlags = pipelineLayout->pushConstantRanges.front().stageFlags;
+            _currentTransformIndexing = transformIndexing;
         }
 
         VkPipelineLayout getCurrentPipelineLayout() const { return _currentPipelineLayout; }
         VkShaderStageFlags getCurrentPushConstantStageFlags() const { return _currentPushConstantStageFlags; }
+        bool getCurrentTransformIndexing() const { return _currentTransformIndexing; }
 
         ref_ptr<ScratchMemory> scratchMemory;
 
@@ -77,6 +85,7 @@ namespace vsg
         ref_ptr<CommandPool> _commandPool;
         VkPipelineLayout _currentPipelineLayout;
         VkShaderStageFlags _currentPushConstantStageFlags;
+        bool _currentTransformIndexing = false;
     };
     VSG_type_name(vsg::CommandBuffer);
 
@@ -23,6 +23,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/state/BufferInfo.h>
 #include <vsg/state/GraphicsPipeline.h>
 #include <vsg/state/ImageInfo.h>
+#include <vsg/state/PipelineScheduler.h>
 #include <vsg/utils/Instrumentation.h>
 #include <vsg/utils/ShaderCompiler.h>
 #include <vsg/vk/CommandPool.h>
@@ -113,6 +114,9 @@ namespace vsg
         // the scene graph .
         GraphicsPipelineStates overridePipelineStates;
 
+        /// optional scheduler used to create GraphicsPipeline in the background, shared between Context so pipelines are deduplicated.
+        ref_ptr<PipelineScheduler> pipelineScheduler;
+
         // DescriptorPool
         std::list<ref_ptr<DescriptorPool>> descriptorPools;
 
@@ -14,6 +14,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 #include <vsg/vk/DeviceExtensions.h>
 #include <vsg/vk/DeviceFeatures.h>
+#include <vsg/vk/MemoryBudget.h>
 #include <vsg/vk/Queue.h>
 
 #include <list>
@@ -82,6 +83,9 @@ namespace vsg
         /// return true if Device was created with specified extension
         bool supportsDeviceExtension(const char* extensionName) const;
 
+        /// per heap budget, usage and memory pressure, uses VK_EXT_memory_budget when the extension is enabled.
+        ref_ptr<MemoryBudget> memoryBudget;
+
     protected:
         virtual ~Device();
 
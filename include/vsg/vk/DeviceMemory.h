@@ -41,6 +41,7 @@ namespace vsg
 
         const VkMemoryRequirements& getMemoryRequirements() const { return _memoryRequirements; }
         const VkMemoryPropertyFlags& getMemoryPropertyFlags() const { return _properties; }
+        uint32_t getMemoryTypeIndex() const { return _memoryTypeIndex; }
 
         MemorySlots::OptionalOffset reserve(VkDeviceSize size);
         void release(VkDeviceSize offset, VkDeviceSize size);
@@ -50,6 +51,9 @@ namespace vsg
         size_t totalAvailableSize() const;
         size_t totalReservedSize() const;
 
+        /// return a copy of the MemorySlots used to track the reserved and available regions of the DeviceMemory.
+        MemorySlots getMemorySlots() const;
+
         Device* getDevice() { return _device; }
         const Device* getDevice() const { return _device; }
 
@@ -59,6 +63,7 @@ namespace vsg
         VkDeviceMemory _deviceMemory;
         VkMemoryRequirements _memoryRequirements;
         VkMemoryPropertyFlags _properties;
+        uint32_t _memoryTypeIndex = 0;
         ref_ptr<Device> _device;
 
         mutable std::mutex _mutex;
@@ -0,0 +1,149 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2025 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+
+#include <vsg/core/Inherit.h>
+#include <vsg/vk/vulkan.h>
+
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+namespace vsg
+{
+
+    // forward declare
+    class PhysicalDevice;
+
+    /// Level of memory pressure on a memory heap, published by MemoryBudget so that consumers can reduce their usage before allocations fail.
+    enum MemoryPressure : uint32_t
+    {
+        MEMORY_PRESSURE_NONE = 0,
+        MEMORY_PRESSURE_LOW = 1,
+        MEMORY_PRESSURE_HIGH = 2,
+        MEMORY_PRESSURE_CRITICAL = 3
+    };
+
+    /// fraction of their normal memory target that consumers such as DatabasePager and TextureStreaming should aim for at the specified pressure.
+    inline double memoryPressureRatio(MemoryPressure pressure)
+    {
+        switch (pressure)
+        {
+        case (MEMORY_PRESSURE_HIGH): return 0.75;
+        case (MEMORY_PRESSURE_CRITICAL): return 0.5;
+        default: return 1.0;
+        }
+    }
+
+    /// MemoryBudget tracks the budget and usage of each memory heap of a Device.
+    /// When VK_EXT_memory_budget is enabled the budget and usage reported by the driver are used, with the allocations made since the last update() added on.
+    /// Otherwise the budget is a fraction of each heap's size and usage is the total of the DeviceMemory allocated through the Device.
+    /// Usage relative to budget is converted to a MemoryPressure level, and changes in level are passed to any registered callbacks.
+    /// The budget and usage can be assigned directly so the accounting and pressure logic can be driven without a GPU.
+    class VSG_DECLSPEC MemoryBudget : public Inherit<Object, MemoryBudget>
+    {
+    public:
+        MemoryBudget();
+        explicit MemoryBudget(PhysicalDevice* in_physicalDevice, bool in_useMemoryBudgetExtension = false);
+
+        struct Heap
+        {
+            VkDeviceSize size = 0;
+            VkMemoryHeapFlags flags = 0;
+            VkDeviceSize budget = 0;
+            VkDeviceSize usage = 0;
+
+            /// bytes allocated through DeviceMemory, and number of allocations.
+            VkDeviceSize allocated = 0;
+            uint64_t numAllocations = 0;
+
+            MemoryPressure pressure = MEMORY_PRESSURE_NONE;
+
+            double utilization() const { return budget > 0 ? static_cast<double>(usage) / static_cast<double>(budget) : 0.0; }
+        };
+
+        /// fraction of each heap's size used as its budget when VK_EXT_memory_budget isn't available.
+        double defaultBudgetRatio = 0.8;
+
+        /// utilization of budget at which each pressure level is entered.
+        double lowThreshold = 0.7;
+        double highThreshold = 0.85;
+        double criticalThreshold = 0.95;
+
+        /// set up the heaps and the memory types that map onto them.
+        void assignHeaps(const std::vector<Heap>& in_heaps, const std::vector<VkMemoryType>& in_memoryTypes);
+
+        /// return the index of the first memory type matching the typeBits and properties, or ~0u if none match.
+        uint32_t memoryTypeIndex(uint32_t typeBits, VkMemoryPropertyFlags properties) const;
+
+        uint32_t heapIndex(uint32_t memoryTypeIndex) const;
+
+        /// record allocation/release of DeviceMemory, called by DeviceMemory.
+        void allocated(uint32_t memoryTypeIndex, VkDeviceSize size);
+        void released(uint32_t memoryTypeIndex, VkDeviceSize size);
+
+        /// return true if allocating size bytes from the memory type's heap would keep usage within budget.
+        bool available(uint32_t memoryTypeIndex, VkDeviceSize size) const;
+
+        /// refresh the budget and usage from VK_EXT_memory_budget when enabled, then update the pressure levels.
+        void update();
+
+        /// assign the budget and usage of each heap, as reported by VK_EXT_memory_budget or a mock, then update the pressure levels.
+        void update(const std::vector<VkDeviceSize>& budgets, const std::vector<VkDeviceSize>& usages);
+
+        /// highest pressure level of all the heaps.
+        MemoryPressure pressure() const { return _pressure.load(); }
+
+        MemoryPressure pressure(uint32_t heapIndex) const;
+
+        /// return a copy of the per heap statistics.
+        std::vector<Heap> getHeaps() const;
+
+        /// callback invoked when a heap's pressure level changes, such as to prune vsg::SharedObjects or reduce paging.
+        /// Callbacks may be invoked from any thread that allocates DeviceMemory.
+        using PressureCallback = std::function<void(MemoryBudget& memoryBudget, uint32_t heapIndex, MemoryPressure previous, MemoryPressure current)>;
+        void addPressureCallback(PressureCallback callback);
+
+        bool useMemoryBudgetExtension() const { return _useMemoryBudgetExtension; }
+
+    protected:
+        virtual ~MemoryBudget();
+
+        struct Change
+        {
+            uint32_t heapIndex;
+            MemoryPressure previous;
+            MemoryPressure current;
+        };
+        using Changes = std::vector<Change>;
+
+        MemoryPressure _computePressure(const Heap& heap) const;
+        void _updatePressure(Changes& changes);
+        void _invokeCallbacks(const Changes& changes);
+
+        ref_ptr<PhysicalDevice> _physicalDevice;
+        bool _useMemoryBudgetExtension = false;
+
+        mutable std::mutex _mutex;
+        std::vector<Heap> _heaps;
+        std::vector<VkMemoryType> _memoryTypes;
+        std::atomic<MemoryPressure> _pressure{MEMORY_PRESSURE_NONE};
+
+        std::mutex _callbacksMutex;
+        std::vector<PressureCallback> _callbacks;
+    };
+    VSG_type_name(vsg::MemoryBudget);
+
+} // namespace vsg
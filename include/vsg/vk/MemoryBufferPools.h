@@ -24,6 +24,8 @@ namespace vsg
 
     /// MemoryBufferPools manages a pool of vsg::DeviceMemory and vsg::Buffer that use them.
     /// Methods are provided for getting Buffer from the pool, sharing memory to make better use of device memory.
+    /// Fragmentation is limited by packing new reservations into the fullest blocks and releasing blocks once they are empty,
+    /// reservations are never relocated so live allocations aren't defragmented.
     class VSG_DECLSPEC MemoryBufferPools : public Inherit<Object, MemoryBufferPools>
     {
     public:
@@ -39,12 +41,44 @@ namespace vsg
         VkDeviceSize computeBufferTotalAvailable() const;
         VkDeviceSize computeBufferTotalReserved() const;
 
+        struct FragmentationStats
+        {
+            size_t numBlocks = 0;
+            size_t numEmptyBlocks = 0;
+            size_t numAvailableSlots = 0;
+            VkDeviceSize totalSize = 0;
+            VkDeviceSize totalReserved = 0;
+            VkDeviceSize totalAvailable = 0;
+            VkDeviceSize largestAvailable = 0;
+
+            /// fraction of the available space not in the largest available slot, 0.0 when the available space is contiguous.
+            double fragmentation() const { return totalAvailable > 0 ? 1.0 - static_cast<double>(largestAvailable) / static_cast<double>(totalAvailable) : 0.0; }
+
+            /// fraction of the allocated blocks that is reserved.
+            double utilization() const { return totalSize > 0 ? static_cast<double>(totalReserved) / static_cast<double>(totalSize) : 1.0; }
+        };
+
+        FragmentationStats computeMemoryFragmentationStats() const;
+        FragmentationStats computeBufferFragmentationStats() const;
+
+        /// return snapshots of the MemorySlots of the pooled DeviceMemory, for analysing fragmentation or recording allocation traces.
+        std::vector<MemorySlots> getMemorySlots() const;
+
+        /// return snapshots of the MemorySlots of the pooled Buffer with matching usage, for analysing fragmentation or recording allocation traces.
+        std::vector<MemorySlots> getBufferMemorySlots(VkBufferUsageFlags bufferUsageFlags) const;
+
+        /// release pooled Buffer and DeviceMemory that no longer have any reservations and aren't referenced outside the pools.
+        /// Returns the number of bytes of DeviceMemory released.
+        VkDeviceSize releaseUnusedMemory();
+
         ref_ptr<BufferInfo> reserveBuffer(VkDeviceSize totalSize, VkDeviceSize alignment, VkBufferUsageFlags bufferUsageFlags, VkSharingMode sharingMode, VkMemoryPropertyFlags memoryProperties);
 
         using DeviceMemoryOffset = std::pair<ref_ptr<DeviceMemory>, VkDeviceSize>;
         DeviceMemoryOffset reserveMemory(VkMemoryRequirements memRequirements, VkMemoryPropertyFlags memoryProperties, void* pNextAllocInfo = nullptr);
 
     protected:
+        VkDeviceSize _releaseUnusedMemory();
+
         mutable std::mutex _mutex;
 
         // transfer data settings
@@ -72,6 +72,9 @@ namespace vsg
             return properties;
         }
 
+        /// return the memory properties, filling in any structures chained to pNext, such as VkPhysicalDeviceMemoryBudgetPropertiesEXT, when vkGetPhysicalDeviceMemoryProperties2 is available.
+        VkPhysicalDeviceMemoryProperties getMemoryProperties(void* pNext = nullptr) const;
+
         /// Call vkEnumerateDeviceExtensionProperties to enumerate extension properties.
         ExtensionProperties enumerateDeviceExtensionProperties(const char* pLayerName = nullptr);
 
@@ -94,6 +97,7 @@ namespace vsg
 
         PFN_vkGetPhysicalDeviceFeatures2 _vkGetPhysicalDeviceFeatures2 = nullptr;
         PFN_vkGetPhysicalDeviceProperties2 _vkGetPhysicalDeviceProperties2 = nullptr;
+        PFN_vkGetPhysicalDeviceMemoryProperties2 _vkGetPhysicalDeviceMemoryProperties2 = nullptr;
 
         vsg::observer_ptr<Instance> _instance;
     };
@@ -12,14 +12,17 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 </editor-fold> */
 
+#include <vsg/core/Array.h>
 #include <vsg/maths/plane.h>
 #include <vsg/maths/transform.h>
 #include <vsg/nodes/MatrixTransform.h>
 #include <vsg/state/PushConstants.h>
 #include <vsg/vk/CommandBuffer.h>
 
+#include <algorithm>
 #include <array>
 #include <map>
+#include <mutex>
 #include <stack>
 
 namespace vsg
@@ -71,6 +74,112 @@ namespace vsg
         }
     };
 
+    /// ReservedTransforms manages the entries at the start of ViewDependentState::transformData that are reserved by CachedCommandGroup recordings,
+    /// so the transform indices recorded into their secondary CommandBuffer remain valid in later frames. The entries assigned each frame follow the reserved entries.
+    class ReservedTransforms : public Inherit<Object, ReservedTransforms>
+    {
+    public:
+        /// number of entries reserved at the start of transformData.
+        uint32_t count = 0;
+
+        /// reserve an entry, returns ~0u if none are available, in which case the shortfall is reserved by the next call to update().
+        uint32_t reserve()
+        {
+            std::scoped_lock<std::mutex> lock(_mutex);
+            if (_available.empty())
+            {
+                ++_shortfall;
+                return ~0u;
+            }
+
+            uint32_t index = _available.back();
+            _available.pop_back();
+            return index;
+        }
+
+        /// return entries to be reused by later reserve() calls.
+        void release(const std::vector<uint32_t>& indices)
+        {
+            std::scoped_lock<std::mutex> lock(_mutex);
+            _available.insert(_available.end(), indices.begin(), indices.end());
+        }
+
+        /// reserve further entries to cover the shortfall of previous reserve() calls, up to maxCount entries in total, called by RecordTraversal at the start of each View.
+        void update(uint32_t maxCount)
+        {
+            std::scoped_lock<std::mutex> lock(_mutex);
+            for (; _shortfall > 0 && count < maxCount; --_shortfall) _available.push_back(count++);
+            _shortfall = 0;
+        }
+
+    protected:
+        std::mutex _mutex;
+        std::vector<uint32_t> _available;
+        uint32_t _shortfall = 0;
+    };
+    VSG_type_name(vsg::ReservedTransforms);
+
+    /// TransformSlots holds the transformData entries reserved while recording a CachedCommandGroup along with their matrices relative to the modelview matrix
+    /// on entry to the CachedCommandGroup, so the entries can be refilled for the current modelview matrix each frame the recording is replayed.
+    struct TransformSlots
+    {
+        TransformSlots() = default;
+        TransformSlots(const TransformSlots&) = delete;
+        TransformSlots& operator=(const TransformSlots&) = delete;
+        ~TransformSlots() { release(); }
+
+        ref_ptr<ReservedTransforms> reservedTransforms;
+        dmat4 inverseOrigin;
+        std::vector<uint32_t> indices;
+        std::vector<dmat4> localMatrices;
+
+        /// false if an entry couldn't be reserved so the recording holds per frame indices and can't be replayed.
+        bool complete = true;
+
+        /// true if matrices were pushed directly, for pipelines that don't use transform indexing, so the recording depends upon the modelview matrix.
+        bool matricesPushed = false;
+
+        void begin(ref_ptr<ReservedTransforms> in_reservedTransforms, const dmat4& origin)
+        {
+            release();
+            reservedTransforms = in_reservedTransforms;
+            inverseOrigin = inverse(origin);
+            complete = true;
+            matricesPushed = false;
+        }
+
+        void release()
+        {
+            if (reservedTransforms && !indices.empty()) reservedTransforms->release(indices);
+            indices.clear();
+            localMatrices.clear();
+        }
+
+        /// reserve an entry for matrix, returns ~0u if none are available.
+        uint32_t add(const dmat4& matrix)
+        {
+            uint32_t index = reservedTransforms->reserve();
+            if (index == ~0u)
+            {
+                complete = false;
+                return index;
+            }
+
+            indices.push_back(index);
+            localMatrices.push_back(inverseOrigin * matrix);
+            return index;
+        }
+
+        /// fill in the reserved entries of transformData for the modelview matrix on entry to the CachedCommandGroup.
+        void fill(mat4Array& transformData, const dmat4& origin) const
+        {
+            for (size_t i = 0; i < indices.size(); ++i)
+            {
+                transformData[indices[i]] = mat4(origin * localMatrices[i]);
+            }
+        }
+    };
+
     /// MatrixStack used internally by vsg::State to manage stack of projection or modelview matrices
     class MatrixStack
     {
@@ -89,6 +198,18 @@ namespace vsg
         uint32_t offset = 0;
         bool dirty = false;
 
+        /// when assigned, matrices for pipelines that use transform indexing are appended to transformData and their index pushed in place of the matrix.
+        ref_ptr<mat4Array> transformData;
+        uint32_t transformBase = 0;
+        uint32_t transformCount = 0;
+        bool transformIndexing = false;
+
+        /// entries at the start of transformData reserved by CachedCommandGroup recordings, the per frame entries start at transformBase.
+        ref_ptr<ReservedTransforms> reservedTransforms;
+
+        /// when assigned, transform indices are taken from the entries reserved for the CachedCommandGroup being recorded rather than the per frame entries.
+        TransformSlots* transformSlots = nullptr;
+
         inline void set(const mat4& matrix)
         {
             matrixStack = {};
@@ -146,9 +267,26 @@ namespace vsg
                     return;
                 }
 
-                // make sure matrix is a float matrix.
-                mat4 newmatrix(matrixStack.top());
-                vkCmdPushConstants(commandBuffer, pipeline, stageFlags, offset, sizeof(newmatrix), newmatrix.data());
+                transformIndexing = transformData && commandBuffer.getCurrentTransformIndexing();
+                if (transformIndexing)
+                {
+                    uint32_t index = transformSlots ? transformSlots->add(matrixStack.top()) : ~0u;
+                    if (index == ~0u)
+                    {
+                        // if transformData is full reuse the last entry, transformCount still records the number required.
+                        index = std::min(transformBase + transformCount++, static_cast<uint32_t>(transformData->size()) - 1);
+                    }
+                    transformData->at(index) = mat4(matrixStack.top());
+                    vkCmdPushConstants(commandBuffer, pipeline, stageFlags, offset, sizeof(index), &index);
+                }
+                else
+                {
+                    if (transformSlots) transformSlots->matricesPushed = true;
+
+                    // make sure matrix is a float matrix.
+                    mat4 newmatrix(matrixStack.top());
+                    vkCmdPushConstants(commandBuffer, pipeline, stageFlags, offset, sizeof(newmatrix), newmatrix.data());
+                }
                 dirty = false;
             }
         }
@@ -250,6 +388,22 @@ namespace vsg
         dmat4 inheritedViewMatrix;
         dmat4 inheritedViewTransform;
 
+        /// ratio of bounding sphere radius to lodDistance below which CullNode, CullGroup and LOD subgraphs are culled as too small to be seen,
+        /// set by RecordTraversal from View::smallFeatureCullingPixelSize, 0.0 disables small feature culling.
+        double smallFeatureRatio = 0.0;
+
+        /// set to false by RecordTraversal while recording a CachedCommandGroup that is replayed independently of the camera, disabling view frustum and small feature culling.
+        bool frustumCulling = true;
+
+        /// hysteresis band applied to LOD and PagedLOD child selection, set by RecordTraversal from View::lodHysteresis.
+        double lodHysteresis = 0.0;
+
+        /// set by RecordTraversal when View::cameraRelative is enabled, CoordinateFrame nodes directly below the view matrix use
+        /// eyePosition and viewRotation, the view matrix with its translation removed, to compute their modelview matrix.
+        bool cameraRelative = false;
+        dvec3 eyePosition;
+        dmat4 viewRotation;
+
         StateStacks stateStacks;
 
         MatrixStack projectionMatrixStack{0};
@@ -283,6 +437,19 @@ namespace vsg
             pushFrustum();
         }
 
+        /// mark all the state and matrices as dirty so they are recorded again, required when switching to a new CommandBuffer or after vkCmdExecuteCommands.
+        inline void dirtyStateStacks()
+        {
+            for (auto& stateStack : stateStacks)
+            {
+                stateStack.dirty = stateStack.size() > 0;
+            }
+
+            projectionMatrixStack.dirty = true;
+            modelviewMatrixStack.dirty = true;
+            dirty = true;
+        }
+
         inline void record()
         {
             if (dirty)
@@ -292,6 +459,12 @@ namespace vsg
                     stateStack.record(*_commandBuffer);
                 }
 
+                // switching between pipelines that take a matrix or a transform index requires the modelview to be pushed again
+                if (modelviewMatrixStack.transformData && modelviewMatrixStack.transformIndexing != _commandBuffer->getCurrentTransformIndexing())
+                {
+                    modelviewMatrixStack.dirty = true;
+                }
+
                 projectionMatrixStack.record(*_commandBuffer);
                 modelviewMatrixStack.record(*_commandBuffer);
 
@@ -322,18 +495,28 @@ namespace vsg
         template<typename T>
         bool intersect(const t_sphere<T>& s) const
         {
-            return _frustumStack.top().intersect(s);
+            return !frustumCulling || _frustumStack.top().intersect(s);
         }
 
         template<typename T>
         T lodDistance(const t_sphere<T>& s) const
         {
             const auto& frustum = _frustumStack.top();
-            if (!frustum.intersect(s)) return -1.0;
+            if (frustumCulling && !frustum.intersect(s)) return -1.0;
 
             const auto& lodScale = frustum.lodScale;
             return std::abs(lodScale[0] * s.x + lodScale[1] * s.y + lodScale[2] * s.z + lodScale[3]);
         }
+
+        /// return true if the sphere's projected size is below the small feature culling threshold.
+        template<typename T>
+        bool smallFeature(const t_sphere<T>& s) const
+        {
+            if (smallFeatureRatio <= 0.0 || !frustumCulling) return false;
+
+            const auto& lodScale = _frustumStack.top().lodScale;
+            return s.radius < std::abs(lodScale[0] * s.x + lodScale[1] * s.y + lodScale[2] * s.z + lodScale[3]) * smallFeatureRatio;
+        }
     };
 
 } // namespace vsg
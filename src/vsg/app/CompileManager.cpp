@@ -166,6 +166,17 @@ void CompileManager::assignInstrumentation(ref_ptr<Instrumentation> in_instrumen
     }
 }
 
+void CompileManager::assignPipelineScheduler(ref_ptr<PipelineScheduler> in_pipelineScheduler)
+{
+    auto cts = takeCompileTraversals(numCompileTraversals);
+    for (auto& ct : cts)
+    {
+        ct->assignPipelineScheduler(in_pipelineScheduler);
+
+        compileTraversals->add(ct);
+    }
+}
+
 CompileResult CompileManager::compile(ref_ptr<Object> object, ContextSelectionFunction contextSelection)
 {
     CollectResourceRequirements collectRequirements;
@@ -31,7 +31,8 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 using namespace vsg;
 
 CompileTraversal::CompileTraversal(const CompileTraversal& ct) :
-    Inherit(ct)
+    Inherit(ct),
+    pipelineScheduler(ct.pipelineScheduler)
 {
     for (auto& context : ct.contexts)
     {
@@ -66,6 +67,7 @@ void CompileTraversal::add(ref_ptr<Device> device, const ResourceRequirements& r
     auto queueFamily = device->getPhysicalDevice()->getQueueFamily(queueFlags);
     auto context = Context::create(device, resourceRequirements);
     context->instrumentation = instrumentation;
+    context->pipelineScheduler = pipelineScheduler;
     context->commandPool = CommandPool::create(device, queueFamily, VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT);
     context->graphicsQueue = device->getQueue(queueFamily, queueFamilyIndex);
     contexts.push_back(context);
@@ -78,6 +80,7 @@ void CompileTraversal::add(Window& window, ref_ptr<ViewportState> viewport, cons
     auto queueFamily = device->getPhysicalDevice()->getQueueFamily(queueFlags);
     auto context = Context::create(device, resourceRequirements);
     context->instrumentation = instrumentation;
+    context->pipelineScheduler = pipelineScheduler;
     context->renderPass = renderPass;
     context->commandPool = CommandPool::create(device, queueFamily, VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT);
     context->graphicsQueue = device->getQueue(queueFamily, queueFamilyIndex);
@@ -99,6 +102,7 @@ void CompileTraversal::add(Window& window, ref_ptr<View> view, const ResourceReq
     auto queueFamily = device->getPhysicalDevice()->getQueueFamily(queueFlags);
     auto context = Context::create(device, resourceRequirements);
     context->instrumentation = instrumentation;
+    context->pipelineScheduler = pipelineScheduler;
     context->renderPass = renderPass;
     context->commandPool = vsg::CommandPool::create(device, queueFamily, VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT);
     context->graphicsQueue = device->getQueue(queueFamily, queueFamilyIndex);
@@ -128,6 +132,7 @@ void CompileTraversal::add(Framebuffer& framebuffer, ref_ptr<View> view, const R
     auto queueFamily = device->getPhysicalDevice()->getQueueFamily(VK_QUEUE_GRAPHICS_BIT);
     auto context = Context::create(device, resourceRequirements);
     context->instrumentation = instrumentation;
+    context->pipelineScheduler = pipelineScheduler;
     context->renderPass = renderPass;
     context->commandPool = vsg::CommandPool::create(device, queueFamily, VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT);
     context->graphicsQueue = device->getQueue(queueFamily, queueFamilyIndex);
@@ -225,6 +230,15 @@ void CompileTraversal::assignInstrumentation(ref_ptr<Instrumentation> in_instrum
     }
 }
 
+void CompileTraversal::assignPipelineScheduler(ref_ptr<PipelineScheduler> in_pipelineScheduler)
+{
+    pipelineScheduler = in_pipelineScheduler;
+    for (auto& context : contexts)
+    {
+        context->pipelineScheduler = pipelineScheduler;
+    }
+}
+
 void CompileTraversal::apply(Object& object)
 {
     CPU_INSTRUMENTATION_L2_NC(instrumentation, "CompileTraversal Object", COLOR_COMPILE);
@@ -62,6 +62,75 @@ dvec3 EllipsoidModel::convertLatLongAltitudeToECEF(const dvec3& lla) const
                  (N * (1 - _eccentricitySquared) + height) * sin_latitude);
 }
 
+void EllipsoidModel::convertLatLongAltitudeToECEF(const dvec3* lla, dvec3* ecef, size_t count) const
+{
+    const double radiusEquator = _radiusEquator;
+    const double eccentricitySquared = _eccentricitySquared;
+    const double polarScale = 1.0 - eccentricitySquared;
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        const double latitude = radians(lla[i][0]);
+        const double longitude = radians(lla[i][1]);
+        const double height = lla[i][2];
+
+        double sin_latitude = sin(latitude);
+        double cos_latitude = cos(latitude);
+        double N = radiusEquator / sqrt(1.0 - eccentricitySquared * sin_latitude * sin_latitude);
+        double horizontal = (N + height) * cos_latitude;
+        ecef[i].set(horizontal * cos(longitude),
+                    horizontal * sin(longitude),
+                    (N * polarScale + height) * sin_latitude);
+    }
+}
+
+void EllipsoidModel::convertLatLongGridToECEF(const double* latitudes, size_t numLatitudes, const double* longitudes, size_t numLongitudes, const double* altitudes, dvec3* ecef) const
+{
+    // longitude terms are shared by all rows, so compute them once up front
+    std::vector<double> cos_longitudes(numLongitudes);
+    std::vector<double> sin_longitudes(numLongitudes);
+    for (size_t c = 0; c < numLongitudes; ++c)
+    {
+        const double longitude = radians(longitudes[c]);
+        cos_longitudes[c] = cos(longitude);
+        sin_longitudes[c] = sin(longitude);
+    }
+
+    const double polarScale = 1.0 - _eccentricitySquared;
+    const double* cos_lon = cos_longitudes.data();
+    const double* sin_lon = sin_longitudes.data();
+
+    for (size_t r = 0; r < numLatitudes; ++r)
+    {
+        const double latitude = radians(latitudes[r]);
+        const double sin_latitude = sin(latitude);
+        const double cos_latitude = cos(latitude);
+        const double N = _radiusEquator / sqrt(1.0 - _eccentricitySquared * sin_latitude * sin_latitude);
+        const double N_polar = N * polarScale;
+
+        dvec3* row = ecef + r * numLongitudes;
+        if (altitudes)
+        {
+            const double* row_altitudes = altitudes + r * numLongitudes;
+            for (size_t c = 0; c < numLongitudes; ++c)
+            {
+                const double height = row_altitudes[c];
+                const double horizontal = (N + height) * cos_latitude;
+                row[c].set(horizontal * cos_lon[c], horizontal * sin_lon[c], (N_polar + height) * sin_latitude);
+            }
+        }
+        else
+        {
+            const double horizontal = N * cos_latitude;
+            const double vertical = N_polar * sin_latitude;
+            for (size_t c = 0; c < numLongitudes; ++c)
+            {
+                row[c].set(horizontal * cos_lon[c], horizontal * sin_lon[c], vertical);
+            }
+        }
+    }
+}
+
 dvec3 EllipsoidModel::convertECEFToLatLongAltitude(const dvec3& ecef) const
 {
     double latitude, longitude, height;
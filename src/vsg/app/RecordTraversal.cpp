@@ -16,6 +16,8 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/app/View.h>
 #include <vsg/commands/Command.h>
 #include <vsg/commands/Commands.h>
+#include <vsg/commands/ExecuteCommands.h>
+#include <vsg/commands/NextSubPass.h>
 #include <vsg/io/DatabasePager.h>
 #include <vsg/io/Logger.h>
 #include <vsg/io/Options.h>
@@ -27,6 +29,8 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/lighting/SpotLight.h>
 #include <vsg/maths/plane.h>
 #include <vsg/nodes/Bin.h>
+#include <vsg/nodes/CachedCommandGroup.h>
+#include <vsg/nodes/CoordinateFrame.h>
 #include <vsg/nodes/CullGroup.h>
 #include <vsg/nodes/CullNode.h>
 #include <vsg/nodes/DepthSorted.h>
@@ -38,7 +42,9 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/nodes/PagedLOD.h>
 #include <vsg/nodes/QuadGroup.h>
 #include <vsg/nodes/RegionOfInterest.h>
+#include <vsg/nodes/SpatialGroup.h>
 #include <vsg/nodes/StateGroup.h>
+#include <vsg/nodes/StreamedTextureGroup.h>
 #include <vsg/nodes/Switch.h>
 #include <vsg/nodes/TileDatabase.h>
 #include <vsg/nodes/VertexDraw.h>
@@ -151,6 +157,9 @@ void RecordTraversal::apply(const LOD& lod)
 {
     GPU_INSTRUMENTATION_L2_NCO(instrumentation, *getCommandBuffer(), "LOD", COLOR_RECORD_L2, &lod);
 
+    // child selection depends upon the distance to the camera
+    if (_cachedCommandDependencies) _cachedCommandDependencies->viewDependent = true;
+
     const auto& sphere = lod.bound;
 
     // check if lod bounding sphere is in view frustum.
@@ -160,6 +169,37 @@ void RecordTraversal::apply(const LOD& lod)
         return;
     }
 
+    // check if lod bounding sphere is too small to be seen
+    if (lod.smallFeatureCulling && sphere.r < lodDistance * _state->smallFeatureRatio)
+    {
+        ++_numSmallFeaturesCulled;
+        return;
+    }
+
+    if (uint32_t viewID = getCommandBuffer()->viewID; _state->lodHysteresis > 0.0 && viewID < LOD::maxActiveChildViews)
+    {
+        // children higher resolution than the active child need to exceed the top of the hysteresis band to be selected,
+        // while the active child remains selected until it drops below the bottom of the band.
+        double hysteresis = _state->lodHysteresis;
+        uint32_t activeChild = lod.getActiveChild(viewID);
+        uint32_t numChildren = static_cast<uint32_t>(lod.children.size());
+        for (uint32_t i = 0; i < numChildren; ++i)
+        {
+            const auto& child = lod.children[i];
+            double scale = (i < activeChild) ? (1.0 + hysteresis) : ((i == activeChild) ? (1.0 - hysteresis) : 1.0);
+            auto cutoff = lodDistance * child.minimumScreenHeightRatio * scale;
+            if (sphere.r > cutoff)
+            {
+                if (i != activeChild) lod.setActiveChild(viewID, i);
+                child.node->accept(*this);
+                return;
+            }
+        }
+
+        if (activeChild < numChildren) lod.setActiveChild(viewID, numChildren);
+        return;
+    }
+
     for (auto& child : lod.children)
     {
         auto cutoff = lodDistance * child.minimumScreenHeightRatio;
@@ -176,6 +216,9 @@ void RecordTraversal::apply(const PagedLOD& plod)
 {
     GPU_INSTRUMENTATION_L2_NCO(instrumentation, *getCommandBuffer(), "PagedLOD", COLOR_PAGER, &plod);
 
+    // PagedLOD need to be traversed each frame to update their usage and request loading
+    if (_cachedCommandDependencies) _cachedCommandDependencies->cacheable = false;
+
     const auto& sphere = plod.bound;
     auto frameCount = _frameStamp->frameCount;
 
@@ -196,6 +239,12 @@ void RecordTraversal::apply(const PagedLOD& plod)
         const auto& child = plod.children[0];
 
         auto cutoff = lodDistance * child.minimumScreenHeightRatio;
+        if (auto hysteresis = _state->lodHysteresis; hysteresis > 0.0)
+        {
+            // keep the high res child selected until it drops below the bottom of the hysteresis band, and only select it when it exceeds the top of the band
+            bool previouslyActive = (frameCount - plod.frameHighResLastUsed) <= 1;
+            cutoff *= previouslyActive ? (1.0 - hysteresis) : (1.0 + hysteresis);
+        }
         bool child_visible = sphere.r > cutoff;
         if (child_visible)
         {
@@ -256,6 +305,13 @@ void RecordTraversal::apply(const TileDatabase& tileDatabase)
 {
     GPU_INSTRUMENTATION_L2_NCO(instrumentation, *getCommandBuffer(), "TileDatabase", COLOR_RECORD_L2, &tileDatabase);
 
+    if (_cachedCommandDependencies) _cachedCommandDependencies->cacheable = false;
+
+    if (tileDatabase.settings && tileDatabase.settings->virtualTexture && _frameStamp)
+    {
+        tileDatabase.settings->virtualTexture->advance(_frameStamp->frameCount, _databasePager ? _databasePager->compileManager : ref_ptr<CompileManager>());
+    }
+
     tileDatabase.traverse(*this);
 }
 
@@ -265,6 +321,12 @@ void RecordTraversal::apply(const CullGroup& cullGroup)
 
     if (_state->intersect(cullGroup.bound))
     {
+        if (cullGroup.smallFeatureCulling && _state->smallFeature(cullGroup.bound))
+        {
+            ++_numSmallFeaturesCulled;
+            return;
+        }
+
         // debug("Passed node");
         cullGroup.traverse(*this);
     }
@@ -276,15 +338,42 @@ void RecordTraversal::apply(const CullNode& cullNode)
 
     if (_state->intersect(cullNode.bound))
     {
+        if (cullNode.smallFeatureCulling && _state->smallFeature(cullNode.bound))
+        {
+            ++_numSmallFeaturesCulled;
+            return;
+        }
+
         //debug("Passed node");
         cullNode.traverse(*this);
     }
 }
 
+void RecordTraversal::apply(const SpatialGroup& spatialGroup)
+{
+    GPU_INSTRUMENTATION_L2_NCO(instrumentation, *getCommandBuffer(), "SpatialGroup", COLOR_RECORD_L2, &spatialGroup);
+
+    // cull octree nodes and children against the view frustum and, as for CullGroup/CullNode, the small feature threshold
+    bool smallFeatureCulling = spatialGroup.smallFeatureCulling && _state->smallFeatureRatio > 0.0;
+    auto intersect = [&](const dsphere& bound) {
+        if (!_state->intersect(bound)) return false;
+        if (smallFeatureCulling && _state->smallFeature(bound))
+        {
+            ++_numSmallFeaturesCulled;
+            return false;
+        }
+        return true;
+    };
+
+    spatialGroup.cull(intersect, [&](const Node& child) { child.accept(*this); });
+}
+
 void RecordTraversal::apply(const Switch& sw)
 {
     GPU_INSTRUMENTATION_L2_NCO(instrumentation, *getCommandBuffer(), "Switch", COLOR_RECORD_L2, &sw);
 
+    if (_cachedCommandDependencies) _cachedCommandDependencies->switches.emplace_back(&sw);
+
     for (auto& child : sw.children)
     {
         if ((traversalMask & (overrideMask | child.mask)) != MASK_OFF)
@@ -298,6 +387,8 @@ void RecordTraversal::apply(const RegionOfInterest& roi)
 {
     CPU_INSTRUMENTATION_L2_NCO(instrumentation, "RegionOfInterest", COLOR_RECORD_L2, &roi);
 
+    if (_cachedCommandDependencies) _cachedCommandDependencies->cacheable = false;
+
     regionsOfInterest.emplace_back(_state->modelviewMatrixStack.top(), &roi);
 }
 
@@ -305,6 +396,9 @@ void RecordTraversal::apply(const DepthSorted& depthSorted)
 {
     CPU_INSTRUMENTATION_L2_NCO(instrumentation, "DepthSorted", COLOR_RECORD_L2, &depthSorted);
 
+    // bins are recorded after the View's subgraph so can't be captured by a CachedCommandGroup
+    if (_cachedCommandDependencies) _cachedCommandDependencies->cacheable = false;
+
     if (_state->intersect(depthSorted.bound))
     {
         const auto& mv = _state->modelviewMatrixStack.top();
@@ -318,6 +412,8 @@ void RecordTraversal::apply(const DepthSorted& depthSorted)
 void RecordTraversal::apply(const Layer& layer)
 {
     CPU_INSTRUMENTATION_L2_NCO(instrumentation, "Layer", COLOR_RECORD_L2, &layer);
+
+    if (_cachedCommandDependencies) _cachedCommandDependencies->cacheable = false;
     if ((traversalMask & (overrideMask | layer.mask)) != MASK_OFF)
     {
         addToBin(layer.binNumber, layer.value, layer.child);
@@ -363,6 +459,7 @@ void RecordTraversal::apply(const AmbientLight& light)
     CPU_INSTRUMENTATION_L2_O(instrumentation, &light);
 
     //debug("RecordTraversal::apply(AmbientLight) ", light.className());
+    if (_cachedCommandDependencies) _cachedCommandDependencies->cacheable = false;
     if (_viewDependentState) _viewDependentState->ambientLights.emplace_back(_state->modelviewMatrixStack.top(), &light);
 }
 
@@ -371,6 +468,7 @@ void RecordTraversal::apply(const DirectionalLight& light)
     CPU_INSTRUMENTATION_L2_O(instrumentation, &light);
 
     //debug("RecordTraversal::apply(DirectionalLight) ", light.className());
+    if (_cachedCommandDependencies) _cachedCommandDependencies->cacheable = false;
     if (_viewDependentState) _viewDependentState->directionalLights.emplace_back(_state->modelviewMatrixStack.top(), &light);
 }
 
@@ -379,6 +477,7 @@ void RecordTraversal::apply(const PointLight& light)
     CPU_INSTRUMENTATION_L2_O(instrumentation, &light);
 
     //debug("RecordTraversal::apply(PointLight) ", light.className());
+    if (_cachedCommandDependencies) _cachedCommandDependencies->cacheable = false;
     if (_viewDependentState) _viewDependentState->pointLights.emplace_back(_state->modelviewMatrixStack.top(), &light);
 }
 
@@ -387,6 +486,7 @@ void RecordTraversal::apply(const SpotLight& light)
     CPU_INSTRUMENTATION_L2_O(instrumentation, &light);
 
     //debug("RecordTraversal::apply(SpotLight) ", light.className());
+    if (_cachedCommandDependencies) _cachedCommandDependencies->cacheable = false;
     if (_viewDependentState) _viewDependentState->spotLights.emplace_back(_state->modelviewMatrixStack.top(), &light);
 }
 
@@ -395,6 +495,9 @@ void RecordTraversal::apply(const Transform& transform)
 {
     GPU_INSTRUMENTATION_L2_NCO(instrumentation, *getCommandBuffer(), "Transform", COLOR_RECORD_L2, &transform);
 
+    // Transform subclasses such as AbsoluteTransform may compute their matrix from the modelview matrix so can't be tracked as a dependency
+    if (_cachedCommandDependencies) _cachedCommandDependencies->viewDependent = true;
+
     _state->modelviewMatrixStack.push(transform);
     _state->dirty = true;
 
@@ -417,6 +520,8 @@ void RecordTraversal::apply(const MatrixTransform& mt)
 {
     GPU_INSTRUMENTATION_L2_NCO(instrumentation, *getCommandBuffer(), "MatrixTransform", COLOR_RECORD_L2, &mt);
 
+    if (_cachedCommandDependencies) _cachedCommandDependencies->transforms.emplace_back(&mt);
+
     _state->modelviewMatrixStack.push(mt);
     _state->dirty = true;
 
@@ -435,6 +540,40 @@ void RecordTraversal::apply(const MatrixTransform& mt)
     _state->dirty = true;
 }
 
+void RecordTraversal::apply(const CoordinateFrame& cf)
+{
+    GPU_INSTRUMENTATION_L2_NCO(instrumentation, *getCommandBuffer(), "CoordinateFrame", COLOR_RECORD_L2, &cf);
+
+    if (_cachedCommandDependencies) _cachedCommandDependencies->coordinateFrames.emplace_back(&cf);
+
+    // when camera relative, a CoordinateFrame directly below the view matrix has the eye subtracted from its origin before the view rotation is applied
+    auto& modelviewMatrixStack = _state->modelviewMatrixStack;
+    if (_state->cameraRelative && modelviewMatrixStack.matrixStack.size() == 1)
+    {
+        if (_cachedCommandDependencies) _cachedCommandDependencies->viewDependent = true;
+        modelviewMatrixStack.push(cf.transform(_state->viewRotation, _state->eyePosition));
+    }
+    else
+    {
+        modelviewMatrixStack.push(cf);
+    }
+    _state->dirty = true;
+
+    if (cf.subgraphRequiresLocalFrustum)
+    {
+        _state->pushFrustum();
+        cf.traverse(*this);
+        _state->popFrustum();
+    }
+    else
+    {
+        cf.traverse(*this);
+    }
+
+    modelviewMatrixStack.pop();
+    _state->dirty = true;
+}
+
 // Animation nodes
 void RecordTraversal::apply(const Joint&)
 {
@@ -450,6 +589,23 @@ void RecordTraversal::apply(const StateGroup& stateGroup)
 
     //debug("Visiting StateGroup");
 
+    // defer recording of subgraphs whose pipelines are still being created in the background and have no fallback,
+    // and avoid caching commands recorded with a fallback pipeline. Once all the stateCommands are ready for a view they aren't checked again.
+    uint32_t viewID = getCommandBuffer()->viewID;
+    uint32_t viewBit = (viewID < 32) ? (1u << viewID) : 0u;
+    if ((stateGroup.readyViewMask.load(std::memory_order_relaxed) & viewBit) == 0)
+    {
+        bool allReady = true;
+        for (auto& command : stateGroup.stateCommands)
+        {
+            if (command->ready(viewID)) continue;
+            if (!command->recordable(viewID)) return;
+            if (_cachedCommandDependencies) _cachedCommandDependencies->cacheable = false;
+            allReady = false;
+        }
+        if (allReady) stateGroup.readyViewMask.fetch_or(viewBit);
+    }
+
     for (auto& command : stateGroup.stateCommands)
     {
         _state->stateStacks[command->slot].push(command);
@@ -465,10 +621,190 @@ void RecordTraversal::apply(const StateGroup& stateGroup)
     _state->dirty = true;
 }
 
+void RecordTraversal::apply(const StreamedTextureGroup& group)
+{
+    GPU_INSTRUMENTATION_L2_NCO(instrumentation, *getCommandBuffer(), "StreamedTextureGroup", COLOR_RECORD_L2, &group);
+
+    // the screen height ratio has to be reported each frame
+    if (_cachedCommandDependencies) _cachedCommandDependencies->cacheable = false;
+
+    // check if bounding sphere is in view frustum.
+    auto lodDistance = _state->lodDistance(group.bound);
+    if (lodDistance < 0.0)
+    {
+        return;
+    }
+
+    ref_ptr<const StateCommand> command;
+    if (group.texture)
+    {
+        // report the screen height ratio covered so TextureStreaming can select the mip levels to make resident
+        group.texture->request(group.bound.r / lodDistance, _frameStamp ? _frameStamp->frameCount : 0);
+        command = group.texture->bindDescriptorSet;
+    }
+
+    if (command)
+    {
+        _state->stateStacks[command->slot].push(command);
+        _state->dirty = true;
+    }
+
+    group.traverse(*this);
+
+    if (command)
+    {
+        _state->stateStacks[command->slot].pop();
+        _state->dirty = true;
+    }
+}
+
+void RecordTraversal::apply(const CachedCommandGroup& group)
+{
+    GPU_INSTRUMENTATION_L2_NCO(instrumentation, *getCommandBuffer(), "CachedCommandGroup", COLOR_RECORD_L2, &group);
+
+    // secondary CommandBuffer can only be executed within a subpass that has secondary command buffer contents, where all the commands are recorded into secondary CommandBuffer,
+    // and can't be nested within the recording of another CachedCommandGroup.
+    if (!_subpassPrimaryCommandBuffer || _cachedCommandDependencies)
+    {
+        group.inlined();
+        ++_numCachedCommandInlined;
+        group.traverse(*this);
+        return;
+    }
+
+    ref_ptr<CommandBuffer> subpassCommandBuffer(_state->_commandBuffer);
+
+    auto frameCount = _frameStamp ? _frameStamp->frameCount : 0;
+    auto& recording = group.getRecording(subpassCommandBuffer->deviceID, subpassCommandBuffer->viewID);
+
+    // in Views with transformData the modelview matrices are read from entries reserved for the recording, so it can be replayed as the camera moves
+    auto& modelviewMatrixStack = _state->modelviewMatrixStack;
+    bool reserveTransforms = modelviewMatrixStack.transformData && modelviewMatrixStack.reservedTransforms;
+    bool viewDependent = !reserveTransforms || recording.dependencies.viewDependent;
+
+    auto key = group.computeKey(*this, viewDependent);
+    bool valid = recording.commandBuffer && recording.dependencies.cacheable && recording.key == key && recording.dependenciesKey == recording.dependencies.hash();
+
+    if (valid)
+    {
+        group.hit();
+        ++_numCachedCommandHits;
+
+        if (reserveTransforms) recording.transformSlots.fill(*modelviewMatrixStack.transformData, modelviewMatrixStack.top());
+    }
+    else
+    {
+        group.miss();
+        ++_numCachedCommandMisses;
+
+        // retire the previous CommandBuffer and reuse the oldest retired CommandBuffer that is no longer in use
+        if (recording.commandBuffer) recording.retired.push_back(CachedCommandGroup::Recording::Retired{recording.commandBuffer, recording.frameLastUsed});
+        recording.commandBuffer = {};
+
+        for (auto itr = recording.retired.begin(); itr != recording.retired.end(); ++itr)
+        {
+            if (itr->commandBuffer->numDependentSubmissions() == 0 && (frameCount - itr->frameLastUsed) >= group.retainFrames)
+            {
+                recording.commandBuffer = itr->commandBuffer;
+                recording.retired.erase(itr);
+                break;
+            }
+        }
+
+        // CommandBuffer still in flight are kept alive by the Fence they were submitted with so the oldest can be dropped
+        if (recording.retired.size() > group.retainFrames) recording.retired.erase(recording.retired.begin());
+
+        if (recording.commandBuffer)
+        {
+            recording.commandBuffer->reset();
+        }
+        else
+        {
+            auto commandPool = CommandPool::create(subpassCommandBuffer->getDevice(), subpassCommandBuffer->getCommandPool()->queueFamilyIndex);
+            recording.commandBuffer = commandPool->allocate(VK_COMMAND_BUFFER_LEVEL_SECONDARY);
+        }
+
+        auto& secondaryCommandBuffer = *recording.commandBuffer;
+        secondaryCommandBuffer.viewID = subpassCommandBuffer->viewID;
+        secondaryCommandBuffer.traversalMask = subpassCommandBuffer->traversalMask;
+        secondaryCommandBuffer.overrideMask = subpassCommandBuffer->overrideMask;
+        secondaryCommandBuffer.viewDependentState = subpassCommandBuffer->viewDependentState;
+
+        VkCommandBufferInheritanceInfo inheritanceInfo = {};
+        inheritanceInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+        inheritanceInfo.renderPass = _subpassPrimaryCommandBuffer->renderPass;
+        inheritanceInfo.subpass = _subpassPrimaryCommandBuffer->subpass;
+        inheritanceInfo.framebuffer = VK_NULL_HANDLE;
+
+        // the recording is replayed in consecutive frames so may be pending execution in several primary CommandBuffer at once
+        VkCommandBufferBeginInfo beginInfo = {};
+        beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        beginInfo.flags = VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT | VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT;
+        beginInfo.pInheritanceInfo = &inheritanceInfo;
+
+        vkBeginCommandBuffer(secondaryCommandBuffer, &beginInfo);
+
+        // secondary CommandBuffer don't inherit any state so all the current state has to be recorded
+        _state->_commandBuffer = recording.commandBuffer;
+        _state->dirtyStateStacks();
+
+        auto previousDependencies = _cachedCommandDependencies;
+        recording.dependencies.clear();
+        _cachedCommandDependencies = &recording.dependencies;
+
+        // entries reserved by the previous recording are returned for reuse
+        recording.transformSlots.release();
+        if (reserveTransforms)
+        {
+            recording.transformSlots.begin(modelviewMatrixStack.reservedTransforms, modelviewMatrixStack.top());
+            modelviewMatrixStack.transformSlots = &recording.transformSlots;
+            _state->frustumCulling = false;
+        }
+
+        group.traverse(*this);
+
+        if (reserveTransforms)
+        {
+            modelviewMatrixStack.transformSlots = nullptr;
+            _state->frustumCulling = true;
+
+            // per frame indices were recorded for the entries that couldn't be reserved so re-record next frame, by which time further entries will be reserved
+            if (!recording.transformSlots.complete) recording.dependencies.cacheable = false;
+            if (recording.transformSlots.matricesPushed) recording.dependencies.viewDependent = true;
+        }
+        else
+        {
+            recording.dependencies.viewDependent = true;
+        }
+
+        _cachedCommandDependencies = previousDependencies;
+        _state->_commandBuffer = subpassCommandBuffer;
+
+        vkEndCommandBuffer(secondaryCommandBuffer);
+
+        recording.key = (recording.dependencies.viewDependent == viewDependent) ? key : group.computeKey(*this, recording.dependencies.viewDependent);
+        recording.dependenciesKey = recording.dependencies.hash();
+    }
+
+    recording.frameLastUsed = frameCount;
+
+    executeCommands(recording.commandBuffer);
+}
+
 void RecordTraversal::apply(const Commands& commands)
 {
     GPU_INSTRUMENTATION_L3_NCO(instrumentation, *getCommandBuffer(), "Commands", COLOR_GPU, &commands);
 
+    if (_subpassPrimaryCommandBuffer)
+    {
+        // NextSubPass and ExecuteCommands have to be recorded into the subpass's primary CommandBuffer
+        for (auto& command : commands.children)
+        {
+            command->accept(*this);
+        }
+        return;
+    }
+
     _state->record();
     for (auto& command : commands.children)
     {
@@ -485,6 +821,149 @@ void RecordTraversal::apply(const Command& command)
     command.record(*(_state->_commandBuffer));
 }
 
+void RecordTraversal::apply(const NextSubPass& nextSubPass)
+{
+    // no GPU instrumentation as the secondary CommandBuffer current on entry is ended by endSubpass()
+    endSubpass();
+
+    nextSubPass.record(*(_state->_commandBuffer));
+
+    beginSubpass();
+}
+
+void RecordTraversal::apply(const ExecuteCommands& executeCommands)
+{
+    GPU_INSTRUMENTATION_L3_NCO(instrumentation, *getCommandBuffer(), "ExecuteCommands", COLOR_GPU, &executeCommands);
+
+    if (_subpassPrimaryCommandBuffer && !_cachedCommandDependencies)
+    {
+        // defer to endSubpass() so the secondary CommandBuffer are executed in order with the commands recorded before and after
+        _subpassCommands.push_back(SubpassCommands{{}, &executeCommands, false});
+        _beginSubpassCommandBuffer();
+        return;
+    }
+
+    _state->record();
+    executeCommands.record(*(_state->_commandBuffer));
+}
+
+void RecordTraversal::beginSubpass()
+{
+    auto& commandBuffer = _state->_commandBuffer;
+    if (_subpassPrimaryCommandBuffer || commandBuffer->level() != VK_COMMAND_BUFFER_LEVEL_PRIMARY || commandBuffer->subpassContents != VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS) return;
+
+    _subpassPrimaryCommandBuffer = commandBuffer;
+    _beginSubpassCommandBuffer();
+}
+
+void RecordTraversal::endSubpass()
+{
+    if (!_subpassPrimaryCommandBuffer) return;
+
+    auto& primaryCommandBuffer = *_subpassPrimaryCommandBuffer;
+
+    std::vector<VkCommandBuffer> vk_commandBuffers;
+    vk_commandBuffers.reserve(_subpassCommands.size());
+    for (auto& subpassCommands : _subpassCommands)
+    {
+        if (subpassCommands.executeCommands)
+        {
+            if (!vk_commandBuffers.empty()) vkCmdExecuteCommands(primaryCommandBuffer, static_cast<uint32_t>(vk_commandBuffers.size()), vk_commandBuffers.data());
+            vk_commandBuffers.clear();
+
+            subpassCommands.executeCommands->record(primaryCommandBuffer);
+            continue;
+        }
+
+        // the secondary CommandBuffer recorded by the RecordTraversal are left open until the end of the subpass so GPU instrumentation scopes that span them remain valid
+        if (subpassCommands.recording) vkEndCommandBuffer(*subpassCommands.commandBuffer);
+        vk_commandBuffers.push_back(*subpassCommands.commandBuffer);
+    }
+
+    if (!vk_commandBuffers.empty()) vkCmdExecuteCommands(primaryCommandBuffer, static_cast<uint32_t>(vk_commandBuffers.size()), vk_commandBuffers.data());
+
+    _subpassCommands.clear();
+    _state->_commandBuffer = _subpassPrimaryCommandBuffer;
+    _state->dirtyStateStacks();
+    _subpassPrimaryCommandBuffer = {};
+}
+
+void RecordTraversal::executeCommands(ref_ptr<CommandBuffer> secondaryCommandBuffer)
+{
+    // track the secondary CommandBuffer with the submission's Fence so it isn't reused while in flight
+    secondaryCommandBuffer->numDependentSubmissions().fetch_add(1);
+    if (recordedCommandBuffers) recordedCommandBuffers->add(0, secondaryCommandBuffer);
+
+    if (!_subpassPrimaryCommandBuffer)
+    {
+        vkCmdExecuteCommands(*(_state->_commandBuffer), 1, secondaryCommandBuffer->data());
+
+        // the state bound in the CommandBuffer is undefined after vkCmdExecuteCommands so needs to be recorded again
+        _state->dirtyStateStacks();
+        return;
+    }
+
+    _subpassCommands.push_back(SubpassCommands{secondaryCommandBuffer, nullptr, false});
+    _beginSubpassCommandBuffer();
+}
+
+void RecordTraversal::_beginSubpassCommandBuffer()
+{
+    ref_ptr<CommandBuffer> previousCommandBuffer(_state->_commandBuffer);
+
+    // reuse a secondary CommandBuffer that is no longer in flight, each has its own CommandPool as CommandBuffer::reset() resets the pool.
+    ref_ptr<CommandBuffer> commandBuffer;
+    for (auto& cb : _subpassCommandBuffers)
+    {
+        if (cb->numDependentSubmissions() == 0)
+        {
+            commandBuffer = cb;
+            break;
+        }
+    }
+
+    if (commandBuffer)
+    {
+        commandBuffer->reset();
+    }
+    else
+    {
+        auto commandPool = CommandPool::create(_subpassPrimaryCommandBuffer->getDevice(), _subpassPrimaryCommandBuffer->getCommandPool()->queueFamilyIndex);
+        commandBuffer = commandPool->allocate(VK_COMMAND_BUFFER_LEVEL_SECONDARY);
+        _subpassCommandBuffers.push_back(commandBuffer);
+    }
+
+    commandBuffer->viewID = previousCommandBuffer->viewID;
+    commandBuffer->traversalMask = previousCommandBuffer->traversalMask;
+    commandBuffer->overrideMask = previousCommandBuffer->overrideMask;
+    commandBuffer->viewDependentState = previousCommandBuffer->viewDependentState;
+    commandBuffer->renderPass = _subpassPrimaryCommandBuffer->renderPass;
+    commandBuffer->subpass = _subpassPrimaryCommandBuffer->subpass;
+    commandBuffer->subpassContents = _subpassPrimaryCommandBuffer->subpassContents;
+
+    VkCommandBufferInheritanceInfo inheritanceInfo = {};
+    inheritanceInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+    inheritanceInfo.renderPass = _subpassPrimaryCommandBuffer->renderPass;
+    inheritanceInfo.subpass = _subpassPrimaryCommandBuffer->subpass;
+    inheritanceInfo.framebuffer = VK_NULL_HANDLE;
+
+    VkCommandBufferBeginInfo beginInfo = {};
+    beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    beginInfo.flags = VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT | VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    beginInfo.pInheritanceInfo = &inheritanceInfo;
+
+    vkBeginCommandBuffer(*commandBuffer, &beginInfo);
+
+    commandBuffer->numDependentSubmissions().fetch_add(1);
+    if (recordedCommandBuffers) recordedCommandBuffers->add(0, commandBuffer);
+
+    _subpassCommands.push_back(SubpassCommands{commandBuffer, nullptr, true});
+
+    // secondary CommandBuffer don't inherit any state so all the current state has to be recorded
+    _state->_commandBuffer = commandBuffer;
+    _state->dirtyStateStacks();
+}
+
 void RecordTraversal::apply(const Bin& bin)
 {
     GPU_INSTRUMENTATION_L1_NCO(instrumentation, *getCommandBuffer(), "Bin", COLOR_RECORD_L1, &bin);
@@ -536,11 +1015,67 @@ void RecordTraversal::apply(const View& view)
         _viewDependentState->clear();
     }
 
+    // collect the modelview matrices of pipelines using transform indexing into the View's transformData
+    auto& modelviewMatrixStack = _state->modelviewMatrixStack;
+    auto cached_transformData = modelviewMatrixStack.transformData;
+    auto cached_reservedTransforms = modelviewMatrixStack.reservedTransforms;
+    auto cached_transformBase = modelviewMatrixStack.transformBase;
+    auto cached_transformCount = modelviewMatrixStack.transformCount;
+    modelviewMatrixStack.transformData = _viewDependentState ? _viewDependentState->transformData : ref_ptr<mat4Array>{};
+    modelviewMatrixStack.reservedTransforms = _viewDependentState ? _viewDependentState->reservedTransforms : ref_ptr<ReservedTransforms>{};
+    modelviewMatrixStack.transformBase = 0;
+    modelviewMatrixStack.transformCount = 0;
+    if (auto& reservedTransforms = modelviewMatrixStack.reservedTransforms; reservedTransforms && modelviewMatrixStack.transformData)
+    {
+        // CachedCommandGroup recordings may reserve up to half of transformData, the per frame entries follow the reserved entries
+        reservedTransforms->update(static_cast<uint32_t>(modelviewMatrixStack.transformData->size() / 2));
+        modelviewMatrixStack.transformBase = reservedTransforms->count;
+    }
+
+    // small feature culling is per View so cache the parent View's setting and count
+    auto cached_smallFeatureRatio = _state->smallFeatureRatio;
+    auto cached_numSmallFeaturesCulled = _numSmallFeaturesCulled;
+    _state->smallFeatureRatio = 0.0;
+    _numSmallFeaturesCulled = 0;
+
+    // CachedCommandGroup usage is reported per View so cache the parent View's counts
+    auto cached_numCachedCommandHits = _numCachedCommandHits;
+    auto cached_numCachedCommandMisses = _numCachedCommandMisses;
+    auto cached_numCachedCommandInlined = _numCachedCommandInlined;
+    _numCachedCommandHits = 0;
+    _numCachedCommandMisses = 0;
+    _numCachedCommandInlined = 0;
+
+    auto cached_lodHysteresis = _state->lodHysteresis;
+    _state->lodHysteresis = std::clamp(view.lodHysteresis, 0.0, 0.5);
+
+    auto cached_cameraRelative = _state->cameraRelative;
+    auto cached_eyePosition = _state->eyePosition;
+    auto cached_viewRotation = _state->viewRotation;
+    _state->cameraRelative = false;
+
     if (view.camera)
     {
         _state->inheritViewForLODScaling = (view.features & INHERIT_VIEWPOINT) != 0;
         _state->setProjectionAndViewMatrix(view.camera->projectionMatrix->transform(), view.camera->viewMatrix->transform());
 
+        if (view.cameraRelative)
+        {
+            // split the view matrix into the eye position and the view rotation so that CoordinateFrame nodes can subtract the eye from their origin
+            auto inverseViewMatrix = view.camera->viewMatrix->inverse();
+            _state->cameraRelative = true;
+            _state->eyePosition.set(inverseViewMatrix[3][0], inverseViewMatrix[3][1], inverseViewMatrix[3][2]);
+            _state->viewRotation = _state->modelviewMatrixStack.top();
+            _state->viewRotation[3].set(0.0, 0.0, 0.0, 1.0);
+        }
+
+        if (view.smallFeatureCullingPixelSize > 0.0 && view.camera->viewportState && !view.camera->viewportState->viewports.empty())
+        {
+            // lodScale includes a factor of sqrt(2) so the projected diameter in pixels is sqrt(2) * viewportHeight * radius / lodDistance
+            auto viewportHeight = static_cast<double>(view.camera->viewportState->viewports.front().height);
+            if (viewportHeight > 0.0) _state->smallFeatureRatio = view.smallFeatureCullingPixelSize / (std::sqrt(2.0) * viewportHeight);
+        }
+
         if (_viewDependentState && _viewDependentState->viewportData && view.camera->viewportState)
         {
             auto& viewportData = _viewDependentState->viewportData;
@@ -578,6 +1113,42 @@ void RecordTraversal::apply(const View& view)
         _viewDependentState->traverse(*this);
     }
 
+    if (auto& transformData = modelviewMatrixStack.transformData; transformData && (modelviewMatrixStack.transformBase + modelviewMatrixStack.transformCount) > 0)
+    {
+        uint32_t required = modelviewMatrixStack.transformBase + modelviewMatrixStack.transformCount;
+        if (required > transformData->size())
+        {
+            warn("RecordTraversal::apply(const View&) ", required, " transforms recorded but ViewDependentState::transformData only holds ", transformData->size(), ", increase ViewDependentState::maxTransformData.");
+        }
+
+        // only transfer the reserved entries and the matrices recorded this frame rather than the whole array
+        if (auto& bufferInfo = _viewDependentState->transformDataBufferInfo)
+        {
+            uint32_t count = std::min(required, static_cast<uint32_t>(transformData->size()));
+            bufferInfo->transferRange = static_cast<VkDeviceSize>(count) * sizeof(mat4);
+        }
+        transformData->dirty();
+    }
+    modelviewMatrixStack.transformData = cached_transformData;
+    modelviewMatrixStack.reservedTransforms = cached_reservedTransforms;
+    modelviewMatrixStack.transformBase = cached_transformBase;
+    modelviewMatrixStack.transformCount = cached_transformCount;
+
+    if (instrumentation && _state->smallFeatureRatio > 0.0) instrumentation->plot("View small features culled", static_cast<double>(_numSmallFeaturesCulled));
+    if (uint32_t numCachedCommandGroups = _numCachedCommandHits + _numCachedCommandMisses + _numCachedCommandInlined; instrumentation && numCachedCommandGroups > 0)
+    {
+        instrumentation->plot("CachedCommandGroup hit ratio", static_cast<double>(_numCachedCommandHits) / static_cast<double>(numCachedCommandGroups));
+    }
+    _state->smallFeatureRatio = cached_smallFeatureRatio;
+    _state->lodHysteresis = cached_lodHysteresis;
+    _state->cameraRelative = cached_cameraRelative;
+    _state->eyePosition = cached_eyePosition;
+    _state->viewRotation = cached_viewRotation;
+    _numSmallFeaturesCulled = cached_numSmallFeaturesCulled;
+    _numCachedCommandHits = cached_numCachedCommandHits;
+    _numCachedCommandMisses = cached_numCachedCommandMisses;
+    _numCachedCommandInlined = cached_numCachedCommandInlined;
+
     // swap back previous bin setup.
     _minimumBinNumber = cached_minimumBinNumber;
     cached_bins.swap(_bins);
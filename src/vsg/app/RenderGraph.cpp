@@ -142,13 +142,26 @@ void RenderGraph::accept(RecordTraversal& recordTraversal) const
     renderPassInfo.clearValueCount = static_cast<uint32_t>(clearValues.size());
     renderPassInfo.pClearValues = clearValues.data();
 
-    VkCommandBuffer vk_commandBuffer = *(recordTraversal.getState()->_commandBuffer);
-    vkCmdBeginRenderPass(vk_commandBuffer, &renderPassInfo, contents);
+    auto& commandBuffer = *(recordTraversal.getState()->_commandBuffer);
+    vkCmdBeginRenderPass(commandBuffer, &renderPassInfo, contents);
+
+    commandBuffer.renderPass = renderPassInfo.renderPass;
+    commandBuffer.subpass = 0;
+    commandBuffer.subpassContents = contents;
+
+    // commands in a subpass with secondary command buffer contents are recorded into secondary CommandBuffer
+    recordTraversal.beginSubpass();
 
     // traverse the subgraph to place commands into the command buffer.
     traverse(recordTraversal);
 
-    vkCmdEndRenderPass(vk_commandBuffer);
+    recordTraversal.endSubpass();
+
+    vkCmdEndRenderPass(commandBuffer);
+
+    commandBuffer.renderPass = VK_NULL_HANDLE;
+    commandBuffer.subpass = 0;
+    commandBuffer.subpassContents = VK_SUBPASS_CONTENTS_INLINE;
 }
 
 void RenderGraph::resized()
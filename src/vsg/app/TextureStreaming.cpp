@@ -0,0 +1,342 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2025 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/app/TextureStreaming.h>
+#include <vsg/io/Logger.h>
+#include <vsg/ui/FrameStamp.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <queue>
+
+using namespace vsg;
+
+namespace
+{
+    struct PrepareStreamedTexture : public Inherit<Operation, PrepareStreamedTexture>
+    {
+        PrepareStreamedTexture(ref_ptr<TextureStreaming> in_textureStreaming, const TextureStreaming::Change& in_change) :
+            textureStreaming(in_textureStreaming),
+            change(in_change) {}
+
+        ref_ptr<TextureStreaming> textureStreaming;
+        TextureStreaming::Change change;
+
+        void run() override
+        {
+            textureStreaming->prepare(change);
+        }
+    };
+} // namespace
+
+TextureStreaming::TextureStreaming()
+{
+}
+
+TextureStreaming::~TextureStreaming()
+{
+}
+
+bool TextureStreaming::add(ref_ptr<StreamedTexture> texture)
+{
+    if (!texture) return false;
+
+    if (texture->numMipLevels() == 0)
+    {
+        uint32_t initialLevel = texture->residentLevel;
+        if (initialLevel == 0) initialLevel = std::numeric_limits<uint32_t>::max();
+        if (!texture->init(initialLevel)) return false;
+    }
+
+    if (std::find(_textures.begin(), _textures.end(), texture) == _textures.end())
+    {
+        _textures.push_back(texture);
+    }
+    return true;
+}
+
+void TextureStreaming::remove(ref_ptr<StreamedTexture> texture)
+{
+    if (auto itr = std::find(_textures.begin(), _textures.end(), texture); itr != _textures.end())
+    {
+        _textures.erase(itr);
+    }
+
+    std::scoped_lock<std::mutex> lock(_sourceCacheMutex);
+    for (auto itr = _sourceCache.begin(); itr != _sourceCache.end(); ++itr)
+    {
+        if (itr->texture == texture)
+        {
+            _sourceCacheSize -= itr->size;
+            _sourceCache.erase(itr);
+            break;
+        }
+    }
+}
+
+TextureStreaming::Changes TextureStreaming::plan(uint64_t frameCount)
+{
+    struct Candidate
+    {
+        StreamedTexture* texture = nullptr;
+        uint32_t level = 0;
+        uint32_t coarsest = 0;
+        double screenPixels = 0.0;
+    };
+
+    std::vector<Candidate> candidates;
+    candidates.reserve(_textures.size());
+
+    VkDeviceSize totalSize = 0;
+    for (auto& texture : _textures)
+    {
+        if (texture->numMipLevels() == 0) continue;
+
+        Candidate candidate;
+        candidate.texture = texture.get();
+        candidate.coarsest = texture->coarsestLevel(residentTailDimension);
+
+        // StreamedTexture holds the lower 32 bits of the frame count so compute the age of the request with 32 bit wrap around.
+        auto [requestFrame, screenHeightRatio] = texture->lastRequest();
+        uint32_t age = static_cast<uint32_t>(frameCount) - static_cast<uint32_t>(requestFrame);
+
+        uint32_t requiredLevel = candidate.coarsest;
+        if (screenHeightRatio > 0.0 && age <= 1)
+        {
+            candidate.screenPixels = screenHeightRatio * screenHeight;
+            int32_t level = static_cast<int32_t>(texture->requiredLevel(candidate.screenPixels)) + levelBias;
+            requiredLevel = static_cast<uint32_t>(std::clamp(level, 0, static_cast<int32_t>(candidate.coarsest)));
+        }
+
+        if (requiredLevel <= texture->residentLevel) texture->frameResidentLevelLastRequired = frameCount;
+
+        if (texture->pending)
+        {
+            candidate.level = texture->residentLevel;
+        }
+        else if (requiredLevel < texture->residentLevel)
+        {
+            // upgrade as soon as finer levels are required
+            candidate.level = requiredLevel;
+        }
+        else if (requiredLevel > texture->residentLevel && (frameCount - texture->frameResidentLevelLastRequired) > downgradeDelay)
+        {
+            // only downgrade once the resident level hasn't been required for a while to avoid thrashing
+            candidate.level = requiredLevel;
+        }
+        else
+        {
+            candidate.level = std::min(texture->residentLevel, candidate.coarsest);
+        }
+
+        totalSize += texture->residentSize(candidate.level);
+        candidates.push_back(candidate);
+    }
+
+    // fit within budget by repeatedly dropping a level from the texture with the most texels per screen pixel.
+    VkDeviceSize effectiveBudget = static_cast<VkDeviceSize>(static_cast<double>(budget) * memoryPressureRatio(memoryPressure.load()));
+    if (totalSize > effectiveBudget)
+    {
+        auto texelsPerPixel = [](const Candidate& candidate) -> double {
+            auto& texture = *candidate.texture;
+            double texels = static_cast<double>(std::max(std::max(texture.width, texture.height) >> candidate.level, 1u));
+            return (candidate.screenPixels > 0.0) ? (texels / candidate.screenPixels) : std::numeric_limits<double>::max();
+        };
+
+        using Entry = std::pair<double, size_t>;
+        std::priority_queue<Entry> queue;
+        for (size_t i = 0; i < candidates.size(); ++i)
+        {
+            auto& candidate = candidates[i];
+            if (!candidate.texture->pending && candidate.level < candidate.coarsest) queue.emplace(texelsPerPixel(candidate), i);
+        }
+
+        while (totalSize > effectiveBudget && !queue.empty())
+        {
+            auto& candidate = candidates[queue.top().second];
+            queue.pop();
+
+            auto& texture = *candidate.texture;
+            totalSize -= texture.levelSizes[candidate.level];
+            ++candidate.level;
+
+            if (candidate.level < candidate.coarsest) queue.emplace(texelsPerPixel(candidate), &candidate - candidates.data());
+        }
+    }
+
+    uint32_t numPending = 0;
+    for (auto& candidate : candidates)
+    {
+        if (candidate.texture->pending) ++numPending;
+    }
+
+    Changes changes;
+    for (auto& candidate : candidates)
+    {
+        if (!candidate.texture->pending && candidate.level != candidate.texture->residentLevel)
+        {
+            changes.push_back(Change{ref_ptr<StreamedTexture>(candidate.texture), candidate.level});
+        }
+    }
+
+    // downgrades release memory so apply them first, then upgrades with the largest change in level.
+    std::sort(changes.begin(), changes.end(), [](const Change& lhs, const Change& rhs) {
+        bool lhs_downgrade = lhs.level > lhs.texture->residentLevel;
+        bool rhs_downgrade = rhs.level > rhs.texture->residentLevel;
+        if (lhs_downgrade != rhs_downgrade) return lhs_downgrade;
+        return (lhs.texture->residentLevel - std::min(lhs.level, lhs.texture->residentLevel)) > (rhs.texture->residentLevel - std::min(rhs.level, rhs.texture->residentLevel));
+    });
+
+    uint32_t maxChanges = (numPending < maxPendingChanges) ? (maxPendingChanges - numPending) : 0;
+    if (changes.size() > maxChanges) changes.resize(maxChanges);
+
+    return changes;
+}
+
+void TextureStreaming::prepare(const Change& change)
+{
+    Prepared prepared;
+    prepared.texture = change.texture;
+    prepared.level = change.level;
+
+    // the texture is pending so its residentLevel and residentImage won't change till this change is merged.
+    auto& texture = *change.texture;
+    if (texture.residentImage && change.level >= texture.residentLevel)
+    {
+        // downgrades only drop the finest levels so can be extracted from the levels already resident
+        prepared.image = StreamedTexture::extractMipmaps(*texture.residentImage, change.level - texture.residentLevel);
+    }
+    else if (auto image = readSource(texture))
+    {
+        prepared.image = StreamedTexture::extractMipmaps(*image, change.level);
+    }
+
+    if (prepared.image)
+    {
+        prepared.bindDescriptorSet = texture.createBindDescriptorSet(prepared.image);
+    }
+
+    if (!prepared.bindDescriptorSet)
+    {
+        warn("TextureStreaming::prepare() unable to create mip levels ", change.level, " of ", change.texture->filename);
+    }
+    else if (compileManager)
+    {
+        prepared.compileResult = compileManager->compile(prepared.bindDescriptorSet);
+        if (!prepared.compileResult)
+        {
+            warn("TextureStreaming::prepare() failed to compile mip levels ", change.level, " of ", change.texture->filename, ", ", prepared.compileResult.message);
+            prepared.bindDescriptorSet = {};
+        }
+    }
+
+    std::scoped_lock<std::mutex> lock(_preparedMutex);
+    _prepared.push_back(prepared);
+}
+
+ref_ptr<Data> TextureStreaming::readSource(StreamedTexture& texture)
+{
+    // in memory source images are decoded once by StreamedTexture::init() so only file sourced images need caching
+    if (texture.source || sourceCacheBudget == 0) return texture.readSource();
+
+    {
+        std::scoped_lock<std::mutex> lock(_sourceCacheMutex);
+        for (auto itr = _sourceCache.begin(); itr != _sourceCache.end(); ++itr)
+        {
+            if (itr->texture.get() == &texture)
+            {
+                _sourceCache.splice(_sourceCache.begin(), _sourceCache, itr);
+                return itr->image;
+            }
+        }
+    }
+
+    auto image = texture.readSource();
+    if (!image) return {};
+
+    VkDeviceSize size = image->dataSize();
+    if (size > sourceCacheBudget) return image;
+
+    std::scoped_lock<std::mutex> lock(_sourceCacheMutex);
+    _sourceCache.push_front(CachedSource{ref_ptr<StreamedTexture>(&texture), image, size});
+    _sourceCacheSize += size;
+
+    while (_sourceCacheSize > sourceCacheBudget)
+    {
+        _sourceCacheSize -= _sourceCache.back().size;
+        _sourceCache.pop_back();
+    }
+
+    return image;
+}
+
+void TextureStreaming::updateSceneGraph(FrameStamp* frameStamp, CompileResult& cr)
+{
+    CPU_INSTRUMENTATION_L1(instrumentation);
+
+    uint64_t frameCount = frameStamp ? frameStamp->frameCount : 0;
+
+    decltype(_prepared) prepared;
+    {
+        std::scoped_lock<std::mutex> lock(_preparedMutex);
+        prepared.swap(_prepared);
+    }
+
+    for (auto& entry : prepared)
+    {
+        auto& texture = entry.texture;
+        texture->pending = false;
+        if (!entry.bindDescriptorSet) continue;
+
+        if (entry.level < texture->residentLevel)
+            ++numUpgrades;
+        else
+            ++numDowngrades;
+
+        // keep the previous binding till any command buffers that reference it have completed.
+        _retired.push_back(Retired{frameCount, texture->bindDescriptorSet});
+
+        texture->bindDescriptorSet = entry.bindDescriptorSet;
+        texture->residentImage = entry.image;
+        texture->residentLevel = entry.level;
+        texture->frameResidentLevelLastRequired = frameCount;
+
+        cr.add(entry.compileResult);
+    }
+
+    while (!_retired.empty() && (frameCount - _retired.front().frameCount) > retainFrames)
+    {
+        _retired.pop_front();
+    }
+
+    if (!compileManager) return;
+
+    for (auto& change : plan(frameCount))
+    {
+        change.texture->pending = true;
+        if (operationThreads)
+            operationThreads->add(PrepareStreamedTexture::create(ref_ptr<TextureStreaming>(this), change));
+        else
+            prepare(change);
+    }
+}
+
+VkDeviceSize TextureStreaming::residentSize() const
+{
+    VkDeviceSize size = 0;
+    for (auto& texture : _textures)
+    {
+        size += texture->residentSize(texture->residentLevel);
+    }
+    return size;
+}
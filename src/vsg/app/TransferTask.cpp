@@ -16,6 +16,8 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/ui/ApplicationEvent.h>
 #include <vsg/vk/State.h>
 
+#include <algorithm>
+
 using namespace vsg;
 
 TransferTask::TransferTask(Device* in_device, uint32_t numBuffers) :
@@ -138,16 +140,18 @@ void TransferTask::_transferBufferInfos(VkCommandBuffer vk_commandBuffer, Frame&
             {
                 if (bufferInfo->syncModifiedCounts(deviceID))
                 {
+                    VkDeviceSize range = (bufferInfo->transferRange > 0) ? std::min(bufferInfo->transferRange, bufferInfo->range) : bufferInfo->range;
+
                     // copy data to staging buffer memory
                     char* ptr = reinterpret_cast<char*>(buffer_data) + offset;
-                    std::memcpy(ptr, bufferInfo->data->dataPointer(), bufferInfo->range);
+                    std::memcpy(ptr, bufferInfo->data->dataPointer(), range);
 
                     // record region
-                    pRegions[regionCount++] = VkBufferCopy{offset, bufferInfo->offset, bufferInfo->range};
+                    pRegions[regionCount++] = VkBufferCopy{offset, bufferInfo->offset, range};
 
                     log(level, "       copying ", bufferInfo, ", ", bufferInfo->data, " to ", (void*)ptr);
 
-                    VkDeviceSize endOfEntry = offset + bufferInfo->range;
+                    VkDeviceSize endOfEntry = offset + range;
                     offset = (/*alignment == 1 ||*/ (endOfEntry % alignment) == 0) ? endOfEntry : ((endOfEntry / alignment) + 1) * alignment;
                 }
 
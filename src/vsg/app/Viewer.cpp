@@ -17,6 +17,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/nodes/StateGroup.h>
 #include <vsg/state/Descriptor.h>
 
+#include <algorithm>
 #include <chrono>
 #include <map>
 #include <set>
@@ -29,9 +30,11 @@ using namespace vsg;
 
 Viewer::Viewer() :
     updateOperations(UpdateOperations::create()),
+    concurrentUpdateOperations(UpdateOperations::create()),
     animationManager(AnimationManager::create()),
     status(vsg::ActivityStatus::create()),
-    _start_point(clock::now())
+    _start_point(clock::now()),
+    _frameCompleted(Latch::create(0))
 {
     CPU_INSTRUMENTATION_L1_NC(instrumentation, "Viewer costructor", COLOR_VIEWER);
 }
@@ -50,6 +53,9 @@ void Viewer::deviceWaitIdle() const
 {
     CPU_INSTRUMENTATION_L1_NC(instrumentation, "Viewer deviceWaitIdle", COLOR_VIEWER);
 
+    // the frame thread may still be submitting a pipelined frame
+    _waitForPipelinedFrame();
+
     std::set<VkDevice> devices;
     for (auto& window : _windows)
     {
@@ -165,7 +171,15 @@ bool Viewer::advanceToNextFrame(double simulationTime)
     // poll all the windows for events.
     pollEvents(true);
 
-    if (!acquireNextFrame()) return false;
+    if (pipelineFrames && frameTaskGraph)
+    {
+        warn("Viewer::pipelineFrames is not supported in combination with Viewer::frameTaskGraph, disabling pipelineFrames.");
+        _waitForPipelinedFrame();
+        pipelineFrames = false;
+    }
+
+    // when pipelining frames the acquisition of the next swapchain images is deferred to recordAndSubmit(), once the previous frame has been presented
+    if (!pipelineFrames && !acquireNextFrame()) return false;
 
     // create FrameStamp for frame
     auto time = vsg::clock::now();
@@ -192,9 +206,12 @@ bool Viewer::advanceToNextFrame(double simulationTime)
     // signal to instrumentation the start of frame
     if (instrumentation) instrumentation->enterFrame(&s_frame_source_location, frameReference, *_frameStamp);
 
-    for (auto& task : recordAndSubmitTasks)
+    if (!pipelineFrames)
     {
-        task->advance();
+        for (auto& task : recordAndSubmitTasks)
+        {
+            task->advance();
+        }
     }
 
     // create an event for the new frame.
@@ -264,6 +281,18 @@ void Viewer::handleEvents()
 {
     CPU_INSTRUMENTATION_L1_NC(instrumentation, "Viewer handle events", COLOR_UPDATE);
 
+    // event handlers may modify the scene graph and cameras so defer them to the frame boundary when pipelining frames
+    if (pipelineFrames)
+    {
+        _eventsDeferred = true;
+        return;
+    }
+
+    _dispatchEvents();
+}
+
+void Viewer::_dispatchEvents()
+{
     for (auto& vsg_event : _events)
     {
         for (auto& handler : _eventHandlers)
@@ -277,6 +306,8 @@ void Viewer::compile(ref_ptr<ResourceHints> hints)
 {
     CPU_INSTRUMENTATION_L1_NC(instrumentation, "Viewer compile", COLOR_COMPILE);
 
+    _waitForPipelinedFrame();
+
     if (recordAndSubmitTasks.empty())
     {
         return;
@@ -415,6 +446,12 @@ void Viewer::compile(ref_ptr<ResourceHints> hints)
         databasePager->compileManager = compileManager;
     }
 
+    // assign CompileManager to TextureStreaming
+    if (textureStreaming && !textureStreaming->compileManager)
+    {
+        textureStreaming->compileManager = compileManager;
+    }
+
     // record any transfer commands
     for (auto& dp : deviceResourceMap)
     {
@@ -445,10 +482,16 @@ void Viewer::assignRecordAndSubmitTaskAndPresentation(CommandGraphs in_commandGr
 {
     CPU_INSTRUMENTATION_L1_NC(instrumentation, "Viewer assignRecordAndSubmitTaskAndPresentation", COLOR_VIEWER);
 
+    _waitForPipelinedFrame();
+
     // now remove any commandGraphs associated with window
     bool needToStartThreading = _threading;
     if (_threading) stopThreading();
 
+    auto operationThreads = frameTaskGraph ? frameTaskGraph->operationThreads : ref_ptr<OperationThreads>();
+    bool needToSetupFrameTaskGraph = frameTaskGraph.valid();
+    frameTaskGraph = {};
+
     // if a DatabasePager is already assigned re-assign
     ref_ptr<DatabasePager> databasePager;
     for (auto& task : recordAndSubmitTasks)
@@ -602,6 +645,7 @@ void Viewer::assignRecordAndSubmitTaskAndPresentation(CommandGraphs in_commandGr
     }
 
     if (needToStartThreading) setupThreading();
+    if (needToSetupFrameTaskGraph) setupFrameTaskGraph(operationThreads);
 }
 
 void Viewer::addRecordAndSubmitTaskAndPresentation(CommandGraphs commandGraphs)
@@ -629,6 +673,9 @@ void Viewer::setupThreading()
 {
     stopThreading();
 
+    // threads replace any previously set up frame task graph
+    frameTaskGraph = {};
+
     // check how many valid tasks there are.
     uint32_t numValidTasks = 0;
     for (auto& task : recordAndSubmitTasks)
@@ -797,6 +844,8 @@ void Viewer::stopThreading()
 {
     CPU_INSTRUMENTATION_L1_NC(instrumentation, "Viewer stopThreading", COLOR_VIEWER);
 
+    _waitForPipelinedFrame();
+
     if (!_threading) return;
     _threading = false;
 
@@ -814,10 +863,191 @@ void Viewer::stopThreading()
     threads.clear();
 }
 
+void Viewer::_updateMemoryPressure()
+{
+    // refresh the memory budgets and pass on the memory pressure so paging and texture streaming can cut back before allocations fail
+    MemoryPressure memoryPressure = MEMORY_PRESSURE_NONE;
+    std::set<Device*> devices;
+    for (auto& task : recordAndSubmitTasks)
+    {
+        if (task->device && task->device->memoryBudget && devices.insert(task->device.get()).second)
+        {
+            task->device->memoryBudget->update();
+            memoryPressure = std::max(memoryPressure, task->device->memoryBudget->pressure());
+        }
+    }
+
+    for (auto& task : recordAndSubmitTasks)
+    {
+        if (task->databasePager) task->databasePager->memoryPressure = memoryPressure;
+    }
+
+    if (textureStreaming) textureStreaming->memoryPressure = memoryPressure;
+}
+
+void Viewer::setupFrameTaskGraph(ref_ptr<OperationThreads> operationThreads)
+{
+    CPU_INSTRUMENTATION_L1_NC(instrumentation, "Viewer setupFrameTaskGraph", COLOR_VIEWER);
+
+    stopThreading();
+
+    if (pipelineFrames)
+    {
+        warn("Viewer::pipelineFrames is not supported in combination with Viewer::frameTaskGraph, disabling pipelineFrames.");
+        pipelineFrames = false;
+    }
+
+    if (!operationThreads)
+    {
+        uint32_t numThreads = std::thread::hardware_concurrency();
+        operationThreads = OperationThreads::create(numThreads > 1 ? numThreads - 1 : 0);
+    }
+
+    frameTaskGraph = FrameTaskGraph::create(operationThreads);
+
+    // results shared between the tasks of each frame
+    struct FrameData : public Inherit<Object, FrameData>
+    {
+        std::vector<CompileResult> compileResults;
+        std::vector<VkResult> startResults;
+    };
+
+    // RecordAndSubmitTasks may share a DatabasePager so only merge each DatabasePager once as concurrent updateSceneGraph() calls on the same DatabasePager would race
+    std::vector<ref_ptr<DatabasePager>> databasePagers;
+    for (auto& task : recordAndSubmitTasks)
+    {
+        if (task->databasePager && std::find(databasePagers.begin(), databasePagers.end(), task->databasePager) == databasePagers.end())
+        {
+            databasePagers.push_back(task->databasePager);
+        }
+    }
+
+    auto data = FrameData::create();
+    data->compileResults.resize(databasePagers.size() + 1);
+    data->startResults.resize(recordAndSubmitTasks.size(), VK_SUCCESS);
+
+    auto& graph = *frameTaskGraph;
+
+    // update tasks
+    auto memoryPressure = graph.add("Viewer memory pressure", [this]() { _updateMemoryPressure(); });
+
+    // merge any updates from the DatabasePager and TextureStreaming, each updating independent parts of the scene graph so they run in parallel
+    FrameTaskGraph::Indices merges;
+    for (size_t i = 0; i < databasePagers.size(); ++i)
+    {
+        auto mergePagedLOD = [this, data, i, databasePager = databasePagers[i]]() {
+            auto& cr = data->compileResults[i];
+            cr.reset();
+            databasePager->updateSceneGraph(_frameStamp, cr);
+        };
+        merges.push_back(graph.add(make_string("DatabasePager merge ", i), mergePagedLOD, {memoryPressure}));
+    }
+
+    auto mergeTextures = [this, data]() {
+        auto& cr = data->compileResults.back();
+        cr.reset();
+        if (textureStreaming) textureStreaming->updateSceneGraph(_frameStamp, cr);
+    };
+    merges.push_back(graph.add("TextureStreaming merge", mergeTextures, {memoryPressure}));
+
+    auto updateCompileResults = [this, data]() {
+        for (auto& cr : data->compileResults)
+        {
+            if (cr.requiresViewerUpdate()) updateViewer(*this, cr);
+        }
+    };
+    auto viewerUpdate = graph.add("Viewer updateViewer", updateCompileResults, merges);
+
+    // concurrentUpdateOperations don't modify the scene graph directly so run in parallel with the merges, any changes they pass on via addUpdateOperation() are run by the update operations task
+    auto concurrentOperations = graph.add("Viewer concurrent update operations", [this]() { concurrentUpdateOperations->run(); }, {memoryPressure});
+
+    auto operations = graph.add("Viewer update operations", [this]() { updateOperations->run(); }, {viewerUpdate, concurrentOperations});
+    auto animations = graph.add("Viewer animations", [this]() { animationManager->run(_frameStamp); }, {operations});
+
+    // record and submission tasks
+    auto resetCommandGraphs = [this]() {
+        for (auto& task : recordAndSubmitTasks)
+        {
+            for (auto& commandGraph : task->commandGraphs) commandGraph->reset();
+        }
+    };
+    auto reset = graph.add("CommandGraph reset", resetCommandGraphs, {animations});
+
+    FrameTaskGraph::Indices finishes;
+    for (size_t i = 0; i < recordAndSubmitTasks.size(); ++i)
+    {
+        auto& task = recordAndSubmitTasks[i];
+        if (task->commandGraphs.empty()) continue;
+
+        auto recordedCommandBuffers = RecordedCommandBuffers::create();
+
+        // waiting on the fence of the frame that last used this task's resources doesn't depend on the update so overlaps with it
+        auto startTask = [this, data, i, task]() {
+            auto& result = data->startResults[i];
+            result = task->start();
+            if (result == VK_SUCCESS) return;
+
+            warn("RecordAndSubmitTask::start() VkResult = ", result, ", frame not recorded.");
+
+            // a lost device can't be recovered so exit main loop, run() completes before the main thread checks _close.
+            if (result == VK_ERROR_DEVICE_LOST) _close = true;
+        };
+        auto start = graph.add(make_string("RecordAndSubmitTask start ", i), startTask);
+
+        FrameTaskGraph::Indices recorded;
+        for (size_t j = 0; j < task->commandGraphs.size(); ++j)
+        {
+            auto record = [this, data, i, task, recordedCommandBuffers, commandGraph = task->commandGraphs[j]]() {
+                if (data->startResults[i] != VK_SUCCESS) return;
+                commandGraph->record(recordedCommandBuffers, _frameStamp, task->databasePager);
+            };
+            recorded.push_back(graph.add(make_string("CommandGraph record ", i, ".", j), record, {start, reset}));
+        }
+
+        if (task->earlyTransferTask)
+        {
+            auto transfer = [data, i, task]() {
+                if (data->startResults[i] != VK_SUCCESS) return;
+                task->earlyTransferTask->transferDynamicData();
+            };
+            recorded.push_back(graph.add(make_string("TransferTask transfer ", i), transfer, {start, animations}));
+        }
+
+        // keep the submissions in the same order as the RecordAndSubmitTasks so semaphore signals are submitted before their waits
+        if (!finishes.empty()) recorded.push_back(finishes.back());
+
+        auto finish = [data, i, task, recordedCommandBuffers]() {
+            // the fence wasn't reset so the recorded CommandBuffers can't be submitted with it
+            if (data->startResults[i] == VK_SUCCESS)
+            {
+                if (VkResult result = task->finish(recordedCommandBuffers); result != VK_SUCCESS) warn("RecordAndSubmitTask::finish() VkResult = ", result);
+            }
+            recordedCommandBuffers->clear();
+        };
+        finishes.push_back(graph.add(make_string("RecordAndSubmitTask finish ", i), finish, recorded));
+    }
+}
+
 void Viewer::update()
 {
     CPU_INSTRUMENTATION_L1_NC(instrumentation, "Viewer update", COLOR_UPDATE);
 
+    // the update work is run as part of the frame task graph by recordAndSubmit()
+    if (frameTaskGraph) return;
+
+    _updateMemoryPressure();
+
+    // run the update operations that may run in parallel with the recording of the previous frame
+    concurrentUpdateOperations->run();
+
+    // when pipelining frames the changes to the scene graph are committed at the frame boundary by recordAndSubmit()
+    if (pipelineFrames) return;
+
+    _updateSceneGraph();
+}
+
+void Viewer::_updateSceneGraph()
+{
     // merge any updates from the DatabasePager
     for (auto& task : recordAndSubmitTasks)
     {
@@ -829,6 +1059,14 @@ void Viewer::update()
         }
     }
 
+    // merge any changes in resident mip levels from the TextureStreaming
+    if (textureStreaming)
+    {
+        CompileResult cr;
+        textureStreaming->updateSceneGraph(_frameStamp, cr);
+        if (cr.requiresViewerUpdate()) updateViewer(*this, cr);
+    }
+
     // run update operations
     updateOperations->run();
 
@@ -840,6 +1078,23 @@ void Viewer::recordAndSubmit()
 {
     CPU_INSTRUMENTATION_L1_NC(instrumentation, "Viewer recordAndSubmitTask", COLOR_VIEWER);
 
+    if (frameTaskGraph)
+    {
+        frameTaskGraph->run();
+        return;
+    }
+
+    if (pipelineFrames)
+    {
+        _recordAndSubmitPipelined();
+        return;
+    }
+
+    _recordAndSubmit(_frameStamp);
+}
+
+void Viewer::_recordAndSubmit(ref_ptr<FrameStamp> frameStamp)
+{
     // reset connected ExecuteCommands
     for (auto& recordAndSubmitTask : recordAndSubmitTasks)
     {
@@ -855,25 +1110,106 @@ void Viewer::recordAndSubmit()
     // The following is a workaround for an odd "Possible data race during write of size 1" warning that valgrind tool=helgrind reports
     // on the first call to vkBeginCommandBuffer despite them being done on independent command buffers.  This could well be a driver bug or a false positive.
     // If you want to quieten this warning then change the #if above to #if 0 as rendering the first three frames single threaded avoids the warning.
-    if (_threading && _frameStamp->frameCount > 2)
+    if (_threading && frameStamp->frameCount > 2)
 #endif
     {
-        _frameBlock->set(_frameStamp);
+        _frameBlock->set(frameStamp);
         _submissionCompleted->arrive_and_wait();
     }
     else
     {
         for (auto& recordAndSubmitTask : recordAndSubmitTasks)
         {
-            recordAndSubmitTask->submit(_frameStamp);
+            recordAndSubmitTask->submit(frameStamp);
         }
     }
 }
 
+void Viewer::_recordAndSubmitPipelined()
+{
+    // wait for the previous frame to be recorded, submitted and presented before the windows, tasks or scene graph are modified
+    _waitForPipelinedFrame();
+
+    // pass on any exception thrown by the frame thread while recording, submitting or presenting the previous frame
+    if (_frameException)
+    {
+        auto exception = _frameException;
+        _frameException = nullptr;
+        std::rethrow_exception(exception);
+    }
+
+    // as in the non pipelined advanceToNextFrame(), exit the main loop when the swapchain images can't be acquired, i.e. on VK_ERROR_DEVICE_LOST
+    if (!acquireNextFrame())
+    {
+        _close = true;
+        return;
+    }
+
+    for (auto& task : recordAndSubmitTasks)
+    {
+        task->advance();
+    }
+
+    // commit the changes to the scene graph deferred while the previous frame was being recorded
+    if (_eventsDeferred)
+    {
+        _eventsDeferred = false;
+        _dispatchEvents();
+    }
+
+    _updateSceneGraph();
+
+    struct RecordSubmitAndPresent : public Inherit<Operation, RecordSubmitAndPresent>
+    {
+        RecordSubmitAndPresent(Viewer* in_viewer, ref_ptr<FrameStamp> in_frameStamp) :
+            viewer(in_viewer), frameStamp(in_frameStamp) {}
+
+        Viewer* viewer;
+        ref_ptr<FrameStamp> frameStamp;
+
+        void run() override
+        {
+            // the main thread waits on _frameCompleted so it has to be counted down even if recording, submission or presentation throws
+            try
+            {
+                viewer->_recordAndSubmit(frameStamp);
+
+                for (auto& presentation : viewer->presentations)
+                {
+                    presentation->present();
+                }
+            }
+            catch (...)
+            {
+                viewer->_frameException = std::current_exception();
+            }
+
+            viewer->_frameCompleted->count_down();
+        }
+    };
+
+    if (!_frameThread) _frameThread = OperationThreads::create(1);
+
+    _frameCompleted->set(1);
+    _frameThread->add(RecordSubmitAndPresent::create(this, _frameStamp));
+}
+
+void Viewer::_waitForPipelinedFrame() const
+{
+    if (_frameCompleted->is_ready()) return;
+
+    CPU_INSTRUMENTATION_L1_NC(instrumentation, "Viewer wait for pipelined frame", COLOR_VIEWER);
+
+    _frameCompleted->wait();
+}
+
 void Viewer::present()
 {
     CPU_INSTRUMENTATION_L1_NC(instrumentation, "Viewer present", COLOR_VIEWER);
 
+    // pipelined frames are presented by the frame thread
+    if (pipelineFrames) return;
+
     for (auto& presentation : presentations)
     {
         presentation->present();
@@ -37,4 +37,7 @@ void NextSubPass::write(Output& output) const
 void NextSubPass::record(CommandBuffer& commandBuffer) const
 {
     vkCmdNextSubpass(commandBuffer, contents);
+
+    ++commandBuffer.subpass;
+    commandBuffer.subpassContents = contents;
 }
@@ -565,6 +565,10 @@ void ConstVisitor::apply(const CullNode& value)
 {
     apply(static_cast<const Node&>(value));
 }
+void ConstVisitor::apply(const SpatialGroup& value)
+{
+    apply(static_cast<const Group&>(value));
+}
 void ConstVisitor::apply(const Transform& value)
 {
     apply(static_cast<const Group&>(value));
@@ -573,6 +577,10 @@ void ConstVisitor::apply(const MatrixTransform& value)
 {
     apply(static_cast<const Transform&>(value));
 }
+void ConstVisitor::apply(const CoordinateFrame& value)
+{
+    apply(static_cast<const Transform&>(value));
+}
 void ConstVisitor::apply(const Geometry& value)
 {
     apply(static_cast<const Command&>(value));
@@ -76,6 +76,13 @@ size_t MemorySlots::totalReservedSize() const
     return totalSize;
 }
 
+double MemorySlots::fragmentation() const
+{
+    size_t availableSize = totalAvailableSize();
+    if (availableSize == 0) return 0.0;
+    return 1.0 - static_cast<double>(maximumAvailableSpace()) / static_cast<double>(availableSize);
+}
+
 bool MemorySlots::check() const
 {
     if (_availableMemory.size() != _offsetSizes.size())
@@ -565,6 +565,10 @@ void Visitor::apply(CullNode& value)
 {
     apply(static_cast<Node&>(value));
 }
+void Visitor::apply(SpatialGroup& value)
+{
+    apply(static_cast<Group&>(value));
+}
 void Visitor::apply(Transform& value)
 {
     apply(static_cast<Group&>(value));
@@ -573,6 +577,10 @@ void Visitor::apply(MatrixTransform& value)
 {
     apply(static_cast<Transform&>(value));
 }
+void Visitor::apply(CoordinateFrame& value)
+{
+    apply(static_cast<Transform&>(value));
+}
 void Visitor::apply(Geometry& value)
 {
     apply(static_cast<Command&>(value));
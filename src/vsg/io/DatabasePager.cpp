@@ -110,6 +110,7 @@ DatabasePager::DatabasePager()
 
     _requestQueue = DatabaseQueue::create(_status);
     _toMergeQueue = DatabaseQueue::create(_status);
+    deleteQueue = DeleteQueue::create(_status);
 
     pagedLODContainer = PagedLODContainer::create(4000);
 }
@@ -124,6 +125,10 @@ DatabasePager::~DatabasePager()
     {
         thread.join();
     }
+
+    if (_deleteThread.joinable()) _deleteThread.join();
+
+    if (deleteQueue) deleteQueue->clear();
 }
 
 void DatabasePager::assignInstrumentation(ref_ptr<Instrumentation> in_instrumentation)
@@ -201,6 +206,27 @@ void DatabasePager::start()
     {
         _readThreads.emplace_back(read, std::ref(_requestQueue), std::ref(_status), std::ref(*this), make_string("DatabasePager thread ", i));
     }
+
+    // set up delete thread
+    auto deleteSubgraphs = [](ref_ptr<DeleteQueue> queue, DatabasePager& databasePager) {
+        debug("Started DatabasePager delete thread");
+
+        auto local_instrumentation = shareOrDuplicateForThreadSafety(databasePager.instrumentation);
+        if (local_instrumentation) local_instrumentation->setThreadName("DatabasePager delete thread");
+
+        while (queue->getStatus()->active())
+        {
+            CPU_INSTRUMENTATION_L1_NC(local_instrumentation, "DatabasePager delete", COLOR_PAGER);
+
+            queue->wait_then_clear();
+        }
+        debug("Finished DatabasePager delete thread");
+    };
+
+    if (deleteQueue && !_deleteThread.joinable())
+    {
+        _deleteThread = std::thread(deleteSubgraphs, deleteQueue, std::ref(*this));
+    }
 }
 
 void DatabasePager::request(ref_ptr<PagedLOD> plod)
@@ -247,6 +273,9 @@ void DatabasePager::updateSceneGraph(FrameStamp* frameStamp, CompileResult& cr)
 
     frameCount.exchange(frameStamp ? frameStamp->frameCount : 0);
 
+    bool deferDeletion = deleteQueue && _deleteThread.joinable();
+    if (deferDeletion) deleteQueue->advance(frameCount);
+
     auto nodes = _toMergeQueue->take_all(cr);
 
     if (culledPagedLODs)
@@ -256,24 +285,14 @@ void DatabasePager::updateSceneGraph(FrameStamp* frameStamp, CompileResult& cr)
 
         for (auto& plod : culledPagedLODs->highresCulled)
         {
-            if ((plod->index != 0) && (elements[plod->index].list == &(pagedLODContainer->activeList)) && !plod->highResActive(frameCount))
+            if ((plod->index != 0) && (elements[plod->index].list == &(pagedLODContainer->activeList)) && !plod->highResActive(frameCount, pagedLODContainer->inactiveAge))
             {
                 pagedLODContainer->inactive(plod);
             }
         }
 
-        auto& activeList = pagedLODContainer->activeList;
-        for (uint32_t index = activeList.head; index != 0;)
-        {
-            auto& element = elements[index];
-            index = element.next;
-
-            if (!element.plod->highResActive(frameCount))
-            {
-                // debug("   active to inactive ", index);
-                pagedLODContainer->inactive(element.plod.get());
-            }
-        }
+        // move the active PagedLOD that are no longer being traversed to the inactive list, only visiting those that may have aged out
+        pagedLODContainer->expire(frameCount);
 
         // debug("  newly active nodes:");
 
@@ -296,9 +315,11 @@ void DatabasePager::updateSceneGraph(FrameStamp* frameStamp, CompileResult& cr)
 
         debug("DatabasePager : activeList.count = ", pagedLODContainer->activeList.count, ", inactiveList.count = ", pagedLODContainer->inactiveList.count, ", total = ", total);
 
-        if ((nodes.size() + total) > targetMaxNumPagedLODWithHighResSubgraphs)
+        uint32_t targetMax = static_cast<uint32_t>(static_cast<double>(targetMaxNumPagedLODWithHighResSubgraphs) * memoryPressureRatio(memoryPressure.load()));
+
+        if ((nodes.size() + total) > targetMax)
         {
-            uint32_t numPagedLODHighRestSubgraphsToRemove = (static_cast<uint32_t>(nodes.size()) + total) - targetMaxNumPagedLODWithHighResSubgraphs;
+            uint32_t numPagedLODHighRestSubgraphsToRemove = (static_cast<uint32_t>(nodes.size()) + total) - targetMax;
             uint32_t targetNumInactive = (numPagedLODHighRestSubgraphsToRemove < pagedLODContainer->inactiveList.count) ? (pagedLODContainer->inactiveList.count - numPagedLODHighRestSubgraphsToRemove) : 0;
 
             debug("Need to remove, inactive count = ", pagedLODContainer->inactiveList.count, ", target = ", targetNumInactive);
@@ -308,9 +329,15 @@ void DatabasePager::updateSceneGraph(FrameStamp* frameStamp, CompileResult& cr)
                 auto& element = elements[index];
                 index = element.next;
 
+                // keep recently merged subgraphs resident
+                if ((frameCount - element.plod->frameHighResMerged) < minimumHighResResidency) continue;
+
                 if (compare_exchange(element.plod->requestStatus, PagedLOD::NoRequest, PagedLOD::DeleteRequest))
                 {
                     ref_ptr<PagedLOD> plod = element.plod;
+
+                    // hand the subgraph to the delete thread so that its deletion doesn't stall the frame
+                    if (deferDeletion) deleteQueue->add(plod->children[0].node);
                     plod->children[0].node = nullptr;
                     plod->requestCount.exchange(0);
                     plod->requestStatus.exchange(PagedLOD::NoRequest);
@@ -343,6 +370,8 @@ void DatabasePager::updateSceneGraph(FrameStamp* frameStamp, CompileResult& cr)
                     plod->children[0].node = plod->pending;
                 }
 
+                plod->frameHighResMerged = frameCount;
+
                 plod->requestStatus.exchange(PagedLOD::NoRequest);
             }
         }
@@ -172,10 +172,12 @@ ObjectFactory::ObjectFactory()
     add<vsg::StateGroup>();
     add<vsg::CullGroup>();
     add<vsg::CullNode>();
+    add<vsg::SpatialGroup>();
     add<vsg::LOD>();
     add<vsg::PagedLOD>();
     add<vsg::AbsoluteTransform>();
     add<vsg::MatrixTransform>();
+    add<vsg::CoordinateFrame>();
     add<vsg::Geometry>();
     add<vsg::VertexDraw>();
     add<vsg::VertexIndexDraw>();
@@ -186,6 +188,8 @@ ObjectFactory::ObjectFactory()
     add<vsg::TileDatabase>();
     add<vsg::TileDatabaseSettings>();
     add<vsg::InstrumentationNode>();
+    add<vsg::StreamedTextureGroup>();
+    add<vsg::CachedCommandGroup>();
 
     // lighting
     add<vsg::Light>();
@@ -231,6 +235,9 @@ ObjectFactory::ObjectFactory()
     add<vsg::DescriptorImage>();
     add<vsg::DescriptorBuffer>();
     add<vsg::Sampler>();
+    add<vsg::StreamedTexture>();
+    add<vsg::VirtualTexture>();
+    add<vsg::BindVirtualTextureTile>();
     add<vsg::PushConstants>();
     add<vsg::ResourceHints>();
     add<vsg::StateSwitch>();
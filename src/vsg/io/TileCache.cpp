@@ -0,0 +1,329 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2025 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/io/FileSystem.h>
+#include <vsg/io/Logger.h>
+#include <vsg/io/Options.h>
+#include <vsg/io/TileCache.h>
+#include <vsg/io/VSG.h>
+#include <vsg/io/stream.h>
+#include <vsg/utils/GenerateMipmaps.h>
+
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <set>
+#include <sstream>
+
+using namespace vsg;
+
+static const char* s_indexFilename = "tilecache.index";
+
+static uint64_t fileSize(const Path& path)
+{
+    FILE* file = vsg::fopen(path, "rb");
+    if (!file) return 0;
+
+    std::fseek(file, 0, SEEK_END);
+    auto size = std::ftell(file);
+    std::fclose(file);
+
+    return size > 0 ? static_cast<uint64_t>(size) : 0;
+}
+
+static bool removeFile(const Path& path)
+{
+#if defined(_MSC_VER) || defined(__MINGW32__)
+    return _wremove(path.c_str()) == 0;
+#else
+    return std::remove(path.c_str()) == 0;
+#endif
+}
+
+static bool renameFile(const Path& from, const Path& to)
+{
+#if defined(_MSC_VER) || defined(__MINGW32__)
+    _wremove(to.c_str());
+    return _wrename(from.c_str(), to.c_str()) == 0;
+#else
+    return std::rename(from.c_str(), to.c_str()) == 0;
+#endif
+}
+
+TileCache::TileCache(const Path& in_directory, uint64_t in_maxSize) :
+    directory(in_directory),
+    maxSize(in_maxSize)
+{
+    _writeOptions = Options::create();
+    _writeOptions->extensionHint = ".vsgb";
+
+    if (!fileExists(directory)) makeDirectory(directory);
+
+    _readIndex();
+}
+
+TileCache::~TileCache()
+{
+    flush();
+}
+
+Path TileCache::getTilePath(const Path& layer, uint32_t x, uint32_t y, uint32_t level) const
+{
+    // FNV-1a hash of the layer so that the file names are stable across sessions and platforms
+    uint64_t hash = 14695981039346656037ull;
+    for (auto c : layer.string())
+    {
+        hash = (hash ^ static_cast<uint8_t>(c)) * 1099511628211ull;
+    }
+
+    std::ostringstream filename;
+    filename << std::hex << std::setw(16) << std::setfill('0') << hash << std::dec << "_" << level << "_" << x << "_" << y << ".vsgb";
+    return directory / filename.str();
+}
+
+void TileCache::_readIndex()
+{
+    // the index records the usage order from previous sessions, least recently used first
+    std::vector<std::pair<Path, uint64_t>> indexed;
+    if (FILE* file = vsg::fopen(directory / s_indexFilename, "r"))
+    {
+        unsigned long long size = 0;
+        char filename[256];
+        while (std::fscanf(file, "%llu %255s", &size, filename) == 2)
+        {
+            indexed.emplace_back(Path(filename), static_cast<uint64_t>(size));
+        }
+        std::fclose(file);
+    }
+
+    std::set<Path> indexedFilenames;
+    for (auto& entry : indexed) indexedFilenames.insert(entry.first);
+
+    std::set<Path> onDisk;
+    for (auto& filename : getDirectoryContents(directory))
+    {
+        if (lowerCaseFileExtension(filename) == ".vsgb") onDisk.insert(filename);
+    }
+
+    // tiles on disk but missing from the index, such as from a session that didn't flush, are treated as least recently used
+    for (auto& filename : onDisk)
+    {
+        if (indexedFilenames.count(filename) != 0) continue;
+
+        auto& entry = _entries[filename];
+        entry.size = fileSize(directory / filename);
+        entry.position = _usageOrder.insert(_usageOrder.end(), filename);
+        _statistics.totalSize += entry.size;
+    }
+
+    for (auto& [filename, size] : indexed)
+    {
+        if (onDisk.count(filename) == 0 || _entries.count(filename) != 0) continue;
+
+        auto& entry = _entries[filename];
+        entry.size = size;
+        entry.position = _usageOrder.insert(_usageOrder.end(), filename);
+        _statistics.totalSize += entry.size;
+    }
+
+    _statistics.numTiles = _entries.size();
+
+    debug("TileCache::TileCache(", directory, ") numTiles = ", _statistics.numTiles, ", totalSize = ", _statistics.totalSize);
+}
+
+bool TileCache::flush()
+{
+    std::scoped_lock<std::mutex> lock(_mutex);
+
+    auto indexPath = directory / s_indexFilename;
+    auto tempPath = indexPath;
+    tempPath.concat(".tmp");
+
+    FILE* file = vsg::fopen(tempPath, "w");
+    if (!file) return false;
+
+    for (auto& filename : _usageOrder)
+    {
+        std::fprintf(file, "%llu %s\n", static_cast<unsigned long long>(_entries[filename].size), filename.string().c_str());
+    }
+    std::fclose(file);
+
+    return renameFile(tempPath, indexPath);
+}
+
+void TileCache::_touch(const Path& filename)
+{
+    auto itr = _entries.find(filename);
+    if (itr == _entries.end()) return;
+
+    _usageOrder.splice(_usageOrder.end(), _usageOrder, itr->second.position);
+}
+
+bool TileCache::contains(const Path& layer, uint32_t x, uint32_t y, uint32_t level) const
+{
+    auto filename = simpleFilename(getTilePath(layer, x, y, level));
+    filename.concat(".vsgb");
+
+    std::scoped_lock<std::mutex> lock(_mutex);
+    return _entries.count(filename) != 0;
+}
+
+ref_ptr<Data> TileCache::encode(ref_ptr<Data> data) const
+{
+    if (!compressionSettings || !data) return data;
+
+    // only encode formats the block compressor supports, such as 8 bit imagery, leaving elevation data untouched
+    if (selectBlockCompressedFormat(data->properties.format, *compressionSettings) == VK_FORMAT_UNDEFINED) return data;
+
+    // block compressed images can't have their mipmaps generated on the GPU, so unless the tile provides its own mipmaps
+    // generate the full chain on the CPU to match the Sampler::maxLod that tile assigns from TileDatabaseSettings::mipmapLevelsHint
+    ref_ptr<const BlockCompressionSettings> settings = compressionSettings;
+    if (!compressionSettings->mipmapSettings && data->properties.maxNumMipmaps <= 1)
+    {
+        auto mipmappedSettings = BlockCompressionSettings::create(*compressionSettings);
+        mipmappedSettings->mipmapSettings = MipmapSettings::create();
+        settings = mipmappedSettings;
+    }
+
+    auto compressed = compressImage(data, settings);
+    return compressed ? compressed : data;
+}
+
+ref_ptr<Data> TileCache::read(const Path& layer, uint32_t x, uint32_t y, uint32_t level)
+{
+    auto path = getTilePath(layer, x, y, level);
+    auto filename = simpleFilename(path);
+    filename.concat(".vsgb");
+
+    {
+        std::scoped_lock<std::mutex> lock(_mutex);
+        if (_entries.count(filename) == 0)
+        {
+            ++_statistics.numMisses;
+            return {};
+        }
+    }
+
+    // read outside the lock so that multiple threads can read from the cache concurrently
+    auto data = VSG().read_cast<Data>(path);
+
+    std::scoped_lock<std::mutex> lock(_mutex);
+    if (data)
+    {
+        ++_statistics.numHits;
+        _touch(filename);
+    }
+    else
+    {
+        // tile evicted by another thread while reading, or the file is unreadable
+        ++_statistics.numMisses;
+    }
+    return data;
+}
+
+bool TileCache::write(const Path& layer, uint32_t x, uint32_t y, uint32_t level, ref_ptr<Data> data)
+{
+    if (!data) return false;
+
+    auto path = getTilePath(layer, x, y, level);
+    auto filename = simpleFilename(path);
+    filename.concat(".vsgb");
+
+    // write to a temporary file then rename so concurrent readers never see a partially written tile
+    static std::atomic_uint64_t s_tempCount{0};
+    auto tempPath = path;
+    tempPath.concat(make_string(".", s_tempCount++, ".tmp"));
+    bool written = false;
+    {
+        std::ofstream fout(tempPath, std::ios::out | std::ios::binary);
+        written = fout && VSG().write(data, fout, _writeOptions) && fout.good();
+    }
+
+    if (!written || !renameFile(tempPath, path))
+    {
+        removeFile(tempPath);
+        warn("TileCache::write() unable to write ", path);
+        return false;
+    }
+
+    uint64_t size = fileSize(path);
+
+    std::scoped_lock<std::mutex> lock(_mutex);
+
+    if (auto itr = _entries.find(filename); itr != _entries.end())
+    {
+        _statistics.totalSize -= itr->second.size;
+        itr->second.size = size;
+        _touch(filename);
+    }
+    else
+    {
+        auto& entry = _entries[filename];
+        entry.size = size;
+        entry.position = _usageOrder.insert(_usageOrder.end(), filename);
+    }
+
+    _statistics.totalSize += size;
+    _statistics.numTiles = _entries.size();
+    ++_statistics.numWrites;
+
+    _prune();
+
+    return true;
+}
+
+void TileCache::prune()
+{
+    std::scoped_lock<std::mutex> lock(_mutex);
+    _prune();
+}
+
+void TileCache::_prune()
+{
+    // evict least recently used tiles, always keeping the most recently used tile so a single oversized tile isn't immediately discarded
+    while (_statistics.totalSize > maxSize && _usageOrder.size() > 1)
+    {
+        auto filename = _usageOrder.front();
+        _usageOrder.pop_front();
+
+        auto itr = _entries.find(filename);
+        _statistics.totalSize -= itr->second.size;
+        _entries.erase(itr);
+
+        removeFile(directory / filename);
+        ++_statistics.numEvictions;
+    }
+
+    _statistics.numTiles = _entries.size();
+}
+
+void TileCache::clear()
+{
+    std::scoped_lock<std::mutex> lock(_mutex);
+
+    for (auto& filename : _usageOrder)
+    {
+        removeFile(directory / filename);
+    }
+
+    _usageOrder.clear();
+    _entries.clear();
+    _statistics.numTiles = 0;
+    _statistics.totalSize = 0;
+}
+
+TileCache::Statistics TileCache::getStatistics() const
+{
+    std::scoped_lock<std::mutex> lock(_mutex);
+    return _statistics;
+}
@@ -23,7 +23,6 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/nodes/PagedLOD.h>
 #include <vsg/nodes/StateGroup.h>
 #include <vsg/nodes/TileDatabase.h>
-#include <vsg/nodes/VertexIndexDraw.h>
 #include <vsg/state/BindDescriptorSet.h>
 #include <vsg/state/ColorBlendState.h>
 #include <vsg/state/DepthStencilState.h>
@@ -34,10 +33,14 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/state/RasterizationState.h>
 #include <vsg/state/VertexInputState.h>
 #include <vsg/state/material.h>
+#include <vsg/threading/Latch.h>
+#include <vsg/threading/OperationThreads.h>
 #include <vsg/ui/UIEvent.h>
 #include <vsg/utils/ComputeBounds.h>
 #include <vsg/vk/ResourceRequirements.h>
 
+#include <atomic>
+
 using namespace vsg;
 
 tile::tile(ref_ptr<TileDatabaseSettings> in_settings, ref_ptr<const Options> in_options) :
@@ -152,20 +155,18 @@ vsg::ref_ptr<vsg::Object> tile::read_root(vsg::ref_ptr<const vsg::Options> optio
     {
         for (uint32_t x = 0; x < settings->noX; ++x)
         {
-            auto imagePath = getTilePath(settings->imageLayer, x, y, lod);
-            auto imageTile = vsg::read_cast<vsg::Data>(imagePath, options);
+            auto imageTile = readTileData(settings->imageLayer, x, y, lod, options);
 
             if (imageTile)
             {
+                vsg::ref_ptr<vsg::Data> elevationTile;
+                if (settings->terrainLayer) elevationTile = readTileData(settings->terrainLayer, x, y, lod, options);
+
+                vsg::dsphere bound;
                 auto tile_extents = computeTileExtents(x, y, lod);
-                auto tile_node = createTile(tile_extents, imageTile);
+                auto tile_node = createTile(tile_extents, imageTile, elevationTile, PageTable::Key{lod, x, y}, bound);
                 if (tile_node)
                 {
-                    vsg::ComputeBounds computeBound;
-                    tile_node->accept(computeBound);
-                    auto& bb = computeBound.bounds;
-                    vsg::dsphere bound((bb.min.x + bb.max.x) * 0.5, (bb.min.y + bb.max.y) * 0.5, (bb.min.z + bb.max.z) * 0.5, vsg::length(bb.max - bb.min) * 0.5);
-
                     auto plod = vsg::PagedLOD::create();
                     plod->bound = bound;
                     plod->children[0] = vsg::PagedLOD::Child{0.25, {}};       // external child visible when its bound occupies more than 1/4 of the height of the window
@@ -202,6 +203,120 @@ vsg::ref_ptr<vsg::Object> tile::read_root(vsg::ref_ptr<const vsg::Options> optio
     return group;
 }
 
+vsg::ref_ptr<vsg::Data> tile::readTileData(const vsg::Path& layer, uint32_t x, uint32_t y, uint32_t level, vsg::ref_ptr<const vsg::Options> options) const
+{
+    auto& tileCache = settings->tileCache;
+    if (tileCache)
+    {
+        if (auto data = tileCache->read(layer, x, y, level)) return data;
+    }
+
+    auto data = vsg::read_cast<vsg::Data>(getTilePath(layer, x, y, level), options);
+    if (data && tileCache)
+    {
+        data = tileCache->encode(data);
+        tileCache->write(layer, x, y, level, data);
+    }
+    return data;
+}
+
+uint64_t tile::seedCache(const vsg::dbox& region, uint32_t minLevel, uint32_t maxLevel, vsg::ref_ptr<const vsg::Options> options, uint32_t numThreads) const
+{
+    auto& tileCache = settings->tileCache;
+    if (!tileCache) return 0;
+
+    struct TileKey
+    {
+        vsg::Path layer;
+        uint32_t x, y, level;
+    };
+
+    // collect the tiles of each level that overlap the region
+    std::vector<TileKey> tileKeys;
+    auto& extents = settings->extents;
+    for (uint32_t level = minLevel; level <= maxLevel; ++level)
+    {
+        uint32_t numX = settings->noX << level;
+        uint32_t numY = settings->noY << level;
+        double tileWidth = (extents.max.x - extents.min.x) / double(numX);
+        double tileHeight = (extents.max.y - extents.min.y) / double(numY);
+
+        auto tileIndex = [](double v, uint32_t num) { return static_cast<uint32_t>(std::clamp(v, 0.0, double(num - 1))); };
+        uint32_t x_begin = tileIndex(std::floor((region.min.x - extents.min.x) / tileWidth), numX);
+        uint32_t x_end = tileIndex(std::ceil((region.max.x - extents.min.x) / tileWidth) - 1.0, numX);
+        uint32_t y_begin, y_end;
+        if (settings->originTopLeft)
+        {
+            y_begin = tileIndex(std::floor((extents.max.y - region.max.y) / tileHeight), numY);
+            y_end = tileIndex(std::ceil((extents.max.y - region.min.y) / tileHeight) - 1.0, numY);
+        }
+        else
+        {
+            y_begin = tileIndex(std::floor((region.min.y - extents.min.y) / tileHeight), numY);
+            y_end = tileIndex(std::ceil((region.max.y - extents.min.y) / tileHeight) - 1.0, numY);
+        }
+
+        for (uint32_t y = y_begin; y <= y_end; ++y)
+        {
+            for (uint32_t x = x_begin; x <= x_end; ++x)
+            {
+                if (settings->imageLayer) tileKeys.push_back(TileKey{settings->imageLayer, x, y, level});
+                if (settings->terrainLayer) tileKeys.push_back(TileKey{settings->terrainLayer, x, y, level});
+            }
+        }
+    }
+
+    // fetch the tiles not already in the cache, with each thread taking the next outstanding tile
+    std::atomic_size_t nextTile{0};
+    std::atomic_uint64_t numFetched{0};
+    auto fetchTiles = [&]() {
+        for (size_t i = nextTile++; i < tileKeys.size(); i = nextTile++)
+        {
+            auto& key = tileKeys[i];
+            if (tileCache->contains(key.layer, key.x, key.y, key.level)) continue;
+
+            auto data = vsg::read_cast<vsg::Data>(getTilePath(key.layer, key.x, key.y, key.level), options);
+            if (data && tileCache->write(key.layer, key.x, key.y, key.level, tileCache->encode(data))) ++numFetched;
+        }
+    };
+
+    struct FetchTiles : public Inherit<Operation, FetchTiles>
+    {
+        FetchTiles(std::function<void()> in_fetch, ref_ptr<Latch> in_latch) :
+            fetch(in_fetch), latch(in_latch) {}
+
+        std::function<void()> fetch;
+        ref_ptr<Latch> latch;
+
+        void run() override
+        {
+            fetch();
+            latch->count_down();
+        }
+    };
+
+    if (numThreads > 1)
+    {
+        auto operationThreads = OperationThreads::create(numThreads - 1);
+        auto latch = Latch::create(static_cast<int>(numThreads - 1));
+        for (uint32_t i = 0; i < numThreads - 1; ++i) operationThreads->add(FetchTiles::create(fetchTiles, latch));
+
+        // the calling thread also fetches tiles
+        fetchTiles();
+        latch->wait();
+    }
+    else
+    {
+        fetchTiles();
+    }
+
+    tileCache->flush();
+
+    vsg::debug("tile::seedCache() fetched ", numFetched.load(), " of ", tileKeys.size(), " tiles");
+
+    return numFetched;
+}
+
 vsg::ref_ptr<vsg::Object> tile::read_subtile(uint32_t x, uint32_t y, uint32_t lod, vsg::ref_ptr<const vsg::Options> options) const
 {
     CPU_INSTRUMENTATION_L2_NC(options ? options->instrumentation.get() : nullptr, "tile read_subtile", COLOR_READ);
@@ -215,10 +330,23 @@ vsg::ref_ptr<vsg::Object> tile::read_subtile(uint32_t x, uint32_t y, uint32_t lo
     {
         uint32_t local_x;
         uint32_t local_y;
+        bool elevation;
     };
 
+    // pair up each image tile with its optional elevation tile, tiles without elevation fall back to the ellipsoid surface
+    std::map<std::pair<uint32_t, uint32_t>, std::pair<vsg::ref_ptr<vsg::Data>, vsg::ref_ptr<vsg::Data>>> tileData;
+    auto assignTileData = [&](const TileID& tileID, vsg::ref_ptr<vsg::Data> data) {
+        auto& [imageTile, elevationTile] = tileData[std::pair(tileID.local_x, tileID.local_y)];
+        if (tileID.elevation)
+            elevationTile = data;
+        else
+            imageTile = data;
+    };
+
+    // imagery and elevation tiles not found in the settings->tileCache are requested together so they share the one batched read
     vsg::Paths tiles;
     std::map<vsg::Path, TileID> pathToTileID;
+    auto& tileCache = settings->tileCache;
 
     uint32_t subtile_x = x * 2;
     uint32_t subtile_y = y * 2;
@@ -229,31 +357,55 @@ vsg::ref_ptr<vsg::Object> tile::read_subtile(uint32_t x, uint32_t y, uint32_t lo
         {
             uint32_t local_x = subtile_x + dx;
             uint32_t local_y = subtile_y + dy;
-            auto tilePath = getTilePath(settings->imageLayer, local_x, local_y, local_lod);
-            tiles.push_back(tilePath);
-            pathToTileID[tilePath] = TileID{local_x, local_y};
+
+            for (auto& [layer, elevation] : {std::pair(settings->imageLayer, false), std::pair(settings->terrainLayer, true)})
+            {
+                if (!layer) continue;
+
+                TileID tileID{local_x, local_y, elevation};
+                tileData[std::pair(local_x, local_y)];
+                if (auto cached = tileCache ? tileCache->read(layer, local_x, local_y, local_lod) : vsg::ref_ptr<vsg::Data>{})
+                {
+                    assignTileData(tileID, cached);
+                    continue;
+                }
+
+                auto tilePath = getTilePath(layer, local_x, local_y, local_lod);
+                tiles.push_back(tilePath);
+                pathToTileID[tilePath] = tileID;
+            }
         }
     }
 
-    auto pathObjects = vsg::read(tiles, options);
-
-    if (pathObjects.size() == 4)
+    if (!tiles.empty())
     {
+        auto pathObjects = vsg::read(tiles, options);
         for (auto& [tilePath, object] : pathObjects)
         {
-            auto imageTile = object.cast<vsg::Data>();
+            auto& tileID = pathToTileID[tilePath];
+            auto data = object.cast<vsg::Data>();
+            if (data && tileCache)
+            {
+                data = tileCache->encode(data);
+                tileCache->write(tileID.elevation ? settings->terrainLayer : settings->imageLayer, tileID.local_x, tileID.local_y, local_lod, data);
+            }
+            assignTileData(tileID, data);
+        }
+    }
+
+    if (tileData.size() == 4)
+    {
+        for (auto& [local_xy, data] : tileData)
+        {
+            auto& [imageTile, elevationTile] = data;
             if (imageTile)
             {
-                auto& tileID = pathToTileID[tilePath];
+                TileID tileID{local_xy.first, local_xy.second, false};
+                vsg::dsphere bound;
                 auto tile_extents = computeTileExtents(tileID.local_x, tileID.local_y, local_lod);
-                auto tile_node = createTile(tile_extents, imageTile);
+                auto tile_node = createTile(tile_extents, imageTile, elevationTile, PageTable::Key{local_lod, tileID.local_x, tileID.local_y}, bound);
                 if (tile_node)
                 {
-                    vsg::ComputeBounds computeBound;
-                    tile_node->accept(computeBound);
-                    auto& bb = computeBound.bounds;
-                    vsg::dsphere bound((bb.min.x + bb.max.x) * 0.5, (bb.min.y + bb.max.y) * 0.5, (bb.min.z + bb.max.z) * 0.5, vsg::length(bb.max - bb.min) * 0.5);
-
                     if (local_lod < settings->maxLevel)
                     {
                         auto plod = vsg::PagedLOD::create();
@@ -314,6 +466,8 @@ void tile::init(vsg::ref_ptr<const vsg::Options> options)
             _shaderSet = createFlatShadedShaderSet(options);
     }
 
+    if (options) _sharedObjects = options->sharedObjects;
+
     _sampler = vsg::Sampler::create();
     _sampler->addressModeU = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
     _sampler->addressModeV = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
@@ -365,6 +519,14 @@ void tile::init(vsg::ref_ptr<const vsg::Options> options)
     }
 
     _graphicsPipelineConfig->init();
+
+    if (auto& virtualTexture = settings->virtualTexture; virtualTexture && virtualTexture->pageBindings.empty())
+    {
+        vsg::Descriptors descriptors;
+        if (settings->ellipsoidModel) descriptors.push_back(_material);
+
+        virtualTexture->init(_sampler, _graphicsPipelineConfig->layout, _materialSetIndex, 0, descriptors);
+    }
 }
 
 vsg::ref_ptr<vsg::StateGroup> tile::createRoot() const
@@ -376,19 +538,176 @@ vsg::ref_ptr<vsg::StateGroup> tile::createRoot() const
     return root;
 }
 
-vsg::ref_ptr<vsg::Node> tile::createTile(const vsg::dbox& tile_extents, vsg::ref_ptr<vsg::Data> sourceData) const
+vsg::ref_ptr<vsg::Node> tile::createTile(const vsg::dbox& tile_extents, vsg::ref_ptr<vsg::Data> sourceData, vsg::ref_ptr<vsg::Data> elevationData, const PageTable::Key& key, vsg::dsphere& bound) const
 {
     if (settings->ellipsoidModel)
     {
-        return createECEFTile(tile_extents, sourceData);
+        return createECEFTile(tile_extents, sourceData, elevationData, key, bound);
+    }
+
+    auto tile_node = createTextureQuad(tile_extents, sourceData, key);
+    if (tile_node)
+    {
+        vsg::ComputeBounds computeBound;
+        tile_node->accept(computeBound);
+        auto& bb = computeBound.bounds;
+        bound.set((bb.min + bb.max) * 0.5, vsg::length(bb.max - bb.min) * 0.5);
+    }
+    return tile_node;
+}
+
+vsg::ref_ptr<vsg::StateCommand> tile::createTextureBinding(vsg::ref_ptr<vsg::Data> textureData, const PageTable::Key& key, const vsg::Descriptors& descriptors) const
+{
+    auto& virtualTexture = settings->virtualTexture;
+    if (virtualTexture && !virtualTexture->pageBindings.empty() && virtualTexture->compatible(*textureData))
+    {
+        // tile imagery is paged into the shared page cache so only needs a per tile reference to its page
+        return vsg::BindVirtualTextureTile::create(virtualTexture, key, textureData, _materialSetIndex);
+    }
+
+    // create texture image, material and associated DescriptorSets and binding
+    auto texture = vsg::DescriptorImage::create(_sampler, textureData, 0, 0, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER);
+
+    vsg::Descriptors tileDescriptors{texture};
+    tileDescriptors.insert(tileDescriptors.end(), descriptors.begin(), descriptors.end());
+
+    return vsg::BindDescriptorSet::create(VK_PIPELINE_BIND_POINT_GRAPHICS, _graphicsPipelineConfig->layout, _materialSetIndex, tileDescriptors);
+}
+
+template<class A>
+static bool sampleElevationArray(const vsg::Data& data, uint32_t numRows, uint32_t numCols, std::vector<double>& altitudes)
+{
+    auto heights = data.cast<A>();
+    if (!heights || heights->width() < 2 || heights->height() < 2) return false;
+
+    uint32_t width = heights->width();
+    uint32_t height = heights->height();
+    bool topLeft = heights->properties.origin == vsg::TOP_LEFT;
+
+    // bilinear sample the heightfield, which covers the whole tile, at each grid vertex
+    altitudes.resize(numRows * numCols);
+    for (uint32_t r = 0; r < numRows; ++r)
+    {
+        double t = double(r) / double(numRows - 1);
+        double j = (topLeft ? (1.0 - t) : t) * double(height - 1);
+        uint32_t j0 = std::min(static_cast<uint32_t>(j), height - 2);
+        double tr = j - double(j0);
+
+        for (uint32_t c = 0; c < numCols; ++c)
+        {
+            double i = double(c) / double(numCols - 1) * double(width - 1);
+            uint32_t i0 = std::min(static_cast<uint32_t>(i), width - 2);
+            double sr = i - double(i0);
+
+            double h00 = static_cast<double>(heights->at(i0, j0));
+            double h10 = static_cast<double>(heights->at(i0 + 1, j0));
+            double h01 = static_cast<double>(heights->at(i0, j0 + 1));
+            double h11 = static_cast<double>(heights->at(i0 + 1, j0 + 1));
+            altitudes[c + r * numCols] = (h00 * (1.0 - sr) + h10 * sr) * (1.0 - tr) + (h01 * (1.0 - sr) + h11 * sr) * tr;
+        }
+    }
+    return true;
+}
+
+bool tile::sampleElevations(const vsg::Data& elevationData, uint32_t numRows, uint32_t numCols, std::vector<double>& altitudes) const
+{
+    if (sampleElevationArray<vsg::floatArray2D>(elevationData, numRows, numCols, altitudes) ||
+        sampleElevationArray<vsg::doubleArray2D>(elevationData, numRows, numCols, altitudes) ||
+        sampleElevationArray<vsg::shortArray2D>(elevationData, numRows, numCols, altitudes) ||
+        sampleElevationArray<vsg::ushortArray2D>(elevationData, numRows, numCols, altitudes))
+    {
+        if (settings->elevationScale != 1.0)
+        {
+            for (auto& altitude : altitudes) altitude *= settings->elevationScale;
+        }
+        return true;
+    }
+
+    vsg::warn("vsg::tile::sampleElevations(..) unsupported elevation data type ", elevationData.className());
+    return false;
+}
+
+vsg::ref_ptr<vsg::BindIndexBuffer> tile::getOrCreateGridIndices(uint32_t gridSize, bool skirt) const
+{
+    std::scoped_lock<std::mutex> lock(_gridIndicesMutex);
+
+    auto& bindIndexBuffer = _gridIndices[GridIndicesKey{gridSize, skirt}];
+    if (bindIndexBuffer) return bindIndexBuffer;
+
+    uint32_t numRows = gridSize;
+    uint32_t numCols = gridSize;
+    uint32_t numGridVertices = numRows * numCols;
+    uint32_t numTriangles = (numRows - 1) * (numCols - 1) * 2;
+    if (skirt) numTriangles += 4 * (gridSize - 1) * 2;
+
+    std::vector<uint32_t> triangles;
+    triangles.reserve(numTriangles * 3);
+    auto addTriangle = [&](uint32_t i0, uint32_t i1, uint32_t i2) {
+        triangles.push_back(i0);
+        triangles.push_back(i1);
+        triangles.push_back(i2);
+    };
+
+    for (uint32_t r = 0; r < numRows - 1; ++r)
+    {
+        for (uint32_t c = 0; c < numCols - 1; ++c)
+        {
+            uint32_t vi = c + r * numCols;
+            addTriangle(vi, vi + 1, vi + numCols);
+            addTriangle(vi + numCols, vi + 1, vi + numCols + 1);
+        }
+    }
+
+    if (skirt)
+    {
+        // a and b are adjacent edge vertices ordered left to right as seen from outside the tile, sa and sb the skirt vertices below them
+        auto addSkirtQuad = [&](uint32_t a, uint32_t b, uint32_t sa, uint32_t sb) {
+            addTriangle(sa, sb, b);
+            addTriangle(sa, b, a);
+        };
+
+        uint32_t bottom = numGridVertices;
+        uint32_t top = bottom + numCols;
+        uint32_t left = top + numCols;
+        uint32_t right = left + numRows;
+        for (uint32_t c = 0; c < numCols - 1; ++c)
+        {
+            addSkirtQuad(c, c + 1, bottom + c, bottom + c + 1);
+            uint32_t vi = c + (numRows - 1) * numCols;
+            addSkirtQuad(vi + 1, vi, top + c + 1, top + c);
+        }
+        for (uint32_t r = 0; r < numRows - 1; ++r)
+        {
+            uint32_t vi = r * numCols;
+            addSkirtQuad(vi + numCols, vi, left + r + 1, left + r);
+            vi += numCols - 1;
+            addSkirtQuad(vi, vi + numCols, right + r, right + r + 1);
+        }
+    }
+
+    // use 16bit indices where possible, only the largest skirted grids need 32bit indices
+    vsg::ref_ptr<vsg::Data> indices;
+    uint32_t numVertices = skirt ? numGridVertices + 4 * gridSize : numGridVertices;
+    if (numVertices <= 65536)
+    {
+        auto ushortIndices = vsg::ushortArray::create(static_cast<uint32_t>(triangles.size()));
+        std::copy(triangles.begin(), triangles.end(), ushortIndices->begin());
+        if (_sharedObjects) _sharedObjects->share(ushortIndices);
+        indices = ushortIndices;
     }
     else
     {
-        return createTextureQuad(tile_extents, sourceData);
+        auto uintIndices = vsg::uintArray::create(static_cast<uint32_t>(triangles.size()));
+        std::copy(triangles.begin(), triangles.end(), uintIndices->begin());
+        if (_sharedObjects) _sharedObjects->share(uintIndices);
+        indices = uintIndices;
     }
+
+    bindIndexBuffer = vsg::BindIndexBuffer::create(indices);
+    return bindIndexBuffer;
 }
 
-vsg::ref_ptr<vsg::Node> tile::createECEFTile(const vsg::dbox& tile_extents, vsg::ref_ptr<vsg::Data> textureData) const
+vsg::ref_ptr<vsg::Node> tile::createECEFTile(const vsg::dbox& tile_extents, vsg::ref_ptr<vsg::Data> textureData, vsg::ref_ptr<vsg::Data> elevationData, const PageTable::Key& key, vsg::dsphere& bound) const
 {
     vsg::dvec3 center = computeLatitudeLongitudeAltitude((tile_extents.min + tile_extents.max) * 0.5);
 
@@ -399,14 +718,9 @@ vsg::ref_ptr<vsg::Node> tile::createECEFTile(const vsg::dbox& tile_extents, vsg:
                             localToWorld(1, 0), localToWorld(1, 1), localToWorld(1, 2),
                             localToWorld(2, 0), localToWorld(2, 1), localToWorld(2, 2));
 
-    // create texture image, material and associated DescriptorSets and binding
-    auto texture = vsg::DescriptorImage::create(_sampler, textureData, 0, 0, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER);
-
-    auto bindDescriptorSet = vsg::BindDescriptorSet::create(VK_PIPELINE_BIND_POINT_GRAPHICS, _graphicsPipelineConfig->layout, _materialSetIndex, vsg::Descriptors{texture, _material});
-
     // create StateGroup to bind any texture state
     auto scenegraph = vsg::StateGroup::create();
-    scenegraph->add(bindDescriptorSet);
+    scenegraph->add(createTextureBinding(textureData, key, vsg::Descriptors{_material}));
 
     // set up model transformation node
     auto transform = vsg::MatrixTransform::create(localToWorld); // VK_SHADER_STAGE_VERTEX_BIT
@@ -414,10 +728,10 @@ vsg::ref_ptr<vsg::Node> tile::createECEFTile(const vsg::dbox& tile_extents, vsg:
     // add transform to root of the scene graph
     scenegraph->addChild(transform);
 
-    uint32_t numRows = 32;
-    uint32_t numCols = 32;
-    uint32_t numVertices = numRows * numCols;
-    uint32_t numTriangles = (numRows - 1) * (numCols - 1) * 2;
+    uint32_t gridSize = settings->gridSizeForLevel(key.level);
+    uint32_t numRows = gridSize;
+    uint32_t numCols = gridSize;
+    uint32_t numGridVertices = numRows * numCols;
 
     double longitudeOrigin = tile_extents.min.x;
     double longitudeScale = (tile_extents.max.x - tile_extents.min.x) / double(numCols - 1);
@@ -433,6 +747,28 @@ vsg::ref_ptr<vsg::Node> tile::createECEFTile(const vsg::dbox& tile_extents, vsg:
         tCoordOrigin = 1.0f;
     }
 
+    // the projection only varies latitude with row and longitude with column, so convert the grid's rows and columns once then batch convert to ECEF
+    std::vector<double> latitudes(numRows);
+    std::vector<double> longitudes(numCols);
+    for (uint32_t r = 0; r < numRows; ++r)
+    {
+        latitudes[r] = computeLatitudeLongitudeAltitude(vsg::dvec3(longitudeOrigin, latitudeOrigin + double(r) * latitudeScale, 0.0)).x;
+    }
+    for (uint32_t c = 0; c < numCols; ++c)
+    {
+        longitudes[c] = computeLatitudeLongitudeAltitude(vsg::dvec3(longitudeOrigin + double(c) * longitudeScale, latitudeOrigin, 0.0)).y;
+    }
+
+    std::vector<double> altitudes;
+    bool hasElevation = elevationData && sampleElevations(*elevationData, numRows, numCols, altitudes);
+
+    std::vector<vsg::dvec3> ecefCoords(numGridVertices);
+    settings->ellipsoidModel->convertLatLongGridToECEF(latitudes.data(), numRows, longitudes.data(), numCols, hasElevation ? altitudes.data() : nullptr, ecefCoords.data());
+
+    // skirts hang down from the tile edges to hide cracks between neighbouring tiles of different resolution
+    bool skirt = hasElevation && settings->skirtRatio > 0.0;
+    uint32_t numVertices = skirt ? numGridVertices + 4 * gridSize : numGridVertices;
+
     vsg::vec4 color(1.0f, 1.0f, 1.0f, 1.0f);
 
     // set up vertex coords
@@ -440,66 +776,68 @@ vsg::ref_ptr<vsg::Node> tile::createECEFTile(const vsg::dbox& tile_extents, vsg:
     auto normals = vsg::vec3Array::create(numVertices);
     auto texcoords = vsg::vec2Array::create(numVertices);
     auto colors = vsg::vec4Value::create(color);
+
+    // track the extents of the tile surface, excluding the skirts, so the bounding sphere tightly fits the elevation range
+    vsg::dbox surfaceExtents;
     for (uint32_t r = 0; r < numRows; ++r)
     {
         for (uint32_t c = 0; c < numCols; ++c)
         {
-            vsg::dvec3 location(longitudeOrigin + double(c) * longitudeScale, latitudeOrigin + double(r) * latitudeScale, 0.0);
-            vsg::dvec3 latitudeLongitudeAltitude = computeLatitudeLongitudeAltitude(location);
-
-            auto ecef = settings->ellipsoidModel->convertLatLongAltitudeToECEF(latitudeLongitudeAltitude);
-            vsg::vec3 vertex(worldToLocal * ecef);
-            vsg::vec3 normal(normalize(ecef * normalMatrix));
-            vsg::vec2 texcoord(float(c) * sCoordScale, tCoordOrigin + float(r) * tCoordScale);
-
             uint32_t vi = c + r * numCols;
-            vertices->set(vi, vertex);
-            texcoords->set(vi, texcoord);
-            normals->set(vi, normal);
+            auto& ecef = ecefCoords[vi];
+            surfaceExtents.add(ecef);
+            vertices->set(vi, vsg::vec3(worldToLocal * ecef));
+            normals->set(vi, vsg::vec3(normalize(ecef * normalMatrix)));
+            texcoords->set(vi, vsg::vec2(float(c) * sCoordScale, tCoordOrigin + float(r) * tCoordScale));
         }
     }
 
-    // set up indices
-    auto indices = vsg::ushortArray::create(numTriangles * 3);
-    auto itr = indices->begin();
-    for (uint32_t r = 0; r < numRows - 1; ++r)
+    if (skirt)
     {
-        for (uint32_t c = 0; c < numCols - 1; ++c)
-        {
-            uint32_t vi = c + r * numCols;
-            (*itr++) = vi;
-            (*itr++) = vi + 1;
-            (*itr++) = vi + numCols;
-            (*itr++) = vi + numCols;
-            (*itr++) = vi + 1;
-            (*itr++) = vi + numCols + 1;
-        }
+        float skirtDepth = static_cast<float>(settings->skirtRatio * vsg::length(ecefCoords[numCols - 1] - ecefCoords[0]));
+
+        // skirt vertices are laid out as the bottom row, top row, left column then right column, matching getOrCreateGridIndices(gridSize, true)
+        auto addSkirtVertex = [&](uint32_t si, uint32_t vi) {
+            vertices->set(si, vertices->at(vi) - normals->at(vi) * skirtDepth);
+            normals->set(si, normals->at(vi));
+            texcoords->set(si, texcoords->at(vi));
+        };
+
+        uint32_t si = numGridVertices;
+        for (uint32_t c = 0; c < numCols; ++c) addSkirtVertex(si++, c);
+        for (uint32_t c = 0; c < numCols; ++c) addSkirtVertex(si++, c + (numRows - 1) * numCols);
+        for (uint32_t r = 0; r < numRows; ++r) addSkirtVertex(si++, r * numCols);
+        for (uint32_t r = 0; r < numRows; ++r) addSkirtVertex(si++, (numCols - 1) + r * numCols);
     }
 
+    vsg::dvec3 boundCenter = (surfaceExtents.min + surfaceExtents.max) * 0.5;
+    double radius2 = 0.0;
+    for (auto& ecef : ecefCoords) radius2 = std::max(radius2, vsg::length2(ecef - boundCenter));
+    // pad the radius to cover the rounding of the vertices to float in the tile's local coordinate frame
+    bound.set(boundCenter, std::sqrt(radius2) * (1.0 + 1e-6));
+
+    // indices are identical for all tiles with the same grid size so share the index buffer binding
+    auto bindIndexBuffer = getOrCreateGridIndices(gridSize, skirt);
+    uint32_t indexCount = static_cast<uint32_t>(bindIndexBuffer->indices->data->valueCount());
+
     // setup geometry
-    auto vid = vsg::VertexIndexDraw::create();
-    vid->assignArrays(vsg::DataList{vertices, normals, texcoords, colors});
-    vid->assignIndices(indices);
-    vid->indexCount = static_cast<uint32_t>(indices->size());
-    vid->instanceCount = 1;
+    auto drawCommands = vsg::Commands::create();
+    drawCommands->addChild(vsg::BindVertexBuffers::create(0, vsg::DataList{vertices, normals, texcoords, colors}));
+    drawCommands->addChild(bindIndexBuffer);
+    drawCommands->addChild(vsg::DrawIndexed::create(indexCount, 1, 0, 0, 0));
 
-    transform->addChild(vid);
+    transform->addChild(drawCommands);
 
     return scenegraph;
 }
 
-vsg::ref_ptr<vsg::Node> tile::createTextureQuad(const vsg::dbox& tile_extents, vsg::ref_ptr<vsg::Data> textureData) const
+vsg::ref_ptr<vsg::Node> tile::createTextureQuad(const vsg::dbox& tile_extents, vsg::ref_ptr<vsg::Data> textureData, const PageTable::Key& key) const
 {
     if (!textureData) return {};
 
-    // create texture image and associated DescriptorSets and binding
-    auto texture = vsg::DescriptorImage::create(_sampler, textureData, 0, 0, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER);
-
-    auto bindDescriptorSet = vsg::BindDescriptorSet::create(VK_PIPELINE_BIND_POINT_GRAPHICS, _graphicsPipelineConfig->layout, _materialSetIndex, vsg::Descriptors{texture});
-
     // create StateGroup to bind any texture state
     auto scenegraph = vsg::StateGroup::create();
-    scenegraph->add(bindDescriptorSet);
+    scenegraph->add(createTextureBinding(textureData, key, {}));
 
     // set up model transformation node
     auto transform = vsg::MatrixTransform::create();
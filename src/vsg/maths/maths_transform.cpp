@@ -368,6 +368,36 @@ dsphere vsg::computeFrustumBound(const dmat4& m)
     return t_computeFrustumBound<double>(m);
 }
 
+template<class M, class A>
+void t_transform(const M& matrix, A& array)
+{
+    for (auto& v : array)
+    {
+        v = matrix * v;
+    }
+    array.dirty();
+}
+
+void vsg::transform(const mat4& matrix, vec3Array& array)
+{
+    t_transform(matrix, array);
+}
+
+void vsg::transform(const dmat4& matrix, dvec3Array& array)
+{
+    t_transform(matrix, array);
+}
+
+void vsg::transform(const mat4& matrix, vec4Array& array)
+{
+    t_transform(matrix, array);
+}
+
+void vsg::transform(const dmat4& matrix, dvec4Array& array)
+{
+    t_transform(matrix, array);
+}
+
 bool vsg::transform(CoordinateConvention source, CoordinateConvention destination, dmat4& matrix)
 {
     if (source == destination || source == CoordinateConvention::NO_PREFERENCE || destination == CoordinateConvention::NO_PREFERENCE) return false;
@@ -0,0 +1,201 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2025 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+
+#include <vsg/app/RecordTraversal.h>
+#include <vsg/io/Options.h>
+#include <vsg/nodes/CachedCommandGroup.h>
+#include <vsg/nodes/CoordinateFrame.h>
+#include <vsg/nodes/MatrixTransform.h>
+#include <vsg/nodes/Switch.h>
+#include <vsg/vk/State.h>
+
+using namespace vsg;
+
+namespace
+{
+    // FNV-1a hash used to detect changes to the inputs of a recording
+    struct Hash
+    {
+        uint64_t value = 14695981039346656037ull;
+
+        void add(const void* ptr, size_t size)
+        {
+            auto bytes = static_cast<const uint8_t*>(ptr);
+            for (size_t i = 0; i < size; ++i)
+            {
+                value ^= bytes[i];
+                value *= 1099511628211ull;
+            }
+        }
+
+        template<typename T>
+        void add(const T& v)
+        {
+            add(&v, sizeof(T));
+        }
+    };
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// CachedCommandDependencies
+//
+void CachedCommandDependencies::clear()
+{
+    cacheable = true;
+    viewDependent = false;
+    switches.clear();
+    transforms.clear();
+    coordinateFrames.clear();
+}
+
+uint64_t CachedCommandDependencies::hash() const
+{
+    Hash hash;
+    for (auto& sw : switches)
+    {
+        hash.add(sw->children.size());
+        for (auto& child : sw->children)
+        {
+            hash.add(child.mask);
+            hash.add(child.node.get());
+        }
+    }
+    for (auto& transform : transforms)
+    {
+        hash.add(transform->matrix);
+    }
+    for (auto& coordinateFrame : coordinateFrames)
+    {
+        hash.add(coordinateFrame->origin);
+        hash.add(coordinateFrame->rotation);
+    }
+    return hash.value;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// CachedCommandGroup
+//
+CachedCommandGroup::CachedCommandGroup(size_t numChildren) :
+    Inherit(numChildren)
+{
+}
+
+CachedCommandGroup::CachedCommandGroup(const CachedCommandGroup& rhs, const CopyOp& copyop) :
+    Inherit(rhs, copyop),
+    retainFrames(rhs.retainFrames)
+{
+}
+
+CachedCommandGroup::~CachedCommandGroup()
+{
+}
+
+double CachedCommandGroup::Statistics::hitRatio() const
+{
+    uint64_t total = numHits + numMisses + numInlined;
+    return total > 0 ? static_cast<double>(numHits) / static_cast<double>(total) : 0.0;
+}
+
+CachedCommandGroup::Statistics CachedCommandGroup::getStatistics() const
+{
+    return Statistics{_numHits.load(), _numMisses.load(), _numInlined.load()};
+}
+
+void CachedCommandGroup::resetStatistics()
+{
+    _numHits = 0;
+    _numMisses = 0;
+    _numInlined = 0;
+}
+
+void CachedCommandGroup::release()
+{
+    std::scoped_lock<std::mutex> lock(_mutex);
+    _recordings.clear();
+}
+
+CachedCommandGroup::Recording& CachedCommandGroup::getRecording(uint32_t deviceID, uint32_t viewID) const
+{
+    std::scoped_lock<std::mutex> lock(_mutex);
+    return _recordings[std::pair<uint32_t, uint32_t>(deviceID, viewID)];
+}
+
+uint64_t CachedCommandGroup::computeKey(RecordTraversal& recordTraversal, bool viewDependent) const
+{
+    auto state = recordTraversal.getState();
+    auto commandBuffer = recordTraversal.getCommandBuffer();
+
+    Hash hash;
+    hash.add(_modifiedCount.load());
+    hash.add(recordTraversal.traversalMask);
+    hash.add(recordTraversal.overrideMask);
+    hash.add(commandBuffer->renderPass);
+    hash.add(commandBuffer->subpass);
+
+    // the projection matrix is pushed as a push constant
+    hash.add(state->projectionMatrixStack.top());
+
+    // modelview matrices pushed as push constants, frustum culling and LOD selection depend upon the modelview matrix,
+    // recordings that read their matrices from transformData with culling disabled don't.
+    hash.add(viewDependent);
+    if (viewDependent)
+    {
+        hash.add(state->modelviewMatrixStack.top());
+        if (state->inheritViewForLODScaling)
+        {
+            hash.add(state->inheritedProjectionMatrix);
+            hash.add(state->inheritedViewTransform);
+        }
+    }
+    hash.add(state->smallFeatureRatio);
+    hash.add(state->lodHysteresis);
+    hash.add(state->cameraRelative);
+
+    // inherited state is recorded at the start of the secondary CommandBuffer
+    for (auto& stateStack : state->stateStacks)
+    {
+        hash.add(stateStack.size() > 0 ? stateStack.top() : nullptr);
+    }
+
+    for (auto& child : children)
+    {
+        hash.add(child.get());
+    }
+
+    return hash.value;
+}
+
+int CachedCommandGroup::compare(const Object& rhs_object) const
+{
+    int result = Group::compare(rhs_object);
+    if (result != 0) return result;
+
+    auto& rhs = static_cast<decltype(*this)>(rhs_object);
+    return compare_value(retainFrames, rhs.retainFrames);
+}
+
+void CachedCommandGroup::read(Input& input)
+{
+    Group::read(input);
+
+    input.read("retainFrames", retainFrames);
+}
+
+void CachedCommandGroup::write(Output& output) const
+{
+    Group::write(output);
+
+    output.write("retainFrames", retainFrames);
+}
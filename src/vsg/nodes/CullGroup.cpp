@@ -22,7 +22,8 @@ CullGroup::CullGroup()
 
 CullGroup::CullGroup(const CullGroup& rhs, const CopyOp& copyop) :
     Inherit(rhs, copyop),
-    bound(rhs.bound)
+    bound(rhs.bound),
+    smallFeatureCulling(rhs.smallFeatureCulling)
 {
 }
 
@@ -41,7 +42,8 @@ int CullGroup::compare(const Object& rhs_object) const
     if (result != 0) return result;
 
     auto& rhs = static_cast<decltype(*this)>(rhs_object);
-    return compare_value(bound, rhs.bound);
+    if ((result = compare_value(bound, rhs.bound)) != 0) return result;
+    return compare_value(smallFeatureCulling, rhs.smallFeatureCulling);
 }
 
 void CullGroup::read(Input& input)
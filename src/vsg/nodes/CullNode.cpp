@@ -23,7 +23,8 @@ CullNode::CullNode()
 CullNode::CullNode(const CullNode& rhs, const CopyOp& copyop) :
     Inherit(rhs, copyop),
     bound(rhs.bound),
-    child(copyop(rhs.child))
+    child(copyop(rhs.child)),
+    smallFeatureCulling(rhs.smallFeatureCulling)
 {
 }
 
@@ -44,6 +45,7 @@ int CullNode::compare(const Object& rhs_object) const
 
     auto& rhs = static_cast<decltype(*this)>(rhs_object);
     if ((result = compare_value(bound, rhs.bound)) != 0) return result;
+    if ((result = compare_value(smallFeatureCulling, rhs.smallFeatureCulling)) != 0) return result;
     return compare_pointer(child, rhs.child);
 }
 
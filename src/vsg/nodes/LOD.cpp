@@ -19,12 +19,16 @@ using namespace vsg;
 
 LOD::LOD()
 {
+    for (auto& activeChild : _activeChildren) activeChild.store(~0u, std::memory_order_relaxed);
 }
 
 LOD::LOD(const LOD& rhs, const CopyOp& copyop) :
     Inherit(rhs, copyop),
-    bound(rhs.bound)
+    bound(rhs.bound),
+    smallFeatureCulling(rhs.smallFeatureCulling)
 {
+    for (auto& activeChild : _activeChildren) activeChild.store(~0u, std::memory_order_relaxed);
+
     children.reserve(rhs.children.size());
     for (auto child : rhs.children)
     {
@@ -44,6 +48,7 @@ int LOD::compare(const Object& rhs_object) const
     auto& rhs = static_cast<decltype(*this)>(rhs_object);
 
     if ((result = compare_value(bound, rhs.bound)) != 0) return result;
+    if ((result = compare_value(smallFeatureCulling, rhs.smallFeatureCulling)) != 0) return result;
 
     // compare the children vector
     if (children.size() < rhs.children.size()) return -1;
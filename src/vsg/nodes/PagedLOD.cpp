@@ -317,6 +317,8 @@ void PagedLODContainer::active(const PagedLOD* plod)
 
     _move(plod, &activeList);
 
+    if (elements[plod->index].expiryFrame == 0) _schedule(plod->index);
+
 #if PRINT_CONTAINER
     debug_stream([&](auto& fout) { check(); print(fout); });
 #endif
@@ -328,6 +330,8 @@ void PagedLODContainer::inactive(const PagedLOD* plod)
 
     _move(plod, &inactiveList);
 
+    elements[plod->index].expiryFrame = 0;
+
 #if PRINT_CONTAINER
     debug_stream([&](std::ostream& fout) { check(); print(fout); });
 #endif
@@ -350,6 +354,7 @@ void PagedLODContainer::remove(PagedLOD* plod)
     auto& element = elements[plod->index];
     plod->index = 0;
     element.plod = nullptr;
+    element.expiryFrame = 0;
 
 #if PRINT_CONTAINER
     check();
@@ -359,6 +364,74 @@ void PagedLODContainer::remove(PagedLOD* plod)
 #endif
 }
 
+void PagedLODContainer::_schedule(uint32_t index)
+{
+    // when the wheel hasn't been set up yet the next expire() call will walk the whole activeList
+    if (expiryWheel.empty()) return;
+
+    auto& element = elements[index];
+
+    // check again once the high res child could have aged out, clamped to the range of frames covered by the wheel.
+    uint64_t frame = element.plod->frameHighResLastUsed.load() + inactiveAge + 1;
+    uint64_t wheelSize = expiryWheel.size();
+    if (frame <= expiryFrameCount) frame = expiryFrameCount + 1;
+    if (frame >= expiryFrameCount + wheelSize) frame = expiryFrameCount + wheelSize - 1;
+
+    element.expiryFrame = frame;
+    expiryWheel[frame % wheelSize].push_back(index);
+}
+
+void PagedLODContainer::expire(uint64_t frameCount)
+{
+    if (frameCount <= expiryFrameCount && !expiryWheel.empty()) return;
+
+    uint64_t previousFrameCount = expiryFrameCount;
+    expiryFrameCount = frameCount;
+
+    uint64_t wheelSize = expiryWheel.size();
+    if (wheelSize == 0 || (frameCount - previousFrameCount + inactiveAge) >= wheelSize)
+    {
+        // first call, or too many frames have passed for the wheel to cover, so rebuild it from a full walk of the activeList
+        wheelSize = std::max(uint64_t(16), inactiveAge + 2);
+        expiryWheel.resize(wheelSize);
+        for (auto& bucket : expiryWheel) bucket.clear();
+
+        for (uint32_t index = activeList.head; index != 0;)
+        {
+            auto& element = elements[index];
+            uint32_t current = index;
+            index = element.next;
+
+            if (element.plod->highResActive(frameCount, inactiveAge))
+                _schedule(current);
+            else
+                inactive(element.plod);
+        }
+        return;
+    }
+
+    // only visit the elements due to be checked in the frames since the previous call, entries that have since been rescheduled, made inactive or removed are stale and skipped.
+    std::vector<uint32_t> due;
+    for (uint64_t frame = previousFrameCount + 1; frame <= frameCount; ++frame)
+    {
+        due.swap(expiryWheel[frame % wheelSize]);
+        for (auto index : due)
+        {
+            auto& element = elements[index];
+            if (element.expiryFrame != frame || element.list != &activeList) continue;
+
+            if (element.plod->highResActive(frameCount, inactiveAge))
+                _schedule(index);
+            else
+                inactive(element.plod);
+        }
+        due.clear();
+
+        // reuse the bucket's allocation for later frames
+        if (auto& bucket = expiryWheel[frame % wheelSize]; bucket.empty()) due.swap(bucket);
+    }
+}
+
 bool PagedLODContainer::check(const List& list)
 {
     if (list.head == 0)
@@ -0,0 +1,366 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2025 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/io/Options.h>
+#include <vsg/io/stream.h>
+#include <vsg/nodes/SpatialGroup.h>
+#include <vsg/utils/ComputeBounds.h>
+
+#include <algorithm>
+
+using namespace vsg;
+
+SpatialGroup::SpatialGroup(size_t numChildren) :
+    Inherit(numChildren)
+{
+}
+
+SpatialGroup::SpatialGroup(const SpatialGroup& rhs, const CopyOp& copyop) :
+    Inherit(rhs, copyop),
+    maxChildrenPerNode(rhs.maxChildrenPerNode),
+    maxDepth(rhs.maxDepth),
+    smallFeatureCulling(rhs.smallFeatureCulling)
+{
+    if (rhs.valid())
+    {
+        // copied or cloned children have the same bounds so the octree can be reused
+        _nodes = rhs._nodes;
+        _childBounds = rhs._childBounds;
+        _childNodes = rhs._childNodes;
+        for (uint32_t i = 0; i < static_cast<uint32_t>(children.size()); ++i)
+        {
+            _childIndices[children[i].get()] = i;
+        }
+    }
+    else
+    {
+        build();
+    }
+}
+
+SpatialGroup::~SpatialGroup()
+{
+}
+
+int SpatialGroup::compare(const Object& rhs_object) const
+{
+    int result = Group::compare(rhs_object);
+    if (result != 0) return result;
+
+    auto& rhs = static_cast<decltype(*this)>(rhs_object);
+    if ((result = compare_value(maxChildrenPerNode, rhs.maxChildrenPerNode))) return result;
+    if ((result = compare_value(maxDepth, rhs.maxDepth))) return result;
+    return compare_value(smallFeatureCulling, rhs.smallFeatureCulling);
+}
+
+void SpatialGroup::read(Input& input)
+{
+    Group::read(input);
+
+    input.read("maxChildrenPerNode", maxChildrenPerNode);
+    input.read("maxDepth", maxDepth);
+
+    build();
+}
+
+void SpatialGroup::write(Output& output) const
+{
+    Group::write(output);
+
+    output.write("maxChildrenPerNode", maxChildrenPerNode);
+    output.write("maxDepth", maxDepth);
+}
+
+dsphere SpatialGroup::_computeBound(const Node& node)
+{
+    ComputeBounds computeBounds;
+    node.accept(computeBounds);
+
+    auto& bb = computeBounds.bounds;
+    if (!bb.valid()) return dsphere(0.0, 0.0, 0.0, -1.0);
+    return dsphere((bb.min + bb.max) * 0.5, length(bb.max - bb.min) * 0.5);
+}
+
+void SpatialGroup::build()
+{
+    _childBounds.resize(children.size());
+    for (size_t i = 0; i < children.size(); ++i)
+    {
+        _childBounds[i] = _computeBound(*children[i]);
+    }
+
+    _rebuild();
+}
+
+void SpatialGroup::_rebuild()
+{
+    // root node is the cube enclosing the centers of all the children
+    dbox extents;
+    for (auto& bound : _childBounds)
+    {
+        if (bound.radius >= 0.0) extents.add(bound.center);
+    }
+
+    OctreeNode root;
+    if (extents.valid())
+    {
+        dvec3 size = extents.max - extents.min;
+        root.center = (extents.min + extents.max) * 0.5;
+        root.halfSize = std::max(std::max(size.x, size.y), std::max(size.z, 1e-6)) * 0.5;
+    }
+
+    _nodes.clear();
+    _nodes.push_back(root);
+    _numOutsideRoot = 0;
+
+    _childNodes.assign(children.size(), 0);
+    _childIndices.clear();
+    for (uint32_t i = 0; i < static_cast<uint32_t>(children.size()); ++i)
+    {
+        _childIndices[children[i].get()] = i;
+        _insert(0, i);
+    }
+}
+
+bool SpatialGroup::_fits(const OctreeNode& node, const dsphere& bound) const
+{
+    if (bound.radius < 0.0 || bound.radius > node.halfSize) return false;
+
+    auto delta = bound.center - node.center;
+    return std::abs(delta.x) <= node.halfSize && std::abs(delta.y) <= node.halfSize && std::abs(delta.z) <= node.halfSize;
+}
+
+void SpatialGroup::_insert(uint32_t nodeIndex, uint32_t childIndex)
+{
+    auto& bound = _childBounds[childIndex];
+
+    // descend to the deepest existing node whose cube contains the child's center and is large enough to contain the child within its loose bounds,
+    // children that don't fit within the root node's cube are held by the root
+    while (true)
+    {
+        auto& node = _nodes[nodeIndex];
+        ++node.numChildren;
+
+        if (!_fits(node, bound))
+        {
+            if (nodeIndex == 0 && bound.radius >= 0.0) ++_numOutsideRoot;
+            break;
+        }
+
+        if (node.firstChild == 0 || bound.radius > node.halfSize * 0.5) break;
+
+        uint32_t octant = (bound.center.x >= node.center.x ? 1 : 0) | (bound.center.y >= node.center.y ? 2 : 0) | (bound.center.z >= node.center.z ? 4 : 0);
+        nodeIndex = node.firstChild + octant;
+    }
+
+    auto& node = _nodes[nodeIndex];
+    node.children.push_back(childIndex);
+    _childNodes[childIndex] = nodeIndex;
+
+    uint32_t depthLimit = std::min(maxDepth, 32u);
+    if (node.firstChild == 0 && node.children.size() > maxChildrenPerNode && node.depth < depthLimit && node.halfSize > 0.0)
+    {
+        _subdivide(nodeIndex);
+    }
+}
+
+void SpatialGroup::_subdivide(uint32_t nodeIndex)
+{
+    uint32_t firstChild = static_cast<uint32_t>(_nodes.size());
+    double childHalfSize = _nodes[nodeIndex].halfSize * 0.5;
+    for (uint32_t octant = 0; octant < 8; ++octant)
+    {
+        auto& parent = _nodes[nodeIndex];
+        OctreeNode child;
+        child.center = parent.center + dvec3((octant & 1) ? childHalfSize : -childHalfSize,
+                                             (octant & 2) ? childHalfSize : -childHalfSize,
+                                             (octant & 4) ? childHalfSize : -childHalfSize);
+        child.halfSize = childHalfSize;
+        child.depth = parent.depth + 1;
+        child.parent = nodeIndex;
+        _nodes.push_back(child);
+    }
+
+    // push the children that fit down into the new octants
+    std::vector<uint32_t> retained;
+    auto previous = std::move(_nodes[nodeIndex].children);
+    _nodes[nodeIndex].firstChild = firstChild;
+    _nodes[nodeIndex].children.clear();
+
+    for (auto childIndex : previous)
+    {
+        auto& bound = _childBounds[childIndex];
+        auto& node = _nodes[nodeIndex];
+        if (_fits(node, bound) && bound.radius <= childHalfSize)
+        {
+            uint32_t octant = (bound.center.x >= node.center.x ? 1 : 0) | (bound.center.y >= node.center.y ? 2 : 0) | (bound.center.z >= node.center.z ? 4 : 0);
+            auto& octantNode = _nodes[firstChild + octant];
+            ++octantNode.numChildren;
+            octantNode.children.push_back(childIndex);
+            _childNodes[childIndex] = firstChild + octant;
+        }
+        else
+        {
+            retained.push_back(childIndex);
+        }
+    }
+    _nodes[nodeIndex].children = std::move(retained);
+
+    // subdivide any octants that are still over full
+    uint32_t depthLimit = std::min(maxDepth, 32u);
+    for (uint32_t octant = 0; octant < 8; ++octant)
+    {
+        auto& octantNode = _nodes[firstChild + octant];
+        if (octantNode.children.size() > maxChildrenPerNode && octantNode.depth < depthLimit) _subdivide(firstChild + octant);
+    }
+}
+
+void SpatialGroup::_detach(uint32_t childIndex)
+{
+    uint32_t nodeIndex = _childNodes[childIndex];
+
+    auto& nodeChildren = _nodes[nodeIndex].children;
+    if (auto itr = std::find(nodeChildren.begin(), nodeChildren.end(), childIndex); itr != nodeChildren.end())
+    {
+        *itr = nodeChildren.back();
+        nodeChildren.pop_back();
+    }
+
+    for (uint32_t i = nodeIndex;; i = _nodes[i].parent)
+    {
+        --_nodes[i].numChildren;
+        if (i == 0) break;
+    }
+
+    // mirror the count made by _insert() for children placed outside the root's cube
+    auto& bound = _childBounds[childIndex];
+    if (nodeIndex == 0 && bound.radius >= 0.0 && !_fits(_nodes[0], bound) && _numOutsideRoot > 0) --_numOutsideRoot;
+}
+
+void SpatialGroup::insert(ref_ptr<Node> child, const dsphere& bound)
+{
+    if (!valid()) build();
+
+    if (_nodes.front().numChildren == 0 && bound.radius >= 0.0)
+    {
+        // first child so set up the root around it
+        OctreeNode root;
+        root.center = bound.center;
+        root.halfSize = std::max(bound.radius, 1e-6);
+        _nodes.assign(1, root);
+        _numOutsideRoot = 0;
+    }
+
+    auto childIndex = static_cast<uint32_t>(children.size());
+    children.push_back(child);
+    _childBounds.push_back(bound);
+    _childNodes.push_back(0);
+    _childIndices[child.get()] = childIndex;
+
+    _insert(0, childIndex);
+
+    // refit the octree once too many children have been placed outside the root's cube
+    if (_numOutsideRoot > maxChildrenPerNode) _rebuild();
+}
+
+void SpatialGroup::insert(ref_ptr<Node> child)
+{
+    insert(child, _computeBound(*child));
+}
+
+bool SpatialGroup::remove(const Node* child)
+{
+    if (!valid()) build();
+
+    auto itr = _childIndices.find(child);
+    if (itr == _childIndices.end()) return false;
+
+    uint32_t childIndex = itr->second;
+    _childIndices.erase(itr);
+    _detach(childIndex);
+
+    // move the last child into the removed child's slot
+    uint32_t lastIndex = static_cast<uint32_t>(children.size()) - 1;
+    if (childIndex != lastIndex)
+    {
+        children[childIndex] = children[lastIndex];
+        _childBounds[childIndex] = _childBounds[lastIndex];
+        _childNodes[childIndex] = _childNodes[lastIndex];
+        _childIndices[children[childIndex].get()] = childIndex;
+
+        auto& nodeChildren = _nodes[_childNodes[childIndex]].children;
+        std::replace(nodeChildren.begin(), nodeChildren.end(), lastIndex, childIndex);
+    }
+
+    children.pop_back();
+    _childBounds.pop_back();
+    _childNodes.pop_back();
+
+    return true;
+}
+
+bool SpatialGroup::update(const Node* child, const dsphere& bound)
+{
+    if (!valid()) build();
+
+    auto itr = _childIndices.find(child);
+    if (itr == _childIndices.end()) return false;
+
+    uint32_t childIndex = itr->second;
+
+    // a child that still fits within its node's loose bounds can stay where it is
+    uint32_t nodeIndex = _childNodes[childIndex];
+    if (nodeIndex != 0 && _fits(_nodes[nodeIndex], bound))
+    {
+        _childBounds[childIndex] = bound;
+        return true;
+    }
+
+    // detach using the previous bound so that _detach() can tell if it was counted as outside the root
+    _detach(childIndex);
+    _childBounds[childIndex] = bound;
+
+    // reinsert from the nearest ancestor that contains the child, or the root if none do
+    while (nodeIndex != 0 && !_fits(_nodes[nodeIndex], bound)) nodeIndex = _nodes[nodeIndex].parent;
+    if (nodeIndex != 0)
+    {
+        // _insert() counts the child in the ancestors of nodeIndex so undo the parents' decrement from _detach()
+        for (uint32_t i = _nodes[nodeIndex].parent;; i = _nodes[i].parent)
+        {
+            ++_nodes[i].numChildren;
+            if (i == 0) break;
+        }
+    }
+    _insert(nodeIndex, childIndex);
+
+    if (_numOutsideRoot > maxChildrenPerNode) _rebuild();
+
+    return true;
+}
+
+bool SpatialGroup::update(const Node* child)
+{
+    return update(child, _computeBound(*child));
+}
+
+SpatialGroup::Statistics SpatialGroup::getStatistics() const
+{
+    Statistics stats;
+    stats.numNodes = static_cast<uint32_t>(_nodes.size());
+    for (auto& node : _nodes)
+    {
+        if (node.firstChild == 0) ++stats.numLeaves;
+        stats.depth = std::max(stats.depth, node.depth);
+        stats.maxChildrenInNode = std::max(stats.maxChildrenInNode, static_cast<uint32_t>(node.children.size()));
+    }
+    return stats;
+}
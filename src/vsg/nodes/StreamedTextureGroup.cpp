@@ -0,0 +1,64 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2025 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/io/Options.h>
+#include <vsg/io/stream.h>
+#include <vsg/nodes/StreamedTextureGroup.h>
+
+using namespace vsg;
+
+StreamedTextureGroup::StreamedTextureGroup()
+{
+}
+
+StreamedTextureGroup::StreamedTextureGroup(const StreamedTextureGroup& rhs, const CopyOp& copyop) :
+    Inherit(rhs, copyop),
+    bound(rhs.bound),
+    texture(copyop(rhs.texture))
+{
+}
+
+StreamedTextureGroup::StreamedTextureGroup(const dsphere& in_bound, ref_ptr<StreamedTexture> in_texture) :
+    bound(in_bound),
+    texture(in_texture)
+{
+}
+
+StreamedTextureGroup::~StreamedTextureGroup()
+{
+}
+
+int StreamedTextureGroup::compare(const Object& rhs_object) const
+{
+    int result = Group::compare(rhs_object);
+    if (result != 0) return result;
+
+    auto& rhs = static_cast<decltype(*this)>(rhs_object);
+    if ((result = compare_value(bound, rhs.bound))) return result;
+    return compare_pointer(texture, rhs.texture);
+}
+
+void StreamedTextureGroup::read(Input& input)
+{
+    Group::read(input);
+
+    input.read("bound", bound);
+    input.read("texture", texture);
+}
+
+void StreamedTextureGroup::write(Output& output) const
+{
+    Group::write(output);
+
+    output.write("bound", bound);
+    output.write("texture", texture);
+}
@@ -16,6 +16,8 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/io/tile.h>
 #include <vsg/nodes/TileDatabase.h>
 
+#include <algorithm>
+
 using namespace vsg;
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -40,7 +42,13 @@ TileDatabaseSettings::TileDatabaseSettings(const TileDatabaseSettings& rhs, cons
     terrainLayer(rhs.terrainLayer),
     mipmapLevelsHint(rhs.mipmapLevelsHint),
     lighting(rhs.lighting),
-    shaderSet(copyop(rhs.shaderSet))
+    shaderSet(copyop(rhs.shaderSet)),
+    virtualTexture(rhs.virtualTexture),
+    tileCache(rhs.tileCache),
+    gridSize(rhs.gridSize),
+    gridSizePerLevel(rhs.gridSizePerLevel),
+    elevationScale(rhs.elevationScale),
+    skirtRatio(rhs.skirtRatio)
 {
 }
 
@@ -62,7 +70,19 @@ int TileDatabaseSettings::compare(const Object& rhs_object) const
     if ((result = compare_value(terrainLayer, rhs.terrainLayer)) != 0) return result;
     if ((result = compare_value(mipmapLevelsHint, rhs.mipmapLevelsHint)) != 0) return result;
     if ((result = compare_value(lighting, rhs.lighting)) != 0) return result;
-    return compare_pointer(shaderSet, rhs.shaderSet);
+    if ((result = compare_pointer(shaderSet, rhs.shaderSet)) != 0) return result;
+    if ((result = compare_pointer(virtualTexture, rhs.virtualTexture)) != 0) return result;
+    if ((result = compare_pointer(tileCache, rhs.tileCache)) != 0) return result;
+    if ((result = compare_value(gridSize, rhs.gridSize)) != 0) return result;
+    if ((result = compare_value_container(gridSizePerLevel, rhs.gridSizePerLevel)) != 0) return result;
+    if ((result = compare_value(elevationScale, rhs.elevationScale)) != 0) return result;
+    return compare_value(skirtRatio, rhs.skirtRatio);
+}
+
+uint32_t TileDatabaseSettings::gridSizeForLevel(uint32_t level) const
+{
+    uint32_t size = (level < gridSizePerLevel.size()) ? gridSizePerLevel[level] : gridSize;
+    return std::clamp(size, 2u, 256u);
 }
 
 void TileDatabaseSettings::read(vsg::Input& input)
@@ -154,6 +154,12 @@ size_t Buffer::totalReservedSize() const
     return _memorySlots.totalReservedSize();
 }
 
+MemorySlots Buffer::getMemorySlots() const
+{
+    std::scoped_lock<std::mutex> lock(_mutex);
+    return _memorySlots;
+}
+
 ref_ptr<Buffer> vsg::createBufferAndMemory(Device* device, VkDeviceSize size, VkBufferUsageFlags usage, VkSharingMode sharingMode, VkMemoryPropertyFlags memoryProperties)
 {
     auto buffer = vsg::Buffer::create(size, usage, sharingMode);
@@ -15,6 +15,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/io/Logger.h>
 #include <vsg/io/Options.h>
 #include <vsg/state/GraphicsPipeline.h>
+#include <vsg/state/PipelineScheduler.h>
 #include <vsg/state/ViewportState.h>
 #include <vsg/vk/Context.h>
 
@@ -131,6 +132,11 @@ void GraphicsPipeline::write(Output& output) const
 }
 
 void GraphicsPipeline::compile(Context& context)
+{
+    _compile(context, true);
+}
+
+void GraphicsPipeline::_compile(Context& context, bool allowBackgroundCreation)
 {
     uint32_t viewID = context.viewID;
     if (static_cast<uint32_t>(_implementation.size()) < (viewID + 1))
@@ -138,7 +144,7 @@ void GraphicsPipeline::compile(Context& context)
         _implementation.resize(viewID + 1);
     }
 
-    if (!_implementation[viewID])
+    if (!_implementation[viewID] && !(viewID < _requests.size() && _requests[viewID]))
     {
         // compile shaders if required
         bool requiresShaderCompiler = false;
@@ -172,6 +178,10 @@ void GraphicsPipeline::compile(Context& context)
         for (auto& shaderStage : stages)
         {
             shaderStage->compile(context);
+
+            auto& module = shaderStage->module;
+            // only use transform indexing if the shader supports it, as the ShaderCompiler ignores defines that a shader's source doesn't import
+            if (module && module->hints && module->hints->defines.count("VSG_TRANSFORM_DATA") != 0 && (module->source.empty() || module->source.find("VSG_TRANSFORM_DATA") != std::string::npos)) _transformIndexing = true;
         }
 
         GraphicsPipelineStates combined_pipelineStates;
@@ -180,10 +190,78 @@ void GraphicsPipeline::compile(Context& context)
         mergeGraphicsPipelineStates(context.mask, combined_pipelineStates, pipelineStates);
         mergeGraphicsPipelineStates(context.mask, combined_pipelineStates, context.overridePipelineStates);
 
-        _implementation[viewID] = GraphicsPipeline::Implementation::create(context, context.device, context.renderPass, layout, stages, combined_pipelineStates, subpass);
+        if (context.pipelineScheduler && allowBackgroundCreation)
+        {
+            // the fallback is bound while the background creation completes so must be available immediately
+            if (fallback) fallback->_compile(context, false);
+
+            PipelineKey key;
+            key.deviceID = context.deviceID;
+            key.mask = context.mask;
+            key.renderPass = context.renderPass;
+            key.subpass = subpass;
+            key.layout = layout;
+            key.stages = stages;
+            key.pipelineStates = combined_pipelineStates;
+
+            if (static_cast<uint32_t>(_requests.size()) < (viewID + 1))
+            {
+                _requests.resize(viewID + 1);
+            }
+
+            _requests[viewID] = context.pipelineScheduler->schedule(key, ref_ptr<Context>(&context));
+            _completeRequest(viewID);
+        }
+        else
+        {
+            _implementation[viewID] = GraphicsPipeline::Implementation::create(context, context.device, context.renderPass, layout, stages, combined_pipelineStates, subpass);
+        }
     }
 }
 
+bool GraphicsPipeline::_completeRequest(uint32_t viewID) const
+{
+    if (viewID >= _requests.size() || !_requests[viewID] || !_requests[viewID]->completed()) return false;
+
+    auto& request = _requests[viewID];
+    if (request->failed())
+    {
+        // keep the failed request so that creation is retried once the PipelineScheduler's retry delay has elapsed, with the fallback used in the meantime
+        auto scheduler = request->scheduler.ref_ptr();
+        if (!scheduler) return false;
+
+        auto retried = scheduler->retry(request);
+        if (retried == request) return false;
+
+        if (request->attempt == 0) warn("GraphicsPipeline::ready(", viewID, ") background pipeline creation failed, retrying.");
+
+        request = retried;
+        if (!request->completed() || request->failed()) return false;
+    }
+
+    _implementation[viewID] = request->implementation();
+    request = {};
+    return true;
+}
+
+const GraphicsPipeline* GraphicsPipeline::wait(uint32_t viewID) const
+{
+    if (viewID < _requests.size() && _requests[viewID]) _requests[viewID]->wait();
+    return active(viewID);
+}
+
+void GraphicsPipeline::release(uint32_t viewID)
+{
+    if (viewID < static_cast<uint32_t>(_implementation.size())) _implementation[viewID] = {};
+    if (viewID < static_cast<uint32_t>(_requests.size())) _requests[viewID] = {};
+}
+
+void GraphicsPipeline::release()
+{
+    _implementation.clear();
+    _requests.clear();
+}
+
 ////////////////////////////////////////////////////////////////////////
 //
 // GraphicsPipeline::Implementation
@@ -231,9 +309,15 @@ GraphicsPipeline::Implementation::Implementation(Context& context, Device* devic
     }
 }
 
+GraphicsPipeline::Implementation::Implementation(Device* device, VkPipeline pipeline) :
+    _pipeline(pipeline),
+    _device(device)
+{
+}
+
 GraphicsPipeline::Implementation::~Implementation()
 {
-    vkDestroyPipeline(*_device, _pipeline, _device->getAllocationCallbacks());
+    if (_device) vkDestroyPipeline(*_device, _pipeline, _device->getAllocationCallbacks());
 }
 
 ////////////////////////////////////////////////////////////////////////
@@ -275,8 +359,18 @@ void BindGraphicsPipeline::write(Output& output) const
 
 void BindGraphicsPipeline::record(CommandBuffer& commandBuffer) const
 {
-    vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline->vk(commandBuffer.viewID));
-    commandBuffer.setCurrentPipelineLayout(pipeline->layout);
+    // use the fallback pipeline while the pipeline is still being created in the background
+    auto active = pipeline->active(commandBuffer.viewID);
+    if (!active)
+    {
+        // StateGroup defers subgraphs that have no pipeline to bind, but when recorded directly, such as from a Commands list, block till the creation completes
+        // if creation failed and there is no fallback then there is nothing to bind, the failure is reported by GraphicsPipeline::ready()
+        active = pipeline->wait(commandBuffer.viewID);
+        if (!active) return;
+    }
+
+    vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, active->vk(commandBuffer.viewID));
+    commandBuffer.setCurrentPipelineLayout(active->layout, active->transformIndexing());
 }
 
 void BindGraphicsPipeline::compile(Context& context)
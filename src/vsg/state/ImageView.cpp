@@ -204,6 +204,7 @@ void vsg::transferImageData(ref_ptr<ImageView> imageView, VkImageLayout targetIm
 {
     ref_ptr<Image> textureImage(imageView->image);
     auto aspectMask = imageView->subresourceRange.aspectMask;
+    auto baseArrayLayer = imageView->subresourceRange.baseArrayLayer;
 
     uint32_t faceWidth = width;
     uint32_t faceHeight = height;
@@ -268,7 +269,7 @@ void vsg::transferImageData(ref_ptr<ImageView> imageView, VkImageLayout targetIm
     preCopyBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
     preCopyBarrier.image = vk_textureImage;
     preCopyBarrier.subresourceRange.aspectMask = aspectMask;
-    preCopyBarrier.subresourceRange.baseArrayLayer = 0;
+    preCopyBarrier.subresourceRange.baseArrayLayer = baseArrayLayer;
     preCopyBarrier.subresourceRange.layerCount = arrayLayers;
     preCopyBarrier.subresourceRange.levelCount = mipLevels;
     preCopyBarrier.subresourceRange.baseMipLevel = 0;
@@ -302,7 +303,7 @@ void vsg::transferImageData(ref_ptr<ImageView> imageView, VkImageLayout targetIm
                 region.bufferImageHeight = 0;
                 region.imageSubresource.aspectMask = aspectMask;
                 region.imageSubresource.mipLevel = mipLevel;
-                region.imageSubresource.baseArrayLayer = face;
+                region.imageSubresource.baseArrayLayer = baseArrayLayer + face;
                 region.imageSubresource.layerCount = 1;
                 region.imageOffset = {0, 0, 0};
                 region.imageExtent = {mipWidth, mipHeight, mipDepth};
@@ -331,7 +332,7 @@ void vsg::transferImageData(ref_ptr<ImageView> imageView, VkImageLayout targetIm
             region.bufferImageHeight = 0;
             region.imageSubresource.aspectMask = aspectMask;
             region.imageSubresource.mipLevel = 0;
-            region.imageSubresource.baseArrayLayer = face;
+            region.imageSubresource.baseArrayLayer = baseArrayLayer + face;
             region.imageSubresource.layerCount = 1;
             region.imageOffset = {0, 0, 0};
             region.imageExtent = {destWidth, destHeight, destDepth};
@@ -349,7 +350,7 @@ void vsg::transferImageData(ref_ptr<ImageView> imageView, VkImageLayout targetIm
         barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
         barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
         barrier.subresourceRange.aspectMask = aspectMask;
-        barrier.subresourceRange.baseArrayLayer = 0;
+        barrier.subresourceRange.baseArrayLayer = baseArrayLayer;
         barrier.subresourceRange.layerCount = arrayLayers;
         barrier.subresourceRange.levelCount = 1;
 
@@ -376,13 +377,13 @@ void vsg::transferImageData(ref_ptr<ImageView> imageView, VkImageLayout targetIm
             blit.srcOffsets[1] = {mipWidth, mipHeight, mipDepth};
             blit.srcSubresource.aspectMask = aspectMask;
             blit.srcSubresource.mipLevel = i - 1;
-            blit.srcSubresource.baseArrayLayer = 0;
+            blit.srcSubresource.baseArrayLayer = baseArrayLayer;
             blit.srcSubresource.layerCount = arrayLayers;
             blit.dstOffsets[0] = {0, 0, 0};
             blit.dstOffsets[1] = {mipWidth > 1 ? mipWidth / 2 : 1, mipHeight > 1 ? mipHeight / 2 : 1, mipDepth > 1 ? mipDepth / 2 : 1};
             blit.dstSubresource.aspectMask = aspectMask;
             blit.dstSubresource.mipLevel = i;
-            blit.dstSubresource.baseArrayLayer = 0;
+            blit.dstSubresource.baseArrayLayer = baseArrayLayer;
             blit.dstSubresource.layerCount = arrayLayers;
 
             vkCmdBlitImage(commandBuffer,
@@ -431,7 +432,7 @@ void vsg::transferImageData(ref_ptr<ImageView> imageView, VkImageLayout targetIm
         postCopyBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
         postCopyBarrier.image = vk_textureImage;
         postCopyBarrier.subresourceRange.aspectMask = aspectMask;
-        postCopyBarrier.subresourceRange.baseArrayLayer = 0;
+        postCopyBarrier.subresourceRange.baseArrayLayer = baseArrayLayer;
         postCopyBarrier.subresourceRange.layerCount = arrayLayers;
         postCopyBarrier.subresourceRange.levelCount = mipLevels;
         postCopyBarrier.subresourceRange.baseMipLevel = 0;
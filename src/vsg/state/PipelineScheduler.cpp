@@ -0,0 +1,267 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2025 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+
+#include <vsg/core/Exception.h>
+#include <vsg/core/compare.h>
+#include <vsg/io/Logger.h>
+#include <vsg/state/PipelineScheduler.h>
+#include <vsg/vk/Context.h>
+
+#include <algorithm>
+#include <cmath>
+
+using namespace vsg;
+
+namespace
+{
+    void completeRequest(PipelineFactory& factory, PipelineRequest& request, Context& context)
+    {
+        ref_ptr<GraphicsPipeline::Implementation> implementation;
+        try
+        {
+            implementation = factory.createPipeline(request.key, context);
+        }
+        catch (const Exception& exception)
+        {
+            warn("PipelineScheduler failed to create pipeline, ", exception.message, " result = ", exception.result);
+        }
+        request.complete(implementation);
+    }
+
+    struct CreatePipeline : public Inherit<Operation, CreatePipeline>
+    {
+        CreatePipeline(ref_ptr<PipelineFactory> in_factory, ref_ptr<PipelineRequest> in_request, ref_ptr<Context> in_context) :
+            factory(in_factory),
+            request(in_request),
+            context(in_context) {}
+
+        ref_ptr<PipelineFactory> factory;
+        ref_ptr<PipelineRequest> request;
+        ref_ptr<Context> context;
+
+        void run() override
+        {
+            completeRequest(*factory, *request, *context);
+        }
+    };
+} // namespace
+
+////////////////////////////////////////////////////////////////////////
+//
+// PipelineKey
+//
+int PipelineKey::compare(const PipelineKey& rhs) const
+{
+    int result = compare_value(deviceID, rhs.deviceID);
+    if (result != 0) return result;
+
+    if ((result = compare_value(mask, rhs.mask))) return result;
+    if ((result = compare_value(renderPass.get(), rhs.renderPass.get()))) return result;
+    if ((result = compare_value(subpass, rhs.subpass))) return result;
+    if ((result = compare_pointer(layout, rhs.layout))) return result;
+    if ((result = compare_pointer_container(stages, rhs.stages))) return result;
+    return compare_pointer_container(pipelineStates, rhs.pipelineStates);
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// PipelineFactory
+//
+ref_ptr<GraphicsPipeline::Implementation> PipelineFactory::createPipeline(const PipelineKey& key, Context& context)
+{
+    return GraphicsPipeline::Implementation::create(context, context.device, key.renderPass, key.layout, key.stages, key.pipelineStates, key.subpass);
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// PipelineRequest
+//
+PipelineRequest::PipelineRequest(const PipelineKey& in_key, uint32_t in_attempt) :
+    key(in_key),
+    attempt(in_attempt),
+    _latch(Latch::create(1))
+{
+}
+
+PipelineRequest::~PipelineRequest()
+{
+}
+
+void PipelineRequest::complete(ref_ptr<GraphicsPipeline::Implementation> in_implementation)
+{
+    _implementation = in_implementation;
+    _completionTime = clock::now();
+
+    // only a failed request needs its Context, to retry creation
+    if (_implementation) context = {};
+
+    _latch->count_down();
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// PipelineScheduler
+//
+PipelineScheduler::PipelineScheduler(uint32_t numThreads) :
+    factory(PipelineFactory::create())
+{
+    if (numThreads > 0) operationThreads = OperationThreads::create(numThreads);
+}
+
+PipelineScheduler::~PipelineScheduler()
+{
+    if (operationThreads) operationThreads->stop();
+
+    // release anything waiting on requests that the stopped threads didn't get to
+    for (auto& [key, request] : _requests)
+    {
+        if (!request->completed()) request->complete({});
+    }
+}
+
+ref_ptr<PipelineRequest> PipelineScheduler::schedule(const PipelineKey& key, ref_ptr<Context> context)
+{
+    ref_ptr<PipelineRequest> request;
+    {
+        std::scoped_lock<std::mutex> lock(_mutex);
+
+        ++_numRequests;
+
+        uint32_t attempt = 0;
+        auto itr = _requests.find(key);
+        if (itr != _requests.end())
+        {
+            auto& existing = itr->second;
+            if (!existing->failed() || !_retryDue(*existing))
+            {
+                ++_numShared;
+                return existing;
+            }
+            attempt = existing->attempt + 1;
+        }
+
+        request = PipelineRequest::create(key, attempt);
+        _requests[key] = request;
+    }
+
+    _create(request, *context);
+
+    return request;
+}
+
+ref_ptr<PipelineRequest> PipelineScheduler::retry(ref_ptr<PipelineRequest> failedRequest)
+{
+    if (!failedRequest || !failedRequest->failed() || !failedRequest->context) return failedRequest;
+
+    ref_ptr<PipelineRequest> request;
+    {
+        std::scoped_lock<std::mutex> lock(_mutex);
+
+        // another GraphicsPipeline sharing the key may have already retried
+        auto itr = _requests.find(failedRequest->key);
+        if (itr != _requests.end() && itr->second != failedRequest) return itr->second;
+
+        if (!_retryDue(*failedRequest)) return failedRequest;
+
+        request = PipelineRequest::create(failedRequest->key, failedRequest->attempt + 1);
+        _requests[request->key] = request;
+    }
+
+    _create(request, *failedRequest->context);
+
+    return request;
+}
+
+bool PipelineScheduler::_retryDue(const PipelineRequest& request) const
+{
+    double delay = std::min(retryDelay * std::pow(2.0, static_cast<double>(request.attempt)), maximumRetryDelay);
+    return std::chrono::duration<double>(PipelineRequest::clock::now() - request.completionTime()).count() >= delay;
+}
+
+void PipelineScheduler::_create(ref_ptr<PipelineRequest> request, const Context& context)
+{
+    // the Context's scratch memory isn't thread safe so give each request its own Context, which is also kept to retry a failed request.
+    // The request doesn't reference the scheduler through it as that would create a reference cycle.
+    auto requestContext = Context::create(context);
+    requestContext->pipelineScheduler = {};
+
+    request->scheduler = this;
+    request->context = requestContext;
+
+    if (operationThreads)
+    {
+        operationThreads->add(CreatePipeline::create(factory, request, requestContext));
+    }
+    else
+    {
+        completeRequest(*factory, *request, *requestContext);
+    }
+}
+
+void PipelineScheduler::wait()
+{
+    std::vector<ref_ptr<PipelineRequest>> pending;
+    {
+        std::scoped_lock<std::mutex> lock(_mutex);
+        for (auto& [key, request] : _requests)
+        {
+            if (!request->completed()) pending.push_back(request);
+        }
+    }
+
+    for (auto& request : pending) request->wait();
+}
+
+size_t PipelineScheduler::prune()
+{
+    std::scoped_lock<std::mutex> lock(_mutex);
+
+    size_t numRemoved = 0;
+    for (auto itr = _requests.begin(); itr != _requests.end();)
+    {
+        auto& request = itr->second;
+        auto implementation = request->implementation();
+
+        // the request is only referenced by the map and the Implementation by the request and local ref_ptr
+        bool unused = request->completed() && request->referenceCount() == 1 && (!implementation || implementation->referenceCount() == 2);
+        if (unused)
+        {
+            itr = _requests.erase(itr);
+            ++numRemoved;
+        }
+        else
+        {
+            ++itr;
+        }
+    }
+    return numRemoved;
+}
+
+PipelineScheduler::Statistics PipelineScheduler::getStatistics() const
+{
+    std::scoped_lock<std::mutex> lock(_mutex);
+
+    Statistics statistics;
+    statistics.numRequests = _numRequests;
+    statistics.numShared = _numShared;
+    for (auto& [key, request] : _requests)
+    {
+        if (!request->completed())
+            ++statistics.numPending;
+        else if (request->failed())
+            ++statistics.numFailed;
+        else
+            ++statistics.numCompleted;
+    }
+    return statistics;
+}
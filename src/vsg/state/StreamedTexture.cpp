@@ -0,0 +1,311 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2025 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/core/Array2D.h>
+#include <vsg/core/ConstVisitor.h>
+#include <vsg/io/Logger.h>
+#include <vsg/io/Options.h>
+#include <vsg/io/read.h>
+#include <vsg/io/stream.h>
+#include <vsg/state/DescriptorImage.h>
+#include <vsg/state/StreamedTexture.h>
+
+#include <cmath>
+#include <cstring>
+
+using namespace vsg;
+
+namespace
+{
+    struct ExtractMipmaps : public ConstVisitor
+    {
+        explicit ExtractMipmaps(uint32_t in_level) :
+            level(in_level) {}
+
+        uint32_t level;
+        ref_ptr<Data> result;
+
+        template<class A>
+        void extract(const A& image)
+        {
+            using value_type = typename A::value_type;
+
+            auto mipmapOffsets = image.computeMipmapOffsets();
+            uint32_t numLevels = std::max(static_cast<uint32_t>(mipmapOffsets.size()), 1u);
+            uint32_t startLevel = std::min(level, numLevels - 1);
+
+            uint32_t width = image.width();
+            uint32_t height = image.height();
+            for (uint32_t l = 0; l < startLevel; ++l)
+            {
+                if (width > 1) width /= 2;
+                if (height > 1) height /= 2;
+            }
+
+            auto properties = image.properties;
+            properties.maxNumMipmaps = static_cast<uint8_t>(numLevels - startLevel);
+
+            size_t valueCount = Data::computeValueCountIncludingMipmaps(width, height, 1, properties.maxNumMipmaps);
+            size_t startIndex = mipmapOffsets.empty() ? 0 : mipmapOffsets[startLevel];
+
+            auto values = new (vsg::allocate(sizeof(value_type) * valueCount, ALLOCATOR_AFFINITY_DATA)) value_type[valueCount];
+            std::memcpy(static_cast<void*>(values), image.dataPointer(startIndex), sizeof(value_type) * valueCount);
+
+            result = A::create(width, height, values, properties);
+        }
+
+        void apply(const ubyteArray2D& image) override { extract(image); }
+        void apply(const ushortArray2D& image) override { extract(image); }
+        void apply(const uintArray2D& image) override { extract(image); }
+        void apply(const floatArray2D& image) override { extract(image); }
+        void apply(const vec2Array2D& image) override { extract(image); }
+        void apply(const vec3Array2D& image) override { extract(image); }
+        void apply(const vec4Array2D& image) override { extract(image); }
+        void apply(const ubvec2Array2D& image) override { extract(image); }
+        void apply(const ubvec3Array2D& image) override { extract(image); }
+        void apply(const ubvec4Array2D& image) override { extract(image); }
+        void apply(const usvec2Array2D& image) override { extract(image); }
+        void apply(const usvec3Array2D& image) override { extract(image); }
+        void apply(const usvec4Array2D& image) override { extract(image); }
+        void apply(const uivec4Array2D& image) override { extract(image); }
+        void apply(const block64Array2D& image) override { extract(image); }
+        void apply(const block128Array2D& image) override { extract(image); }
+    };
+} // namespace
+
+StreamedTexture::StreamedTexture()
+{
+}
+
+StreamedTexture::StreamedTexture(ref_ptr<Data> in_source, ref_ptr<Sampler> in_sampler, ref_ptr<BindDescriptorSet> in_bindDescriptorSet, uint32_t in_dstBinding) :
+    source(in_source),
+    sampler(in_sampler),
+    bindDescriptorSet(in_bindDescriptorSet),
+    dstBinding(in_dstBinding)
+{
+}
+
+StreamedTexture::StreamedTexture(const Path& in_filename, ref_ptr<const Options> in_options, ref_ptr<Sampler> in_sampler, ref_ptr<BindDescriptorSet> in_bindDescriptorSet, uint32_t in_dstBinding) :
+    filename(in_filename),
+    options(in_options),
+    sampler(in_sampler),
+    bindDescriptorSet(in_bindDescriptorSet),
+    dstBinding(in_dstBinding)
+{
+}
+
+StreamedTexture::~StreamedTexture()
+{
+}
+
+uint32_t StreamedTexture::coarsestLevel(uint32_t maxDimension) const
+{
+    uint32_t numLevels = numMipLevels();
+    if (numLevels == 0) return 0;
+
+    uint32_t w = width;
+    uint32_t h = height;
+    for (uint32_t level = 0; level < numLevels; ++level)
+    {
+        if (std::max(w, h) <= maxDimension) return level;
+        if (w > 1) w /= 2;
+        if (h > 1) h /= 2;
+    }
+    return numLevels - 1;
+}
+
+VkDeviceSize StreamedTexture::residentSize(uint32_t level) const
+{
+    VkDeviceSize size = 0;
+    for (uint32_t l = level; l < levelSizes.size(); ++l)
+    {
+        size += levelSizes[l];
+    }
+    return size;
+}
+
+uint32_t StreamedTexture::requiredLevel(double screenPixels) const
+{
+    uint32_t numLevels = numMipLevels();
+    if (numLevels == 0) return 0;
+    if (screenPixels <= 0.0) return numLevels - 1;
+
+    double texelsPerPixel = static_cast<double>(std::max(width, height)) / screenPixels;
+    if (texelsPerPixel <= 1.0) return 0;
+
+    auto level = static_cast<uint32_t>(std::floor(std::log2(texelsPerPixel)));
+    return std::min(level, numLevels - 1);
+}
+
+void StreamedTexture::request(double screenHeightRatio, uint64_t frameCount)
+{
+    // non negative floats order the same way as their bit patterns so the packed value can be compared as an integer
+    float ratio = (screenHeightRatio > 0.0) ? static_cast<float>(screenHeightRatio) : 0.0f;
+    uint32_t ratioBits;
+    std::memcpy(&ratioBits, &ratio, sizeof(ratioBits));
+
+    uint64_t frame = frameCount & 0xffffffff;
+    uint64_t value = (frame << 32) | ratioBits;
+
+    uint64_t previous = _request.load();
+    while (true)
+    {
+        uint64_t previousFrame = previous >> 32;
+        if (previousFrame > frame || (previousFrame == frame && previous >= value)) return;
+        if (_request.compare_exchange_weak(previous, value)) return;
+    }
+}
+
+std::pair<uint64_t, double> StreamedTexture::lastRequest() const
+{
+    uint64_t value = _request.load();
+
+    uint32_t ratioBits = static_cast<uint32_t>(value & 0xffffffff);
+    float ratio;
+    std::memcpy(&ratio, &ratioBits, sizeof(ratio));
+
+    return {value >> 32, static_cast<double>(ratio)};
+}
+
+ref_ptr<Data> StreamedTexture::readSource() const
+{
+    ref_ptr<Data> image = source;
+    if (!image && filename) image = vsg::read_cast<Data>(filename, options);
+    if (!image) return {};
+
+    if (image->properties.maxNumMipmaps <= 1)
+    {
+        if (auto mipmapped = generateMipmaps(image, mipmapSettings)) image = mipmapped;
+    }
+
+    if (compressionSettings && image->properties.blockWidth == 1)
+    {
+        if (auto compressed = compressImage(image, compressionSettings)) image = compressed;
+    }
+
+    return image;
+}
+
+bool StreamedTexture::init(uint32_t initialLevel)
+{
+    auto image = readSource();
+    if (!image)
+    {
+        warn("StreamedTexture::init() unable to read source image ", filename);
+        return false;
+    }
+
+    // retain the mipmapped/compressed version so they aren't regenerated on each change of residency
+    if (source) source = image;
+
+    width = image->width() * image->properties.blockWidth;
+    height = image->height() * image->properties.blockHeight;
+
+    auto mipmapOffsets = image->computeMipmapOffsets();
+    if (mipmapOffsets.empty()) mipmapOffsets.push_back(0);
+
+    size_t valueCount = Data::computeValueCountIncludingMipmaps(image->width(), image->height(), image->depth(), static_cast<uint32_t>(mipmapOffsets.size()));
+
+    levelSizes.resize(mipmapOffsets.size());
+    for (size_t i = 0; i < mipmapOffsets.size(); ++i)
+    {
+        size_t end = (i + 1 < mipmapOffsets.size()) ? mipmapOffsets[i + 1] : valueCount;
+        levelSizes[i] = static_cast<VkDeviceSize>(end - mipmapOffsets[i]) * image->valueSize();
+    }
+
+    residentLevel = std::min(initialLevel, numMipLevels() - 1);
+    pending = false;
+
+    auto resident = extractMipmaps(*image, residentLevel);
+    if (!resident)
+    {
+        warn("StreamedTexture::init() image type ", image->className(), " not supported.");
+        return false;
+    }
+
+    residentImage = resident;
+    bindDescriptorSet = createBindDescriptorSet(resident);
+    return bindDescriptorSet.valid();
+}
+
+ref_ptr<Data> StreamedTexture::extractMipmaps(const Data& image, uint32_t level)
+{
+    ExtractMipmaps extractMipmaps(level);
+    image.accept(extractMipmaps);
+    return extractMipmaps.result;
+}
+
+ref_ptr<BindDescriptorSet> StreamedTexture::createBindDescriptorSet(ref_ptr<Data> image) const
+{
+    if (!image || !bindDescriptorSet || !bindDescriptorSet->descriptorSet) return {};
+
+    auto imageInfo = ImageInfo::create(sampler, image, imageLayout);
+
+    auto& original = *bindDescriptorSet->descriptorSet;
+    Descriptors descriptors;
+    bool replaced = false;
+    for (auto& descriptor : original.descriptors)
+    {
+        if (descriptor->dstBinding == dstBinding)
+        {
+            descriptors.push_back(DescriptorImage::create(imageInfo, dstBinding, descriptor->dstArrayElement, descriptor->descriptorType));
+            replaced = true;
+        }
+        else
+        {
+            descriptors.push_back(descriptor);
+        }
+    }
+    if (!replaced) descriptors.push_back(DescriptorImage::create(imageInfo, dstBinding));
+
+    auto descriptorSet = DescriptorSet::create(original.setLayout, descriptors);
+    auto bds = BindDescriptorSet::create(bindDescriptorSet->pipelineBindPoint, bindDescriptorSet->layout, bindDescriptorSet->firstSet, descriptorSet);
+    bds->dynamicOffsets = bindDescriptorSet->dynamicOffsets;
+    return bds;
+}
+
+void StreamedTexture::traverse(Visitor& visitor)
+{
+    if (bindDescriptorSet) bindDescriptorSet->accept(visitor);
+}
+
+void StreamedTexture::traverse(ConstVisitor& visitor) const
+{
+    if (bindDescriptorSet) bindDescriptorSet->accept(visitor);
+}
+
+void StreamedTexture::read(Input& input)
+{
+    Object::read(input);
+
+    input.read("source", source);
+    input.read("filename", filename);
+    input.read("sampler", sampler);
+    input.read("bindDescriptorSet", bindDescriptorSet);
+    input.read("dstBinding", dstBinding);
+    input.read("residentLevel", residentLevel);
+
+    levelSizes.clear();
+    residentImage = {};
+}
+
+void StreamedTexture::write(Output& output) const
+{
+    Object::write(output);
+
+    output.write("source", source);
+    output.write("filename", filename);
+    output.write("sampler", sampler);
+    output.write("bindDescriptorSet", bindDescriptorSet);
+    output.write("dstBinding", dstBinding);
+    output.write("residentLevel", residentLevel);
+}
@@ -298,6 +298,21 @@ void ViewDependentState::init(ResourceRequirements& requirements)
     viewportDataBufferInfo = BufferInfo::create(viewportData.get());
     descriptorConfigurator->assignDescriptor("viewportData", BufferInfoList{viewportDataBufferInfo});
 
+    if (maxTransformData > 0)
+    {
+        transformData = mat4Array::create(maxTransformData);
+        transformData->properties.dataVariance = DYNAMIC_DATA_TRANSFER_AFTER_RECORD;
+        transformDataBufferInfo = BufferInfo::create(transformData.get());
+        reservedTransforms = ReservedTransforms::create();
+        if (!descriptorConfigurator->assignDescriptor("transformData", BufferInfoList{transformDataBufferInfo}))
+        {
+            // use the binding declared by the built-in shaders' VSG_TRANSFORM_DATA code path
+            uint32_t binding = 5;
+            descriptorConfigurator->assignDescriptor(0, binding, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_VERTEX_BIT,
+                                                     DescriptorBuffer::create(BufferInfoList{transformDataBufferInfo}, binding, 0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER));
+        }
+    }
+
     // set up ShadowMaps
     auto shadowMapDirectSampler = Sampler::create();
     shadowMapDirectSampler->minFilter = VK_FILTER_NEAREST;
@@ -0,0 +1,402 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2025 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+
+#include <vsg/app/CompileManager.h>
+#include <vsg/core/Exception.h>
+#include <vsg/core/compare.h>
+#include <vsg/core/observer_ptr.h>
+#include <vsg/io/Logger.h>
+#include <vsg/io/Options.h>
+#include <vsg/state/DescriptorImage.h>
+#include <vsg/state/VirtualTexture.h>
+#include <vsg/vk/CommandBuffer.h>
+#include <vsg/vk/Context.h>
+
+#include <cmath>
+#include <set>
+
+using namespace vsg;
+
+namespace
+{
+    // Command used to compile the reloading of evicted pages through the CompileManager
+    struct LoadVirtualTexturePages : public Inherit<Command, LoadVirtualTexturePages>
+    {
+        LoadVirtualTexturePages(VirtualTexture* in_virtualTexture, std::vector<ref_ptr<const BindVirtualTextureTile>> in_tiles) :
+            virtualTexture(in_virtualTexture),
+            tiles(in_tiles) {}
+
+        VirtualTexture* virtualTexture;
+        std::vector<ref_ptr<const BindVirtualTextureTile>> tiles;
+        std::set<uint32_t> pages;
+
+        void compile(Context& context) override
+        {
+            virtualTexture->compile(context);
+            for (auto& tile : tiles)
+            {
+                if (auto page = virtualTexture->load(tile->key, tile->data, context, false)) pages.insert(page);
+            }
+        }
+
+        void record(CommandBuffer&) const override {}
+    };
+
+    // Operation used to reload evicted pages on the VirtualTexture's operationThreads, observes the VirtualTexture so a queued reload doesn't keep it alive.
+    struct ReloadVirtualTexturePages : public Inherit<Operation, ReloadVirtualTexturePages>
+    {
+        ReloadVirtualTexturePages(ref_ptr<VirtualTexture> in_virtualTexture, std::vector<ref_ptr<const BindVirtualTextureTile>> in_tiles) :
+            virtualTexture(in_virtualTexture),
+            tiles(in_tiles) {}
+
+        observer_ptr<VirtualTexture> virtualTexture;
+        std::vector<ref_ptr<const BindVirtualTextureTile>> tiles;
+
+        void run() override
+        {
+            if (auto vt = virtualTexture.ref_ptr()) vt->reload(tiles);
+        }
+    };
+
+    // format that RGB data is expanded to on upload
+    VkFormat uploadFormat(VkFormat format)
+    {
+        switch (format)
+        {
+        case (VK_FORMAT_R8G8B8_UNORM): return VK_FORMAT_R8G8B8A8_UNORM;
+        case (VK_FORMAT_R8G8B8_SNORM): return VK_FORMAT_R8G8B8A8_SNORM;
+        case (VK_FORMAT_R8G8B8_USCALED): return VK_FORMAT_R8G8B8A8_USCALED;
+        case (VK_FORMAT_R8G8B8_SSCALED): return VK_FORMAT_R8G8B8A8_SSCALED;
+        case (VK_FORMAT_R8G8B8_UINT): return VK_FORMAT_R8G8B8A8_UINT;
+        case (VK_FORMAT_R8G8B8_SINT): return VK_FORMAT_R8G8B8A8_SINT;
+        case (VK_FORMAT_R8G8B8_SRGB): return VK_FORMAT_R8G8B8A8_SRGB;
+        case (VK_FORMAT_B8G8R8_UNORM): return VK_FORMAT_B8G8R8A8_UNORM;
+        case (VK_FORMAT_B8G8R8_SNORM): return VK_FORMAT_B8G8R8A8_SNORM;
+        case (VK_FORMAT_B8G8R8_USCALED): return VK_FORMAT_B8G8R8A8_USCALED;
+        case (VK_FORMAT_B8G8R8_SSCALED): return VK_FORMAT_B8G8R8A8_SSCALED;
+        case (VK_FORMAT_B8G8R8_UINT): return VK_FORMAT_B8G8R8A8_UINT;
+        case (VK_FORMAT_B8G8R8_SINT): return VK_FORMAT_B8G8R8A8_SINT;
+        case (VK_FORMAT_B8G8R8_SRGB): return VK_FORMAT_B8G8R8A8_SRGB;
+        default: return format;
+        }
+    }
+} // namespace
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// VirtualTexture
+//
+VirtualTexture::VirtualTexture(uint32_t in_pageWidth, uint32_t in_pageHeight, uint32_t in_numPages, VkFormat in_format) :
+    pageWidth(in_pageWidth),
+    pageHeight(in_pageHeight),
+    numPages(in_numPages),
+    format(in_format)
+{
+    mipLevels = 1 + static_cast<uint32_t>(std::floor(std::log2(static_cast<double>(std::max({pageWidth, pageHeight, 1u})))));
+}
+
+VirtualTexture::~VirtualTexture()
+{
+    // the tiles of a reload may hold the last reference, in which case this runs on the reload thread, OperationThreads::stop() handles this by detaching rather than joining it.
+    if (operationThreads) operationThreads->stop();
+}
+
+bool VirtualTexture::compatible(const Data& data) const
+{
+    const auto& properties = data.properties;
+    if (data.width() != pageWidth || data.height() != pageHeight || data.depth() != 1) return false;
+    if (properties.blockWidth > 1 || properties.blockHeight > 1) return false;
+    if (data.computeMipmapOffsets().size() > 1) return false;
+
+    // RGB data is expanded to RGBA on upload
+    return uploadFormat(properties.format) == format;
+}
+
+void VirtualTexture::init(ref_ptr<Sampler> sampler, ref_ptr<PipelineLayout> layout, uint32_t firstSet, uint32_t dstBinding, const Descriptors& descriptors)
+{
+    std::scoped_lock<std::mutex> lock(_mutex);
+
+    numPages = std::max(numPages, 2u);
+
+    pageTable = PageTable::create(numPages, 1);
+
+    image = Image::create();
+    image->imageType = VK_IMAGE_TYPE_2D;
+    image->format = format;
+    image->extent = VkExtent3D{pageWidth, pageHeight, 1};
+    image->mipLevels = mipLevels;
+    image->arrayLayers = numPages;
+    image->usage = VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+    if (mipLevels > 1) image->usage |= VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+
+    pageImageInfos.clear();
+    pageBindings.clear();
+    for (uint32_t page = 0; page < numPages; ++page)
+    {
+        auto imageView = ImageView::create(image);
+        imageView->viewType = VK_IMAGE_VIEW_TYPE_2D;
+        imageView->subresourceRange.baseMipLevel = 0;
+        imageView->subresourceRange.levelCount = mipLevels;
+        imageView->subresourceRange.baseArrayLayer = page;
+        imageView->subresourceRange.layerCount = 1;
+
+        auto imageInfo = ImageInfo::create(sampler, imageView, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+        pageImageInfos.push_back(imageInfo);
+
+        Descriptors pageDescriptors{DescriptorImage::create(imageInfo, dstBinding, 0, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER)};
+        pageDescriptors.insert(pageDescriptors.end(), descriptors.begin(), descriptors.end());
+
+        pageBindings.push_back(BindDescriptorSet::create(VK_PIPELINE_BIND_POINT_GRAPHICS, layout, firstSet, pageDescriptors));
+    }
+
+    if (!fallback)
+    {
+        if (format == VK_FORMAT_R8G8B8A8_UNORM || format == VK_FORMAT_R8G8B8A8_SRGB || format == VK_FORMAT_B8G8R8A8_UNORM || format == VK_FORMAT_B8G8R8A8_SRGB)
+        {
+            fallback = ubvec4Array2D::create(pageWidth, pageHeight, ubvec4(128, 128, 128, 255), Data::Properties{format});
+        }
+        else
+        {
+            warn("VirtualTexture::init() no fallback imagery assigned for format ", format, ", tiles awaiting reload will be unbound.");
+        }
+    }
+
+    _pageReady.assign(numPages, 0);
+    _compiled.clear();
+    _reloadRequests.clear();
+}
+
+void VirtualTexture::compile(Context& context)
+{
+    std::scoped_lock<std::mutex> lock(_mutex);
+
+    if (context.deviceID >= _compiled.size()) _compiled.resize(context.deviceID + 1, false);
+    if (_compiled[context.deviceID]) return;
+
+    for (auto& bindDescriptorSet : pageBindings)
+    {
+        bindDescriptorSet->compile(context);
+    }
+
+    if (fallback && !pageImageInfos.empty())
+    {
+        context.copy(fallback, pageImageInfos[0], mipLevels);
+        _pageReady[0] = 1;
+    }
+
+    _compiled[context.deviceID] = true;
+}
+
+uint32_t VirtualTexture::load(const PageTable::Key& key, ref_ptr<Data> data, Context& context, bool in_ready)
+{
+    if (!data || !pageTable) return 0;
+
+    uint32_t page = 0;
+    bool newlyAssigned = false;
+    {
+        std::scoped_lock<std::mutex> lock(_mutex);
+
+        std::tie(page, newlyAssigned) = pageTable->acquire(key, _frameCount);
+        if (page == 0 || !newlyAssigned) return page;
+
+        _pageReady[page] = in_ready ? 1 : 0;
+        ++numLoads;
+    }
+
+    context.copy(data, pageImageInfos[page], mipLevels);
+
+    return page;
+}
+
+void VirtualTexture::ready(uint32_t page)
+{
+    std::scoped_lock<std::mutex> lock(_mutex);
+    if (page < _pageReady.size()) _pageReady[page] = 1;
+}
+
+uint32_t VirtualTexture::use(const BindVirtualTextureTile& tile)
+{
+    std::scoped_lock<std::mutex> lock(_mutex);
+
+    if (!pageTable) return 0;
+
+    uint32_t page = pageTable->touch(tile.key, _frameCount);
+    if (page != 0)
+    {
+        // page may still be being reloaded
+        return _pageReady[page] ? page : 0;
+    }
+
+    if (tile.data) _reloadRequests.emplace(tile.key, ref_ptr<const BindVirtualTextureTile>(&tile));
+
+    return 0;
+}
+
+void VirtualTexture::advance(uint64_t frameCount, ref_ptr<CompileManager> in_compileManager)
+{
+    std::scoped_lock<std::mutex> lock(_mutex);
+
+    if (frameCount > _frameCount) _frameCount = frameCount;
+    if (!compileManager) compileManager = in_compileManager;
+
+    if (_reloading || _reloadRequests.empty() || !compileManager) return;
+
+    std::vector<ref_ptr<const BindVirtualTextureTile>> tiles;
+    for (auto itr = _reloadRequests.begin(); itr != _reloadRequests.end() && tiles.size() < maxReloadsPerFrame;)
+    {
+        tiles.push_back(itr->second);
+        itr = _reloadRequests.erase(itr);
+    }
+
+    _reloading = true;
+
+    if (!operationThreads) operationThreads = OperationThreads::create(1);
+    operationThreads->add(ReloadVirtualTexturePages::create(ref_ptr<VirtualTexture>(this), tiles));
+}
+
+void VirtualTexture::reload(std::vector<ref_ptr<const BindVirtualTextureTile>> tiles)
+{
+    auto loadPages = LoadVirtualTexturePages::create(this, tiles);
+
+    ref_ptr<CompileManager> cm;
+    {
+        std::scoped_lock<std::mutex> lock(_mutex);
+        cm = compileManager;
+    }
+
+    bool compiled = false;
+    if (cm)
+    {
+        try
+        {
+            compiled = static_cast<bool>(cm->compile(loadPages));
+        }
+        catch (const Exception& ve)
+        {
+            warn("VirtualTexture::reload() ", ve.message);
+        }
+    }
+
+    std::scoped_lock<std::mutex> lock(_mutex);
+
+    if (compiled)
+    {
+        for (auto& page : loadPages->pages) _pageReady[page] = 1;
+        numReloads += loadPages->pages.size();
+    }
+    else
+    {
+        // release the pages so the tiles are requested again
+        for (auto& tile : tiles) pageTable->release(tile->key);
+    }
+
+    _reloading = false;
+}
+
+void VirtualTexture::read(Input& input)
+{
+    Object::read(input);
+
+    input.read("pageWidth", pageWidth);
+    input.read("pageHeight", pageHeight);
+    input.read("numPages", numPages);
+    input.readValue<uint32_t>("format", format);
+    input.read("mipLevels", mipLevels);
+    input.read("maxReloadsPerFrame", maxReloadsPerFrame);
+    input.readObject("fallback", fallback);
+}
+
+void VirtualTexture::write(Output& output) const
+{
+    Object::write(output);
+
+    output.write("pageWidth", pageWidth);
+    output.write("pageHeight", pageHeight);
+    output.write("numPages", numPages);
+    output.writeValue<uint32_t>("format", format);
+    output.write("mipLevels", mipLevels);
+    output.write("maxReloadsPerFrame", maxReloadsPerFrame);
+    output.writeObject("fallback", fallback);
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// BindVirtualTextureTile
+//
+BindVirtualTextureTile::BindVirtualTextureTile()
+{
+}
+
+BindVirtualTextureTile::BindVirtualTextureTile(ref_ptr<VirtualTexture> in_virtualTexture, const PageTable::Key& in_key, ref_ptr<Data> in_data, uint32_t in_slot) :
+    Inherit(in_slot),
+    virtualTexture(in_virtualTexture),
+    key(in_key),
+    data(in_data)
+{
+}
+
+BindVirtualTextureTile::~BindVirtualTextureTile()
+{
+}
+
+int BindVirtualTextureTile::compare(const Object& rhs_object) const
+{
+    int result = StateCommand::compare(rhs_object);
+    if (result != 0) return result;
+
+    auto& rhs = static_cast<decltype(*this)>(rhs_object);
+
+    if ((result = compare_pointer(virtualTexture, rhs.virtualTexture))) return result;
+    if ((result = compare_memory(key, rhs.key))) return result;
+    return compare_pointer(data, rhs.data);
+}
+
+void BindVirtualTextureTile::read(Input& input)
+{
+    StateCommand::read(input);
+
+    input.readObject("virtualTexture", virtualTexture);
+    input.read("level", key.level);
+    input.read("x", key.x);
+    input.read("y", key.y);
+    input.readObject("data", data);
+}
+
+void BindVirtualTextureTile::write(Output& output) const
+{
+    StateCommand::write(output);
+
+    output.writeObject("virtualTexture", virtualTexture);
+    output.write("level", key.level);
+    output.write("x", key.x);
+    output.write("y", key.y);
+    output.writeObject("data", data);
+}
+
+void BindVirtualTextureTile::compile(Context& context)
+{
+    if (!virtualTexture || virtualTexture->pageBindings.empty()) return;
+
+    virtualTexture->compile(context);
+    virtualTexture->load(key, data, context);
+}
+
+void BindVirtualTextureTile::record(CommandBuffer& commandBuffer) const
+{
+    if (!virtualTexture || virtualTexture->pageBindings.empty()) return;
+
+    auto page = virtualTexture->use(*this);
+    if (page == 0 && !virtualTexture->fallback) return;
+
+    virtualTexture->pageBindings[page]->record(commandBuffer);
+}
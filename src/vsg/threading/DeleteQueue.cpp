@@ -0,0 +1,113 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2025 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/io/Logger.h>
+#include <vsg/threading/DeleteQueue.h>
+
+#include <chrono>
+
+using namespace vsg;
+
+DeleteQueue::DeleteQueue(ref_ptr<ActivityStatus> status) :
+    _status(status)
+{
+}
+
+DeleteQueue::~DeleteQueue()
+{
+    clear();
+}
+
+void DeleteQueue::advance(uint64_t frameCount)
+{
+    std::scoped_lock lock(_mutex);
+    _frameCount = frameCount;
+    _cv.notify_one();
+}
+
+void DeleteQueue::add(ref_ptr<Object> object)
+{
+    if (!object) return;
+
+    std::scoped_lock lock(_mutex);
+    _objectsToDelete.push_back(ObjectToDelete{_frameCount + retainFrames, object});
+    _cv.notify_one();
+}
+
+size_t DeleteQueue::wait_then_clear()
+{
+    std::chrono::duration waitDuration = std::chrono::milliseconds(100);
+
+    size_t numDeleted = 0;
+    std::unique_lock lock(_mutex);
+
+    // wait until the oldest object can be deleted and the current frame's time budget hasn't been used up
+    auto available = [&]() {
+        if (_objectsToDelete.empty() || _objectsToDelete.front().frameCount > _frameCount) return false;
+        return timeBudget <= 0.0 || _budgetFrameCount != _frameCount || _budgetUsed < timeBudget;
+    };
+
+    while (!available() && _status->active())
+    {
+        _cv.wait_for(lock, waitDuration);
+    }
+
+    if (_status->cancel()) return 0;
+
+    if (_budgetFrameCount != _frameCount)
+    {
+        _budgetFrameCount = _frameCount;
+        _budgetUsed = 0.0;
+    }
+
+    while (!_objectsToDelete.empty() && _objectsToDelete.front().frameCount <= _frameCount && (timeBudget <= 0.0 || _budgetUsed < timeBudget))
+    {
+        auto object = std::move(_objectsToDelete.front().object);
+        _objectsToDelete.pop_front();
+
+        // delete the object with the mutex released so that add() and advance() aren't blocked
+        lock.unlock();
+
+        auto start_point = std::chrono::steady_clock::now();
+        object = {};
+        auto duration = std::chrono::duration<double, std::chrono::milliseconds::period>(std::chrono::steady_clock::now() - start_point).count();
+
+        lock.lock();
+
+        // the frame may have advanced while deleting, in which case the time is charged to the new frame
+        if (_budgetFrameCount != _frameCount)
+        {
+            _budgetFrameCount = _frameCount;
+            _budgetUsed = 0.0;
+        }
+        _budgetUsed += duration;
+        ++numDeleted;
+    }
+
+    return numDeleted;
+}
+
+void DeleteQueue::clear()
+{
+    std::list<ObjectToDelete> objectsToDelete;
+    {
+        std::scoped_lock lock(_mutex);
+        objectsToDelete.swap(_objectsToDelete);
+    }
+    objectsToDelete.clear();
+}
+
+size_t DeleteQueue::size() const
+{
+    std::scoped_lock lock(_mutex);
+    return _objectsToDelete.size();
+}
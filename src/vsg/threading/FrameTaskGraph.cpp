@@ -0,0 +1,227 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2025 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/io/Logger.h>
+#include <vsg/threading/FrameTaskGraph.h>
+
+#include <iomanip>
+
+using namespace vsg;
+
+namespace
+{
+    double milliseconds(const time_point& start, const time_point& end)
+    {
+        return std::chrono::duration<double, std::chrono::milliseconds::period>(end - start).count();
+    }
+} // namespace
+
+FrameTaskGraph::FrameTaskGraph(ref_ptr<OperationThreads> in_operationThreads) :
+    operationThreads(in_operationThreads),
+    _latch(Latch::create(0))
+{
+}
+
+FrameTaskGraph::~FrameTaskGraph()
+{
+}
+
+uint32_t FrameTaskGraph::add(const std::string& name, Function function, const Indices& dependencies)
+{
+    uint32_t index = static_cast<uint32_t>(tasks.size());
+
+    Task task;
+    task.name = name;
+    task.function = function;
+    for (auto dependency : dependencies)
+    {
+        if (dependency < index)
+        {
+            task.dependencies.push_back(dependency);
+            tasks[dependency].dependents.push_back(index);
+        }
+        else
+        {
+            warn("FrameTaskGraph::add(", name, ", ...) dependency ", dependency, " has not been added yet, ignoring dependency.");
+        }
+    }
+
+    tasks.push_back(std::move(task));
+
+    return index;
+}
+
+void FrameTaskGraph::clear()
+{
+    tasks.clear();
+    _operations.clear();
+    _pending.reset();
+    _compiledSize = 0;
+}
+
+void FrameTaskGraph::run()
+{
+    start = clock::now();
+
+    if (!operationThreads)
+    {
+        // tasks are always added after their dependencies so running them in order satisfies all dependencies
+        for (auto& task : tasks)
+        {
+            task.start = clock::now();
+            if (task.function) task.function();
+            task.end = clock::now();
+        }
+
+        end = clock::now();
+        return;
+    }
+
+    if (_compiledSize != tasks.size())
+    {
+        struct RunTask : public Inherit<Operation, RunTask>
+        {
+            RunTask(FrameTaskGraph* in_graph, uint32_t in_index) :
+                graph(in_graph), index(in_index) {}
+
+            FrameTaskGraph* graph;
+            uint32_t index;
+
+            void run() override { graph->_run(index); }
+        };
+
+        _compiledSize = tasks.size();
+        _pending.reset(new std::atomic_uint32_t[_compiledSize]);
+        _operations.clear();
+        for (uint32_t i = 0; i < _compiledSize; ++i)
+        {
+            _operations.push_back(RunTask::create(this, i));
+        }
+    }
+
+    Indices roots;
+    for (uint32_t i = 0; i < _compiledSize; ++i)
+    {
+        _pending[i] = static_cast<uint32_t>(tasks[i].dependencies.size());
+        if (tasks[i].dependencies.empty()) roots.push_back(i);
+    }
+
+    _latch->set(static_cast<int>(_compiledSize));
+
+    if (!roots.empty())
+    {
+        // pass all but the first root task to the worker threads, and run the first root task on this thread
+        for (size_t i = 1; i < roots.size(); ++i)
+        {
+            operationThreads->add(_operations[roots[i]]);
+        }
+
+        _run(roots.front());
+    }
+
+    // use this thread to help with any remaining tasks then wait for the worker threads to complete
+    operationThreads->run();
+    _latch->wait();
+
+    end = clock::now();
+}
+
+void FrameTaskGraph::_run(uint32_t index)
+{
+    static constexpr uint32_t none = std::numeric_limits<uint32_t>::max();
+
+    while (index != none)
+    {
+        auto& task = tasks[index];
+
+        task.start = clock::now();
+        if (task.function) task.function();
+        task.end = clock::now();
+
+        // release the dependents, continuing on this thread with the first to become ready and passing any others to the worker threads
+        uint32_t next = none;
+        for (auto dependent : task.dependents)
+        {
+            if (_pending[dependent].fetch_sub(1) == 1)
+            {
+                if (next == none)
+                    next = dependent;
+                else
+                    operationThreads->add(_operations[dependent]);
+            }
+        }
+
+        _latch->count_down();
+
+        index = next;
+    }
+}
+
+double FrameTaskGraph::duration(uint32_t index) const
+{
+    if (index >= tasks.size()) return 0.0;
+    return milliseconds(tasks[index].start, tasks[index].end);
+}
+
+FrameTaskGraph::Indices FrameTaskGraph::criticalPath() const
+{
+    if (tasks.empty()) return {};
+
+    static constexpr uint32_t none = std::numeric_limits<uint32_t>::max();
+
+    // tasks are in dependency order so the longest chain ending at each task can be accumulated in a single pass
+    std::vector<double> longest(tasks.size(), 0.0);
+    std::vector<uint32_t> previous(tasks.size(), none);
+    uint32_t last = 0;
+    for (uint32_t i = 0; i < tasks.size(); ++i)
+    {
+        for (auto dependency : tasks[i].dependencies)
+        {
+            if (longest[dependency] > longest[i] || previous[i] == none)
+            {
+                longest[i] = longest[dependency];
+                previous[i] = dependency;
+            }
+        }
+        longest[i] += duration(i);
+        if (longest[i] > longest[last]) last = i;
+    }
+
+    Indices path;
+    for (uint32_t i = last; i != none; i = previous[i])
+    {
+        path.push_back(i);
+    }
+    return Indices(path.rbegin(), path.rend());
+}
+
+void FrameTaskGraph::report(std::ostream& out) const
+{
+    auto path = criticalPath();
+    std::vector<bool> onPath(tasks.size(), false);
+    double criticalPathDuration = 0.0;
+    for (auto index : path)
+    {
+        onPath[index] = true;
+        criticalPathDuration += duration(index);
+    }
+
+    double totalDuration = 0.0;
+    for (uint32_t i = 0; i < tasks.size(); ++i) totalDuration += duration(i);
+
+    out << "FrameTaskGraph " << tasks.size() << " tasks, frame " << milliseconds(start, end) << "ms, total task time " << totalDuration << "ms, critical path " << criticalPathDuration << "ms" << std::endl;
+    for (uint32_t i = 0; i < tasks.size(); ++i)
+    {
+        auto& task = tasks[i];
+        out << (onPath[i] ? "  * " : "    ") << std::left << std::setw(32) << task.name << std::right << " start " << std::setw(10) << milliseconds(start, task.start) << "ms, duration " << std::setw(10) << duration(i) << "ms" << std::endl;
+    }
+}
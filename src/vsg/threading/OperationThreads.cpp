@@ -55,9 +55,14 @@ void OperationThreads::stop()
 {
     status->set(false);
 
+    auto this_thread_id = std::this_thread::get_id();
     for (auto& thread : threads)
     {
-        thread.join();
+        // an Operation may release the last reference to the owner of this OperationThreads, a thread can't join itself so detach it, it exits once the Operation returns.
+        if (thread.get_id() == this_thread_id)
+            thread.detach();
+        else if (thread.joinable())
+            thread.join();
     }
 
     threads.clear();
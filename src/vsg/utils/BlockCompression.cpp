@@ -0,0 +1,1208 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2025 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/core/Array2D.h>
+#include <vsg/core/Array3D.h>
+#include <vsg/io/Logger.h>
+#include <vsg/threading/OperationThreads.h>
+#include <vsg/utils/BlockCompression.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+using namespace vsg;
+
+namespace
+{
+    using Block = uint8_t[16][4];
+    using Quality = BlockCompressionSettings::Quality;
+
+    struct EncodeParameters
+    {
+        Quality quality = BlockCompressionSettings::BALANCED;
+        bool punchThroughAlpha = false;
+        uint8_t alphaThreshold = 128;
+    };
+
+    using EncodeFunction = void (*)(const Block& block, uint8_t* dest, const EncodeParameters& parameters);
+
+    inline int clamp255(int v) { return v < 0 ? 0 : (v > 255 ? 255 : v); }
+    inline int clamp255(float v) { return clamp255(static_cast<int>(std::lround(v))); }
+
+    inline int square(int v) { return v * v; }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    //
+    // principal axis fitting shared by the BC1 and BC7 encoders
+    //
+    template<int N>
+    void computeEndPoints(const Block& block, Quality quality, float ep0[4], float ep1[4])
+    {
+        float mean[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+        float minv[4] = {255.0f, 255.0f, 255.0f, 255.0f};
+        float maxv[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+        for (int i = 0; i < 16; ++i)
+        {
+            for (int c = 0; c < N; ++c)
+            {
+                float v = block[i][c];
+                mean[c] += v;
+                minv[c] = std::min(minv[c], v);
+                maxv[c] = std::max(maxv[c], v);
+            }
+        }
+        for (int c = 0; c < N; ++c) mean[c] /= 16.0f;
+
+        float cov[N][N];
+        for (int r = 0; r < N; ++r)
+            for (int c = 0; c < N; ++c) cov[r][c] = 0.0f;
+
+        for (int i = 0; i < 16; ++i)
+        {
+            float d[N];
+            for (int c = 0; c < N; ++c) d[c] = block[i][c] - mean[c];
+            for (int r = 0; r < N; ++r)
+                for (int c = 0; c < N; ++c) cov[r][c] += d[r] * d[c];
+        }
+
+        float axis[N];
+        for (int c = 0; c < N; ++c) axis[c] = maxv[c] - minv[c];
+
+        if (quality == BlockCompressionSettings::FASTEST)
+        {
+            // flip the bounding box diagonal to follow the sign of the covariance with the dominant channel
+            int dominant = 0;
+            for (int c = 1; c < N; ++c)
+                if (cov[c][c] > cov[dominant][dominant]) dominant = c;
+            for (int c = 0; c < N; ++c)
+                if (cov[dominant][c] < 0.0f) axis[c] = -axis[c];
+        }
+        else
+        {
+            // power iteration to find the principal axis of the colour distribution
+            for (int iteration = 0; iteration < 8; ++iteration)
+            {
+                float next[N];
+                float length = 0.0f;
+                for (int r = 0; r < N; ++r)
+                {
+                    next[r] = 0.0f;
+                    for (int c = 0; c < N; ++c) next[r] += cov[r][c] * axis[c];
+                    length = std::max(length, std::abs(next[r]));
+                }
+                if (length == 0.0f) break;
+                for (int c = 0; c < N; ++c) axis[c] = next[c] / length;
+            }
+        }
+
+        float axisLength2 = 0.0f;
+        for (int c = 0; c < N; ++c) axisLength2 += axis[c] * axis[c];
+
+        if (axisLength2 == 0.0f)
+        {
+            for (int c = 0; c < N; ++c) ep0[c] = ep1[c] = mean[c];
+            return;
+        }
+
+        float minT = 0.0f, maxT = 0.0f;
+        for (int i = 0; i < 16; ++i)
+        {
+            float t = 0.0f;
+            for (int c = 0; c < N; ++c) t += (block[i][c] - mean[c]) * axis[c];
+            minT = std::min(minT, t);
+            maxT = std::max(maxT, t);
+        }
+        minT /= axisLength2;
+        maxT /= axisLength2;
+
+        // inset the end points slightly to reduce the error of the extremes dominating the interpolated values
+        float inset = (maxT - minT) / 32.0f;
+        minT += inset;
+        maxT -= inset;
+
+        for (int c = 0; c < N; ++c)
+        {
+            ep0[c] = std::clamp(mean[c] + maxT * axis[c], 0.0f, 255.0f);
+            ep1[c] = std::clamp(mean[c] + minT * axis[c], 0.0f, 255.0f);
+        }
+    }
+
+    /// least squares fit of the end points given the interpolation weights assigned to each texel, weights[i] is the weighting of ep0.
+    template<int N>
+    bool refineEndPoints(const Block& block, const float weights[16], float ep0[4], float ep1[4])
+    {
+        float aa = 0.0f, ab = 0.0f, bb = 0.0f;
+        float ax[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+        float bx[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+        for (int i = 0; i < 16; ++i)
+        {
+            float a = weights[i];
+            float b = 1.0f - a;
+            aa += a * a;
+            ab += a * b;
+            bb += b * b;
+            for (int c = 0; c < N; ++c)
+            {
+                ax[c] += a * block[i][c];
+                bx[c] += b * block[i][c];
+            }
+        }
+
+        float det = aa * bb - ab * ab;
+        if (std::abs(det) < 1e-6f) return false;
+
+        for (int c = 0; c < N; ++c)
+        {
+            ep0[c] = std::clamp((ax[c] * bb - bx[c] * ab) / det, 0.0f, 255.0f);
+            ep1[c] = std::clamp((bx[c] * aa - ax[c] * ab) / det, 0.0f, 255.0f);
+        }
+        return true;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    //
+    // BC1 colour block, also used for the colour part of BC3
+    //
+    inline uint16_t pack565(const float c[4])
+    {
+        int r = (clamp255(c[0]) * 31 + 127) / 255;
+        int g = (clamp255(c[1]) * 63 + 127) / 255;
+        int b = (clamp255(c[2]) * 31 + 127) / 255;
+        return static_cast<uint16_t>((r << 11) | (g << 5) | b);
+    }
+
+    inline void unpack565(uint16_t v, int c[3])
+    {
+        int r = (v >> 11) & 31;
+        int g = (v >> 5) & 63;
+        int b = v & 31;
+        c[0] = (r << 3) | (r >> 2);
+        c[1] = (g << 2) | (g >> 4);
+        c[2] = (b << 3) | (b >> 2);
+    }
+
+    struct ColorBlock
+    {
+        uint16_t c0, c1;
+        uint32_t indices;
+        int error;
+    };
+
+    ColorBlock fitColorBlock(const Block& block, const float ep0[4], const float ep1[4], bool threeColor, const bool transparent[16])
+    {
+        ColorBlock result;
+        result.c0 = pack565(ep0);
+        result.c1 = pack565(ep1);
+
+        // four colour mode requires c0 > c1, three colour mode requires c0 <= c1
+        if (threeColor ? (result.c0 > result.c1) : (result.c0 < result.c1)) std::swap(result.c0, result.c1);
+
+        int palette[4][3];
+        unpack565(result.c0, palette[0]);
+        unpack565(result.c1, palette[1]);
+        int numColors = 4;
+        if (result.c0 == result.c1 && !threeColor)
+        {
+            numColors = 1;
+        }
+        else if (threeColor)
+        {
+            for (int c = 0; c < 3; ++c) palette[2][c] = (palette[0][c] + palette[1][c]) / 2;
+            numColors = 3;
+        }
+        else
+        {
+            for (int c = 0; c < 3; ++c)
+            {
+                palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+                palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+            }
+        }
+
+        result.indices = 0;
+        result.error = 0;
+        for (int i = 0; i < 16; ++i)
+        {
+            if (transparent && transparent[i])
+            {
+                result.indices |= 3u << (2 * i);
+                continue;
+            }
+
+            int best = 0;
+            int bestError = std::numeric_limits<int>::max();
+            for (int p = 0; p < numColors; ++p)
+            {
+                int e = square(block[i][0] - palette[p][0]) + square(block[i][1] - palette[p][1]) + square(block[i][2] - palette[p][2]);
+                if (e < bestError)
+                {
+                    bestError = e;
+                    best = p;
+                }
+            }
+            result.indices |= static_cast<uint32_t>(best) << (2 * i);
+            result.error += bestError;
+        }
+        return result;
+    }
+
+    void encodeColorBlock(const Block& block, uint8_t* dest, const EncodeParameters& parameters, bool allowPunchThrough)
+    {
+        bool transparent[16];
+        bool anyTransparent = false;
+        for (int i = 0; i < 16; ++i)
+        {
+            transparent[i] = allowPunchThrough && block[i][3] < parameters.alphaThreshold;
+            anyTransparent = anyTransparent || transparent[i];
+        }
+
+        float ep0[4], ep1[4];
+        computeEndPoints<3>(block, parameters.quality, ep0, ep1);
+
+        ColorBlock result = fitColorBlock(block, ep0, ep1, anyTransparent, anyTransparent ? transparent : nullptr);
+
+        if (parameters.quality == BlockCompressionSettings::HIGHEST && !anyTransparent)
+        {
+            static const float s_weights[4] = {1.0f, 0.0f, 2.0f / 3.0f, 1.0f / 3.0f};
+            for (int iteration = 0; iteration < 2 && result.error > 0; ++iteration)
+            {
+                float weights[16];
+                for (int i = 0; i < 16; ++i) weights[i] = s_weights[(result.indices >> (2 * i)) & 3];
+
+                int p0[3], p1[3];
+                unpack565(result.c0, p0);
+                unpack565(result.c1, p1);
+                float r0[4] = {float(p0[0]), float(p0[1]), float(p0[2]), 0.0f};
+                float r1[4] = {float(p1[0]), float(p1[1]), float(p1[2]), 0.0f};
+                if (!refineEndPoints<3>(block, weights, r0, r1)) break;
+
+                ColorBlock refined = fitColorBlock(block, r0, r1, false, nullptr);
+                if (refined.error >= result.error) break;
+                result = refined;
+            }
+        }
+
+        dest[0] = static_cast<uint8_t>(result.c0 & 0xff);
+        dest[1] = static_cast<uint8_t>(result.c0 >> 8);
+        dest[2] = static_cast<uint8_t>(result.c1 & 0xff);
+        dest[3] = static_cast<uint8_t>(result.c1 >> 8);
+        for (int i = 0; i < 4; ++i) dest[4 + i] = static_cast<uint8_t>(result.indices >> (8 * i));
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    //
+    // BC4 single channel block, also used for the alpha part of BC3 and both channels of BC5
+    //
+    int fitChannelBlock(const uint8_t values[16], int a0, int a1, uint64_t& indices)
+    {
+        int palette[8];
+        palette[0] = a0;
+        palette[1] = a1;
+        if (a0 > a1)
+        {
+            for (int i = 1; i < 7; ++i) palette[i + 1] = ((7 - i) * a0 + i * a1 + 3) / 7;
+        }
+        else
+        {
+            for (int i = 1; i < 5; ++i) palette[i + 1] = ((5 - i) * a0 + i * a1 + 2) / 5;
+            palette[6] = 0;
+            palette[7] = 255;
+        }
+
+        int error = 0;
+        indices = 0;
+        for (int i = 0; i < 16; ++i)
+        {
+            int best = 0;
+            int bestError = std::numeric_limits<int>::max();
+            for (int p = 0; p < 8; ++p)
+            {
+                int e = square(values[i] - palette[p]);
+                if (e < bestError)
+                {
+                    bestError = e;
+                    best = p;
+                }
+            }
+            indices |= static_cast<uint64_t>(best) << (3 * i);
+            error += bestError;
+        }
+        return error;
+    }
+
+    void encodeChannelBlock(const Block& block, int channel, uint8_t* dest, Quality quality)
+    {
+        uint8_t values[16];
+        int minv = 255, maxv = 0;
+        int minInner = 255, maxInner = 0;
+        for (int i = 0; i < 16; ++i)
+        {
+            int v = block[i][channel];
+            values[i] = static_cast<uint8_t>(v);
+            minv = std::min(minv, v);
+            maxv = std::max(maxv, v);
+            if (v != 0 && v != 255)
+            {
+                minInner = std::min(minInner, v);
+                maxInner = std::max(maxInner, v);
+            }
+        }
+
+        int a0 = maxv, a1 = minv;
+        uint64_t indices = 0;
+        int error = fitChannelBlock(values, a0, a1, indices);
+
+        if (quality != BlockCompressionSettings::FASTEST && error > 0)
+        {
+            // the six value mode has explicit 0 and 255 entries so can fit the remaining values more tightly
+            if (minInner <= maxInner)
+            {
+                uint64_t sixIndices = 0;
+                int sixError = fitChannelBlock(values, minInner, maxInner, sixIndices);
+                if (sixError < error)
+                {
+                    a0 = minInner;
+                    a1 = maxInner;
+                    indices = sixIndices;
+                    error = sixError;
+                }
+            }
+
+            if (quality == BlockCompressionSettings::HIGHEST && a0 > a1)
+            {
+                // search for nearby end points that reduce the overall error
+                const int range = 4;
+                int best0 = a0, best1 = a1;
+                for (int d0 = -range; d0 <= range; ++d0)
+                {
+                    for (int d1 = -range; d1 <= range; ++d1)
+                    {
+                        int t0 = clamp255(best0 + d0);
+                        int t1 = clamp255(best1 + d1);
+                        if (t0 <= t1) continue;
+
+                        uint64_t trialIndices = 0;
+                        int trialError = fitChannelBlock(values, t0, t1, trialIndices);
+                        if (trialError < error)
+                        {
+                            a0 = t0;
+                            a1 = t1;
+                            indices = trialIndices;
+                            error = trialError;
+                        }
+                    }
+                }
+            }
+        }
+
+        dest[0] = static_cast<uint8_t>(a0);
+        dest[1] = static_cast<uint8_t>(a1);
+        for (int i = 0; i < 6; ++i) dest[2 + i] = static_cast<uint8_t>(indices >> (8 * i));
+    }
+
+    void encodeBC1(const Block& block, uint8_t* dest, const EncodeParameters& parameters)
+    {
+        encodeColorBlock(block, dest, parameters, parameters.punchThroughAlpha);
+    }
+
+    void encodeBC3(const Block& block, uint8_t* dest, const EncodeParameters& parameters)
+    {
+        encodeChannelBlock(block, 3, dest, parameters.quality);
+        encodeColorBlock(block, dest + 8, parameters, false);
+    }
+
+    void encodeBC4(const Block& block, uint8_t* dest, const EncodeParameters& parameters)
+    {
+        encodeChannelBlock(block, 0, dest, parameters.quality);
+    }
+
+    void encodeBC5(const Block& block, uint8_t* dest, const EncodeParameters& parameters)
+    {
+        encodeChannelBlock(block, 0, dest, parameters.quality);
+        encodeChannelBlock(block, 1, dest + 8, parameters.quality);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    //
+    // BC7 encoded using mode 6, a single subset with 7777 RGBA end points, per end point p-bit and 4 bit indices.
+    //
+    const int s_bc7Weights4[16] = {0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+
+    struct BC7Mode6
+    {
+        int endpoint[2][4]; // 7 bit values
+        int pbit[2];
+        uint8_t indices[16];
+        int error;
+    };
+
+    void quantizeBC7EndPoint(const float ep[4], int endpoint[4], int& pbit)
+    {
+        int bestError = std::numeric_limits<int>::max();
+        for (int p = 0; p < 2; ++p)
+        {
+            int q[4];
+            int error = 0;
+            for (int c = 0; c < 4; ++c)
+            {
+                q[c] = std::clamp(static_cast<int>(std::lround((ep[c] - p) / 2.0f)), 0, 127);
+                error += square(((q[c] << 1) | p) - clamp255(ep[c]));
+            }
+            if (error < bestError)
+            {
+                bestError = error;
+                pbit = p;
+                for (int c = 0; c < 4; ++c) endpoint[c] = q[c];
+            }
+        }
+    }
+
+    BC7Mode6 fitBC7Mode6(const Block& block, const float ep0[4], const float ep1[4])
+    {
+        BC7Mode6 result;
+        quantizeBC7EndPoint(ep0, result.endpoint[0], result.pbit[0]);
+        quantizeBC7EndPoint(ep1, result.endpoint[1], result.pbit[1]);
+
+        int e0[4], e1[4];
+        for (int c = 0; c < 4; ++c)
+        {
+            e0[c] = (result.endpoint[0][c] << 1) | result.pbit[0];
+            e1[c] = (result.endpoint[1][c] << 1) | result.pbit[1];
+        }
+
+        int palette[16][4];
+        for (int i = 0; i < 16; ++i)
+        {
+            int w = s_bc7Weights4[i];
+            for (int c = 0; c < 4; ++c) palette[i][c] = ((64 - w) * e0[c] + w * e1[c] + 32) >> 6;
+        }
+
+        result.error = 0;
+        for (int i = 0; i < 16; ++i)
+        {
+            int best = 0;
+            int bestError = std::numeric_limits<int>::max();
+            for (int p = 0; p < 16; ++p)
+            {
+                int e = square(block[i][0] - palette[p][0]) + square(block[i][1] - palette[p][1]) + square(block[i][2] - palette[p][2]) + square(block[i][3] - palette[p][3]);
+                if (e < bestError)
+                {
+                    bestError = e;
+                    best = p;
+                }
+            }
+            result.indices[i] = static_cast<uint8_t>(best);
+            result.error += bestError;
+        }
+        return result;
+    }
+
+    struct BitWriter
+    {
+        uint8_t* dest;
+        uint32_t position = 0;
+
+        void write(uint32_t value, uint32_t numBits)
+        {
+            for (uint32_t i = 0; i < numBits; ++i, ++position)
+            {
+                if ((value >> i) & 1) dest[position >> 3] |= static_cast<uint8_t>(1u << (position & 7));
+            }
+        }
+    };
+
+    void encodeBC7(const Block& block, uint8_t* dest, const EncodeParameters& parameters)
+    {
+        float ep0[4], ep1[4];
+        computeEndPoints<4>(block, parameters.quality, ep0, ep1);
+
+        BC7Mode6 result = fitBC7Mode6(block, ep0, ep1);
+
+        if (parameters.quality == BlockCompressionSettings::HIGHEST)
+        {
+            for (int iteration = 0; iteration < 2 && result.error > 0; ++iteration)
+            {
+                float weights[16];
+                for (int i = 0; i < 16; ++i) weights[i] = 1.0f - static_cast<float>(s_bc7Weights4[result.indices[i]]) / 64.0f;
+
+                float r0[4], r1[4];
+                if (!refineEndPoints<4>(block, weights, r0, r1)) break;
+
+                BC7Mode6 refined = fitBC7Mode6(block, r0, r1);
+                if (refined.error >= result.error) break;
+                result = refined;
+            }
+        }
+
+        // the most significant bit of the anchor index is implicitly zero, so swap end points if required.
+        if (result.indices[0] & 8)
+        {
+            for (int c = 0; c < 4; ++c) std::swap(result.endpoint[0][c], result.endpoint[1][c]);
+            std::swap(result.pbit[0], result.pbit[1]);
+            for (auto& index : result.indices) index = static_cast<uint8_t>(15 - index);
+        }
+
+        std::fill(dest, dest + 16, uint8_t(0));
+        BitWriter writer{dest};
+        writer.write(1u << 6, 7); // mode 6
+        for (int c = 0; c < 4; ++c)
+        {
+            writer.write(result.endpoint[0][c], 7);
+            writer.write(result.endpoint[1][c], 7);
+        }
+        writer.write(result.pbit[0], 1);
+        writer.write(result.pbit[1], 1);
+        writer.write(result.indices[0], 3);
+        for (int i = 1; i < 16; ++i) writer.write(result.indices[i], 4);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    //
+    // ETC2 RGB8, encoded using the ETC1 compatible individual and differential modes
+    //
+    const int s_etcModifiers[8][2] = {{2, 8}, {5, 17}, {9, 29}, {13, 42}, {18, 60}, {24, 80}, {33, 106}, {47, 183}};
+
+    /// index of texel (x, y) in the column major order used by ETC2 and EAC
+    inline int etcPixelIndex(int x, int y) { return x * 4 + y; }
+
+    struct SubBlockFit
+    {
+        int table = 0;
+        int error = std::numeric_limits<int>::max();
+        uint8_t selectors[8];
+    };
+
+    SubBlockFit fitSubBlock(const Block& block, const int texels[8], const int base[3])
+    {
+        SubBlockFit best;
+        for (int t = 0; t < 8; ++t)
+        {
+            int modifiers[4] = {s_etcModifiers[t][0], s_etcModifiers[t][1], -s_etcModifiers[t][0], -s_etcModifiers[t][1]};
+            SubBlockFit fit;
+            fit.table = t;
+            fit.error = 0;
+            for (int i = 0; i < 8 && fit.error < best.error; ++i)
+            {
+                const uint8_t* texel = block[texels[i]];
+                int bestSelector = 0;
+                int bestError = std::numeric_limits<int>::max();
+                for (int s = 0; s < 4; ++s)
+                {
+                    int e = square(texel[0] - clamp255(base[0] + modifiers[s])) + square(texel[1] - clamp255(base[1] + modifiers[s])) + square(texel[2] - clamp255(base[2] + modifiers[s]));
+                    if (e < bestError)
+                    {
+                        bestError = e;
+                        bestSelector = s;
+                    }
+                }
+                fit.selectors[i] = static_cast<uint8_t>(bestSelector);
+                fit.error += bestError;
+            }
+            if (fit.error < best.error) best = fit;
+        }
+        return best;
+    }
+
+    struct ETCBlock
+    {
+        bool differential = false;
+        bool flip = false;
+        int base[2][3];         // quantized base colours, 4 bit for individual and 5 bit for differential
+        SubBlockFit fits[2];
+        int texels[2][8];
+        int error = std::numeric_limits<int>::max();
+    };
+
+    inline int expand4(int v) { return (v << 4) | v; }
+    inline int expand5(int v) { return (v << 3) | (v >> 2); }
+
+    void tryETCBlock(const Block& block, ETCBlock& best, bool flip, bool differential, const int q0[3], const int q1[3], const int texels[2][8])
+    {
+        ETCBlock candidate;
+        candidate.flip = flip;
+        candidate.differential = differential;
+        candidate.error = 0;
+        for (int s = 0; s < 2; ++s)
+        {
+            const int* q = (s == 0) ? q0 : q1;
+            int base[3];
+            for (int c = 0; c < 3; ++c)
+            {
+                candidate.base[s][c] = q[c];
+                base[c] = differential ? expand5(q[c]) : expand4(q[c]);
+            }
+            for (int i = 0; i < 8; ++i) candidate.texels[s][i] = texels[s][i];
+            candidate.fits[s] = fitSubBlock(block, texels[s], base);
+            candidate.error += candidate.fits[s].error;
+        }
+        if (candidate.error < best.error) best = candidate;
+    }
+
+    void encodeETCColor(const Block& block, uint8_t* dest, Quality quality)
+    {
+        ETCBlock best;
+
+        int numFlips = (quality == BlockCompressionSettings::FASTEST) ? 1 : 2;
+        for (int f = 0; f < numFlips; ++f)
+        {
+            bool flip = (f == 1);
+
+            // assign texels to sub blocks, flip==false splits into left/right 2x4 halves, flip==true top/bottom 4x2 halves.
+            int texels[2][8];
+            int count[2] = {0, 0};
+            for (int y = 0; y < 4; ++y)
+            {
+                for (int x = 0; x < 4; ++x)
+                {
+                    int s = flip ? (y / 2) : (x / 2);
+                    texels[s][count[s]++] = y * 4 + x;
+                }
+            }
+
+            float average[2][3];
+            for (int s = 0; s < 2; ++s)
+            {
+                for (int c = 0; c < 3; ++c)
+                {
+                    int sum = 0;
+                    for (int i = 0; i < 8; ++i) sum += block[texels[s][i]][c];
+                    average[s][c] = static_cast<float>(sum) / 8.0f;
+                }
+            }
+
+            // differential mode, 5 bit base colours with the second expressed as a 3 bit signed offset from the first.
+            int q0[3], q1[3];
+            bool differentialValid = true;
+            for (int c = 0; c < 3; ++c)
+            {
+                q0[c] = std::clamp(static_cast<int>(std::lround(average[0][c] * 31.0f / 255.0f)), 0, 31);
+                q1[c] = std::clamp(static_cast<int>(std::lround(average[1][c] * 31.0f / 255.0f)), 0, 31);
+                int delta = q1[c] - q0[c];
+                if (delta < -4 || delta > 3) differentialValid = false;
+            }
+
+            if (differentialValid)
+            {
+                tryETCBlock(block, best, flip, true, q0, q1, texels);
+
+                if (quality == BlockCompressionSettings::HIGHEST)
+                {
+                    // try shifting the intensity of each base colour by one quantization step
+                    for (int d0 = -1; d0 <= 1; ++d0)
+                    {
+                        for (int d1 = -1; d1 <= 1; ++d1)
+                        {
+                            if (d0 == 0 && d1 == 0) continue;
+                            int t0[3], t1[3];
+                            bool valid = true;
+                            for (int c = 0; c < 3; ++c)
+                            {
+                                t0[c] = std::clamp(q0[c] + d0, 0, 31);
+                                t1[c] = std::clamp(q1[c] + d1, 0, 31);
+                                int delta = t1[c] - t0[c];
+                                if (delta < -4 || delta > 3) valid = false;
+                            }
+                            if (valid) tryETCBlock(block, best, flip, true, t0, t1, texels);
+                        }
+                    }
+                }
+            }
+
+            if (!differentialValid || quality != BlockCompressionSettings::FASTEST)
+            {
+                // individual mode, two independent 4 bit base colours
+                for (int c = 0; c < 3; ++c)
+                {
+                    q0[c] = std::clamp(static_cast<int>(std::lround(average[0][c] * 15.0f / 255.0f)), 0, 15);
+                    q1[c] = std::clamp(static_cast<int>(std::lround(average[1][c] * 15.0f / 255.0f)), 0, 15);
+                }
+                tryETCBlock(block, best, flip, false, q0, q1, texels);
+            }
+        }
+
+        uint64_t bits = 0;
+        if (best.differential)
+        {
+            for (int c = 0; c < 3; ++c)
+            {
+                int shift = 59 - c * 8;
+                uint64_t delta = static_cast<uint64_t>((best.base[1][c] - best.base[0][c]) & 7);
+                bits |= static_cast<uint64_t>(best.base[0][c]) << shift;
+                bits |= delta << (shift - 3);
+            }
+            bits |= uint64_t(1) << 33;
+        }
+        else
+        {
+            for (int c = 0; c < 3; ++c)
+            {
+                int shift = 60 - c * 8;
+                bits |= static_cast<uint64_t>(best.base[0][c]) << shift;
+                bits |= static_cast<uint64_t>(best.base[1][c]) << (shift - 4);
+            }
+        }
+        bits |= static_cast<uint64_t>(best.fits[0].table) << 37;
+        bits |= static_cast<uint64_t>(best.fits[1].table) << 34;
+        if (best.flip) bits |= uint64_t(1) << 32;
+
+        for (int s = 0; s < 2; ++s)
+        {
+            for (int i = 0; i < 8; ++i)
+            {
+                int texel = best.texels[s][i];
+                int p = etcPixelIndex(texel % 4, texel / 4);
+                uint64_t selector = best.fits[s].selectors[i];
+                bits |= (selector & 1) << p;
+                bits |= ((selector >> 1) & 1) << (16 + p);
+            }
+        }
+
+        for (int i = 0; i < 8; ++i) dest[i] = static_cast<uint8_t>(bits >> (56 - 8 * i));
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    //
+    // EAC alpha, used for the alpha part of ETC2 RGBA8
+    //
+    const int s_eacModifiers[16][8] = {
+        {-3, -6, -9, -15, 2, 5, 8, 14},
+        {-3, -7, -10, -13, 2, 6, 9, 12},
+        {-2, -5, -8, -13, 1, 4, 7, 12},
+        {-2, -4, -6, -13, 1, 3, 5, 12},
+        {-3, -6, -8, -12, 2, 5, 7, 11},
+        {-3, -7, -9, -11, 2, 6, 8, 10},
+        {-4, -7, -8, -11, 3, 6, 7, 10},
+        {-3, -5, -8, -11, 2, 4, 7, 10},
+        {-2, -6, -8, -10, 1, 5, 7, 9},
+        {-2, -5, -8, -10, 1, 4, 7, 9},
+        {-2, -4, -8, -10, 1, 3, 7, 9},
+        {-2, -5, -7, -10, 1, 4, 6, 9},
+        {-3, -4, -7, -10, 2, 3, 6, 9},
+        {-1, -2, -3, -10, 0, 1, 2, 9},
+        {-4, -6, -8, -9, 3, 5, 7, 8},
+        {-3, -5, -7, -9, 2, 4, 6, 8}};
+
+    int fitEACBlock(const uint8_t values[16], int base, int multiplier, int table, uint64_t& indices, int bestError)
+    {
+        int error = 0;
+        indices = 0;
+        for (int p = 0; p < 16 && error < bestError; ++p)
+        {
+            int best = 0;
+            int bestTexelError = std::numeric_limits<int>::max();
+            for (int s = 0; s < 8; ++s)
+            {
+                int e = square(values[p] - clamp255(base + s_eacModifiers[table][s] * multiplier));
+                if (e < bestTexelError)
+                {
+                    bestTexelError = e;
+                    best = s;
+                }
+            }
+            indices |= static_cast<uint64_t>(best) << (45 - 3 * p);
+            error += bestTexelError;
+        }
+        return error;
+    }
+
+    void encodeEACAlpha(const Block& block, uint8_t* dest, Quality quality)
+    {
+        // gather the alpha values in column major order
+        uint8_t values[16];
+        int minv = 255, maxv = 0;
+        for (int y = 0; y < 4; ++y)
+        {
+            for (int x = 0; x < 4; ++x)
+            {
+                int v = block[y * 4 + x][3];
+                values[etcPixelIndex(x, y)] = static_cast<uint8_t>(v);
+                minv = std::min(minv, v);
+                maxv = std::max(maxv, v);
+            }
+        }
+
+        int bestBase = (minv + maxv + 1) / 2, bestMultiplier = 1, bestTable = 13;
+        uint64_t bestIndices = 0;
+        int bestError = fitEACBlock(values, bestBase, bestMultiplier, bestTable, bestIndices, std::numeric_limits<int>::max());
+
+        int baseRange = (quality == BlockCompressionSettings::HIGHEST) ? 2 : 0;
+        int tableStep = (quality == BlockCompressionSettings::FASTEST) ? 4 : 1;
+        for (int table = 0; table < 16 && bestError > 0; table += tableStep)
+        {
+            int tableRange = s_eacModifiers[table][7] - s_eacModifiers[table][3];
+            int multiplier = std::clamp((maxv - minv + tableRange / 2) / tableRange, 1, 15);
+            int center = (minv + maxv + 1) / 2;
+            for (int m = std::max(1, multiplier - 1); m <= std::min(15, multiplier + 1); ++m)
+            {
+                for (int db = -baseRange; db <= baseRange; ++db)
+                {
+                    int base = clamp255(center + db);
+                    uint64_t indices = 0;
+                    int error = fitEACBlock(values, base, m, table, indices, bestError);
+                    if (error < bestError)
+                    {
+                        bestError = error;
+                        bestBase = base;
+                        bestMultiplier = m;
+                        bestTable = table;
+                        bestIndices = indices;
+                    }
+                }
+            }
+        }
+
+        uint64_t bits = (static_cast<uint64_t>(bestBase) << 56) | (static_cast<uint64_t>(bestMultiplier) << 52) | (static_cast<uint64_t>(bestTable) << 48) | bestIndices;
+        for (int i = 0; i < 8; ++i) dest[i] = static_cast<uint8_t>(bits >> (56 - 8 * i));
+    }
+
+    void encodeETC2RGB(const Block& block, uint8_t* dest, const EncodeParameters& parameters)
+    {
+        encodeETCColor(block, dest, parameters.quality);
+    }
+
+    void encodeETC2RGBA(const Block& block, uint8_t* dest, const EncodeParameters& parameters)
+    {
+        encodeEACAlpha(block, dest, parameters.quality);
+        encodeETCColor(block, dest + 8, parameters.quality);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    //
+    // source image access and block scheduling
+    //
+    struct SourceFormat
+    {
+        uint32_t numComponents = 0;
+        bool bgr = false;
+        bool srgb = false;
+    };
+
+    SourceFormat getSourceFormat(VkFormat format)
+    {
+        switch (format)
+        {
+        case (VK_FORMAT_R8_UNORM): return {1, false, false};
+        case (VK_FORMAT_R8_SRGB): return {1, false, true};
+        case (VK_FORMAT_R8G8_UNORM): return {2, false, false};
+        case (VK_FORMAT_R8G8_SRGB): return {2, false, true};
+        case (VK_FORMAT_R8G8B8_UNORM): return {3, false, false};
+        case (VK_FORMAT_R8G8B8_SRGB): return {3, false, true};
+        case (VK_FORMAT_B8G8R8_UNORM): return {3, true, false};
+        case (VK_FORMAT_B8G8R8_SRGB): return {3, true, true};
+        case (VK_FORMAT_R8G8B8A8_UNORM): return {4, false, false};
+        case (VK_FORMAT_R8G8B8A8_SRGB): return {4, false, true};
+        case (VK_FORMAT_B8G8R8A8_UNORM): return {4, true, false};
+        case (VK_FORMAT_B8G8R8A8_SRGB): return {4, true, true};
+        default: return {};
+        }
+    }
+
+    struct TargetFormat
+    {
+        EncodeFunction encode = nullptr;
+        uint32_t blockSize = 0;
+        bool punchThroughAlpha = false;
+    };
+
+    TargetFormat getTargetFormat(VkFormat format)
+    {
+        switch (format)
+        {
+        case (VK_FORMAT_BC1_RGB_UNORM_BLOCK):
+        case (VK_FORMAT_BC1_RGB_SRGB_BLOCK): return {encodeBC1, 8, false};
+        case (VK_FORMAT_BC1_RGBA_UNORM_BLOCK):
+        case (VK_FORMAT_BC1_RGBA_SRGB_BLOCK): return {encodeBC1, 8, true};
+        case (VK_FORMAT_BC3_UNORM_BLOCK):
+        case (VK_FORMAT_BC3_SRGB_BLOCK): return {encodeBC3, 16, false};
+        case (VK_FORMAT_BC4_UNORM_BLOCK): return {encodeBC4, 8, false};
+        case (VK_FORMAT_BC5_UNORM_BLOCK): return {encodeBC5, 16, false};
+        case (VK_FORMAT_BC7_UNORM_BLOCK):
+        case (VK_FORMAT_BC7_SRGB_BLOCK): return {encodeBC7, 16, false};
+        case (VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK):
+        case (VK_FORMAT_ETC2_R8G8B8_SRGB_BLOCK): return {encodeETC2RGB, 8, false};
+        case (VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK):
+        case (VK_FORMAT_ETC2_R8G8B8A8_SRGB_BLOCK): return {encodeETC2RGBA, 16, false};
+        default: return {};
+        }
+    }
+
+    struct MipmapLevel
+    {
+        const uint8_t* source = nullptr;
+        uint32_t width = 0, height = 0, depth = 0;
+        uint8_t* dest = nullptr;
+        uint32_t blocksWide = 0, blocksHigh = 0;
+    };
+
+    struct CompressContext
+    {
+        SourceFormat sourceFormat;
+        size_t sourceStride = 0;
+        TargetFormat targetFormat;
+        EncodeParameters parameters;
+    };
+
+    /// compress a range of block rows, rows are indexed across all the depth slices of the level.
+    void compressRows(const CompressContext& context, const MipmapLevel& level, uint32_t beginRow, uint32_t endRow)
+    {
+        const auto& sourceFormat = context.sourceFormat;
+        const size_t stride = context.sourceStride;
+        const uint32_t blockSize = context.targetFormat.blockSize;
+
+        Block block;
+        for (uint32_t row = beginRow; row < endRow; ++row)
+        {
+            uint32_t z = row / level.blocksHigh;
+            uint32_t by = row % level.blocksHigh;
+            const uint8_t* slice = level.source + static_cast<size_t>(z) * level.width * level.height * stride;
+            uint8_t* dest = level.dest + static_cast<size_t>(row) * level.blocksWide * blockSize;
+
+            for (uint32_t bx = 0; bx < level.blocksWide; ++bx)
+            {
+                // gather the 4x4 texels, replicating edge texels for partial blocks
+                for (uint32_t j = 0; j < 4; ++j)
+                {
+                    uint32_t y = std::min(by * 4 + j, level.height - 1);
+                    for (uint32_t i = 0; i < 4; ++i)
+                    {
+                        uint32_t x = std::min(bx * 4 + i, level.width - 1);
+                        const uint8_t* texel = slice + (static_cast<size_t>(y) * level.width + x) * stride;
+                        uint8_t* rgba = block[j * 4 + i];
+                        rgba[0] = texel[0];
+                        rgba[1] = (sourceFormat.numComponents > 1) ? texel[1] : 0;
+                        rgba[2] = (sourceFormat.numComponents > 2) ? texel[2] : 0;
+                        rgba[3] = (sourceFormat.numComponents > 3) ? texel[3] : 255;
+                        if (sourceFormat.bgr) std::swap(rgba[0], rgba[2]);
+                    }
+                }
+
+                context.targetFormat.encode(block, dest, context.parameters);
+                dest += blockSize;
+            }
+        }
+    }
+
+    template<typename T>
+    ref_ptr<Data> createBlockData(const Data& image, const Data::Properties& properties, uint32_t blocksWide, uint32_t blocksHigh, size_t valueCount)
+    {
+        auto blocks = new (vsg::allocate(sizeof(T) * valueCount, ALLOCATOR_AFFINITY_DATA)) T[valueCount];
+        if (image.dimensions() == 3)
+            return Array3D<T>::create(blocksWide, blocksHigh, image.depth(), blocks, properties);
+        else
+            return Array2D<T>::create(blocksWide, blocksHigh, blocks, properties);
+    }
+
+} // namespace
+
+bool vsg::supportsBlockCompression(VkFormat format)
+{
+    return getTargetFormat(format).encode != nullptr;
+}
+
+VkFormat vsg::selectBlockCompressedFormat(VkFormat sourceFormat, const BlockCompressionSettings& settings)
+{
+    auto source = getSourceFormat(sourceFormat);
+    switch (source.numComponents)
+    {
+    case (1):
+        if (settings.preferETC2) return source.srgb ? VK_FORMAT_ETC2_R8G8B8_SRGB_BLOCK : VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK;
+        return VK_FORMAT_BC4_UNORM_BLOCK;
+    case (2):
+        if (settings.preferETC2) return source.srgb ? VK_FORMAT_ETC2_R8G8B8_SRGB_BLOCK : VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK;
+        return VK_FORMAT_BC5_UNORM_BLOCK;
+    case (3):
+        if (settings.preferETC2) return source.srgb ? VK_FORMAT_ETC2_R8G8B8_SRGB_BLOCK : VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK;
+        return source.srgb ? VK_FORMAT_BC1_RGB_SRGB_BLOCK : VK_FORMAT_BC1_RGB_UNORM_BLOCK;
+    case (4):
+        if (settings.preferETC2) return source.srgb ? VK_FORMAT_ETC2_R8G8B8A8_SRGB_BLOCK : VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK;
+        if (settings.quality == BlockCompressionSettings::FASTEST) return source.srgb ? VK_FORMAT_BC3_SRGB_BLOCK : VK_FORMAT_BC3_UNORM_BLOCK;
+        return source.srgb ? VK_FORMAT_BC7_SRGB_BLOCK : VK_FORMAT_BC7_UNORM_BLOCK;
+    default:
+        return VK_FORMAT_UNDEFINED;
+    }
+}
+
+ref_ptr<Data> vsg::compressImage(ref_ptr<const Data> image, ref_ptr<const BlockCompressionSettings> settings)
+{
+    if (!image || !image->dataAvailable()) return {};
+    if (!settings) settings = BlockCompressionSettings::create();
+
+    // copy the properties as image may be replaced by its mipmapped version, releasing the original
+    const auto sourceProperties = image->properties;
+    if (sourceProperties.blockWidth > 1 || sourceProperties.blockHeight > 1 || sourceProperties.blockDepth > 1)
+    {
+        warn("vsg::compressImage(..) source image is already block compressed.");
+        return {};
+    }
+
+    if (image->dimensions() < 2)
+    {
+        warn("vsg::compressImage(..) only Array2D and Array3D source images are supported.");
+        return {};
+    }
+
+    if (settings->mipmapSettings && image->computeMipmapOffsets().size() <= 1)
+    {
+        if (auto mipmappedImage = generateMipmaps(image, settings->mipmapSettings)) image = mipmappedImage;
+    }
+
+    CompressContext context;
+    context.sourceFormat = getSourceFormat(sourceProperties.format);
+    context.sourceStride = image->stride();
+    if (context.sourceFormat.numComponents == 0 || context.sourceStride < context.sourceFormat.numComponents)
+    {
+        warn("vsg::compressImage(..) unsupported source format ", sourceProperties.format);
+        return {};
+    }
+
+    VkFormat format = settings->format;
+    if (format == VK_FORMAT_UNDEFINED) format = selectBlockCompressedFormat(sourceProperties.format, *settings);
+
+    context.targetFormat = getTargetFormat(format);
+    if (!context.targetFormat.encode)
+    {
+        warn("vsg::compressImage(..) unsupported block compressed format ", format);
+        return {};
+    }
+
+    context.parameters.quality = settings->quality;
+    context.parameters.punchThroughAlpha = context.targetFormat.punchThroughAlpha;
+    context.parameters.alphaThreshold = settings->alphaThreshold;
+
+    // Block compressed mipmaps are laid out by halving the block dimensions, so only retain the source mipmap levels
+    // whose texel dimensions round up to the same number of blocks.
+    uint32_t width = image->width();
+    uint32_t height = image->height();
+    uint32_t depth = image->depth();
+    uint32_t blocksWide = (width + 3) / 4;
+    uint32_t blocksHigh = (height + 3) / 4;
+
+    auto sourceOffsets = image->computeMipmapOffsets();
+    uint32_t maxLevels = std::max(static_cast<uint32_t>(sourceOffsets.size()), 1u);
+
+    std::vector<MipmapLevel> levels;
+    {
+        uint32_t w = width, h = height, d = depth;
+        uint32_t bw = blocksWide, bh = blocksHigh;
+        for (uint32_t level = 0; level < maxLevels; ++level)
+        {
+            if ((w + 3) / 4 != bw || (h + 3) / 4 != bh) break;
+
+            MipmapLevel mipmapLevel;
+            mipmapLevel.source = static_cast<const uint8_t*>(image->dataPointer(sourceOffsets.empty() ? 0 : sourceOffsets[level]));
+            mipmapLevel.width = w;
+            mipmapLevel.height = h;
+            mipmapLevel.depth = d;
+            mipmapLevel.blocksWide = bw;
+            mipmapLevel.blocksHigh = bh;
+            levels.push_back(mipmapLevel);
+
+            // block layout terminates once a single block remains
+            if (bw == 1 && bh == 1 && d == 1) break;
+
+            if (w > 1) w /= 2;
+            if (h > 1) h /= 2;
+            if (d > 1) d /= 2;
+            if (bw > 1) bw /= 2;
+            if (bh > 1) bh /= 2;
+        }
+    }
+
+    Data::Properties properties(format);
+    properties.stride = context.targetFormat.blockSize;
+    properties.blockWidth = 4;
+    properties.blockHeight = 4;
+    properties.blockDepth = 1;
+    properties.maxNumMipmaps = static_cast<uint8_t>(levels.size() > 1 ? levels.size() : 0);
+    properties.origin = sourceProperties.origin;
+    properties.imageViewType = sourceProperties.imageViewType;
+    properties.dataVariance = sourceProperties.dataVariance;
+
+    size_t valueCount = Data::computeValueCountIncludingMipmaps(blocksWide, blocksHigh, depth, properties.maxNumMipmaps);
+
+    ref_ptr<Data> compressed;
+    if (context.targetFormat.blockSize == 8)
+        compressed = createBlockData<block64>(*image, properties, blocksWide, blocksHigh, valueCount);
+    else
+        compressed = createBlockData<block128>(*image, properties, blocksWide, blocksHigh, valueCount);
+
+    auto destOffsets = compressed->computeMipmapOffsets();
+    for (size_t level = 0; level < levels.size(); ++level)
+    {
+        levels[level].dest = static_cast<uint8_t*>(compressed->dataPointer(destOffsets.empty() ? 0 : destOffsets[level]));
+    }
+
+    // split the work into batches of block rows.
+    struct RowRange
+    {
+        const MipmapLevel* level;
+        uint32_t beginRow;
+        uint32_t endRow;
+    };
+    std::vector<RowRange> ranges;
+    const uint32_t rowsPerRange = 16;
+    for (auto& level : levels)
+    {
+        uint32_t numRows = level.blocksHigh * level.depth;
+        for (uint32_t row = 0; row < numRows; row += rowsPerRange)
+        {
+            ranges.push_back(RowRange{&level, row, std::min(row + rowsPerRange, numRows)});
+        }
+    }
+
+    if (settings->operationThreads && ranges.size() > 1)
+    {
+        struct CompressOperation : public Operation
+        {
+            CompressOperation(const CompressContext& in_context, const RowRange& in_range, ref_ptr<Latch> in_latch) :
+                context(in_context),
+                range(in_range),
+                latch(in_latch) {}
+
+            void run() override
+            {
+                compressRows(context, *range.level, range.beginRow, range.endRow);
+                latch->count_down();
+            }
+
+            const CompressContext& context;
+            RowRange range;
+            ref_ptr<Latch> latch;
+        };
+
+        // use latch to synchronize this thread with the compression threads
+        auto latch = Latch::create(ranges.size());
+
+        for (auto& range : ranges)
+        {
+            settings->operationThreads->add(ref_ptr<Operation>(new CompressOperation(context, range, latch)));
+        }
+
+        // use this thread to compress blocks as well
+        settings->operationThreads->run();
+
+        // wait till all the compress operations have completed
+        latch->wait();
+    }
+    else
+    {
+        for (auto& range : ranges)
+        {
+            compressRows(context, *range.level, range.beginRow, range.endRow);
+        }
+    }
+
+    compressed->dirty();
+
+    return compressed;
+}
@@ -28,10 +28,182 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/nodes/VertexIndexDraw.h>
 #include <vsg/text/Text.h>
 #include <vsg/text/TextGroup.h>
+#include <vsg/threading/Latch.h>
 #include <vsg/utils/ComputeBounds.h>
 
 using namespace vsg;
 
+namespace
+{
+    // min/max reduction over contiguous vertices, 4 vertices are processed per iteration as 12 independent lanes so that the compiler can vectorize the loop.
+    template<typename T>
+    dbox reduceBounds(const t_vec3<T>* vertices, size_t count)
+    {
+        T lower[12], upper[12];
+        for (size_t j = 0; j < 12; ++j)
+        {
+            lower[j] = std::numeric_limits<T>::max();
+            upper[j] = std::numeric_limits<T>::lowest();
+        }
+
+        const T* ptr = vertices->data();
+        size_t i = 0;
+        for (; i + 4 <= count; i += 4, ptr += 12)
+        {
+            for (size_t j = 0; j < 12; ++j)
+            {
+                lower[j] = ptr[j] < lower[j] ? ptr[j] : lower[j];
+                upper[j] = ptr[j] > upper[j] ? ptr[j] : upper[j];
+            }
+        }
+        for (; i < count; ++i, ptr += 3)
+        {
+            for (size_t j = 0; j < 3; ++j)
+            {
+                lower[j] = ptr[j] < lower[j] ? ptr[j] : lower[j];
+                upper[j] = ptr[j] > upper[j] ? ptr[j] : upper[j];
+            }
+        }
+
+        for (size_t j = 3; j < 12; ++j)
+        {
+            lower[j % 3] = std::min(lower[j % 3], lower[j]);
+            upper[j % 3] = std::max(upper[j % 3], upper[j]);
+        }
+
+        dbox bb;
+        if (lower[0] <= upper[0] && lower[1] <= upper[1] && lower[2] <= upper[2])
+        {
+            bb.add(dvec3(lower[0], lower[1], lower[2]));
+            bb.add(dvec3(upper[0], upper[1], upper[2]));
+        }
+        return bb;
+    }
+
+    // compute the bounds of the vertices returned by vertex(i) for i in [0, count), transformed by matrix when assigned.
+    template<class VertexFunction>
+    dbox transformedBounds(uint32_t count, const dmat4* matrix, VertexFunction vertex)
+    {
+        dbox bb;
+        if (!matrix)
+        {
+            for (uint32_t i = 0; i < count; ++i) bb.add(dvec3(vertex(i)));
+        }
+        else if ((*matrix)[0][3] == 0.0 && (*matrix)[1][3] == 0.0 && (*matrix)[2][3] == 0.0 && (*matrix)[3][3] == 1.0)
+        {
+            // affine transform so no need for the divide by w
+            const auto& m = *matrix;
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                dvec3 v(vertex(i));
+                bb.add(m[0][0] * v.x + m[1][0] * v.y + m[2][0] * v.z + m[3][0],
+                       m[0][1] * v.x + m[1][1] * v.y + m[2][1] * v.z + m[3][1],
+                       m[0][2] * v.x + m[1][2] * v.y + m[2][2] * v.z + m[3][2]);
+            }
+        }
+        else
+        {
+            for (uint32_t i = 0; i < count; ++i) bb.add((*matrix) * dvec3(vertex(i)));
+        }
+        return bb;
+    }
+
+    template<class A>
+    dbox arrayBounds(const A& vertices, uint32_t first, uint32_t count, const dmat4* matrix)
+    {
+        if (!matrix && vertices.stride() == sizeof(typename A::value_type)) return reduceBounds(vertices.data() + first, count);
+        return transformedBounds(count, matrix, [&](uint32_t i) -> const typename A::value_type& { return *vertices.data(first + i); });
+    }
+
+    template<class A, class I>
+    dbox indexedBounds(const A& vertices, const I& indices, uint32_t first, uint32_t count, const dmat4* matrix)
+    {
+        return transformedBounds(count, matrix, [&](uint32_t i) -> const typename A::value_type& { return *vertices.data(indices.at(first + i)); });
+    }
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// BoundsCache
+//
+BoundsCache::BoundsCache()
+{
+}
+
+BoundsCache::~BoundsCache()
+{
+}
+
+bool BoundsCache::get(const Key& key, dbox& bounds) const
+{
+    std::scoped_lock<std::mutex> lock(_mutex);
+
+    auto itr = _entries.find(key);
+    if (itr == _entries.end() ||
+        key.vertices->differentModifiedCount(itr->second.verticesModifiedCount) ||
+        (key.indices && key.indices->differentModifiedCount(itr->second.indicesModifiedCount)))
+    {
+        ++misses;
+        return false;
+    }
+
+    ++hits;
+    bounds = itr->second.bounds;
+    return true;
+}
+
+void BoundsCache::set(const Key& key, const dbox& bounds)
+{
+    std::scoped_lock<std::mutex> lock(_mutex);
+
+    auto& entry = _entries[key];
+    entry.vertices = key.vertices;
+    entry.indices = key.indices;
+    key.vertices->getModifiedCount(entry.verticesModifiedCount);
+    if (key.indices) key.indices->getModifiedCount(entry.indicesModifiedCount);
+    entry.bounds = bounds;
+}
+
+void BoundsCache::prune()
+{
+    std::scoped_lock<std::mutex> lock(_mutex);
+
+    for (auto itr = _entries.begin(); itr != _entries.end();)
+    {
+        auto& entry = itr->second;
+        if (entry.vertices->referenceCount() == 1 || (entry.indices && entry.indices->referenceCount() == 1))
+            itr = _entries.erase(itr);
+        else
+            ++itr;
+    }
+}
+
+void BoundsCache::clear()
+{
+    std::scoped_lock<std::mutex> lock(_mutex);
+    _entries.clear();
+}
+
+size_t BoundsCache::size() const
+{
+    std::scoped_lock<std::mutex> lock(_mutex);
+    return _entries.size();
+}
+
+dbox vsg::computeBounds(const vec3Array& vertices)
+{
+    return arrayBounds(vertices, 0, static_cast<uint32_t>(vertices.size()), nullptr);
+}
+
+dbox vsg::computeBounds(const dvec3Array& vertices)
+{
+    return arrayBounds(vertices, 0, static_cast<uint32_t>(vertices.size()), nullptr);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// ComputeBounds
+//
 ComputeBounds::ComputeBounds(ref_ptr<ArrayState> intialArrayState)
 {
     arrayStateStack.reserve(4);
@@ -43,6 +215,71 @@ void ComputeBounds::apply(const vsg::Object& object)
     object.traverse(*this);
 }
 
+void ComputeBounds::apply(const Group& group)
+{
+    auto numChildren = static_cast<uint32_t>(group.children.size());
+    if (!operationThreads || numChildren < std::max(minimumParallelChildren, 2u))
+    {
+        group.traverse(*this);
+        return;
+    }
+
+    struct TraverseChildren : public Inherit<Operation, TraverseChildren>
+    {
+        TraverseChildren(const Group& in_group, uint32_t in_begin, uint32_t in_end, ref_ptr<ComputeBounds> in_computeBounds, ref_ptr<Latch> in_latch) :
+            group(in_group),
+            begin(in_begin),
+            end(in_end),
+            computeBounds(in_computeBounds),
+            latch(in_latch) {}
+
+        void run() override
+        {
+            for (uint32_t i = begin; i < end; ++i) group.children[i]->accept(*computeBounds);
+            latch->count_down();
+        }
+
+        const Group& group;
+        uint32_t begin;
+        uint32_t end;
+        ref_ptr<ComputeBounds> computeBounds;
+        ref_ptr<Latch> latch;
+    };
+
+    // split the children into several batches per thread so that uneven subgraphs are balanced across the threads
+    uint32_t numBatches = std::min(numChildren, static_cast<uint32_t>(operationThreads->threads.size() + 1) * 4);
+    uint32_t batchSize = (numChildren + numBatches - 1) / numBatches;
+    numBatches = (numChildren + batchSize - 1) / batchSize;
+
+    std::vector<ref_ptr<ComputeBounds>> batchComputeBounds;
+    auto latch = Latch::create(static_cast<int>(numBatches));
+    for (uint32_t begin = 0; begin < numChildren; begin += batchSize)
+    {
+        // each batch has its own copy of the traversal state, and doesn't traverse in parallel itself
+        auto computeBounds = ComputeBounds::create(arrayStateStack.back()->cloneArrayState());
+        computeBounds->traversalMask = traversalMask;
+        computeBounds->overrideMask = overrideMask;
+        computeBounds->useNodeBounds = useNodeBounds;
+        computeBounds->matrixStack = matrixStack;
+        computeBounds->ushort_indices = ushort_indices;
+        computeBounds->uint_indices = uint_indices;
+        computeBounds->boundsCache = boundsCache;
+        batchComputeBounds.push_back(computeBounds);
+
+        operationThreads->add(TraverseChildren::create(group, begin, std::min(begin + batchSize, numChildren), computeBounds, latch));
+    }
+
+    // use this thread to traverse batches as well
+    operationThreads->run();
+
+    latch->wait();
+
+    for (auto& computeBounds : batchComputeBounds)
+    {
+        bounds.add(computeBounds->bounds);
+    }
+}
+
 void ComputeBounds::apply(const StateGroup& stategroup)
 {
     auto arrayState = stategroup.prototypeArrayState ? stategroup.prototypeArrayState->cloneArrayState(arrayStateStack.back()) : arrayStateStack.back()->cloneArrayState();
@@ -192,54 +429,73 @@ void ComputeBounds::applyDraw(uint32_t firstVertex, uint32_t vertexCount, uint32
 {
     auto& arrayState = *arrayStateStack.back();
     uint32_t lastIndex = instanceCount > 1 ? (firstInstance + instanceCount) : firstInstance + 1;
-    uint32_t endVertex = firstVertex + vertexCount;
-    dmat4 matrix;
-    if (!matrixStack.empty()) matrix = matrixStack.back();
+    const dmat4* matrix = matrixStack.empty() ? nullptr : &matrixStack.back();
 
     for (uint32_t instanceIndex = firstInstance; instanceIndex < lastIndex; ++instanceIndex)
     {
         if (auto vertices = arrayState.vertexArray(instanceIndex))
         {
-            for (uint32_t i = firstVertex; i < endVertex; ++i)
+            if (vertexCount == 0 || (firstVertex + vertexCount) > vertices->size()) continue;
+
+            // per instance vertices are generated by the ArrayState for each call so can't be cached
+            bool cacheable = boundsCache && vertices == arrayState.vertices;
+
+            BoundsCache::Key key;
+            dbox bb;
+            if (cacheable)
             {
-                bounds.add(matrix * dvec3(vertices->at(i)));
+                key = BoundsCache::Key{vertices.get(), nullptr, firstVertex, vertexCount, matrix ? *matrix : dmat4()};
+                if (boundsCache->get(key, bb))
+                {
+                    bounds.add(bb);
+                    continue;
+                }
             }
+
+            bb = arrayBounds(*vertices, firstVertex, vertexCount, matrix);
+            if (cacheable) boundsCache->set(key, bb);
+
+            bounds.add(bb);
         }
     }
 }
 
 void ComputeBounds::applyDrawIndexed(uint32_t firstIndex, uint32_t indexCount, uint32_t firstInstance, uint32_t instanceCount)
 {
+    const Data* indices = ushort_indices ? static_cast<const Data*>(ushort_indices.get()) : static_cast<const Data*>(uint_indices.get());
+    if (!indices || indexCount == 0) return;
+
     auto& arrayState = *arrayStateStack.back();
     uint32_t lastIndex = instanceCount > 1 ? (firstInstance + instanceCount) : firstInstance + 1;
-    uint32_t endIndex = firstIndex + indexCount;
-    dmat4 matrix;
-    if (!matrixStack.empty()) matrix = matrixStack.back();
+    const dmat4* matrix = matrixStack.empty() ? nullptr : &matrixStack.back();
 
-    if (ushort_indices)
-    {
-        for (uint32_t instanceIndex = firstInstance; instanceIndex < lastIndex; ++instanceIndex)
-        {
-            if (auto vertices = arrayState.vertexArray(instanceIndex))
-            {
-                for (uint32_t i = firstIndex; i < endIndex; ++i)
-                {
-                    bounds.add(matrix * dvec3(vertices->at(ushort_indices->at(i))));
-                }
-            }
-        }
-    }
-    else if (uint_indices)
+    for (uint32_t instanceIndex = firstInstance; instanceIndex < lastIndex; ++instanceIndex)
     {
-        for (uint32_t instanceIndex = firstInstance; instanceIndex < lastIndex; ++instanceIndex)
+        if (auto vertices = arrayState.vertexArray(instanceIndex))
         {
-            if (auto vertices = arrayState.vertexArray(instanceIndex))
+            // per instance vertices are generated by the ArrayState for each call so can't be cached
+            bool cacheable = boundsCache && vertices == arrayState.vertices;
+
+            BoundsCache::Key key;
+            dbox bb;
+            if (cacheable)
             {
-                for (uint32_t i = firstIndex; i < endIndex; ++i)
+                key = BoundsCache::Key{vertices.get(), indices, firstIndex, indexCount, matrix ? *matrix : dmat4()};
+                if (boundsCache->get(key, bb))
                 {
-                    bounds.add(matrix * dvec3(vertices->at(uint_indices->at(i))));
+                    bounds.add(bb);
+                    continue;
                 }
             }
+
+            if (ushort_indices)
+                bb = indexedBounds(*vertices, *ushort_indices, firstIndex, indexCount, matrix);
+            else
+                bb = indexedBounds(*vertices, *uint_indices, firstIndex, indexCount, matrix);
+
+            if (cacheable) boundsCache->set(key, bb);
+
+            bounds.add(bb);
         }
     }
 }
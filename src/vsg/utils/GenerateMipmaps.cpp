@@ -0,0 +1,514 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2025 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/core/Array2D.h>
+#include <vsg/core/Array3D.h>
+#include <vsg/io/Logger.h>
+#include <vsg/threading/OperationThreads.h>
+#include <vsg/utils/GenerateMipmaps.h>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+
+using namespace vsg;
+
+namespace
+{
+    enum ComponentType
+    {
+        UNORM8,
+        UNORM16,
+        SFLOAT32
+    };
+
+    struct SourceFormat
+    {
+        ComponentType type = UNORM8;
+        uint32_t numComponents = 0;
+        bool srgb = false;
+    };
+
+    SourceFormat getSourceFormat(VkFormat format)
+    {
+        switch (format)
+        {
+        case (VK_FORMAT_R8_UNORM): return {UNORM8, 1, false};
+        case (VK_FORMAT_R8_SRGB): return {UNORM8, 1, true};
+        case (VK_FORMAT_R8G8_UNORM): return {UNORM8, 2, false};
+        case (VK_FORMAT_R8G8_SRGB): return {UNORM8, 2, true};
+        case (VK_FORMAT_R8G8B8_UNORM):
+        case (VK_FORMAT_B8G8R8_UNORM): return {UNORM8, 3, false};
+        case (VK_FORMAT_R8G8B8_SRGB):
+        case (VK_FORMAT_B8G8R8_SRGB): return {UNORM8, 3, true};
+        case (VK_FORMAT_R8G8B8A8_UNORM):
+        case (VK_FORMAT_B8G8R8A8_UNORM): return {UNORM8, 4, false};
+        case (VK_FORMAT_R8G8B8A8_SRGB):
+        case (VK_FORMAT_B8G8R8A8_SRGB): return {UNORM8, 4, true};
+        case (VK_FORMAT_R16_UNORM): return {UNORM16, 1, false};
+        case (VK_FORMAT_R16G16_UNORM): return {UNORM16, 2, false};
+        case (VK_FORMAT_R16G16B16_UNORM): return {UNORM16, 3, false};
+        case (VK_FORMAT_R16G16B16A16_UNORM): return {UNORM16, 4, false};
+        case (VK_FORMAT_R32_SFLOAT): return {SFLOAT32, 1, false};
+        case (VK_FORMAT_R32G32_SFLOAT): return {SFLOAT32, 2, false};
+        case (VK_FORMAT_R32G32B32_SFLOAT): return {SFLOAT32, 3, false};
+        case (VK_FORMAT_R32G32B32A32_SFLOAT): return {SFLOAT32, 4, false};
+        default: return {};
+        }
+    }
+
+    /// mipmap level held as linear floating point RGBA values
+    struct Level
+    {
+        uint32_t width = 0, height = 0, depth = 0;
+        std::vector<vec4> texels;
+
+        Level() = default;
+        Level(uint32_t w, uint32_t h, uint32_t d) :
+            width(w), height(h), depth(d), texels(static_cast<size_t>(w) * h * d) {}
+
+        size_t index(uint32_t x, uint32_t y, uint32_t z) const { return (static_cast<size_t>(z) * height + y) * width + x; }
+    };
+
+    struct Tap
+    {
+        uint32_t index;
+        float weight;
+    };
+    using Taps = std::vector<std::vector<Tap>>;
+
+    double besselI0(double x)
+    {
+        double sum = 1.0, term = 1.0;
+        for (int k = 1; k < 32; ++k)
+        {
+            double f = x / (2.0 * k);
+            term *= f * f;
+            sum += term;
+            if (term < sum * 1e-12) break;
+        }
+        return sum;
+    }
+
+    /// compute the source texels and weights contributing to each destination texel along one axis.
+    Taps computeTaps(MipmapSettings::Filter filter, uint32_t sourceSize, uint32_t destSize)
+    {
+        Taps taps(destSize);
+        double ratio = static_cast<double>(sourceSize) / static_cast<double>(destSize);
+
+        for (uint32_t i = 0; i < destSize; ++i)
+        {
+            auto& destTaps = taps[i];
+            if (filter == MipmapSettings::BOX)
+            {
+                // weight source texels by their overlap with the destination texel's footprint
+                double begin = i * ratio;
+                double end = (i + 1) * ratio;
+                for (auto j = static_cast<uint32_t>(begin); j < sourceSize && j < end; ++j)
+                {
+                    double overlap = std::min(end, j + 1.0) - std::max(begin, static_cast<double>(j));
+                    if (overlap > 0.0) destTaps.push_back(Tap{j, static_cast<float>(overlap / ratio)});
+                }
+            }
+            else
+            {
+                // Kaiser windowed sinc evaluated in destination texel units
+                const double radius = 3.0;
+                const double alpha = 4.0;
+                const double i0Alpha = besselI0(alpha);
+                const double pi = 3.14159265358979323846;
+
+                double center = (i + 0.5) * ratio;
+                auto first = static_cast<int>(std::floor(center - radius * ratio));
+                auto last = static_cast<int>(std::ceil(center + radius * ratio));
+                double totalWeight = 0.0;
+                std::vector<double> weights;
+                std::vector<uint32_t> indices;
+                for (int j = first; j <= last; ++j)
+                {
+                    double t = ((j + 0.5) - center) / ratio;
+                    if (std::abs(t) >= radius) continue;
+
+                    double sinc = (t == 0.0) ? 1.0 : std::sin(pi * t) / (pi * t);
+                    double window = besselI0(alpha * std::sqrt(1.0 - (t / radius) * (t / radius))) / i0Alpha;
+                    double weight = sinc * window;
+
+                    indices.push_back(static_cast<uint32_t>(std::clamp(j, 0, static_cast<int>(sourceSize) - 1)));
+                    weights.push_back(weight);
+                    totalWeight += weight;
+                }
+                for (size_t k = 0; k < indices.size(); ++k)
+                {
+                    destTaps.push_back(Tap{indices[k], static_cast<float>(weights[k] / totalWeight)});
+                }
+            }
+        }
+        return taps;
+    }
+
+    using RangeFunction = std::function<void(uint32_t, uint32_t)>;
+
+    /// run the function over the range [0, count) in batches, using the operationThreads when available.
+    void parallelFor(OperationThreads* operationThreads, uint32_t count, uint32_t batchSize, const RangeFunction& function)
+    {
+        if (!operationThreads || count <= batchSize)
+        {
+            function(0, count);
+            return;
+        }
+
+        struct RangeOperation : public Operation
+        {
+            RangeOperation(const RangeFunction& in_function, uint32_t in_begin, uint32_t in_end, ref_ptr<Latch> in_latch) :
+                function(in_function),
+                begin(in_begin),
+                end(in_end),
+                latch(in_latch) {}
+
+            void run() override
+            {
+                function(begin, end);
+                latch->count_down();
+            }
+
+            const RangeFunction& function;
+            uint32_t begin;
+            uint32_t end;
+            ref_ptr<Latch> latch;
+        };
+
+        // use latch to synchronize this thread with the filtering threads
+        auto latch = Latch::create(static_cast<int>((count + batchSize - 1) / batchSize));
+        for (uint32_t begin = 0; begin < count; begin += batchSize)
+        {
+            operationThreads->add(ref_ptr<Operation>(new RangeOperation(function, begin, std::min(begin + batchSize, count), latch)));
+        }
+
+        // use this thread to filter rows as well
+        operationThreads->run();
+
+        // wait till all the filter operations have completed
+        latch->wait();
+    }
+
+    /// filter the source level along the specified axis (0 = x, 1 = y, 2 = z) to produce the destination level.
+    void filterAxis(const Level& source, Level& dest, uint32_t axis, const Taps& taps, OperationThreads* operationThreads)
+    {
+        // lines run along the filtered axis, one line for each combination of the other two axes.
+        uint32_t numLines = (axis == 0) ? dest.height * dest.depth : ((axis == 1) ? dest.width * dest.depth : dest.width * dest.height);
+
+        auto filterLines = [&](uint32_t beginLine, uint32_t endLine) {
+            for (uint32_t line = beginLine; line < endLine; ++line)
+            {
+                for (uint32_t i = 0; i < taps.size(); ++i)
+                {
+                    vec4 sum(0.0f, 0.0f, 0.0f, 0.0f);
+                    size_t destIndex = 0;
+                    if (axis == 0)
+                    {
+                        uint32_t y = line % dest.height, z = line / dest.height;
+                        for (auto& tap : taps[i]) sum += source.texels[source.index(tap.index, y, z)] * tap.weight;
+                        destIndex = dest.index(i, y, z);
+                    }
+                    else if (axis == 1)
+                    {
+                        uint32_t x = line % dest.width, z = line / dest.width;
+                        for (auto& tap : taps[i]) sum += source.texels[source.index(x, tap.index, z)] * tap.weight;
+                        destIndex = dest.index(x, i, z);
+                    }
+                    else
+                    {
+                        uint32_t x = line % dest.width, y = line / dest.width;
+                        for (auto& tap : taps[i]) sum += source.texels[source.index(x, y, tap.index)] * tap.weight;
+                        destIndex = dest.index(x, y, i);
+                    }
+                    dest.texels[destIndex] = sum;
+                }
+            }
+        };
+
+        parallelFor(operationThreads, numLines, 64, filterLines);
+    }
+
+    Level downsample(const Level& source, uint32_t width, uint32_t height, uint32_t depth, MipmapSettings::Filter filter, OperationThreads* operationThreads)
+    {
+        Level current = source;
+        const uint32_t destSizes[3] = {width, height, depth};
+        for (uint32_t axis = 0; axis < 3; ++axis)
+        {
+            const uint32_t sourceSizes[3] = {current.width, current.height, current.depth};
+            if (sourceSizes[axis] == destSizes[axis]) continue;
+
+            Level next(axis == 0 ? width : current.width, axis == 1 ? height : current.height, axis == 2 ? depth : current.depth);
+            filterAxis(current, next, axis, computeTaps(filter, sourceSizes[axis], destSizes[axis]), operationThreads);
+            current = std::move(next);
+        }
+        return current;
+    }
+
+    inline float srgbToLinear(float c)
+    {
+        return (c <= 0.04045f) ? (c / 12.92f) : std::pow((c + 0.055f) / 1.055f, 2.4f);
+    }
+
+    inline float linearToSRGB(float c)
+    {
+        return (c <= 0.0031308f) ? (c * 12.92f) : (1.055f * std::pow(c, 1.0f / 2.4f) - 0.055f);
+    }
+
+    struct Codec
+    {
+        SourceFormat format;
+        float srgbTable[256];
+
+        explicit Codec(const SourceFormat& in_format) :
+            format(in_format)
+        {
+            for (int i = 0; i < 256; ++i) srgbTable[i] = srgbToLinear(static_cast<float>(i) / 255.0f);
+        }
+
+        /// components affected by sRGB encoding, alpha is always stored linearly.
+        bool srgbComponent(uint32_t c) const { return format.srgb && c < 3; }
+
+        vec4 decode(const uint8_t* texel) const
+        {
+            vec4 value(0.0f, 0.0f, 0.0f, 1.0f);
+            for (uint32_t c = 0; c < format.numComponents; ++c)
+            {
+                switch (format.type)
+                {
+                case (UNORM8): value[c] = srgbComponent(c) ? srgbTable[texel[c]] : static_cast<float>(texel[c]) / 255.0f; break;
+                case (UNORM16): value[c] = static_cast<float>(reinterpret_cast<const uint16_t*>(texel)[c]) / 65535.0f; break;
+                case (SFLOAT32): value[c] = reinterpret_cast<const float*>(texel)[c]; break;
+                }
+            }
+            return value;
+        }
+
+        void encode(const vec4& value, uint8_t* texel) const
+        {
+            for (uint32_t c = 0; c < format.numComponents; ++c)
+            {
+                float v = value[c];
+                switch (format.type)
+                {
+                case (UNORM8):
+                    v = std::clamp(v, 0.0f, 1.0f);
+                    if (srgbComponent(c)) v = linearToSRGB(v);
+                    texel[c] = static_cast<uint8_t>(std::lround(v * 255.0f));
+                    break;
+                case (UNORM16):
+                    reinterpret_cast<uint16_t*>(texel)[c] = static_cast<uint16_t>(std::lround(std::clamp(v, 0.0f, 1.0f) * 65535.0f));
+                    break;
+                case (SFLOAT32):
+                    reinterpret_cast<float*>(texel)[c] = v;
+                    break;
+                }
+            }
+        }
+
+        size_t valueSize() const
+        {
+            switch (format.type)
+            {
+            case (UNORM8): return format.numComponents;
+            case (UNORM16): return 2 * format.numComponents;
+            default: return 4 * format.numComponents;
+            }
+        }
+    };
+
+    float computeAlphaCoverage(const Level& level, float reference, float scale)
+    {
+        size_t numPassed = 0;
+        for (auto& texel : level.texels)
+        {
+            if (std::min(texel.a * scale, 1.0f) > reference) ++numPassed;
+        }
+        return static_cast<float>(numPassed) / static_cast<float>(level.texels.size());
+    }
+
+    /// find the alpha scale that brings the level's coverage closest to the target coverage.
+    float computeAlphaScale(const Level& level, float reference, float targetCoverage)
+    {
+        float minScale = 0.0f, maxScale = 4.0f;
+        float scale = 1.0f;
+        float bestScale = 1.0f;
+        float bestDelta = std::numeric_limits<float>::max();
+        for (int i = 0; i < 10; ++i)
+        {
+            float coverage = computeAlphaCoverage(level, reference, scale);
+            float delta = std::abs(coverage - targetCoverage);
+            if (delta < bestDelta)
+            {
+                bestDelta = delta;
+                bestScale = scale;
+            }
+
+            if (coverage < targetCoverage)
+                minScale = scale;
+            else if (coverage > targetCoverage)
+                maxScale = scale;
+            else
+                break;
+            scale = (minScale + maxScale) * 0.5f;
+        }
+        return bestScale;
+    }
+
+    template<typename T>
+    ref_ptr<Data> createImage(const Data& image, const Data::Properties& properties, size_t valueCount)
+    {
+        auto values = new (vsg::allocate(sizeof(T) * valueCount, ALLOCATOR_AFFINITY_DATA)) T[valueCount];
+        if (image.dimensions() == 3)
+            return Array3D<T>::create(image.width(), image.height(), image.depth(), values, properties);
+        else
+            return Array2D<T>::create(image.width(), image.height(), values, properties);
+    }
+
+    ref_ptr<Data> createImage(const Data& image, const SourceFormat& format, const Data::Properties& properties, size_t valueCount)
+    {
+        switch (format.type)
+        {
+        case (UNORM8):
+            switch (format.numComponents)
+            {
+            case (1): return createImage<uint8_t>(image, properties, valueCount);
+            case (2): return createImage<ubvec2>(image, properties, valueCount);
+            case (3): return createImage<ubvec3>(image, properties, valueCount);
+            default: return createImage<ubvec4>(image, properties, valueCount);
+            }
+        case (UNORM16):
+            switch (format.numComponents)
+            {
+            case (1): return createImage<uint16_t>(image, properties, valueCount);
+            case (2): return createImage<usvec2>(image, properties, valueCount);
+            case (3): return createImage<usvec3>(image, properties, valueCount);
+            default: return createImage<usvec4>(image, properties, valueCount);
+            }
+        default:
+            switch (format.numComponents)
+            {
+            case (1): return createImage<float>(image, properties, valueCount);
+            case (2): return createImage<vec2>(image, properties, valueCount);
+            case (3): return createImage<vec3>(image, properties, valueCount);
+            default: return createImage<vec4>(image, properties, valueCount);
+            }
+        }
+    }
+
+} // namespace
+
+ref_ptr<Data> vsg::generateMipmaps(ref_ptr<const Data> image, ref_ptr<const MipmapSettings> settings)
+{
+    if (!image || !image->dataAvailable()) return {};
+    if (!settings) settings = MipmapSettings::create();
+
+    const auto& sourceProperties = image->properties;
+    if (sourceProperties.blockWidth > 1 || sourceProperties.blockHeight > 1 || sourceProperties.blockDepth > 1)
+    {
+        warn("vsg::generateMipmaps(..) block compressed images are not supported.");
+        return {};
+    }
+
+    bool volume = image->dimensions() == 3 && (sourceProperties.imageViewType < 0 || sourceProperties.imageViewType == VK_IMAGE_VIEW_TYPE_3D);
+    if (image->dimensions() != 2 && !volume)
+    {
+        warn("vsg::generateMipmaps(..) only Array2D and 3D volume Array3D images are supported.");
+        return {};
+    }
+
+    auto format = getSourceFormat(sourceProperties.format);
+    if (format.numComponents == 0)
+    {
+        warn("vsg::generateMipmaps(..) unsupported format ", sourceProperties.format);
+        return {};
+    }
+
+    Codec codec(format);
+    const size_t sourceStride = image->stride();
+    if (sourceStride < codec.valueSize())
+    {
+        warn("vsg::generateMipmaps(..) stride too small for format ", sourceProperties.format);
+        return {};
+    }
+
+    // compute the number of levels using the same rules as Data::computeMipmapOffsets()
+    uint32_t numLevels = 1;
+    {
+        uint32_t w = image->width(), h = image->height(), d = image->depth();
+        while (w > 1 || h > 1 || d > 1)
+        {
+            if (w > 1) w /= 2;
+            if (h > 1) h /= 2;
+            if (d > 1) d /= 2;
+            ++numLevels;
+        }
+    }
+    if (settings->maxNumMipmaps > 0) numLevels = std::min(numLevels, settings->maxNumMipmaps);
+    numLevels = std::min(numLevels, 255u);
+
+    auto properties = sourceProperties;
+    properties.stride = static_cast<uint32_t>(codec.valueSize());
+    properties.maxNumMipmaps = static_cast<uint8_t>(numLevels);
+    properties.allocatorType = ALLOCATOR_TYPE_VSG_ALLOCATOR;
+
+    size_t valueCount = Data::computeValueCountIncludingMipmaps(image->width(), image->height(), image->depth(), numLevels);
+    auto mipmappedImage = createImage(*image, format, properties, valueCount);
+    auto offsets = mipmappedImage->computeMipmapOffsets();
+
+    OperationThreads* operationThreads = settings->operationThreads.get();
+
+    // decode the base level
+    Level level(image->width(), image->height(), image->depth());
+    {
+        auto source = static_cast<const uint8_t*>(image->dataPointer());
+        auto dest = static_cast<uint8_t*>(mipmappedImage->dataPointer());
+        parallelFor(operationThreads, static_cast<uint32_t>(level.texels.size()), 16384, [&](uint32_t begin, uint32_t end) {
+            for (uint32_t i = begin; i < end; ++i)
+            {
+                level.texels[i] = codec.decode(source + static_cast<size_t>(i) * sourceStride);
+                codec.encode(level.texels[i], dest + static_cast<size_t>(i) * properties.stride);
+            }
+        });
+    }
+
+    bool preserveAlphaCoverage = settings->alphaCoverageReference >= 0.0f && format.numComponents == 4;
+    float targetCoverage = preserveAlphaCoverage ? computeAlphaCoverage(level, settings->alphaCoverageReference, 1.0f) : 0.0f;
+
+    for (uint32_t levelIndex = 1; levelIndex < numLevels; ++levelIndex)
+    {
+        uint32_t w = std::max(level.width / 2, 1u);
+        uint32_t h = std::max(level.height / 2, 1u);
+        uint32_t d = std::max(level.depth / 2, 1u);
+
+        level = downsample(level, w, h, d, settings->filter, operationThreads);
+
+        float alphaScale = preserveAlphaCoverage ? computeAlphaScale(level, settings->alphaCoverageReference, targetCoverage) : 1.0f;
+
+        // the unscaled level is retained as the source for the next level so that alpha scaling doesn't accumulate.
+        auto dest = static_cast<uint8_t*>(mipmappedImage->dataPointer(offsets[levelIndex]));
+        parallelFor(operationThreads, static_cast<uint32_t>(level.texels.size()), 16384, [&](uint32_t begin, uint32_t end) {
+            for (uint32_t i = begin; i < end; ++i)
+            {
+                vec4 value = level.texels[i];
+                value.a *= alphaScale;
+                codec.encode(value, dest + static_cast<size_t>(i) * properties.stride);
+            }
+        });
+    }
+
+    mipmappedImage->dirty();
+
+    return mipmappedImage;
+}
@@ -0,0 +1,286 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2025 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+
+#include <vsg/io/Logger.h>
+#include <vsg/io/Options.h>
+#include <vsg/maths/transform.h>
+#include <vsg/nodes/CullNode.h>
+#include <vsg/nodes/MatrixTransform.h>
+#include <vsg/nodes/StateGroup.h>
+#include <vsg/nodes/VertexDraw.h>
+#include <vsg/nodes/VertexIndexDraw.h>
+#include <vsg/state/ArrayState.h>
+#include <vsg/state/VertexInputState.h>
+#include <vsg/utils/ComputeBounds.h>
+#include <vsg/utils/InstanceRepeatedSubgraphs.h>
+
+#include <algorithm>
+
+using namespace vsg;
+
+InstanceRepeatedSubgraphs::InstanceRepeatedSubgraphs(ref_ptr<ShaderSet> in_shaderSet) :
+    shaderSet(in_shaderSet)
+{
+    if (!shaderSet) shaderSet = createPhysicsBasedRenderingShaderSet();
+}
+
+void InstanceRepeatedSubgraphs::apply(Object& object)
+{
+    object.traverse(*this);
+}
+
+void InstanceRepeatedSubgraphs::apply(Group& group)
+{
+    if (!_visited.insert(&group).second) return;
+
+    group.traverse(*this);
+
+    // collect the MatrixTransforms that are only referenced by this group, grouped by their child and the non translation part of their matrix
+    std::map<std::pair<Node*, dmat4>, Instances> candidates;
+    for (auto& child : group.children)
+    {
+        auto transform = child->cast<MatrixTransform>();
+        if (!transform || transform->type_info() != typeid(MatrixTransform) || transform->referenceCount() > 1 || transform->children.size() != 1) continue;
+
+        // only affine transforms can be split into a shared linear part and per instance translation
+        const auto& matrix = transform->matrix;
+        if (matrix[0][3] != 0.0 || matrix[1][3] != 0.0 || matrix[2][3] != 0.0 || matrix[3][3] != 1.0) continue;
+
+        dmat4 linear = matrix;
+        linear[3].set(0.0, 0.0, 0.0, 1.0);
+
+        candidates[{transform->children.front().get(), linear}].emplace_back(transform);
+    }
+
+    std::set<Node*> replaced;
+    for (auto& [key, instances] : candidates)
+    {
+        if (instances.size() < minimumInstances) continue;
+
+        auto& proto = prototype(key.first);
+        if (!proto) continue;
+
+        for (auto& transform : instances) replaced.insert(transform.get());
+
+        instance(group, proto, key.second, instances);
+    }
+
+    if (!replaced.empty())
+    {
+        auto itr = std::remove_if(group.children.begin(), group.children.end(), [&replaced](const ref_ptr<Node>& child) { return replaced.count(child.get()) != 0; });
+        group.children.erase(itr, group.children.end());
+    }
+}
+
+const InstanceRepeatedSubgraphs::Prototype& InstanceRepeatedSubgraphs::prototype(Node* node)
+{
+    if (auto itr = _prototypes.find(node); itr != _prototypes.end()) return itr->second;
+
+    auto& proto = _prototypes[node];
+
+    auto stateGroup = node->cast<StateGroup>();
+    if (!stateGroup || stateGroup->children.size() != 1) return proto;
+
+    size_t numArrays = 0;
+    auto& child = stateGroup->children.front();
+    if (auto vid = child->cast<VertexIndexDraw>(); vid && vid->instanceCount == 1 && vid->firstInstance == 0 && vid->firstBinding == 0)
+        numArrays = vid->arrays.size();
+    else if (auto vd = child->cast<VertexDraw>(); vd && vd->instanceCount == 1 && vd->firstInstance == 0 && vd->firstBinding == 0)
+        numArrays = vd->arrays.size();
+    else
+        return proto;
+
+    GraphicsPipeline* pipeline = nullptr;
+    for (auto& stateCommand : stateGroup->stateCommands)
+    {
+        if (auto bindPipeline = stateCommand->cast<BindGraphicsPipeline>()) pipeline = bindPipeline->pipeline.get();
+    }
+    if (!pipeline) return proto;
+
+    // the vertex arrays must map directly to the pipeline's vertex bindings so the instance positions can be appended as the next binding
+    for (auto& pipelineState : pipeline->pipelineStates)
+    {
+        if (auto vis = pipelineState->cast<VertexInputState>(); vis && vis->vertexBindingDescriptions.size() != numArrays) return proto;
+    }
+
+    ComputeBounds computeBounds;
+    node->accept(computeBounds);
+    if (!computeBounds.bounds.valid()) return proto;
+
+    auto& bounds = computeBounds.bounds;
+    auto bindInstancedPipeline = instancedPipeline(pipeline);
+    if (!bindInstancedPipeline) return proto;
+
+    proto.stateGroup = stateGroup;
+    proto.bindInstancedPipeline = BindGraphicsPipeline::create(bindInstancedPipeline);
+    proto.bound.set((bounds.min + bounds.max) * 0.5, length(bounds.max - bounds.min) * 0.5);
+
+    return proto;
+}
+
+ref_ptr<GraphicsPipeline> InstanceRepeatedSubgraphs::instancedPipeline(GraphicsPipeline* pipeline)
+{
+    if (auto itr = _instancedPipelines.find(pipeline); itr != _instancedPipelines.end()) return itr->second;
+
+    auto& instanced = _instancedPipelines[pipeline];
+
+    auto& positionBinding = shaderSet->getAttributeBinding("vsg_position");
+    if (!positionBinding || positionBinding.format != VK_FORMAT_R32G32B32_SFLOAT) return instanced;
+
+    // shaders are recompiled with the instance position define so must have their source
+    ShaderStages stages;
+    for (auto& stage : pipeline->stages)
+    {
+        auto& module = stage->module;
+        if (!module || module->source.empty()) return instanced;
+
+        auto hints = module->hints ? ShaderCompileSettings::create(*module->hints) : ShaderCompileSettings::create();
+        if (!positionBinding.define.empty())
+        {
+            if (hints->defines.count(positionBinding.define) != 0) return instanced;
+            hints->defines.insert(positionBinding.define);
+        }
+
+        auto instancedStage = ShaderStage::create(stage->stage, stage->entryPointName, ShaderModule::create(module->source, hints));
+        instancedStage->mask = stage->mask;
+        instancedStage->specializationConstants = stage->specializationConstants;
+        stages.push_back(instancedStage);
+    }
+
+    bool hasVertexInputState = false;
+    GraphicsPipelineStates pipelineStates;
+    for (auto& pipelineState : pipeline->pipelineStates)
+    {
+        if (auto vis = pipelineState->cast<VertexInputState>())
+        {
+            for (auto& attribute : vis->vertexAttributeDescriptions)
+            {
+                if (attribute.location == positionBinding.location) return instanced;
+            }
+
+            auto instancedVertexInputState = VertexInputState::create(*vis);
+
+            // existing per instance arrays only hold the values for the single original instance, so share them across all instances
+            for (auto& binding : instancedVertexInputState->vertexBindingDescriptions)
+            {
+                if (binding.inputRate == VK_VERTEX_INPUT_RATE_INSTANCE) binding.stride = 0;
+            }
+
+            uint32_t binding = static_cast<uint32_t>(instancedVertexInputState->vertexBindingDescriptions.size());
+            instancedVertexInputState->vertexBindingDescriptions.push_back(VkVertexInputBindingDescription{binding, 12, VK_VERTEX_INPUT_RATE_INSTANCE});
+            instancedVertexInputState->vertexAttributeDescriptions.push_back(VkVertexInputAttributeDescription{positionBinding.location, binding, positionBinding.format, 0});
+
+            pipelineStates.push_back(instancedVertexInputState);
+            hasVertexInputState = true;
+        }
+        else
+        {
+            pipelineStates.push_back(pipelineState);
+        }
+    }
+    if (!hasVertexInputState) return instanced;
+
+    instanced = GraphicsPipeline::create(pipeline->layout, stages, pipelineStates, pipeline->subpass);
+    return instanced;
+}
+
+ref_ptr<Node> InstanceRepeatedSubgraphs::createInstancedDraw(const Prototype& proto, const std::vector<vec3>& positions)
+{
+    auto positionArray = vec3Array::create(static_cast<uint32_t>(positions.size()));
+    std::copy(positions.begin(), positions.end(), positionArray->begin());
+
+    ref_ptr<Node> draw;
+    auto& original = proto.stateGroup->children.front();
+    if (auto vid = original->cast<VertexIndexDraw>())
+    {
+        auto instancedDraw = VertexIndexDraw::create(*vid);
+        instancedDraw->arrays.push_back(BufferInfo::create(positionArray));
+        instancedDraw->instanceCount = static_cast<uint32_t>(positions.size());
+        draw = instancedDraw;
+    }
+    else if (auto vd = original->cast<VertexDraw>())
+    {
+        auto instancedDraw = VertexDraw::create(*vd);
+        instancedDraw->arrays.push_back(BufferInfo::create(positionArray));
+        instancedDraw->instanceCount = static_cast<uint32_t>(positions.size());
+        draw = instancedDraw;
+    }
+
+    auto stateGroup = StateGroup::create(*proto.stateGroup);
+    stateGroup->children.clear();
+    stateGroup->addChild(draw);
+    for (auto& stateCommand : stateGroup->stateCommands)
+    {
+        if (stateCommand->cast<BindGraphicsPipeline>()) stateCommand = proto.bindInstancedPipeline;
+    }
+
+    // enable LineSegmentIntersector and ComputeBounds to account for the instance positions
+    auto arrayState = PositionArrayState::create();
+    arrayState->position_attribute_location = shaderSet->getAttributeBinding("vsg_position").location;
+    stateGroup->prototypeArrayState = arrayState;
+
+    return stateGroup;
+}
+
+void InstanceRepeatedSubgraphs::instance(Group& group, const Prototype& proto, const dmat4& linear, const Instances& instances)
+{
+    // M * v = L * v + t = L * (v + inverse(L) * t), so the translations in L's frame become the instance positions
+    auto inverseLinear = inverse(linear);
+
+    std::vector<dvec3> positions;
+    positions.reserve(instances.size());
+    for (auto& transform : instances)
+    {
+        const auto& t = transform->matrix[3];
+        positions.emplace_back(inverseLinear * dvec3(t.x, t.y, t.z));
+    }
+
+    // split the instances along their longest axis till each batch fits within maxInstancesPerBatch
+    auto batch = [&](auto& self, std::vector<dvec3>::iterator begin, std::vector<dvec3>::iterator end) -> void {
+        dbox extents;
+        for (auto itr = begin; itr != end; ++itr) extents.add(*itr);
+
+        auto count = static_cast<uint32_t>(end - begin);
+        if (count > std::max(maxInstancesPerBatch, 1u))
+        {
+            auto size = extents.max - extents.min;
+            int axis = (size.x >= size.y && size.x >= size.z) ? 0 : ((size.y >= size.z) ? 1 : 2);
+            auto mid = begin + count / 2;
+            std::nth_element(begin, mid, end, [axis](const dvec3& lhs, const dvec3& rhs) { return lhs[axis] < rhs[axis]; });
+            self(self, begin, mid);
+            self(self, mid, end);
+            return;
+        }
+
+        // store the float instance positions relative to the center of the batch so large world coordinates don't lose precision,
+        // with the center, in double, and the common linear part applied by the batch's MatrixTransform.
+        dvec3 center = (extents.min + extents.max) * 0.5;
+
+        std::vector<vec3> localPositions;
+        localPositions.reserve(count);
+        for (auto itr = begin; itr != end; ++itr) localPositions.emplace_back(*itr - center);
+
+        // bound of the batch is the bound of the instance positions expanded by the radius of the prototype's bound
+        dsphere bound(proto.bound.center, length(extents.max - extents.min) * 0.5 + proto.bound.radius);
+
+        auto transform = MatrixTransform::create(linear * translate(center));
+        transform->addChild(CullNode::create(bound, createInstancedDraw(proto, localPositions)));
+        group.addChild(transform);
+        ++numInstancedDraws;
+    };
+    batch(batch, positions.begin(), positions.end());
+
+    numDrawsReplaced += static_cast<uint32_t>(instances.size());
+
+    debug("InstanceRepeatedSubgraphs replaced ", instances.size(), " transformed draws with instanced draws, total reduction ", drawCallReduction());
+}
@@ -22,6 +22,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/nodes/Geometry.h>
 #include <vsg/nodes/LOD.h>
 #include <vsg/nodes/PagedLOD.h>
+#include <vsg/nodes/SpatialGroup.h>
 #include <vsg/nodes/StateGroup.h>
 #include <vsg/nodes/Transform.h>
 #include <vsg/nodes/VertexDraw.h>
@@ -130,6 +131,13 @@ void Intersector::apply(const CullGroup& cn)
     if (intersects(cn.bound)) cn.traverse(*this);
 }
 
+void Intersector::apply(const SpatialGroup& sg)
+{
+    PushPopNode ppn(_nodePath, &sg);
+
+    sg.cull([&](const dsphere& bound) { return intersects(bound); }, [&](const Node& child) { child.accept(*this); });
+}
+
 void Intersector::apply(const DepthSorted& cn)
 {
     PushPopNode ppn(_nodePath, &cn);
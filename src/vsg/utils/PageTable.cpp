@@ -0,0 +1,231 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2025 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+
+#include <vsg/io/Logger.h>
+#include <vsg/utils/PageTable.h>
+
+using namespace vsg;
+
+PageTable::PageTable(uint32_t in_numPages, uint32_t in_numReservedPages) :
+    _numReservedPages(std::max(in_numReservedPages, 1u))
+{
+    _pages.resize(std::max(in_numPages, _numReservedPages));
+    for (uint32_t page = _numReservedPages; page < _pages.size(); ++page)
+    {
+        _pushBack(page);
+    }
+}
+
+void PageTable::_unlink(uint32_t page)
+{
+    auto& element = _pages[page];
+    if (element.previous == 0)
+        _head = element.next;
+    else
+        _pages[element.previous].next = element.next;
+
+    if (element.next == 0)
+        _tail = element.previous;
+    else
+        _pages[element.next].previous = element.previous;
+
+    element.previous = 0;
+    element.next = 0;
+}
+
+void PageTable::_pushFront(uint32_t page)
+{
+    auto& element = _pages[page];
+    element.previous = 0;
+    element.next = _head;
+    if (_head == 0)
+        _tail = page;
+    else
+        _pages[_head].previous = page;
+    _head = page;
+}
+
+void PageTable::_pushBack(uint32_t page)
+{
+    auto& element = _pages[page];
+    element.previous = _tail;
+    element.next = 0;
+    if (_tail == 0)
+        _head = page;
+    else
+        _pages[_tail].next = page;
+    _tail = page;
+}
+
+uint32_t PageTable::find(const Key& key) const
+{
+    if (auto itr = _keyToPage.find(key); itr != _keyToPage.end()) return itr->second;
+    return 0;
+}
+
+uint32_t PageTable::touch(const Key& key, uint64_t frameCount)
+{
+    auto itr = _keyToPage.find(key);
+    if (itr == _keyToPage.end())
+    {
+        ++numMisses;
+        return 0;
+    }
+
+    ++numHits;
+
+    uint32_t page = itr->second;
+    auto& element = _pages[page];
+    if (element.frameLastUsed != frameCount)
+    {
+        element.frameLastUsed = frameCount;
+        if (page != _tail)
+        {
+            _unlink(page);
+            _pushBack(page);
+        }
+    }
+    return page;
+}
+
+std::pair<uint32_t, bool> PageTable::acquire(const Key& key, uint64_t frameCount)
+{
+    if (_keyToPage.count(key) != 0)
+    {
+        return {touch(key, frameCount), false};
+    }
+
+    ++numMisses;
+
+    uint32_t page = _head;
+    if (page == 0)
+    {
+        ++numFailures;
+        return {0, false};
+    }
+
+    auto& element = _pages[page];
+    if (element.assigned)
+    {
+        if ((frameCount - element.frameLastUsed) < retainFrames)
+        {
+            // least recently used page is still potentially in use by the GPU
+            ++numFailures;
+            return {0, false};
+        }
+
+        _keyToPage.erase(element.key);
+        ++numEvictions;
+    }
+
+    element.assigned = true;
+    element.key = key;
+    element.frameLastUsed = frameCount;
+    _keyToPage[key] = page;
+
+    _unlink(page);
+    _pushBack(page);
+
+    return {page, true};
+}
+
+void PageTable::release(const Key& key)
+{
+    auto itr = _keyToPage.find(key);
+    if (itr == _keyToPage.end()) return;
+
+    uint32_t page = itr->second;
+    _keyToPage.erase(itr);
+
+    auto& element = _pages[page];
+    element.assigned = false;
+    element.frameLastUsed = 0;
+
+    _unlink(page);
+    _pushFront(page);
+}
+
+void PageTable::clear()
+{
+    while (!_keyToPage.empty())
+    {
+        release(_keyToPage.begin()->first);
+    }
+}
+
+bool PageTable::assigned(uint32_t page, Key& key) const
+{
+    if (page >= _pages.size() || !_pages[page].assigned) return false;
+    key = _pages[page].key;
+    return true;
+}
+
+bool PageTable::check() const
+{
+    uint32_t count = 0;
+    uint32_t previous = 0;
+    uint32_t numAssigned = 0;
+    for (uint32_t page = _head; page != 0; page = _pages[page].next)
+    {
+        if (page < _numReservedPages || page >= _pages.size())
+        {
+            warn("PageTable::check() invalid page ", page, " in list.");
+            return false;
+        }
+
+        auto& element = _pages[page];
+        if (element.previous != previous)
+        {
+            warn("PageTable::check() page ", page, " previous ", element.previous, " does not match ", previous);
+            return false;
+        }
+
+        if (element.assigned)
+        {
+            ++numAssigned;
+            auto itr = _keyToPage.find(element.key);
+            if (itr == _keyToPage.end() || itr->second != page)
+            {
+                warn("PageTable::check() page ", page, " key not mapped to page.");
+                return false;
+            }
+        }
+
+        previous = page;
+        if (++count > _pages.size())
+        {
+            warn("PageTable::check() list contains a cycle.");
+            return false;
+        }
+    }
+
+    if (previous != _tail)
+    {
+        warn("PageTable::check() tail ", _tail, " does not match last page ", previous);
+        return false;
+    }
+
+    if (count != (_pages.size() - _numReservedPages))
+    {
+        warn("PageTable::check() list contains ", count, " pages, expected ", _pages.size() - _numReservedPages);
+        return false;
+    }
+
+    if (numAssigned != _keyToPage.size())
+    {
+        warn("PageTable::check() ", numAssigned, " assigned pages but ", _keyToPage.size(), " keys mapped.");
+        return false;
+    }
+
+    return true;
+}
@@ -0,0 +1,352 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2025 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/commands/BindIndexBuffer.h>
+#include <vsg/commands/BindVertexBuffers.h>
+#include <vsg/io/Options.h>
+#include <vsg/nodes/CullGroup.h>
+#include <vsg/nodes/CullNode.h>
+#include <vsg/nodes/Geometry.h>
+#include <vsg/nodes/LOD.h>
+#include <vsg/nodes/MatrixTransform.h>
+#include <vsg/nodes/PagedLOD.h>
+#include <vsg/nodes/SpatialGroup.h>
+#include <vsg/nodes/StateGroup.h>
+#include <vsg/nodes/VertexDraw.h>
+#include <vsg/nodes/VertexIndexDraw.h>
+#include <vsg/threading/Latch.h>
+#include <vsg/utils/RefitBounds.h>
+
+using namespace vsg;
+
+namespace vsg
+{
+    /// CollectRefitBounds traverses a scene graph recording the bound nodes and the transforms and arrays each bound depends upon.
+    class CollectRefitBounds : public Visitor
+    {
+    public:
+        explicit CollectRefitBounds(RefitBounds& in_refitBounds) :
+            refitBounds(in_refitBounds)
+        {
+            arrayStateStack.emplace_back(ArrayState::create());
+        }
+
+        RefitBounds& refitBounds;
+        std::vector<ref_ptr<ArrayState>> arrayStateStack;
+        int32_t current = -1;
+        uint32_t depth = 0;
+        SpatialGroup* spatialGroup = nullptr;
+
+        void addDependent(const Object* object)
+        {
+            if (current < 0) return;
+
+            auto& dependents = refitBounds._dependents[object];
+            if (dependents.empty() || dependents.back() != static_cast<uint32_t>(current)) dependents.push_back(static_cast<uint32_t>(current));
+        }
+
+        void addArray(const BufferInfo* bufferInfo)
+        {
+            if (current < 0 || !bufferInfo || !bufferInfo->data) return;
+
+            ref_ptr<const Data> data(bufferInfo->data);
+            auto& bound = refitBounds._bounds[current];
+            bound.arrays.push_back(RefitBounds::ArrayDependency{data, {}});
+            data->getModifiedCount(bound.arrays.back().previous);
+            addDependent(data.get());
+        }
+
+        void addBound(Node& node, dsphere& sphere)
+        {
+            auto index = static_cast<int32_t>(refitBounds._bounds.size());
+
+            RefitBounds::Bound bound;
+            bound.node = &node;
+            bound.bound = &sphere;
+            bound.parent = current;
+            bound.spatialGroup = spatialGroup;
+            bound.arrayState = arrayStateStack.back();
+            refitBounds._bounds.push_back(bound);
+
+            if (refitBounds._levels.size() <= depth) refitBounds._levels.resize(depth + 1);
+            refitBounds._levels[depth].push_back(static_cast<uint32_t>(index));
+
+            auto previous = current;
+            current = index;
+            ++depth;
+            spatialGroup = nullptr;
+
+            addDependent(&node);
+            node.traverse(*this);
+
+            --depth;
+            current = previous;
+        }
+
+        void apply(Object& object) override
+        {
+            spatialGroup = nullptr;
+            object.traverse(*this);
+        }
+
+        void apply(SpatialGroup& group) override
+        {
+            for (auto& child : group.children)
+            {
+                spatialGroup = &group;
+                child->accept(*this);
+            }
+            spatialGroup = nullptr;
+        }
+
+        void apply(StateGroup& stategroup) override
+        {
+            spatialGroup = nullptr;
+
+            auto arrayState = stategroup.prototypeArrayState ? stategroup.prototypeArrayState->cloneArrayState(arrayStateStack.back()) : arrayStateStack.back()->cloneArrayState();
+            for (auto& statecommand : stategroup.stateCommands)
+            {
+                statecommand->accept(*arrayState);
+                statecommand->accept(*this);
+            }
+
+            arrayStateStack.emplace_back(arrayState);
+            stategroup.traverse(*this);
+            arrayStateStack.pop_back();
+        }
+
+        void apply(Transform& transform) override
+        {
+            spatialGroup = nullptr;
+
+            if (current >= 0)
+            {
+                RefitBounds::TransformDependency dependency;
+                dependency.transform = &transform;
+                if (auto mt = transform.cast<MatrixTransform>())
+                {
+                    dependency.matrix = &(mt->matrix);
+                    dependency.previous = mt->matrix;
+                }
+                else
+                {
+                    dependency.previous = transform.transform(dmat4());
+                }
+                refitBounds._bounds[current].transforms.push_back(dependency);
+                addDependent(&transform);
+            }
+
+            transform.traverse(*this);
+        }
+
+        void apply(CullGroup& cullGroup) override { addBound(cullGroup, cullGroup.bound); }
+        void apply(CullNode& cullNode) override { addBound(cullNode, cullNode.bound); }
+        void apply(LOD& lod) override { addBound(lod, lod.bound); }
+
+        void apply(PagedLOD& plod) override
+        {
+            // PagedLOD bounds are provided by the database and their subgraphs are loaded and expired by the DatabasePager so aren't tracked,
+            // though dirty(plod) will refit the enclosing bound.
+            spatialGroup = nullptr;
+            addDependent(&plod);
+        }
+
+        void apply(Geometry& geometry) override
+        {
+            spatialGroup = nullptr;
+            for (auto& array : geometry.arrays) addArray(array);
+            addArray(geometry.indices);
+        }
+
+        void apply(VertexDraw& vd) override
+        {
+            spatialGroup = nullptr;
+            for (auto& array : vd.arrays) addArray(array);
+        }
+
+        void apply(VertexIndexDraw& vid) override
+        {
+            spatialGroup = nullptr;
+            for (auto& array : vid.arrays) addArray(array);
+            addArray(vid.indices);
+        }
+
+        void apply(BindVertexBuffers& bvb) override
+        {
+            for (auto& array : bvb.arrays) addArray(array);
+        }
+
+        void apply(BindIndexBuffer& bib) override
+        {
+            addArray(bib.indices);
+        }
+    };
+} // namespace vsg
+
+RefitBounds::RefitBounds()
+{
+}
+
+RefitBounds::~RefitBounds()
+{
+}
+
+void RefitBounds::build(ref_ptr<Node> node)
+{
+    _bounds.clear();
+    _levels.clear();
+    _dependents.clear();
+
+    if (!node) return;
+
+    CollectRefitBounds collect(*this);
+    node->accept(collect);
+}
+
+void RefitBounds::dirty(const Object* object)
+{
+    if (auto itr = _dependents.find(object); itr != _dependents.end())
+    {
+        for (auto index : itr->second) _bounds[index].dirty = true;
+    }
+}
+
+bool RefitBounds::_changed(Bound& bound)
+{
+    bool changed = false;
+    for (auto& dependency : bound.transforms)
+    {
+        if (dependency.matrix)
+        {
+            if (*dependency.matrix != dependency.previous)
+            {
+                dependency.previous = *dependency.matrix;
+                changed = true;
+            }
+        }
+        else if (auto matrix = dependency.transform->transform(dmat4()); matrix != dependency.previous)
+        {
+            dependency.previous = matrix;
+            changed = true;
+        }
+    }
+
+    for (auto& dependency : bound.arrays)
+    {
+        if (dependency.data->getModifiedCount(dependency.previous)) changed = true;
+    }
+
+    return changed;
+}
+
+dsphere RefitBounds::_compute(const Bound& bound) const
+{
+    // traverse the children using the bounds of nested Cull/LOD nodes, which have already been refit
+    auto computeBounds = ComputeBounds::create(bound.arrayState->cloneArrayState());
+    computeBounds->useNodeBounds = true;
+    computeBounds->boundsCache = boundsCache;
+    bound.node->traverse(*computeBounds);
+
+    const auto& bb = computeBounds->bounds;
+    if (!bb.valid()) return {};
+
+    return dsphere((bb.min + bb.max) * 0.5, length(bb.max - bb.min) * 0.5);
+}
+
+uint32_t RefitBounds::refit()
+{
+    for (auto& bound : _bounds)
+    {
+        if (_changed(bound)) bound.dirty = true;
+    }
+
+    struct RefitOperation : public Inherit<Operation, RefitOperation>
+    {
+        RefitOperation(const RefitBounds& in_refitBounds, const Bound* in_bounds, const uint32_t* in_indices, dsphere* in_results, size_t in_count, ref_ptr<Latch> in_latch) :
+            refitBounds(in_refitBounds),
+            bounds(in_bounds),
+            indices(in_indices),
+            results(in_results),
+            count(in_count),
+            latch(in_latch) {}
+
+        void run() override
+        {
+            for (size_t i = 0; i < count; ++i) results[i] = refitBounds._compute(bounds[indices[i]]);
+            latch->count_down();
+        }
+
+        const RefitBounds& refitBounds;
+        const Bound* bounds;
+        const uint32_t* indices;
+        dsphere* results;
+        size_t count;
+        ref_ptr<Latch> latch;
+    };
+
+    uint32_t numRefit = 0;
+    std::vector<uint32_t> dirtyBounds;
+    std::vector<dsphere> results;
+
+    // refit the deepest bounds first so that enclosing bounds are computed from up to date nested bounds
+    for (auto level = _levels.rbegin(); level != _levels.rend(); ++level)
+    {
+        dirtyBounds.clear();
+        for (auto index : *level)
+        {
+            if (_bounds[index].dirty) dirtyBounds.push_back(index);
+        }
+        if (dirtyBounds.empty()) continue;
+
+        results.resize(dirtyBounds.size());
+
+        auto count = dirtyBounds.size();
+        if (operationThreads && count >= std::max(minimumParallelBounds, 2u))
+        {
+            size_t numBatches = std::min(count, (operationThreads->threads.size() + 1) * 4);
+            size_t batchSize = (count + numBatches - 1) / numBatches;
+            numBatches = (count + batchSize - 1) / batchSize;
+
+            auto latch = Latch::create(static_cast<int>(numBatches));
+            for (size_t begin = 0; begin < count; begin += batchSize)
+            {
+                operationThreads->add(RefitOperation::create(*this, _bounds.data(), dirtyBounds.data() + begin, results.data() + begin, std::min(batchSize, count - begin), latch));
+            }
+
+            // use this thread to refit batches as well
+            operationThreads->run();
+
+            latch->wait();
+        }
+        else
+        {
+            for (size_t i = 0; i < count; ++i) results[i] = _compute(_bounds[dirtyBounds[i]]);
+        }
+
+        // assign the new bounds, propagating changes to the parent bounds and SpatialGroup octrees
+        for (size_t i = 0; i < count; ++i)
+        {
+            auto& bound = _bounds[dirtyBounds[i]];
+            bound.dirty = false;
+
+            if (*bound.bound == results[i]) continue;
+
+            *bound.bound = results[i];
+            if (bound.parent >= 0) _bounds[bound.parent].dirty = true;
+            if (bound.spatialGroup) bound.spatialGroup->update(bound.node, results[i]);
+        }
+
+        numRefit += static_cast<uint32_t>(count);
+    }
+
+    return numRefit;
+}
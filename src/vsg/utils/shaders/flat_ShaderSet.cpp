@@ -2,580 +2,598 @@
 #include <vsg/io/mem_stream.h>
 static auto flat_ShaderSet = []() {
 static const uint8_t data[] = {
-35, 118, 115, 103, 98, 32, 49, 46, 49, 46, 51, 10, 1, 0, 0, 0, 14, 0, 0, 0, 118, 115, 103, 58, 58, 83, 104, 97, 100, 101, 114, 83,
+35, 118, 115, 103, 98, 32, 49, 46, 49, 46, 53, 10, 1, 0, 0, 0, 14, 0, 0, 0, 118, 115, 103, 58, 58, 83, 104, 97, 100, 101, 114, 83,
 101, 116, 0, 0, 0, 0, 2, 0, 0, 0, 2, 0, 0, 0, 16, 0, 0, 0, 118, 115, 103, 58, 58, 83, 104, 97, 100, 101, 114, 83, 116, 97,
 103, 101, 0, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 1, 0, 0, 0, 4, 0, 0, 0, 109, 97, 105, 110, 3, 0, 0, 0, 17, 0,
-0, 0, 118, 115, 103, 58, 58, 83, 104, 97, 100, 101, 114, 77, 111, 100, 117, 108, 101, 0, 0, 0, 0, 0, 0, 0, 0, 132, 16, 0, 0, 35,
+0, 0, 118, 115, 103, 58, 58, 83, 104, 97, 100, 101, 114, 77, 111, 100, 117, 108, 101, 0, 0, 0, 0, 0, 0, 0, 0, 25, 18, 0, 0, 35,
 118, 101, 114, 115, 105, 111, 110, 32, 52, 53, 48, 10, 35, 101, 120, 116, 101, 110, 115, 105, 111, 110, 32, 71, 76, 95, 65, 82, 66, 95, 115, 101,
 112, 97, 114, 97, 116, 101, 95, 115, 104, 97, 100, 101, 114, 95, 111, 98, 106, 101, 99, 116, 115, 32, 58, 32, 101, 110, 97, 98, 108, 101, 10, 10,
 35, 112, 114, 97, 103, 109, 97, 32, 105, 109, 112, 111, 114, 116, 95, 100, 101, 102, 105, 110, 101, 115, 32, 40, 86, 83, 71, 95, 73, 78, 83, 84,
 65, 78, 67, 69, 95, 80, 79, 83, 73, 84, 73, 79, 78, 83, 44, 32, 86, 83, 71, 95, 66, 73, 76, 76, 66, 79, 65, 82, 68, 44, 32, 86,
 83, 71, 95, 68, 73, 83, 80, 76, 65, 67, 69, 77, 69, 78, 84, 95, 77, 65, 80, 44, 32, 86, 83, 71, 95, 83, 75, 73, 78, 78, 73, 78,
-71, 41, 10, 10, 35, 100, 101, 102, 105, 110, 101, 32, 86, 73, 69, 87, 95, 68, 69, 83, 67, 82, 73, 80, 84, 79, 82, 95, 83, 69, 84, 32,
-48, 10, 35, 100, 101, 102, 105, 110, 101, 32, 77, 65, 84, 69, 82, 73, 65, 76, 95, 68, 69, 83, 67, 82, 73, 80, 84, 79, 82, 95, 83, 69,
-84, 32, 49, 10, 10, 108, 97, 121, 111, 117, 116, 40, 112, 117, 115, 104, 95, 99, 111, 110, 115, 116, 97, 110, 116, 41, 32, 117, 110, 105, 102, 111,
-114, 109, 32, 80, 117, 115, 104, 67, 111, 110, 115, 116, 97, 110, 116, 115, 32, 123, 10, 32, 32, 32, 32, 109, 97, 116, 52, 32, 112, 114, 111, 106,
-101, 99, 116, 105, 111, 110, 59, 10, 32, 32, 32, 32, 109, 97, 116, 52, 32, 109, 111, 100, 101, 108, 86, 105, 101, 119, 59, 10, 125, 32, 112, 99,
-59, 10, 10, 35, 105, 102, 100, 101, 102, 32, 86, 83, 71, 95, 68, 73, 83, 80, 76, 65, 67, 69, 77, 69, 78, 84, 95, 77, 65, 80, 10, 108,
-97, 121, 111, 117, 116, 40, 115, 101, 116, 32, 61, 32, 77, 65, 84, 69, 82, 73, 65, 76, 95, 68, 69, 83, 67, 82, 73, 80, 84, 79, 82, 95,
-83, 69, 84, 44, 32, 98, 105, 110, 100, 105, 110, 103, 32, 61, 32, 54, 41, 32, 117, 110, 105, 102, 111, 114, 109, 32, 115, 97, 109, 112, 108, 101,
-114, 50, 68, 32, 100, 105, 115, 112, 108, 97, 99, 101, 109, 101, 110, 116, 77, 97, 112, 59, 10, 35, 101, 110, 100, 105, 102, 10, 10, 108, 97, 121,
-111, 117, 116, 40, 108, 111, 99, 97, 116, 105, 111, 110, 32, 61, 32, 48, 41, 32, 105, 110, 32, 118, 101, 99, 51, 32, 118, 115, 103, 95, 86, 101,
-114, 116, 101, 120, 59, 10, 108, 97, 121, 111, 117, 116, 40, 108, 111, 99, 97, 116, 105, 111, 110, 32, 61, 32, 49, 41, 32, 105, 110, 32, 118, 101,
-99, 51, 32, 118, 115, 103, 95, 78, 111, 114, 109, 97, 108, 59, 10, 108, 97, 121, 111, 117, 116, 40, 108, 111, 99, 97, 116, 105, 111, 110, 32, 61,
-32, 50, 41, 32, 105, 110, 32, 118, 101, 99, 50, 32, 118, 115, 103, 95, 84, 101, 120, 67, 111, 111, 114, 100, 48, 59, 10, 108, 97, 121, 111, 117,
-116, 40, 108, 111, 99, 97, 116, 105, 111, 110, 32, 61, 32, 51, 41, 32, 105, 110, 32, 118, 101, 99, 52, 32, 118, 115, 103, 95, 67, 111, 108, 111,
-114, 59, 10, 10, 10, 35, 105, 102, 100, 101, 102, 32, 86, 83, 71, 95, 66, 73, 76, 76, 66, 79, 65, 82, 68, 10, 108, 97, 121, 111, 117, 116,
-40, 108, 111, 99, 97, 116, 105, 111, 110, 32, 61, 32, 52, 41, 32, 105, 110, 32, 118, 101, 99, 52, 32, 118, 115, 103, 95, 112, 111, 115, 105, 116,
-105, 111, 110, 95, 115, 99, 97, 108, 101, 68, 105, 115, 116, 97, 110, 99, 101, 59, 10, 35, 101, 108, 105, 102, 32, 100, 101, 102, 105, 110, 101, 100,
-40, 86, 83, 71, 95, 73, 78, 83, 84, 65, 78, 67, 69, 95, 80, 79, 83, 73, 84, 73, 79, 78, 83, 41, 10, 108, 97, 121, 111, 117, 116, 40,
-108, 111, 99, 97, 116, 105, 111, 110, 32, 61, 32, 52, 41, 32, 105, 110, 32, 118, 101, 99, 51, 32, 118, 115, 103, 95, 112, 111, 115, 105, 116, 105,
-111, 110, 59, 10, 35, 101, 110, 100, 105, 102, 10, 10, 35, 105, 102, 100, 101, 102, 32, 86, 83, 71, 95, 83, 75, 73, 78, 78, 73, 78, 71, 10,
-108, 97, 121, 111, 117, 116, 40, 108, 111, 99, 97, 116, 105, 111, 110, 32, 61, 32, 53, 41, 32, 105, 110, 32, 105, 118, 101, 99, 52, 32, 118, 115,
-103, 95, 74, 111, 105, 110, 116, 73, 110, 100, 105, 99, 101, 115, 59, 10, 108, 97, 121, 111, 117, 116, 40, 108, 111, 99, 97, 116, 105, 111, 110, 32,
-61, 32, 54, 41, 32, 105, 110, 32, 118, 101, 99, 52, 32, 118, 115, 103, 95, 74, 111, 105, 110, 116, 87, 101, 105, 103, 104, 116, 115, 59, 10, 10,
-108, 97, 121, 111, 117, 116, 40, 115, 101, 116, 32, 61, 32, 77, 65, 84, 69, 82, 73, 65, 76, 95, 68, 69, 83, 67, 82, 73, 80, 84, 79, 82,
-95, 83, 69, 84, 44, 32, 98, 105, 110, 100, 105, 110, 103, 32, 61, 32, 49, 49, 41, 32, 98, 117, 102, 102, 101, 114, 32, 74, 111, 105, 110, 116,
-77, 97, 116, 114, 105, 99, 101, 115, 10, 123, 10, 9, 109, 97, 116, 52, 32, 109, 97, 116, 114, 105, 99, 101, 115, 91, 93, 59, 10, 125, 32, 106,
-111, 105, 110, 116, 59, 10, 35, 101, 110, 100, 105, 102, 10, 10, 108, 97, 121, 111, 117, 116, 40, 108, 111, 99, 97, 116, 105, 111, 110, 32, 61, 32,
-48, 41, 32, 111, 117, 116, 32, 118, 101, 99, 51, 32, 101, 121, 101, 80, 111, 115, 59, 10, 108, 97, 121, 111, 117, 116, 40, 108, 111, 99, 97, 116,
-105, 111, 110, 32, 61, 32, 49, 41, 32, 111, 117, 116, 32, 118, 101, 99, 51, 32, 110, 111, 114, 109, 97, 108, 68, 105, 114, 59, 10, 108, 97, 121,
-111, 117, 116, 40, 108, 111, 99, 97, 116, 105, 111, 110, 32, 61, 32, 50, 41, 32, 111, 117, 116, 32, 118, 101, 99, 52, 32, 118, 101, 114, 116, 101,
-120, 67, 111, 108, 111, 114, 59, 10, 108, 97, 121, 111, 117, 116, 40, 108, 111, 99, 97, 116, 105, 111, 110, 32, 61, 32, 51, 41, 32, 111, 117, 116,
-32, 118, 101, 99, 50, 32, 116, 101, 120, 67, 111, 111, 114, 100, 48, 59, 10, 10, 108, 97, 121, 111, 117, 116, 40, 108, 111, 99, 97, 116, 105, 111,
-110, 32, 61, 32, 53, 41, 32, 111, 117, 116, 32, 118, 101, 99, 51, 32, 118, 105, 101, 119, 68, 105, 114, 59, 10, 10, 111, 117, 116, 32, 103, 108,
-95, 80, 101, 114, 86, 101, 114, 116, 101, 120, 123, 32, 118, 101, 99, 52, 32, 103, 108, 95, 80, 111, 115, 105, 116, 105, 111, 110, 59, 32, 125, 59,
-10, 10, 35, 105, 102, 100, 101, 102, 32, 86, 83, 71, 95, 66, 73, 76, 76, 66, 79, 65, 82, 68, 10, 109, 97, 116, 52, 32, 99, 111, 109, 112,
-117, 116, 101, 66, 105, 108, 108, 98, 111, 97, 100, 77, 97, 116, 114, 105, 120, 40, 118, 101, 99, 52, 32, 99, 101, 110, 116, 101, 114, 95, 101, 121,
-101, 44, 32, 102, 108, 111, 97, 116, 32, 97, 117, 116, 111, 83, 99, 97, 108, 101, 68, 105, 115, 116, 97, 110, 99, 101, 41, 10, 123, 10, 32, 32,
-32, 32, 102, 108, 111, 97, 116, 32, 100, 105, 115, 116, 97, 110, 99, 101, 32, 61, 32, 45, 99, 101, 110, 116, 101, 114, 95, 101, 121, 101, 46, 122,
-59, 10, 10, 32, 32, 32, 32, 102, 108, 111, 97, 116, 32, 115, 99, 97, 108, 101, 32, 61, 32, 40, 100, 105, 115, 116, 97, 110, 99, 101, 32, 60,
-32, 97, 117, 116, 111, 83, 99, 97, 108, 101, 68, 105, 115, 116, 97, 110, 99, 101, 41, 32, 63, 32, 100, 105, 115, 116, 97, 110, 99, 101, 47, 97,
-117, 116, 111, 83, 99, 97, 108, 101, 68, 105, 115, 116, 97, 110, 99, 101, 32, 58, 32, 49, 46, 48, 59, 10, 32, 32, 32, 32, 109, 97, 116, 52,
-32, 83, 32, 61, 32, 109, 97, 116, 52, 40, 115, 99, 97, 108, 101, 44, 32, 48, 46, 48, 44, 32, 48, 46, 48, 44, 32, 48, 46, 48, 44, 10,
-32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 46, 48, 44, 32, 115, 99, 97, 108, 101, 44, 32, 48, 46,
-48, 44, 32, 48, 46, 48, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 46, 48, 44, 32, 48,
-46, 48, 44, 32, 115, 99, 97, 108, 101, 44, 32, 48, 46, 48, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-32, 32, 48, 46, 48, 44, 32, 48, 46, 48, 44, 32, 48, 46, 48, 44, 32, 49, 46, 48, 41, 59, 10, 10, 32, 32, 32, 32, 109, 97, 116, 52,
-32, 84, 32, 61, 32, 109, 97, 116, 52, 40, 49, 46, 48, 44, 32, 48, 46, 48, 44, 32, 48, 46, 48, 44, 32, 48, 46, 48, 44, 10, 32, 32,
-32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 46, 48, 44, 32, 49, 46, 48, 44, 32, 48, 46, 48, 44, 32, 48,
-46, 48, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 46, 48, 44, 32, 48, 46, 48, 44, 32,
-49, 46, 48, 44, 32, 48, 46, 48, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 101, 110, 116,
-101, 114, 95, 101, 121, 101, 46, 120, 44, 32, 99, 101, 110, 116, 101, 114, 95, 101, 121, 101, 46, 121, 44, 32, 99, 101, 110, 116, 101, 114, 95, 101,
-121, 101, 46, 122, 44, 32, 49, 46, 48, 41, 59, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 84, 42, 83, 59, 10, 125, 10, 35, 101,
-110, 100, 105, 102, 10, 10, 118, 111, 105, 100, 32, 109, 97, 105, 110, 40, 41, 10, 123, 10, 32, 32, 32, 32, 118, 101, 99, 52, 32, 118, 101, 114,
-116, 101, 120, 32, 61, 32, 118, 101, 99, 52, 40, 118, 115, 103, 95, 86, 101, 114, 116, 101, 120, 44, 32, 49, 46, 48, 41, 59, 10, 32, 32, 32,
-32, 118, 101, 99, 52, 32, 110, 111, 114, 109, 97, 108, 32, 61, 32, 118, 101, 99, 52, 40, 118, 115, 103, 95, 78, 111, 114, 109, 97, 108, 44, 32,
-48, 46, 48, 41, 59, 10, 10, 35, 105, 102, 100, 101, 102, 32, 86, 83, 71, 95, 68, 73, 83, 80, 76, 65, 67, 69, 77, 69, 78, 84, 95, 77,
-65, 80, 10, 32, 32, 32, 32, 47, 47, 32, 84, 79, 68, 79, 32, 110, 101, 101, 100, 32, 116, 111, 32, 112, 97, 115, 115, 32, 97, 115, 32, 97,
-115, 32, 117, 110, 105, 102, 111, 114, 109, 32, 111, 114, 32, 112, 101, 114, 32, 105, 110, 115, 116, 97, 110, 99, 101, 32, 97, 116, 116, 114, 105, 98,
-117, 116, 101, 115, 10, 32, 32, 32, 32, 118, 101, 99, 51, 32, 115, 99, 97, 108, 101, 32, 61, 32, 118, 101, 99, 51, 40, 49, 46, 48, 44, 32,
-49, 46, 48, 44, 32, 49, 46, 48, 41, 59, 10, 10, 32, 32, 32, 32, 118, 101, 114, 116, 101, 120, 46, 120, 121, 122, 32, 61, 32, 118, 101, 114,
-116, 101, 120, 46, 120, 121, 122, 32, 43, 32, 118, 115, 103, 95, 78, 111, 114, 109, 97, 108, 32, 42, 32, 40, 116, 101, 120, 116, 117, 114, 101, 40,
-100, 105, 115, 112, 108, 97, 99, 101, 109, 101, 110, 116, 77, 97, 112, 44, 32, 118, 115, 103, 95, 84, 101, 120, 67, 111, 111, 114, 100, 48, 46, 115,
-116, 41, 46, 115, 32, 42, 32, 115, 99, 97, 108, 101, 46, 122, 41, 59, 10, 10, 32, 32, 32, 32, 102, 108, 111, 97, 116, 32, 115, 95, 100, 101,
-108, 116, 97, 32, 61, 32, 48, 46, 48, 49, 59, 10, 32, 32, 32, 32, 102, 108, 111, 97, 116, 32, 119, 105, 100, 116, 104, 32, 61, 32, 48, 46,
-48, 59, 10, 10, 32, 32, 32, 32, 102, 108, 111, 97, 116, 32, 115, 95, 108, 101, 102, 116, 32, 61, 32, 109, 97, 120, 40, 118, 115, 103, 95, 84,
-101, 120, 67, 111, 111, 114, 100, 48, 46, 115, 32, 45, 32, 115, 95, 100, 101, 108, 116, 97, 44, 32, 48, 46, 48, 41, 59, 10, 32, 32, 32, 32,
-102, 108, 111, 97, 116, 32, 115, 95, 114, 105, 103, 104, 116, 32, 61, 32, 109, 105, 110, 40, 118, 115, 103, 95, 84, 101, 120, 67, 111, 111, 114, 100,
-48, 46, 115, 32, 43, 32, 115, 95, 100, 101, 108, 116, 97, 44, 32, 49, 46, 48, 41, 59, 10, 32, 32, 32, 32, 102, 108, 111, 97, 116, 32, 116,
-95, 99, 101, 110, 116, 101, 114, 32, 61, 32, 118, 115, 103, 95, 84, 101, 120, 67, 111, 111, 114, 100, 48, 46, 116, 59, 10, 32, 32, 32, 32, 102,
-108, 111, 97, 116, 32, 100, 101, 108, 116, 97, 95, 108, 101, 102, 116, 95, 114, 105, 103, 104, 116, 32, 61, 32, 40, 115, 95, 114, 105, 103, 104, 116,
-32, 45, 32, 115, 95, 108, 101, 102, 116, 41, 32, 42, 32, 115, 99, 97, 108, 101, 46, 120, 59, 10, 32, 32, 32, 32, 102, 108, 111, 97, 116, 32,
-100, 122, 95, 108, 101, 102, 116, 95, 114, 105, 103, 104, 116, 32, 61, 32, 40, 116, 101, 120, 116, 117, 114, 101, 40, 100, 105, 115, 112, 108, 97, 99,
-101, 109, 101, 110, 116, 77, 97, 112, 44, 32, 118, 101, 99, 50, 40, 115, 95, 114, 105, 103, 104, 116, 44, 32, 116, 95, 99, 101, 110, 116, 101, 114,
-41, 41, 46, 115, 32, 45, 32, 116, 101, 120, 116, 117, 114, 101, 40, 100, 105, 115, 112, 108, 97, 99, 101, 109, 101, 110, 116, 77, 97, 112, 44, 32,
-118, 101, 99, 50, 40, 115, 95, 108, 101, 102, 116, 44, 32, 116, 95, 99, 101, 110, 116, 101, 114, 41, 41, 46, 115, 41, 32, 42, 32, 115, 99, 97,
-108, 101, 46, 122, 59, 10, 10, 32, 32, 32, 32, 47, 47, 32, 84, 79, 68, 79, 32, 110, 101, 101, 100, 32, 116, 111, 32, 104, 97, 110, 100, 108,
-101, 32, 100, 105, 102, 102, 101, 114, 101, 110, 116, 32, 111, 114, 105, 103, 105, 110, 115, 32, 111, 102, 32, 100, 105, 115, 112, 108, 97, 99, 101, 109,
-101, 110, 116, 77, 97, 112, 32, 118, 115, 32, 100, 105, 102, 102, 117, 115, 101, 77, 97, 112, 32, 101, 116, 99, 44, 10, 32, 32, 32, 32, 102, 108,
-111, 97, 116, 32, 116, 95, 100, 101, 108, 116, 97, 32, 61, 32, 115, 95, 100, 101, 108, 116, 97, 59, 10, 32, 32, 32, 32, 102, 108, 111, 97, 116,
-32, 116, 95, 98, 111, 116, 116, 111, 109, 32, 61, 32, 109, 97, 120, 40, 118, 115, 103, 95, 84, 101, 120, 67, 111, 111, 114, 100, 48, 46, 116, 32,
-45, 32, 116, 95, 100, 101, 108, 116, 97, 44, 32, 48, 46, 48, 41, 59, 10, 32, 32, 32, 32, 102, 108, 111, 97, 116, 32, 116, 95, 116, 111, 112,
-32, 61, 32, 109, 105, 110, 40, 118, 115, 103, 95, 84, 101, 120, 67, 111, 111, 114, 100, 48, 46, 116, 32, 43, 32, 116, 95, 100, 101, 108, 116, 97,
-44, 32, 49, 46, 48, 41, 59, 10, 32, 32, 32, 32, 102, 108, 111, 97, 116, 32, 115, 95, 99, 101, 110, 116, 101, 114, 32, 61, 32, 118, 115, 103,
-95, 84, 101, 120, 67, 111, 111, 114, 100, 48, 46, 115, 59, 10, 32, 32, 32, 32, 102, 108, 111, 97, 116, 32, 100, 101, 108, 116, 97, 95, 98, 111,
-116, 116, 111, 109, 95, 116, 111, 112, 32, 61, 32, 40, 116, 95, 116, 111, 112, 32, 45, 32, 116, 95, 98, 111, 116, 116, 111, 109, 41, 32, 42, 32,
-115, 99, 97, 108, 101, 46, 121, 59, 10, 32, 32, 32, 32, 102, 108, 111, 97, 116, 32, 100, 122, 95, 98, 111, 116, 116, 111, 109, 95, 116, 111, 112,
-32, 61, 32, 40, 116, 101, 120, 116, 117, 114, 101, 40, 100, 105, 115, 112, 108, 97, 99, 101, 109, 101, 110, 116, 77, 97, 112, 44, 32, 118, 101, 99,
-50, 40, 115, 95, 99, 101, 110, 116, 101, 114, 44, 32, 116, 95, 116, 111, 112, 41, 41, 46, 115, 32, 45, 32, 116, 101, 120, 116, 117, 114, 101, 40,
-100, 105, 115, 112, 108, 97, 99, 101, 109, 101, 110, 116, 77, 97, 112, 44, 32, 118, 101, 99, 50, 40, 115, 95, 99, 101, 110, 116, 101, 114, 44, 32,
-116, 95, 98, 111, 116, 116, 111, 109, 41, 41, 46, 115, 41, 32, 42, 32, 115, 99, 97, 108, 101, 46, 122, 59, 10, 10, 32, 32, 32, 32, 118, 101,
-99, 51, 32, 100, 120, 32, 61, 32, 110, 111, 114, 109, 97, 108, 105, 122, 101, 40, 118, 101, 99, 51, 40, 100, 101, 108, 116, 97, 95, 108, 101, 102,
-116, 95, 114, 105, 103, 104, 116, 44, 32, 48, 46, 48, 44, 32, 100, 122, 95, 108, 101, 102, 116, 95, 114, 105, 103, 104, 116, 41, 41, 59, 10, 32,
-32, 32, 32, 118, 101, 99, 51, 32, 100, 121, 32, 61, 32, 110, 111, 114, 109, 97, 108, 105, 122, 101, 40, 118, 101, 99, 51, 40, 48, 46, 48, 44,
-32, 100, 101, 108, 116, 97, 95, 98, 111, 116, 116, 111, 109, 95, 116, 111, 112, 44, 32, 45, 100, 122, 95, 98, 111, 116, 116, 111, 109, 95, 116, 111,
-112, 41, 41, 59, 10, 32, 32, 32, 32, 118, 101, 99, 51, 32, 100, 122, 32, 61, 32, 110, 111, 114, 109, 97, 108, 105, 122, 101, 40, 99, 114, 111,
-115, 115, 40, 100, 120, 44, 32, 100, 121, 41, 41, 59, 10, 10, 32, 32, 32, 32, 110, 111, 114, 109, 97, 108, 46, 120, 121, 122, 32, 61, 32, 110,
-111, 114, 109, 97, 108, 105, 122, 101, 40, 100, 120, 32, 42, 32, 118, 115, 103, 95, 78, 111, 114, 109, 97, 108, 46, 120, 32, 43, 32, 100, 121, 32,
-42, 32, 118, 115, 103, 95, 78, 111, 114, 109, 97, 108, 46, 121, 32, 43, 32, 100, 122, 32, 42, 32, 118, 115, 103, 95, 78, 111, 114, 109, 97, 108,
-46, 122, 41, 59, 10, 35, 101, 110, 100, 105, 102, 10, 10, 35, 105, 102, 100, 101, 102, 32, 86, 83, 71, 95, 73, 78, 83, 84, 65, 78, 67, 69,
-95, 80, 79, 83, 73, 84, 73, 79, 78, 83, 10, 32, 32, 32, 32, 118, 101, 114, 116, 101, 120, 46, 120, 121, 122, 32, 61, 32, 118, 101, 114, 116,
-101, 120, 46, 120, 121, 122, 32, 43, 32, 118, 115, 103, 95, 112, 111, 115, 105, 116, 105, 111, 110, 59, 10, 35, 101, 110, 100, 105, 102, 10, 10, 35,
-105, 102, 100, 101, 102, 32, 86, 83, 71, 95, 66, 73, 76, 76, 66, 79, 65, 82, 68, 10, 32, 32, 32, 32, 109, 97, 116, 52, 32, 109, 118, 32,
-61, 32, 99, 111, 109, 112, 117, 116, 101, 66, 105, 108, 108, 98, 111, 97, 100, 77, 97, 116, 114, 105, 120, 40, 112, 99, 46, 109, 111, 100, 101, 108,
-86, 105, 101, 119, 32, 42, 32, 118, 101, 99, 52, 40, 118, 115, 103, 95, 112, 111, 115, 105, 116, 105, 111, 110, 95, 115, 99, 97, 108, 101, 68, 105,
-115, 116, 97, 110, 99, 101, 46, 120, 121, 122, 44, 32, 49, 46, 48, 41, 44, 32, 118, 115, 103, 95, 112, 111, 115, 105, 116, 105, 111, 110, 95, 115,
-99, 97, 108, 101, 68, 105, 115, 116, 97, 110, 99, 101, 46, 119, 41, 59, 10, 35, 101, 108, 105, 102, 32, 100, 101, 102, 105, 110, 101, 100, 40, 86,
-83, 71, 95, 83, 75, 73, 78, 78, 73, 78, 71, 41, 10, 32, 32, 32, 32, 47, 47, 32, 67, 97, 108, 99, 117, 108, 97, 116, 101, 32, 115, 107,
-105, 110, 110, 101, 100, 32, 109, 97, 116, 114, 105, 120, 32, 102, 114, 111, 109, 32, 119, 101, 105, 103, 104, 116, 115, 32, 97, 110, 100, 32, 106, 111,
-105, 110, 116, 32, 105, 110, 100, 105, 99, 101, 115, 32, 111, 102, 32, 116, 104, 101, 32, 99, 117, 114, 114, 101, 110, 116, 32, 118, 101, 114, 116, 101,
-120, 10, 32, 32, 32, 32, 109, 97, 116, 52, 32, 115, 107, 105, 110, 77, 97, 116, 32, 61, 10, 32, 32, 32, 32, 32, 32, 32, 32, 118, 115, 103,
-95, 74, 111, 105, 110, 116, 87, 101, 105, 103, 104, 116, 115, 46, 120, 32, 42, 32, 106, 111, 105, 110, 116, 46, 109, 97, 116, 114, 105, 99, 101, 115,
-91, 118, 115, 103, 95, 74, 111, 105, 110, 116, 73, 110, 100, 105, 99, 101, 115, 46, 120, 93, 32, 43, 10, 32, 32, 32, 32, 32, 32, 32, 32, 118,
-115, 103, 95, 74, 111, 105, 110, 116, 87, 101, 105, 103, 104, 116, 115, 46, 121, 32, 42, 32, 106, 111, 105, 110, 116, 46, 109, 97, 116, 114, 105, 99,
-101, 115, 91, 118, 115, 103, 95, 74, 111, 105, 110, 116, 73, 110, 100, 105, 99, 101, 115, 46, 121, 93, 32, 43, 10, 32, 32, 32, 32, 32, 32, 32,
-32, 118, 115, 103, 95, 74, 111, 105, 110, 116, 87, 101, 105, 103, 104, 116, 115, 46, 122, 32, 42, 32, 106, 111, 105, 110, 116, 46, 109, 97, 116, 114,
-105, 99, 101, 115, 91, 118, 115, 103, 95, 74, 111, 105, 110, 116, 73, 110, 100, 105, 99, 101, 115, 46, 122, 93, 32, 43, 10, 32, 32, 32, 32, 32,
-32, 32, 32, 118, 115, 103, 95, 74, 111, 105, 110, 116, 87, 101, 105, 103, 104, 116, 115, 46, 119, 32, 42, 32, 106, 111, 105, 110, 116, 46, 109, 97,
-116, 114, 105, 99, 101, 115, 91, 118, 115, 103, 95, 74, 111, 105, 110, 116, 73, 110, 100, 105, 99, 101, 115, 46, 119, 93, 59, 10, 10, 32, 32, 32,
-32, 109, 97, 116, 52, 32, 109, 118, 32, 61, 32, 112, 99, 46, 109, 111, 100, 101, 108, 86, 105, 101, 119, 32, 42, 32, 115, 107, 105, 110, 77, 97,
-116, 59, 10, 35, 101, 108, 115, 101, 10, 32, 32, 32, 32, 109, 97, 116, 52, 32, 109, 118, 32, 61, 32, 112, 99, 46, 109, 111, 100, 101, 108, 86,
-105, 101, 119, 59, 10, 35, 101, 110, 100, 105, 102, 10, 10, 32, 32, 32, 32, 103, 108, 95, 80, 111, 115, 105, 116, 105, 111, 110, 32, 61, 32, 40,
-112, 99, 46, 112, 114, 111, 106, 101, 99, 116, 105, 111, 110, 32, 42, 32, 109, 118, 41, 32, 42, 32, 118, 101, 114, 116, 101, 120, 59, 10, 32, 32,
-32, 32, 101, 121, 101, 80, 111, 115, 32, 61, 32, 40, 109, 118, 32, 42, 32, 118, 101, 114, 116, 101, 120, 41, 46, 120, 121, 122, 59, 10, 32, 32,
-32, 32, 118, 105, 101, 119, 68, 105, 114, 32, 61, 32, 45, 32, 40, 109, 118, 32, 42, 32, 118, 101, 114, 116, 101, 120, 41, 46, 120, 121, 122, 59,
-10, 32, 32, 32, 32, 110, 111, 114, 109, 97, 108, 68, 105, 114, 32, 61, 32, 40, 109, 118, 32, 42, 32, 110, 111, 114, 109, 97, 108, 41, 46, 120,
-121, 122, 59, 10, 10, 32, 32, 32, 32, 118, 101, 114, 116, 101, 120, 67, 111, 108, 111, 114, 32, 61, 32, 118, 115, 103, 95, 67, 111, 108, 111, 114,
-59, 10, 32, 32, 32, 32, 116, 101, 120, 67, 111, 111, 114, 100, 48, 32, 61, 32, 118, 115, 103, 95, 84, 101, 120, 67, 111, 111, 114, 100, 48, 59,
-10, 125, 10, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 16, 0, 0, 0, 118, 115, 103, 58, 58, 83, 104, 97, 100, 101, 114, 83, 116,
-97, 103, 101, 0, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 16, 0, 0, 0, 4, 0, 0, 0, 109, 97, 105, 110, 5, 0, 0, 0, 17,
-0, 0, 0, 118, 115, 103, 58, 58, 83, 104, 97, 100, 101, 114, 77, 111, 100, 117, 108, 101, 0, 0, 0, 0, 0, 0, 0, 0, 16, 5, 0, 0,
-35, 118, 101, 114, 115, 105, 111, 110, 32, 52, 53, 48, 10, 35, 101, 120, 116, 101, 110, 115, 105, 111, 110, 32, 71, 76, 95, 65, 82, 66, 95, 115,
-101, 112, 97, 114, 97, 116, 101, 95, 115, 104, 97, 100, 101, 114, 95, 111, 98, 106, 101, 99, 116, 115, 32, 58, 32, 101, 110, 97, 98, 108, 101, 10,
-35, 112, 114, 97, 103, 109, 97, 32, 105, 109, 112, 111, 114, 116, 95, 100, 101, 102, 105, 110, 101, 115, 32, 40, 86, 83, 71, 95, 80, 79, 73, 78,
-84, 95, 83, 80, 82, 73, 84, 69, 44, 32, 86, 83, 71, 95, 68, 73, 70, 70, 85, 83, 69, 95, 77, 65, 80, 44, 32, 86, 83, 71, 95, 71,
-82, 69, 89, 83, 67, 65, 76, 69, 95, 68, 73, 70, 70, 85, 83, 69, 95, 77, 65, 80, 44, 32, 86, 83, 71, 95, 65, 76, 80, 72, 65, 95,
-84, 69, 83, 84, 41, 10, 10, 35, 100, 101, 102, 105, 110, 101, 32, 86, 73, 69, 87, 95, 68, 69, 83, 67, 82, 73, 80, 84, 79, 82, 95, 83,
-69, 84, 32, 48, 10, 35, 100, 101, 102, 105, 110, 101, 32, 77, 65, 84, 69, 82, 73, 65, 76, 95, 68, 69, 83, 67, 82, 73, 80, 84, 79, 82,
-95, 83, 69, 84, 32, 49, 10, 10, 35, 105, 102, 100, 101, 102, 32, 86, 83, 71, 95, 68, 73, 70, 70, 85, 83, 69, 95, 77, 65, 80, 10, 108,
-97, 121, 111, 117, 116, 40, 115, 101, 116, 32, 61, 32, 77, 65, 84, 69, 82, 73, 65, 76, 95, 68, 69, 83, 67, 82, 73, 80, 84, 79, 82, 95,
-83, 69, 84, 44, 32, 98, 105, 110, 100, 105, 110, 103, 32, 61, 32, 48, 41, 32, 117, 110, 105, 102, 111, 114, 109, 32, 115, 97, 109, 112, 108, 101,
-114, 50, 68, 32, 100, 105, 102, 102, 117, 115, 101, 77, 97, 112, 59, 10, 35, 101, 110, 100, 105, 102, 10, 10, 108, 97, 121, 111, 117, 116, 40, 115,
-101, 116, 32, 61, 32, 77, 65, 84, 69, 82, 73, 65, 76, 95, 68, 69, 83, 67, 82, 73, 80, 84, 79, 82, 95, 83, 69, 84, 44, 32, 98, 105,
-110, 100, 105, 110, 103, 32, 61, 32, 49, 48, 41, 32, 117, 110, 105, 102, 111, 114, 109, 32, 77, 97, 116, 101, 114, 105, 97, 108, 68, 97, 116, 97,
-10, 123, 10, 32, 32, 32, 32, 118, 101, 99, 52, 32, 97, 109, 98, 105, 101, 110, 116, 67, 111, 108, 111, 114, 59, 10, 32, 32, 32, 32, 118, 101,
-99, 52, 32, 100, 105, 102, 102, 117, 115, 101, 67, 111, 108, 111, 114, 59, 10, 32, 32, 32, 32, 118, 101, 99, 52, 32, 115, 112, 101, 99, 117, 108,
-97, 114, 67, 111, 108, 111, 114, 59, 10, 32, 32, 32, 32, 118, 101, 99, 52, 32, 101, 109, 105, 115, 115, 105, 118, 101, 67, 111, 108, 111, 114, 59,
-10, 32, 32, 32, 32, 102, 108, 111, 97, 116, 32, 115, 104, 105, 110, 105, 110, 101, 115, 115, 59, 10, 32, 32, 32, 32, 102, 108, 111, 97, 116, 32,
-97, 108, 112, 104, 97, 77, 97, 115, 107, 59, 10, 32, 32, 32, 32, 102, 108, 111, 97, 116, 32, 97, 108, 112, 104, 97, 77, 97, 115, 107, 67, 117,
-116, 111, 102, 102, 59, 10, 125, 32, 109, 97, 116, 101, 114, 105, 97, 108, 59, 10, 10, 108, 97, 121, 111, 117, 116, 40, 108, 111, 99, 97, 116, 105,
-111, 110, 32, 61, 32, 50, 41, 32, 105, 110, 32, 118, 101, 99, 52, 32, 118, 101, 114, 116, 101, 120, 67, 111, 108, 111, 114, 59, 10, 35, 105, 102,
-110, 100, 101, 102, 32, 86, 83, 71, 95, 80, 79, 73, 78, 84, 95, 83, 80, 82, 73, 84, 69, 10, 108, 97, 121, 111, 117, 116, 40, 108, 111, 99,
-97, 116, 105, 111, 110, 32, 61, 32, 51, 41, 32, 105, 110, 32, 118, 101, 99, 50, 32, 116, 101, 120, 67, 111, 111, 114, 100, 48, 59, 10, 35, 101,
-110, 100, 105, 102, 10, 10, 108, 97, 121, 111, 117, 116, 40, 108, 111, 99, 97, 116, 105, 111, 110, 32, 61, 32, 48, 41, 32, 111, 117, 116, 32, 118,
-101, 99, 52, 32, 111, 117, 116, 67, 111, 108, 111, 114, 59, 10, 10, 118, 111, 105, 100, 32, 109, 97, 105, 110, 40, 41, 10, 123, 10, 35, 105, 102,
-100, 101, 102, 32, 86, 83, 71, 95, 80, 79, 73, 78, 84, 95, 83, 80, 82, 73, 84, 69, 10, 32, 32, 32, 32, 118, 101, 99, 50, 32, 116, 101,
-120, 67, 111, 111, 114, 100, 48, 32, 61, 32, 103, 108, 95, 80, 111, 105, 110, 116, 67, 111, 111, 114, 100, 46, 120, 121, 59, 10, 35, 101, 110, 100,
-105, 102, 10, 10, 32, 32, 32, 32, 118, 101, 99, 52, 32, 100, 105, 102, 102, 117, 115, 101, 67, 111, 108, 111, 114, 32, 61, 32, 118, 101, 114, 116,
-101, 120, 67, 111, 108, 111, 114, 32, 42, 32, 109, 97, 116, 101, 114, 105, 97, 108, 46, 100, 105, 102, 102, 117, 115, 101, 67, 111, 108, 111, 114, 59,
-10, 10, 35, 105, 102, 100, 101, 102, 32, 86, 83, 71, 95, 68, 73, 70, 70, 85, 83, 69, 95, 77, 65, 80, 10, 32, 32, 32, 32, 35, 105, 102,
-100, 101, 102, 32, 86, 83, 71, 95, 71, 82, 69, 89, 83, 67, 65, 76, 69, 95, 68, 73, 70, 70, 85, 83, 69, 95, 77, 65, 80, 10, 32, 32,
-32, 32, 32, 32, 32, 32, 102, 108, 111, 97, 116, 32, 118, 32, 61, 32, 116, 101, 120, 116, 117, 114, 101, 40, 100, 105, 102, 102, 117, 115, 101, 77,
-97, 112, 44, 32, 116, 101, 120, 67, 111, 111, 114, 100, 48, 46, 115, 116, 41, 46, 115, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 100, 105, 102,
-102, 117, 115, 101, 67, 111, 108, 111, 114, 32, 42, 61, 32, 118, 101, 99, 52, 40, 118, 44, 32, 118, 44, 32, 118, 44, 32, 49, 46, 48, 41, 59,
-10, 32, 32, 32, 32, 35, 101, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 32, 32, 100, 105, 102, 102, 117, 115, 101, 67, 111, 108, 111, 114, 32,
-42, 61, 32, 116, 101, 120, 116, 117, 114, 101, 40, 100, 105, 102, 102, 117, 115, 101, 77, 97, 112, 44, 32, 116, 101, 120, 67, 111, 111, 114, 100, 48,
-46, 115, 116, 41, 59, 10, 32, 32, 32, 32, 35, 101, 110, 100, 105, 102, 10, 35, 101, 110, 100, 105, 102, 10, 10, 35, 105, 102, 100, 101, 102, 32,
-86, 83, 71, 95, 65, 76, 80, 72, 65, 95, 84, 69, 83, 84, 10, 32, 32, 32, 32, 105, 102, 32, 40, 109, 97, 116, 101, 114, 105, 97, 108, 46,
-97, 108, 112, 104, 97, 77, 97, 115, 107, 32, 61, 61, 32, 49, 46, 48, 102, 32, 38, 38, 32, 100, 105, 102, 102, 117, 115, 101, 67, 111, 108, 111,
-114, 46, 97, 32, 60, 32, 109, 97, 116, 101, 114, 105, 97, 108, 46, 97, 108, 112, 104, 97, 77, 97, 115, 107, 67, 117, 116, 111, 102, 102, 41, 32,
-100, 105, 115, 99, 97, 114, 100, 59, 10, 35, 101, 110, 100, 105, 102, 10, 10, 32, 32, 32, 32, 111, 117, 116, 67, 111, 108, 111, 114, 32, 61, 32,
-100, 105, 102, 102, 117, 115, 101, 67, 111, 108, 111, 114, 59, 10, 125, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 0,
-10, 0, 0, 0, 118, 115, 103, 95, 86, 101, 114, 116, 101, 120, 0, 0, 0, 0, 0, 0, 0, 0, 106, 0, 0, 0, 6, 0, 0, 0, 14, 0,
-0, 0, 118, 115, 103, 58, 58, 118, 101, 99, 51, 65, 114, 114, 97, 121, 0, 0, 0, 0, 0, 0, 0, 0, 12, 0, 0, 0, 0, 1, 1, 1,
-0, 255, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 0, 0, 0, 118, 115, 103, 95, 78,
-111, 114, 109, 97, 108, 0, 0, 0, 0, 1, 0, 0, 0, 106, 0, 0, 0, 7, 0, 0, 0, 14, 0, 0, 0, 118, 115, 103, 58, 58, 118, 101,
-99, 51, 65, 114, 114, 97, 121, 0, 0, 0, 0, 0, 0, 0, 0, 12, 0, 0, 0, 0, 1, 1, 1, 0, 255, 0, 1, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 118, 115, 103, 95, 84, 101, 120, 67, 111, 111, 114, 100, 48, 0,
-0, 0, 0, 2, 0, 0, 0, 103, 0, 0, 0, 8, 0, 0, 0, 14, 0, 0, 0, 118, 115, 103, 58, 58, 118, 101, 99, 50, 65, 114, 114, 97,
-121, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 0, 1, 1, 1, 0, 255, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 9, 0, 0, 0, 118, 115, 103, 95, 67, 111, 108, 111, 114, 0, 0, 0, 0, 3, 0, 0, 0, 109, 0, 0, 0, 9, 0, 0,
-0, 14, 0, 0, 0, 118, 115, 103, 58, 58, 118, 101, 99, 52, 65, 114, 114, 97, 121, 0, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0,
-1, 1, 1, 0, 255, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 0,
-0, 0, 118, 115, 103, 95, 112, 111, 115, 105, 116, 105, 111, 110, 22, 0, 0, 0, 86, 83, 71, 95, 73, 78, 83, 84, 65, 78, 67, 69, 95, 80,
-79, 83, 73, 84, 73, 79, 78, 83, 4, 0, 0, 0, 106, 0, 0, 0, 10, 0, 0, 0, 14, 0, 0, 0, 118, 115, 103, 58, 58, 118, 101, 99,
-51, 65, 114, 114, 97, 121, 0, 0, 0, 0, 0, 0, 0, 0, 12, 0, 0, 0, 0, 1, 1, 1, 0, 255, 0, 1, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 0, 0, 0, 118, 115, 103, 95, 112, 111, 115, 105, 116, 105, 111, 110, 95, 115, 99,
-97, 108, 101, 68, 105, 115, 116, 97, 110, 99, 101, 13, 0, 0, 0, 86, 83, 71, 95, 66, 73, 76, 76, 66, 79, 65, 82, 68, 4, 0, 0, 0,
-109, 0, 0, 0, 11, 0, 0, 0, 14, 0, 0, 0, 118, 115, 103, 58, 58, 118, 101, 99, 52, 65, 114, 114, 97, 121, 0, 0, 0, 0, 0, 0,
-0, 0, 16, 0, 0, 0, 0, 1, 1, 1, 0, 255, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 16, 0, 0, 0, 118, 115, 103, 95, 74, 111, 105, 110, 116, 73, 110, 100, 105, 99, 101, 115, 12, 0, 0, 0, 86, 83, 71,
-95, 83, 75, 73, 78, 78, 73, 78, 71, 5, 0, 0, 0, 108, 0, 0, 0, 12, 0, 0, 0, 15, 0, 0, 0, 118, 115, 103, 58, 58, 105, 118,
+71, 44, 32, 86, 83, 71, 95, 84, 82, 65, 78, 83, 70, 79, 82, 77, 95, 68, 65, 84, 65, 41, 10, 10, 35, 100, 101, 102, 105, 110, 101, 32,
+86, 73, 69, 87, 95, 68, 69, 83, 67, 82, 73, 80, 84, 79, 82, 95, 83, 69, 84, 32, 48, 10, 35, 100, 101, 102, 105, 110, 101, 32, 77, 65,
+84, 69, 82, 73, 65, 76, 95, 68, 69, 83, 67, 82, 73, 80, 84, 79, 82, 95, 83, 69, 84, 32, 49, 10, 10, 35, 105, 102, 100, 101, 102, 32,
+86, 83, 71, 95, 84, 82, 65, 78, 83, 70, 79, 82, 77, 95, 68, 65, 84, 65, 10, 108, 97, 121, 111, 117, 116, 40, 112, 117, 115, 104, 95, 99,
+111, 110, 115, 116, 97, 110, 116, 41, 32, 117, 110, 105, 102, 111, 114, 109, 32, 80, 117, 115, 104, 67, 111, 110, 115, 116, 97, 110, 116, 115, 32, 123,
+10, 32, 32, 32, 32, 109, 97, 116, 52, 32, 112, 114, 111, 106, 101, 99, 116, 105, 111, 110, 59, 10, 32, 32, 32, 32, 117, 105, 110, 116, 32, 116,
+114, 97, 110, 115, 102, 111, 114, 109, 73, 110, 100, 101, 120, 59, 10, 125, 32, 112, 99, 59, 10, 10, 108, 97, 121, 111, 117, 116, 40, 115, 101, 116,
+32, 61, 32, 86, 73, 69, 87, 95, 68, 69, 83, 67, 82, 73, 80, 84, 79, 82, 95, 83, 69, 84, 44, 32, 98, 105, 110, 100, 105, 110, 103, 32,
+61, 32, 53, 41, 32, 114, 101, 97, 100, 111, 110, 108, 121, 32, 98, 117, 102, 102, 101, 114, 32, 84, 114, 97, 110, 115, 102, 111, 114, 109, 68, 97,
+116, 97, 10, 123, 10, 32, 32, 32, 32, 109, 97, 116, 52, 32, 109, 97, 116, 114, 105, 99, 101, 115, 91, 93, 59, 10, 125, 32, 116, 114, 97, 110,
+115, 102, 111, 114, 109, 68, 97, 116, 97, 59, 10, 35, 101, 108, 115, 101, 10, 108, 97, 121, 111, 117, 116, 40, 112, 117, 115, 104, 95, 99, 111, 110,
+115, 116, 97, 110, 116, 41, 32, 117, 110, 105, 102, 111, 114, 109, 32, 80, 117, 115, 104, 67, 111, 110, 115, 116, 97, 110, 116, 115, 32, 123, 10, 32,
+32, 32, 32, 109, 97, 116, 52, 32, 112, 114, 111, 106, 101, 99, 116, 105, 111, 110, 59, 10, 32, 32, 32, 32, 109, 97, 116, 52, 32, 109, 111, 100,
+101, 108, 86, 105, 101, 119, 59, 10, 125, 32, 112, 99, 59, 10, 35, 101, 110, 100, 105, 102, 10, 10, 35, 105, 102, 100, 101, 102, 32, 86, 83, 71,
+95, 68, 73, 83, 80, 76, 65, 67, 69, 77, 69, 78, 84, 95, 77, 65, 80, 10, 108, 97, 121, 111, 117, 116, 40, 115, 101, 116, 32, 61, 32, 77,
+65, 84, 69, 82, 73, 65, 76, 95, 68, 69, 83, 67, 82, 73, 80, 84, 79, 82, 95, 83, 69, 84, 44, 32, 98, 105, 110, 100, 105, 110, 103, 32,
+61, 32, 54, 41, 32, 117, 110, 105, 102, 111, 114, 109, 32, 115, 97, 109, 112, 108, 101, 114, 50, 68, 32, 100, 105, 115, 112, 108, 97, 99, 101, 109,
+101, 110, 116, 77, 97, 112, 59, 10, 35, 101, 110, 100, 105, 102, 10, 10, 108, 97, 121, 111, 117, 116, 40, 108, 111, 99, 97, 116, 105, 111, 110, 32,
+61, 32, 48, 41, 32, 105, 110, 32, 118, 101, 99, 51, 32, 118, 115, 103, 95, 86, 101, 114, 116, 101, 120, 59, 10, 108, 97, 121, 111, 117, 116, 40,
+108, 111, 99, 97, 116, 105, 111, 110, 32, 61, 32, 49, 41, 32, 105, 110, 32, 118, 101, 99, 51, 32, 118, 115, 103, 95, 78, 111, 114, 109, 97, 108,
+59, 10, 108, 97, 121, 111, 117, 116, 40, 108, 111, 99, 97, 116, 105, 111, 110, 32, 61, 32, 50, 41, 32, 105, 110, 32, 118, 101, 99, 50, 32, 118,
+115, 103, 95, 84, 101, 120, 67, 111, 111, 114, 100, 48, 59, 10, 108, 97, 121, 111, 117, 116, 40, 108, 111, 99, 97, 116, 105, 111, 110, 32, 61, 32,
+51, 41, 32, 105, 110, 32, 118, 101, 99, 52, 32, 118, 115, 103, 95, 67, 111, 108, 111, 114, 59, 10, 10, 10, 35, 105, 102, 100, 101, 102, 32, 86,
+83, 71, 95, 66, 73, 76, 76, 66, 79, 65, 82, 68, 10, 108, 97, 121, 111, 117, 116, 40, 108, 111, 99, 97, 116, 105, 111, 110, 32, 61, 32, 52,
+41, 32, 105, 110, 32, 118, 101, 99, 52, 32, 118, 115, 103, 95, 112, 111, 115, 105, 116, 105, 111, 110, 95, 115, 99, 97, 108, 101, 68, 105, 115, 116,
+97, 110, 99, 101, 59, 10, 35, 101, 108, 105, 102, 32, 100, 101, 102, 105, 110, 101, 100, 40, 86, 83, 71, 95, 73, 78, 83, 84, 65, 78, 67, 69,
+95, 80, 79, 83, 73, 84, 73, 79, 78, 83, 41, 10, 108, 97, 121, 111, 117, 116, 40, 108, 111, 99, 97, 116, 105, 111, 110, 32, 61, 32, 52, 41,
+32, 105, 110, 32, 118, 101, 99, 51, 32, 118, 115, 103, 95, 112, 111, 115, 105, 116, 105, 111, 110, 59, 10, 35, 101, 110, 100, 105, 102, 10, 10, 35,
+105, 102, 100, 101, 102, 32, 86, 83, 71, 95, 83, 75, 73, 78, 78, 73, 78, 71, 10, 108, 97, 121, 111, 117, 116, 40, 108, 111, 99, 97, 116, 105,
+111, 110, 32, 61, 32, 53, 41, 32, 105, 110, 32, 105, 118, 101, 99, 52, 32, 118, 115, 103, 95, 74, 111, 105, 110, 116, 73, 110, 100, 105, 99, 101,
+115, 59, 10, 108, 97, 121, 111, 117, 116, 40, 108, 111, 99, 97, 116, 105, 111, 110, 32, 61, 32, 54, 41, 32, 105, 110, 32, 118, 101, 99, 52, 32,
+118, 115, 103, 95, 74, 111, 105, 110, 116, 87, 101, 105, 103, 104, 116, 115, 59, 10, 10, 108, 97, 121, 111, 117, 116, 40, 115, 101, 116, 32, 61, 32,
+77, 65, 84, 69, 82, 73, 65, 76, 95, 68, 69, 83, 67, 82, 73, 80, 84, 79, 82, 95, 83, 69, 84, 44, 32, 98, 105, 110, 100, 105, 110, 103,
+32, 61, 32, 49, 49, 41, 32, 98, 117, 102, 102, 101, 114, 32, 74, 111, 105, 110, 116, 77, 97, 116, 114, 105, 99, 101, 115, 10, 123, 10, 9, 109,
+97, 116, 52, 32, 109, 97, 116, 114, 105, 99, 101, 115, 91, 93, 59, 10, 125, 32, 106, 111, 105, 110, 116, 59, 10, 35, 101, 110, 100, 105, 102, 10,
+10, 108, 97, 121, 111, 117, 116, 40, 108, 111, 99, 97, 116, 105, 111, 110, 32, 61, 32, 48, 41, 32, 111, 117, 116, 32, 118, 101, 99, 51, 32, 101,
+121, 101, 80, 111, 115, 59, 10, 108, 97, 121, 111, 117, 116, 40, 108, 111, 99, 97, 116, 105, 111, 110, 32, 61, 32, 49, 41, 32, 111, 117, 116, 32,
+118, 101, 99, 51, 32, 110, 111, 114, 109, 97, 108, 68, 105, 114, 59, 10, 108, 97, 121, 111, 117, 116, 40, 108, 111, 99, 97, 116, 105, 111, 110, 32,
+61, 32, 50, 41, 32, 111, 117, 116, 32, 118, 101, 99, 52, 32, 118, 101, 114, 116, 101, 120, 67, 111, 108, 111, 114, 59, 10, 108, 97, 121, 111, 117,
+116, 40, 108, 111, 99, 97, 116, 105, 111, 110, 32, 61, 32, 51, 41, 32, 111, 117, 116, 32, 118, 101, 99, 50, 32, 116, 101, 120, 67, 111, 111, 114,
+100, 48, 59, 10, 10, 108, 97, 121, 111, 117, 116, 40, 108, 111, 99, 97, 116, 105, 111, 110, 32, 61, 32, 53, 41, 32, 111, 117, 116, 32, 118, 101,
+99, 51, 32, 118, 105, 101, 119, 68, 105, 114, 59, 10, 10, 111, 117, 116, 32, 103, 108, 95, 80, 101, 114, 86, 101, 114, 116, 101, 120, 123, 32, 118,
+101, 99, 52, 32, 103, 108, 95, 80, 111, 115, 105, 116, 105, 111, 110, 59, 32, 125, 59, 10, 10, 35, 105, 102, 100, 101, 102, 32, 86, 83, 71, 95,
+66, 73, 76, 76, 66, 79, 65, 82, 68, 10, 109, 97, 116, 52, 32, 99, 111, 109, 112, 117, 116, 101, 66, 105, 108, 108, 98, 111, 97, 100, 77, 97,
+116, 114, 105, 120, 40, 118, 101, 99, 52, 32, 99, 101, 110, 116, 101, 114, 95, 101, 121, 101, 44, 32, 102, 108, 111, 97, 116, 32, 97, 117, 116, 111,
+83, 99, 97, 108, 101, 68, 105, 115, 116, 97, 110, 99, 101, 41, 10, 123, 10, 32, 32, 32, 32, 102, 108, 111, 97, 116, 32, 100, 105, 115, 116, 97,
+110, 99, 101, 32, 61, 32, 45, 99, 101, 110, 116, 101, 114, 95, 101, 121, 101, 46, 122, 59, 10, 10, 32, 32, 32, 32, 102, 108, 111, 97, 116, 32,
+115, 99, 97, 108, 101, 32, 61, 32, 40, 100, 105, 115, 116, 97, 110, 99, 101, 32, 60, 32, 97, 117, 116, 111, 83, 99, 97, 108, 101, 68, 105, 115,
+116, 97, 110, 99, 101, 41, 32, 63, 32, 100, 105, 115, 116, 97, 110, 99, 101, 47, 97, 117, 116, 111, 83, 99, 97, 108, 101, 68, 105, 115, 116, 97,
+110, 99, 101, 32, 58, 32, 49, 46, 48, 59, 10, 32, 32, 32, 32, 109, 97, 116, 52, 32, 83, 32, 61, 32, 109, 97, 116, 52, 40, 115, 99, 97,
+108, 101, 44, 32, 48, 46, 48, 44, 32, 48, 46, 48, 44, 32, 48, 46, 48, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 48, 46, 48, 44, 32, 115, 99, 97, 108, 101, 44, 32, 48, 46, 48, 44, 32, 48, 46, 48, 44, 10, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 46, 48, 44, 32, 48, 46, 48, 44, 32, 115, 99, 97, 108, 101, 44, 32, 48, 46,
+48, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 46, 48, 44, 32, 48, 46, 48, 44, 32, 48,
+46, 48, 44, 32, 49, 46, 48, 41, 59, 10, 10, 32, 32, 32, 32, 109, 97, 116, 52, 32, 84, 32, 61, 32, 109, 97, 116, 52, 40, 49, 46, 48,
+44, 32, 48, 46, 48, 44, 32, 48, 46, 48, 44, 32, 48, 46, 48, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 48, 46, 48, 44, 32, 49, 46, 48, 44, 32, 48, 46, 48, 44, 32, 48, 46, 48, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 46, 48, 44, 32, 48, 46, 48, 44, 32, 49, 46, 48, 44, 32, 48, 46, 48, 44, 10, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 101, 110, 116, 101, 114, 95, 101, 121, 101, 46, 120, 44, 32, 99, 101, 110,
+116, 101, 114, 95, 101, 121, 101, 46, 121, 44, 32, 99, 101, 110, 116, 101, 114, 95, 101, 121, 101, 46, 122, 44, 32, 49, 46, 48, 41, 59, 10, 32,
+32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 84, 42, 83, 59, 10, 125, 10, 35, 101, 110, 100, 105, 102, 10, 10, 118, 111, 105, 100, 32, 109, 97,
+105, 110, 40, 41, 10, 123, 10, 35, 105, 102, 100, 101, 102, 32, 86, 83, 71, 95, 84, 82, 65, 78, 83, 70, 79, 82, 77, 95, 68, 65, 84, 65,
+10, 32, 32, 32, 32, 109, 97, 116, 52, 32, 109, 111, 100, 101, 108, 86, 105, 101, 119, 32, 61, 32, 116, 114, 97, 110, 115, 102, 111, 114, 109, 68,
+97, 116, 97, 46, 109, 97, 116, 114, 105, 99, 101, 115, 91, 112, 99, 46, 116, 114, 97, 110, 115, 102, 111, 114, 109, 73, 110, 100, 101, 120, 93, 59,
+10, 35, 101, 108, 115, 101, 10, 32, 32, 32, 32, 109, 97, 116, 52, 32, 109, 111, 100, 101, 108, 86, 105, 101, 119, 32, 61, 32, 112, 99, 46, 109,
+111, 100, 101, 108, 86, 105, 101, 119, 59, 10, 35, 101, 110, 100, 105, 102, 10, 10, 32, 32, 32, 32, 118, 101, 99, 52, 32, 118, 101, 114, 116, 101,
+120, 32, 61, 32, 118, 101, 99, 52, 40, 118, 115, 103, 95, 86, 101, 114, 116, 101, 120, 44, 32, 49, 46, 48, 41, 59, 10, 32, 32, 32, 32, 118,
+101, 99, 52, 32, 110, 111, 114, 109, 97, 108, 32, 61, 32, 118, 101, 99, 52, 40, 118, 115, 103, 95, 78, 111, 114, 109, 97, 108, 44, 32, 48, 46,
+48, 41, 59, 10, 10, 35, 105, 102, 100, 101, 102, 32, 86, 83, 71, 95, 68, 73, 83, 80, 76, 65, 67, 69, 77, 69, 78, 84, 95, 77, 65, 80,
+10, 32, 32, 32, 32, 47, 47, 32, 84, 79, 68, 79, 32, 110, 101, 101, 100, 32, 116, 111, 32, 112, 97, 115, 115, 32, 97, 115, 32, 97, 115, 32,
+117, 110, 105, 102, 111, 114, 109, 32, 111, 114, 32, 112, 101, 114, 32, 105, 110, 115, 116, 97, 110, 99, 101, 32, 97, 116, 116, 114, 105, 98, 117, 116,
+101, 115, 10, 32, 32, 32, 32, 118, 101, 99, 51, 32, 115, 99, 97, 108, 101, 32, 61, 32, 118, 101, 99, 51, 40, 49, 46, 48, 44, 32, 49, 46,
+48, 44, 32, 49, 46, 48, 41, 59, 10, 10, 32, 32, 32, 32, 118, 101, 114, 116, 101, 120, 46, 120, 121, 122, 32, 61, 32, 118, 101, 114, 116, 101,
+120, 46, 120, 121, 122, 32, 43, 32, 118, 115, 103, 95, 78, 111, 114, 109, 97, 108, 32, 42, 32, 40, 116, 101, 120, 116, 117, 114, 101, 40, 100, 105,
+115, 112, 108, 97, 99, 101, 109, 101, 110, 116, 77, 97, 112, 44, 32, 118, 115, 103, 95, 84, 101, 120, 67, 111, 111, 114, 100, 48, 46, 115, 116, 41,
+46, 115, 32, 42, 32, 115, 99, 97, 108, 101, 46, 122, 41, 59, 10, 10, 32, 32, 32, 32, 102, 108, 111, 97, 116, 32, 115, 95, 100, 101, 108, 116,
+97, 32, 61, 32, 48, 46, 48, 49, 59, 10, 32, 32, 32, 32, 102, 108, 111, 97, 116, 32, 119, 105, 100, 116, 104, 32, 61, 32, 48, 46, 48, 59,
+10, 10, 32, 32, 32, 32, 102, 108, 111, 97, 116, 32, 115, 95, 108, 101, 102, 116, 32, 61, 32, 109, 97, 120, 40, 118, 115, 103, 95, 84, 101, 120,
+67, 111, 111, 114, 100, 48, 46, 115, 32, 45, 32, 115, 95, 100, 101, 108, 116, 97, 44, 32, 48, 46, 48, 41, 59, 10, 32, 32, 32, 32, 102, 108,
+111, 97, 116, 32, 115, 95, 114, 105, 103, 104, 116, 32, 61, 32, 109, 105, 110, 40, 118, 115, 103, 95, 84, 101, 120, 67, 111, 111, 114, 100, 48, 46,
+115, 32, 43, 32, 115, 95, 100, 101, 108, 116, 97, 44, 32, 49, 46, 48, 41, 59, 10, 32, 32, 32, 32, 102, 108, 111, 97, 116, 32, 116, 95, 99,
+101, 110, 116, 101, 114, 32, 61, 32, 118, 115, 103, 95, 84, 101, 120, 67, 111, 111, 114, 100, 48, 46, 116, 59, 10, 32, 32, 32, 32, 102, 108, 111,
+97, 116, 32, 100, 101, 108, 116, 97, 95, 108, 101, 102, 116, 95, 114, 105, 103, 104, 116, 32, 61, 32, 40, 115, 95, 114, 105, 103, 104, 116, 32, 45,
+32, 115, 95, 108, 101, 102, 116, 41, 32, 42, 32, 115, 99, 97, 108, 101, 46, 120, 59, 10, 32, 32, 32, 32, 102, 108, 111, 97, 116, 32, 100, 122,
+95, 108, 101, 102, 116, 95, 114, 105, 103, 104, 116, 32, 61, 32, 40, 116, 101, 120, 116, 117, 114, 101, 40, 100, 105, 115, 112, 108, 97, 99, 101, 109,
+101, 110, 116, 77, 97, 112, 44, 32, 118, 101, 99, 50, 40, 115, 95, 114, 105, 103, 104, 116, 44, 32, 116, 95, 99, 101, 110, 116, 101, 114, 41, 41,
+46, 115, 32, 45, 32, 116, 101, 120, 116, 117, 114, 101, 40, 100, 105, 115, 112, 108, 97, 99, 101, 109, 101, 110, 116, 77, 97, 112, 44, 32, 118, 101,
+99, 50, 40, 115, 95, 108, 101, 102, 116, 44, 32, 116, 95, 99, 101, 110, 116, 101, 114, 41, 41, 46, 115, 41, 32, 42, 32, 115, 99, 97, 108, 101,
+46, 122, 59, 10, 10, 32, 32, 32, 32, 47, 47, 32, 84, 79, 68, 79, 32, 110, 101, 101, 100, 32, 116, 111, 32, 104, 97, 110, 100, 108, 101, 32,
+100, 105, 102, 102, 101, 114, 101, 110, 116, 32, 111, 114, 105, 103, 105, 110, 115, 32, 111, 102, 32, 100, 105, 115, 112, 108, 97, 99, 101, 109, 101, 110,
+116, 77, 97, 112, 32, 118, 115, 32, 100, 105, 102, 102, 117, 115, 101, 77, 97, 112, 32, 101, 116, 99, 44, 10, 32, 32, 32, 32, 102, 108, 111, 97,
+116, 32, 116, 95, 100, 101, 108, 116, 97, 32, 61, 32, 115, 95, 100, 101, 108, 116, 97, 59, 10, 32, 32, 32, 32, 102, 108, 111, 97, 116, 32, 116,
+95, 98, 111, 116, 116, 111, 109, 32, 61, 32, 109, 97, 120, 40, 118, 115, 103, 95, 84, 101, 120, 67, 111, 111, 114, 100, 48, 46, 116, 32, 45, 32,
+116, 95, 100, 101, 108, 116, 97, 44, 32, 48, 46, 48, 41, 59, 10, 32, 32, 32, 32, 102, 108, 111, 97, 116, 32, 116, 95, 116, 111, 112, 32, 61,
+32, 109, 105, 110, 40, 118, 115, 103, 95, 84, 101, 120, 67, 111, 111, 114, 100, 48, 46, 116, 32, 43, 32, 116, 95, 100, 101, 108, 116, 97, 44, 32,
+49, 46, 48, 41, 59, 10, 32, 32, 32, 32, 102, 108, 111, 97, 116, 32, 115, 95, 99, 101, 110, 116, 101, 114, 32, 61, 32, 118, 115, 103, 95, 84,
+101, 120, 67, 111, 111, 114, 100, 48, 46, 115, 59, 10, 32, 32, 32, 32, 102, 108, 111, 97, 116, 32, 100, 101, 108, 116, 97, 95, 98, 111, 116, 116,
+111, 109, 95, 116, 111, 112, 32, 61, 32, 40, 116, 95, 116, 111, 112, 32, 45, 32, 116, 95, 98, 111, 116, 116, 111, 109, 41, 32, 42, 32, 115, 99,
+97, 108, 101, 46, 121, 59, 10, 32, 32, 32, 32, 102, 108, 111, 97, 116, 32, 100, 122, 95, 98, 111, 116, 116, 111, 109, 95, 116, 111, 112, 32, 61,
+32, 40, 116, 101, 120, 116, 117, 114, 101, 40, 100, 105, 115, 112, 108, 97, 99, 101, 109, 101, 110, 116, 77, 97, 112, 44, 32, 118, 101, 99, 50, 40,
+115, 95, 99, 101, 110, 116, 101, 114, 44, 32, 116, 95, 116, 111, 112, 41, 41, 46, 115, 32, 45, 32, 116, 101, 120, 116, 117, 114, 101, 40, 100, 105,
+115, 112, 108, 97, 99, 101, 109, 101, 110, 116, 77, 97, 112, 44, 32, 118, 101, 99, 50, 40, 115, 95, 99, 101, 110, 116, 101, 114, 44, 32, 116, 95,
+98, 111, 116, 116, 111, 109, 41, 41, 46, 115, 41, 32, 42, 32, 115, 99, 97, 108, 101, 46, 122, 59, 10, 10, 32, 32, 32, 32, 118, 101, 99, 51,
+32, 100, 120, 32, 61, 32, 110, 111, 114, 109, 97, 108, 105, 122, 101, 40, 118, 101, 99, 51, 40, 100, 101, 108, 116, 97, 95, 108, 101, 102, 116, 95,
+114, 105, 103, 104, 116, 44, 32, 48, 46, 48, 44, 32, 100, 122, 95, 108, 101, 102, 116, 95, 114, 105, 103, 104, 116, 41, 41, 59, 10, 32, 32, 32,
+32, 118, 101, 99, 51, 32, 100, 121, 32, 61, 32, 110, 111, 114, 109, 97, 108, 105, 122, 101, 40, 118, 101, 99, 51, 40, 48, 46, 48, 44, 32, 100,
+101, 108, 116, 97, 95, 98, 111, 116, 116, 111, 109, 95, 116, 111, 112, 44, 32, 45, 100, 122, 95, 98, 111, 116, 116, 111, 109, 95, 116, 111, 112, 41,
+41, 59, 10, 32, 32, 32, 32, 118, 101, 99, 51, 32, 100, 122, 32, 61, 32, 110, 111, 114, 109, 97, 108, 105, 122, 101, 40, 99, 114, 111, 115, 115,
+40, 100, 120, 44, 32, 100, 121, 41, 41, 59, 10, 10, 32, 32, 32, 32, 110, 111, 114, 109, 97, 108, 46, 120, 121, 122, 32, 61, 32, 110, 111, 114,
+109, 97, 108, 105, 122, 101, 40, 100, 120, 32, 42, 32, 118, 115, 103, 95, 78, 111, 114, 109, 97, 108, 46, 120, 32, 43, 32, 100, 121, 32, 42, 32,
+118, 115, 103, 95, 78, 111, 114, 109, 97, 108, 46, 121, 32, 43, 32, 100, 122, 32, 42, 32, 118, 115, 103, 95, 78, 111, 114, 109, 97, 108, 46, 122,
+41, 59, 10, 35, 101, 110, 100, 105, 102, 10, 10, 35, 105, 102, 100, 101, 102, 32, 86, 83, 71, 95, 73, 78, 83, 84, 65, 78, 67, 69, 95, 80,
+79, 83, 73, 84, 73, 79, 78, 83, 10, 32, 32, 32, 32, 118, 101, 114, 116, 101, 120, 46, 120, 121, 122, 32, 61, 32, 118, 101, 114, 116, 101, 120,
+46, 120, 121, 122, 32, 43, 32, 118, 115, 103, 95, 112, 111, 115, 105, 116, 105, 111, 110, 59, 10, 35, 101, 110, 100, 105, 102, 10, 10, 35, 105, 102,
+100, 101, 102, 32, 86, 83, 71, 95, 66, 73, 76, 76, 66, 79, 65, 82, 68, 10, 32, 32, 32, 32, 109, 97, 116, 52, 32, 109, 118, 32, 61, 32,
+99, 111, 109, 112, 117, 116, 101, 66, 105, 108, 108, 98, 111, 97, 100, 77, 97, 116, 114, 105, 120, 40, 109, 111, 100, 101, 108, 86, 105, 101, 119, 32,
+42, 32, 118, 101, 99, 52, 40, 118, 115, 103, 95, 112, 111, 115, 105, 116, 105, 111, 110, 95, 115, 99, 97, 108, 101, 68, 105, 115, 116, 97, 110, 99,
+101, 46, 120, 121, 122, 44, 32, 49, 46, 48, 41, 44, 32, 118, 115, 103, 95, 112, 111, 115, 105, 116, 105, 111, 110, 95, 115, 99, 97, 108, 101, 68,
+105, 115, 116, 97, 110, 99, 101, 46, 119, 41, 59, 10, 35, 101, 108, 105, 102, 32, 100, 101, 102, 105, 110, 101, 100, 40, 86, 83, 71, 95, 83, 75,
+73, 78, 78, 73, 78, 71, 41, 10, 32, 32, 32, 32, 47, 47, 32, 67, 97, 108, 99, 117, 108, 97, 116, 101, 32, 115, 107, 105, 110, 110, 101, 100,
+32, 109, 97, 116, 114, 105, 120, 32, 102, 114, 111, 109, 32, 119, 101, 105, 103, 104, 116, 115, 32, 97, 110, 100, 32, 106, 111, 105, 110, 116, 32, 105,
+110, 100, 105, 99, 101, 115, 32, 111, 102, 32, 116, 104, 101, 32, 99, 117, 114, 114, 101, 110, 116, 32, 118, 101, 114, 116, 101, 120, 10, 32, 32, 32,
+32, 109, 97, 116, 52, 32, 115, 107, 105, 110, 77, 97, 116, 32, 61, 10, 32, 32, 32, 32, 32, 32, 32, 32, 118, 115, 103, 95, 74, 111, 105, 110,
+116, 87, 101, 105, 103, 104, 116, 115, 46, 120, 32, 42, 32, 106, 111, 105, 110, 116, 46, 109, 97, 116, 114, 105, 99, 101, 115, 91, 118, 115, 103, 95,
+74, 111, 105, 110, 116, 73, 110, 100, 105, 99, 101, 115, 46, 120, 93, 32, 43, 10, 32, 32, 32, 32, 32, 32, 32, 32, 118, 115, 103, 95, 74, 111,
+105, 110, 116, 87, 101, 105, 103, 104, 116, 115, 46, 121, 32, 42, 32, 106, 111, 105, 110, 116, 46, 109, 97, 116, 114, 105, 99, 101, 115, 91, 118, 115,
+103, 95, 74, 111, 105, 110, 116, 73, 110, 100, 105, 99, 101, 115, 46, 121, 93, 32, 43, 10, 32, 32, 32, 32, 32, 32, 32, 32, 118, 115, 103, 95,
+74, 111, 105, 110, 116, 87, 101, 105, 103, 104, 116, 115, 46, 122, 32, 42, 32, 106, 111, 105, 110, 116, 46, 109, 97, 116, 114, 105, 99, 101, 115, 91,
+118, 115, 103, 95, 74, 111, 105, 110, 116, 73, 110, 100, 105, 99, 101, 115, 46, 122, 93, 32, 43, 10, 32, 32, 32, 32, 32, 32, 32, 32, 118, 115,
+103, 95, 74, 111, 105, 110, 116, 87, 101, 105, 103, 104, 116, 115, 46, 119, 32, 42, 32, 106, 111, 105, 110, 116, 46, 109, 97, 116, 114, 105, 99, 101,
+115, 91, 118, 115, 103, 95, 74, 111, 105, 110, 116, 73, 110, 100, 105, 99, 101, 115, 46, 119, 93, 59, 10, 10, 32, 32, 32, 32, 109, 97, 116, 52,
+32, 109, 118, 32, 61, 32, 109, 111, 100, 101, 108, 86, 105, 101, 119, 32, 42, 32, 115, 107, 105, 110, 77, 97, 116, 59, 10, 35, 101, 108, 115, 101,
+10, 32, 32, 32, 32, 109, 97, 116, 52, 32, 109, 118, 32, 61, 32, 109, 111, 100, 101, 108, 86, 105, 101, 119, 59, 10, 35, 101, 110, 100, 105, 102,
+10, 10, 32, 32, 32, 32, 103, 108, 95, 80, 111, 115, 105, 116, 105, 111, 110, 32, 61, 32, 40, 112, 99, 46, 112, 114, 111, 106, 101, 99, 116, 105,
+111, 110, 32, 42, 32, 109, 118, 41, 32, 42, 32, 118, 101, 114, 116, 101, 120, 59, 10, 32, 32, 32, 32, 101, 121, 101, 80, 111, 115, 32, 61, 32,
+40, 109, 118, 32, 42, 32, 118, 101, 114, 116, 101, 120, 41, 46, 120, 121, 122, 59, 10, 32, 32, 32, 32, 118, 105, 101, 119, 68, 105, 114, 32, 61,
+32, 45, 32, 40, 109, 118, 32, 42, 32, 118, 101, 114, 116, 101, 120, 41, 46, 120, 121, 122, 59, 10, 32, 32, 32, 32, 110, 111, 114, 109, 97, 108,
+68, 105, 114, 32, 61, 32, 40, 109, 118, 32, 42, 32, 110, 111, 114, 109, 97, 108, 41, 46, 120, 121, 122, 59, 10, 10, 32, 32, 32, 32, 118, 101,
+114, 116, 101, 120, 67, 111, 108, 111, 114, 32, 61, 32, 118, 115, 103, 95, 67, 111, 108, 111, 114, 59, 10, 32, 32, 32, 32, 116, 101, 120, 67, 111,
+111, 114, 100, 48, 32, 61, 32, 118, 115, 103, 95, 84, 101, 120, 67, 111, 111, 114, 100, 48, 59, 10, 125, 10, 0, 0, 0, 0, 0, 0, 0, 0,
+4, 0, 0, 0, 16, 0, 0, 0, 118, 115, 103, 58, 58, 83, 104, 97, 100, 101, 114, 83, 116, 97, 103, 101, 0, 0, 0, 0, 255, 255, 255, 255,
+255, 255, 255, 255, 16, 0, 0, 0, 4, 0, 0, 0, 109, 97, 105, 110, 5, 0, 0, 0, 17, 0, 0, 0, 118, 115, 103, 58, 58, 83, 104, 97,
+100, 101, 114, 77, 111, 100, 117, 108, 101, 0, 0, 0, 0, 0, 0, 0, 0, 16, 5, 0, 0, 35, 118, 101, 114, 115, 105, 111, 110, 32, 52, 53,
+48, 10, 35, 101, 120, 116, 101, 110, 115, 105, 111, 110, 32, 71, 76, 95, 65, 82, 66, 95, 115, 101, 112, 97, 114, 97, 116, 101, 95, 115, 104, 97,
+100, 101, 114, 95, 111, 98, 106, 101, 99, 116, 115, 32, 58, 32, 101, 110, 97, 98, 108, 101, 10, 35, 112, 114, 97, 103, 109, 97, 32, 105, 109, 112,
+111, 114, 116, 95, 100, 101, 102, 105, 110, 101, 115, 32, 40, 86, 83, 71, 95, 80, 79, 73, 78, 84, 95, 83, 80, 82, 73, 84, 69, 44, 32, 86,
+83, 71, 95, 68, 73, 70, 70, 85, 83, 69, 95, 77, 65, 80, 44, 32, 86, 83, 71, 95, 71, 82, 69, 89, 83, 67, 65, 76, 69, 95, 68, 73,
+70, 70, 85, 83, 69, 95, 77, 65, 80, 44, 32, 86, 83, 71, 95, 65, 76, 80, 72, 65, 95, 84, 69, 83, 84, 41, 10, 10, 35, 100, 101, 102,
+105, 110, 101, 32, 86, 73, 69, 87, 95, 68, 69, 83, 67, 82, 73, 80, 84, 79, 82, 95, 83, 69, 84, 32, 48, 10, 35, 100, 101, 102, 105, 110,
+101, 32, 77, 65, 84, 69, 82, 73, 65, 76, 95, 68, 69, 83, 67, 82, 73, 80, 84, 79, 82, 95, 83, 69, 84, 32, 49, 10, 10, 35, 105, 102,
+100, 101, 102, 32, 86, 83, 71, 95, 68, 73, 70, 70, 85, 83, 69, 95, 77, 65, 80, 10, 108, 97, 121, 111, 117, 116, 40, 115, 101, 116, 32, 61,
+32, 77, 65, 84, 69, 82, 73, 65, 76, 95, 68, 69, 83, 67, 82, 73, 80, 84, 79, 82, 95, 83, 69, 84, 44, 32, 98, 105, 110, 100, 105, 110,
+103, 32, 61, 32, 48, 41, 32, 117, 110, 105, 102, 111, 114, 109, 32, 115, 97, 109, 112, 108, 101, 114, 50, 68, 32, 100, 105, 102, 102, 117, 115, 101,
+77, 97, 112, 59, 10, 35, 101, 110, 100, 105, 102, 10, 10, 108, 97, 121, 111, 117, 116, 40, 115, 101, 116, 32, 61, 32, 77, 65, 84, 69, 82, 73,
+65, 76, 95, 68, 69, 83, 67, 82, 73, 80, 84, 79, 82, 95, 83, 69, 84, 44, 32, 98, 105, 110, 100, 105, 110, 103, 32, 61, 32, 49, 48, 41,
+32, 117, 110, 105, 102, 111, 114, 109, 32, 77, 97, 116, 101, 114, 105, 97, 108, 68, 97, 116, 97, 10, 123, 10, 32, 32, 32, 32, 118, 101, 99, 52,
+32, 97, 109, 98, 105, 101, 110, 116, 67, 111, 108, 111, 114, 59, 10, 32, 32, 32, 32, 118, 101, 99, 52, 32, 100, 105, 102, 102, 117, 115, 101, 67,
+111, 108, 111, 114, 59, 10, 32, 32, 32, 32, 118, 101, 99, 52, 32, 115, 112, 101, 99, 117, 108, 97, 114, 67, 111, 108, 111, 114, 59, 10, 32, 32,
+32, 32, 118, 101, 99, 52, 32, 101, 109, 105, 115, 115, 105, 118, 101, 67, 111, 108, 111, 114, 59, 10, 32, 32, 32, 32, 102, 108, 111, 97, 116, 32,
+115, 104, 105, 110, 105, 110, 101, 115, 115, 59, 10, 32, 32, 32, 32, 102, 108, 111, 97, 116, 32, 97, 108, 112, 104, 97, 77, 97, 115, 107, 59, 10,
+32, 32, 32, 32, 102, 108, 111, 97, 116, 32, 97, 108, 112, 104, 97, 77, 97, 115, 107, 67, 117, 116, 111, 102, 102, 59, 10, 125, 32, 109, 97, 116,
+101, 114, 105, 97, 108, 59, 10, 10, 108, 97, 121, 111, 117, 116, 40, 108, 111, 99, 97, 116, 105, 111, 110, 32, 61, 32, 50, 41, 32, 105, 110, 32,
+118, 101, 99, 52, 32, 118, 101, 114, 116, 101, 120, 67, 111, 108, 111, 114, 59, 10, 35, 105, 102, 110, 100, 101, 102, 32, 86, 83, 71, 95, 80, 79,
+73, 78, 84, 95, 83, 80, 82, 73, 84, 69, 10, 108, 97, 121, 111, 117, 116, 40, 108, 111, 99, 97, 116, 105, 111, 110, 32, 61, 32, 51, 41, 32,
+105, 110, 32, 118, 101, 99, 50, 32, 116, 101, 120, 67, 111, 111, 114, 100, 48, 59, 10, 35, 101, 110, 100, 105, 102, 10, 10, 108, 97, 121, 111, 117,
+116, 40, 108, 111, 99, 97, 116, 105, 111, 110, 32, 61, 32, 48, 41, 32, 111, 117, 116, 32, 118, 101, 99, 52, 32, 111, 117, 116, 67, 111, 108, 111,
+114, 59, 10, 10, 118, 111, 105, 100, 32, 109, 97, 105, 110, 40, 41, 10, 123, 10, 35, 105, 102, 100, 101, 102, 32, 86, 83, 71, 95, 80, 79, 73,
+78, 84, 95, 83, 80, 82, 73, 84, 69, 10, 32, 32, 32, 32, 118, 101, 99, 50, 32, 116, 101, 120, 67, 111, 111, 114, 100, 48, 32, 61, 32, 103,
+108, 95, 80, 111, 105, 110, 116, 67, 111, 111, 114, 100, 46, 120, 121, 59, 10, 35, 101, 110, 100, 105, 102, 10, 10, 32, 32, 32, 32, 118, 101, 99,
+52, 32, 100, 105, 102, 102, 117, 115, 101, 67, 111, 108, 111, 114, 32, 61, 32, 118, 101, 114, 116, 101, 120, 67, 111, 108, 111, 114, 32, 42, 32, 109,
+97, 116, 101, 114, 105, 97, 108, 46, 100, 105, 102, 102, 117, 115, 101, 67, 111, 108, 111, 114, 59, 10, 10, 35, 105, 102, 100, 101, 102, 32, 86, 83,
+71, 95, 68, 73, 70, 70, 85, 83, 69, 95, 77, 65, 80, 10, 32, 32, 32, 32, 35, 105, 102, 100, 101, 102, 32, 86, 83, 71, 95, 71, 82, 69,
+89, 83, 67, 65, 76, 69, 95, 68, 73, 70, 70, 85, 83, 69, 95, 77, 65, 80, 10, 32, 32, 32, 32, 32, 32, 32, 32, 102, 108, 111, 97, 116,
+32, 118, 32, 61, 32, 116, 101, 120, 116, 117, 114, 101, 40, 100, 105, 102, 102, 117, 115, 101, 77, 97, 112, 44, 32, 116, 101, 120, 67, 111, 111, 114,
+100, 48, 46, 115, 116, 41, 46, 115, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 100, 105, 102, 102, 117, 115, 101, 67, 111, 108, 111, 114, 32, 42,
+61, 32, 118, 101, 99, 52, 40, 118, 44, 32, 118, 44, 32, 118, 44, 32, 49, 46, 48, 41, 59, 10, 32, 32, 32, 32, 35, 101, 108, 115, 101, 10,
+32, 32, 32, 32, 32, 32, 32, 32, 100, 105, 102, 102, 117, 115, 101, 67, 111, 108, 111, 114, 32, 42, 61, 32, 116, 101, 120, 116, 117, 114, 101, 40,
+100, 105, 102, 102, 117, 115, 101, 77, 97, 112, 44, 32, 116, 101, 120, 67, 111, 111, 114, 100, 48, 46, 115, 116, 41, 59, 10, 32, 32, 32, 32, 35,
+101, 110, 100, 105, 102, 10, 35, 101, 110, 100, 105, 102, 10, 10, 35, 105, 102, 100, 101, 102, 32, 86, 83, 71, 95, 65, 76, 80, 72, 65, 95, 84,
+69, 83, 84, 10, 32, 32, 32, 32, 105, 102, 32, 40, 109, 97, 116, 101, 114, 105, 97, 108, 46, 97, 108, 112, 104, 97, 77, 97, 115, 107, 32, 61,
+61, 32, 49, 46, 48, 102, 32, 38, 38, 32, 100, 105, 102, 102, 117, 115, 101, 67, 111, 108, 111, 114, 46, 97, 32, 60, 32, 109, 97, 116, 101, 114,
+105, 97, 108, 46, 97, 108, 112, 104, 97, 77, 97, 115, 107, 67, 117, 116, 111, 102, 102, 41, 32, 100, 105, 115, 99, 97, 114, 100, 59, 10, 35, 101,
+110, 100, 105, 102, 10, 10, 32, 32, 32, 32, 111, 117, 116, 67, 111, 108, 111, 114, 32, 61, 32, 100, 105, 102, 102, 117, 115, 101, 67, 111, 108, 111,
+114, 59, 10, 125, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 10, 0, 0, 0, 118, 115, 103, 95, 86, 101, 114,
+116, 101, 120, 0, 0, 0, 0, 0, 0, 0, 0, 106, 0, 0, 0, 6, 0, 0, 0, 14, 0, 0, 0, 118, 115, 103, 58, 58, 118, 101, 99, 51,
+65, 114, 114, 97, 121, 0, 0, 0, 0, 0, 0, 0, 0, 12, 0, 0, 0, 0, 1, 1, 1, 0, 255, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 0, 0, 0, 118, 115, 103, 95, 78, 111, 114, 109, 97, 108, 0, 0, 0, 0, 1, 0,
+0, 0, 106, 0, 0, 0, 7, 0, 0, 0, 14, 0, 0, 0, 118, 115, 103, 58, 58, 118, 101, 99, 51, 65, 114, 114, 97, 121, 0, 0, 0, 0,
+0, 0, 0, 0, 12, 0, 0, 0, 0, 1, 1, 1, 0, 255, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 13, 0, 0, 0, 118, 115, 103, 95, 84, 101, 120, 67, 111, 111, 114, 100, 48, 0, 0, 0, 0, 2, 0, 0, 0, 103, 0, 0, 0,
+8, 0, 0, 0, 14, 0, 0, 0, 118, 115, 103, 58, 58, 118, 101, 99, 50, 65, 114, 114, 97, 121, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0,
+0, 0, 0, 1, 1, 1, 0, 255, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 118, 115, 103,
+95, 67, 111, 108, 111, 114, 0, 0, 0, 0, 3, 0, 0, 0, 109, 0, 0, 0, 9, 0, 0, 0, 14, 0, 0, 0, 118, 115, 103, 58, 58, 118,
 101, 99, 52, 65, 114, 114, 97, 121, 0, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0, 1, 1, 1, 0, 255, 0, 1, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 118, 115, 103, 95, 74, 111, 105, 110, 116,
-87, 101, 105, 103, 104, 116, 115, 12, 0, 0, 0, 86, 83, 71, 95, 83, 75, 73, 78, 78, 73, 78, 71, 6, 0, 0, 0, 109, 0, 0, 0, 13,
-0, 0, 0, 14, 0, 0, 0, 118, 115, 103, 58, 58, 118, 101, 99, 52, 65, 114, 114, 97, 121, 0, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0,
-0, 0, 1, 1, 1, 0, 255, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-7, 0, 0, 0, 15, 0, 0, 0, 100, 105, 115, 112, 108, 97, 99, 101, 109, 101, 110, 116, 77, 97, 112, 20, 0, 0, 0, 86, 83, 71, 95, 68,
-73, 83, 80, 76, 65, 67, 69, 77, 69, 78, 84, 95, 77, 65, 80, 1, 0, 0, 0, 6, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1,
-0, 0, 0, 14, 0, 0, 0, 17, 0, 0, 0, 118, 115, 103, 58, 58, 102, 108, 111, 97, 116, 65, 114, 114, 97, 121, 50, 68, 0, 0, 0, 0,
-100, 0, 0, 0, 4, 0, 0, 0, 0, 1, 1, 1, 0, 255, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10,
-0, 0, 0, 100, 105, 102, 102, 117, 115, 101, 77, 97, 112, 15, 0, 0, 0, 86, 83, 71, 95, 68, 73, 70, 70, 85, 83, 69, 95, 77, 65, 80,
-1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 16, 0, 0, 0, 15, 0, 0, 0, 18, 0, 0, 0, 118, 115, 103, 58,
-58, 117, 98, 118, 101, 99, 52, 65, 114, 114, 97, 121, 50, 68, 0, 0, 0, 0, 37, 0, 0, 0, 4, 0, 0, 0, 0, 1, 1, 1, 0, 255,
-0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 109, 97, 116, 101, 114, 105, 97, 108, 0, 0, 0,
-0, 1, 0, 0, 0, 10, 0, 0, 0, 6, 0, 0, 0, 1, 0, 0, 0, 16, 0, 0, 0, 16, 0, 0, 0, 23, 0, 0, 0, 118, 115, 103,
-58, 58, 80, 104, 111, 110, 103, 77, 97, 116, 101, 114, 105, 97, 108, 86, 97, 108, 117, 101, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 1, 1, 1, 0, 255, 0, 0, 0, 128, 63, 0, 0, 128, 63, 0, 0, 128, 63, 0, 0, 128, 63, 102, 102, 102, 63, 102, 102, 102, 63, 102,
-102, 102, 63, 0, 0, 128, 63, 205, 204, 76, 62, 205, 204, 76, 62, 205, 204, 76, 62, 0, 0, 128, 63, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 200, 66, 0, 0, 128, 63, 0, 0, 0, 63, 13, 0, 0, 0, 106, 111, 105, 110, 116, 77, 97, 116, 114,
-105, 99, 101, 115, 12, 0, 0, 0, 86, 83, 71, 95, 83, 75, 73, 78, 78, 73, 78, 71, 1, 0, 0, 0, 11, 0, 0, 0, 7, 0, 0, 0,
-1, 0, 0, 0, 1, 0, 0, 0, 17, 0, 0, 0, 14, 0, 0, 0, 118, 115, 103, 58, 58, 109, 97, 116, 52, 86, 97, 108, 117, 101, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 255, 0, 0, 0, 128, 63, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 128, 63, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 63, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 63, 9, 0, 0, 0, 108, 105, 103, 104, 116, 68, 97, 116, 97, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 1, 0, 0, 0, 17, 0, 0, 0, 18, 0, 0, 0, 14, 0, 0, 0, 118, 115,
-103, 58, 58, 118, 101, 99, 52, 65, 114, 114, 97, 121, 0, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0, 1, 1, 1, 0, 255, 0, 64,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 12, 0, 0, 0, 118, 105, 101, 119, 112, 111, 114, 116, 68, 97, 116, 97, 0, 0, 0, 0, 0, 0, 0, 0, 1,
-0, 0, 0, 7, 0, 0, 0, 1, 0, 0, 0, 17, 0, 0, 0, 19, 0, 0, 0, 14, 0, 0, 0, 118, 115, 103, 58, 58, 118, 101, 99, 52,
-86, 97, 108, 117, 101, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 160, 68, 0, 0, 128, 68, 10, 0, 0, 0, 115, 104, 97, 100, 111, 119, 77, 97, 112, 115, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0,
-0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 16, 0, 0, 0, 20, 0, 0, 0, 17, 0, 0, 0, 118, 115, 103, 58, 58, 102, 108, 111, 97, 116,
-65, 114, 114, 97, 121, 51, 68, 0, 0, 0, 0, 100, 0, 0, 0, 4, 0, 0, 0, 0, 1, 1, 1, 0, 255, 0, 1, 0, 0, 0, 1, 0,
-0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0, 112, 99, 0, 0, 0, 0, 1, 0, 0, 0,
-0, 0, 0, 0, 128, 0, 0, 0, 4, 0, 0, 0, 2, 0, 0, 0, 20, 0, 0, 0, 86, 83, 71, 95, 68, 73, 83, 80, 76, 65, 67, 69,
-77, 69, 78, 84, 95, 77, 65, 80, 22, 0, 0, 0, 86, 83, 71, 95, 73, 78, 83, 84, 65, 78, 67, 69, 95, 80, 79, 83, 73, 84, 73, 79,
-78, 83, 21, 0, 0, 0, 41, 0, 0, 0, 118, 115, 103, 58, 58, 80, 111, 115, 105, 116, 105, 111, 110, 65, 110, 100, 68, 105, 115, 112, 108, 97,
-99, 101, 109, 101, 110, 116, 77, 97, 112, 65, 114, 114, 97, 121, 83, 116, 97, 116, 101, 0, 0, 0, 0, 1, 0, 0, 0, 22, 0, 0, 0, 86,
-83, 71, 95, 73, 78, 83, 84, 65, 78, 67, 69, 95, 80, 79, 83, 73, 84, 73, 79, 78, 83, 22, 0, 0, 0, 23, 0, 0, 0, 118, 115, 103,
-58, 58, 80, 111, 115, 105, 116, 105, 111, 110, 65, 114, 114, 97, 121, 83, 116, 97, 116, 101, 0, 0, 0, 0, 1, 0, 0, 0, 20, 0, 0, 0,
-86, 83, 71, 95, 68, 73, 83, 80, 76, 65, 67, 69, 77, 69, 78, 84, 95, 77, 65, 80, 23, 0, 0, 0, 30, 0, 0, 0, 118, 115, 103, 58,
-58, 68, 105, 115, 112, 108, 97, 99, 101, 109, 101, 110, 116, 77, 97, 112, 65, 114, 114, 97, 121, 83, 116, 97, 116, 101, 0, 0, 0, 0, 1, 0,
-0, 0, 13, 0, 0, 0, 86, 83, 71, 95, 66, 73, 76, 76, 66, 79, 65, 82, 68, 24, 0, 0, 0, 24, 0, 0, 0, 118, 115, 103, 58, 58,
-66, 105, 108, 108, 98, 111, 97, 114, 100, 65, 114, 114, 97, 121, 83, 116, 97, 116, 101, 0, 0, 0, 0, 3, 0, 0, 0, 14, 0, 0, 0, 86,
-83, 71, 95, 65, 76, 80, 72, 65, 95, 84, 69, 83, 84, 25, 0, 0, 0, 86, 83, 71, 95, 71, 82, 69, 89, 83, 67, 65, 76, 69, 95, 68,
-73, 70, 70, 85, 83, 69, 95, 77, 65, 80, 16, 0, 0, 0, 86, 83, 71, 95, 80, 79, 73, 78, 84, 95, 83, 80, 82, 73, 84, 69, 0, 0,
-0, 0, 4, 0, 0, 0, 25, 0, 0, 0, 26, 0, 0, 0, 118, 115, 103, 58, 58, 83, 104, 97, 100, 101, 114, 67, 111, 109, 112, 105, 108, 101,
-83, 101, 116, 116, 105, 110, 103, 115, 0, 0, 64, 0, 100, 0, 0, 0, 0, 0, 0, 0, 194, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
-0, 0, 2, 0, 0, 0, 26, 0, 0, 0, 16, 0, 0, 0, 118, 115, 103, 58, 58, 83, 104, 97, 100, 101, 114, 83, 116, 97, 103, 101, 0, 0,
-0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 1, 0, 0, 0, 4, 0, 0, 0, 109, 97, 105, 110, 27, 0, 0, 0, 17, 0, 0, 0, 118, 115,
-103, 58, 58, 83, 104, 97, 100, 101, 114, 77, 111, 100, 117, 108, 101, 0, 0, 0, 0, 25, 0, 0, 0, 0, 0, 0, 0, 56, 2, 0, 0, 3,
-2, 35, 7, 0, 0, 1, 0, 11, 0, 8, 0, 77, 0, 0, 0, 0, 0, 0, 0, 17, 0, 2, 0, 1, 0, 0, 0, 11, 0, 6, 0, 1,
-0, 0, 0, 71, 76, 83, 76, 46, 115, 116, 100, 46, 52, 53, 48, 0, 0, 0, 0, 14, 0, 3, 0, 0, 0, 0, 0, 1, 0, 0, 0, 15,
-0, 15, 0, 0, 0, 0, 0, 4, 0, 0, 0, 109, 97, 105, 110, 0, 0, 0, 0, 12, 0, 0, 0, 20, 0, 0, 0, 40, 0, 0, 0, 51,
-0, 0, 0, 56, 0, 0, 0, 62, 0, 0, 0, 67, 0, 0, 0, 69, 0, 0, 0, 73, 0, 0, 0, 75, 0, 0, 0, 3, 0, 3, 0, 2,
-0, 0, 0, 194, 1, 0, 0, 4, 0, 9, 0, 71, 76, 95, 65, 82, 66, 95, 115, 101, 112, 97, 114, 97, 116, 101, 95, 115, 104, 97, 100, 101,
-114, 95, 111, 98, 106, 101, 99, 116, 115, 0, 0, 5, 0, 4, 0, 4, 0, 0, 0, 109, 97, 105, 110, 0, 0, 0, 0, 5, 0, 4, 0, 9,
-0, 0, 0, 118, 101, 114, 116, 101, 120, 0, 0, 5, 0, 5, 0, 12, 0, 0, 0, 118, 115, 103, 95, 86, 101, 114, 116, 101, 120, 0, 0, 5,
-0, 4, 0, 19, 0, 0, 0, 110, 111, 114, 109, 97, 108, 0, 0, 5, 0, 5, 0, 20, 0, 0, 0, 118, 115, 103, 95, 78, 111, 114, 109, 97,
-108, 0, 0, 5, 0, 3, 0, 29, 0, 0, 0, 109, 118, 0, 0, 5, 0, 6, 0, 30, 0, 0, 0, 80, 117, 115, 104, 67, 111, 110, 115, 116,
-97, 110, 116, 115, 0, 0, 0, 6, 0, 6, 0, 30, 0, 0, 0, 0, 0, 0, 0, 112, 114, 111, 106, 101, 99, 116, 105, 111, 110, 0, 0, 6,
-0, 6, 0, 30, 0, 0, 0, 1, 0, 0, 0, 109, 111, 100, 101, 108, 86, 105, 101, 119, 0, 0, 0, 5, 0, 3, 0, 32, 0, 0, 0, 112,
-99, 0, 0, 5, 0, 6, 0, 38, 0, 0, 0, 103, 108, 95, 80, 101, 114, 86, 101, 114, 116, 101, 120, 0, 0, 0, 0, 6, 0, 6, 0, 38,
-0, 0, 0, 0, 0, 0, 0, 103, 108, 95, 80, 111, 115, 105, 116, 105, 111, 110, 0, 5, 0, 3, 0, 40, 0, 0, 0, 0, 0, 0, 0, 5,
-0, 4, 0, 51, 0, 0, 0, 101, 121, 101, 80, 111, 115, 0, 0, 5, 0, 4, 0, 56, 0, 0, 0, 118, 105, 101, 119, 68, 105, 114, 0, 5,
-0, 5, 0, 62, 0, 0, 0, 110, 111, 114, 109, 97, 108, 68, 105, 114, 0, 0, 0, 5, 0, 5, 0, 67, 0, 0, 0, 118, 101, 114, 116, 101,
-120, 67, 111, 108, 111, 114, 0, 5, 0, 5, 0, 69, 0, 0, 0, 118, 115, 103, 95, 67, 111, 108, 111, 114, 0, 0, 0, 5, 0, 5, 0, 73,
-0, 0, 0, 116, 101, 120, 67, 111, 111, 114, 100, 48, 0, 0, 0, 5, 0, 6, 0, 75, 0, 0, 0, 118, 115, 103, 95, 84, 101, 120, 67, 111,
-111, 114, 100, 48, 0, 0, 0, 71, 0, 4, 0, 12, 0, 0, 0, 30, 0, 0, 0, 0, 0, 0, 0, 71, 0, 4, 0, 20, 0, 0, 0, 30,
-0, 0, 0, 1, 0, 0, 0, 72, 0, 4, 0, 30, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 72, 0, 5, 0, 30, 0, 0, 0, 0,
-0, 0, 0, 35, 0, 0, 0, 0, 0, 0, 0, 72, 0, 5, 0, 30, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 16, 0, 0, 0, 72,
-0, 4, 0, 30, 0, 0, 0, 1, 0, 0, 0, 5, 0, 0, 0, 72, 0, 5, 0, 30, 0, 0, 0, 1, 0, 0, 0, 35, 0, 0, 0, 64,
-0, 0, 0, 72, 0, 5, 0, 30, 0, 0, 0, 1, 0, 0, 0, 7, 0, 0, 0, 16, 0, 0, 0, 71, 0, 3, 0, 30, 0, 0, 0, 2,
-0, 0, 0, 72, 0, 5, 0, 38, 0, 0, 0, 0, 0, 0, 0, 11, 0, 0, 0, 0, 0, 0, 0, 71, 0, 3, 0, 38, 0, 0, 0, 2,
-0, 0, 0, 71, 0, 4, 0, 51, 0, 0, 0, 30, 0, 0, 0, 0, 0, 0, 0, 71, 0, 4, 0, 56, 0, 0, 0, 30, 0, 0, 0, 5,
-0, 0, 0, 71, 0, 4, 0, 62, 0, 0, 0, 30, 0, 0, 0, 1, 0, 0, 0, 71, 0, 4, 0, 67, 0, 0, 0, 30, 0, 0, 0, 2,
-0, 0, 0, 71, 0, 4, 0, 69, 0, 0, 0, 30, 0, 0, 0, 3, 0, 0, 0, 71, 0, 4, 0, 73, 0, 0, 0, 30, 0, 0, 0, 3,
-0, 0, 0, 71, 0, 4, 0, 75, 0, 0, 0, 30, 0, 0, 0, 2, 0, 0, 0, 19, 0, 2, 0, 2, 0, 0, 0, 33, 0, 3, 0, 3,
-0, 0, 0, 2, 0, 0, 0, 22, 0, 3, 0, 6, 0, 0, 0, 32, 0, 0, 0, 23, 0, 4, 0, 7, 0, 0, 0, 6, 0, 0, 0, 4,
-0, 0, 0, 32, 0, 4, 0, 8, 0, 0, 0, 7, 0, 0, 0, 7, 0, 0, 0, 23, 0, 4, 0, 10, 0, 0, 0, 6, 0, 0, 0, 3,
-0, 0, 0, 32, 0, 4, 0, 11, 0, 0, 0, 1, 0, 0, 0, 10, 0, 0, 0, 59, 0, 4, 0, 11, 0, 0, 0, 12, 0, 0, 0, 1,
-0, 0, 0, 43, 0, 4, 0, 6, 0, 0, 0, 14, 0, 0, 0, 0, 0, 128, 63, 59, 0, 4, 0, 11, 0, 0, 0, 20, 0, 0, 0, 1,
-0, 0, 0, 43, 0, 4, 0, 6, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 24, 0, 4, 0, 27, 0, 0, 0, 7, 0, 0, 0, 4,
-0, 0, 0, 32, 0, 4, 0, 28, 0, 0, 0, 7, 0, 0, 0, 27, 0, 0, 0, 30, 0, 4, 0, 30, 0, 0, 0, 27, 0, 0, 0, 27,
-0, 0, 0, 32, 0, 4, 0, 31, 0, 0, 0, 9, 0, 0, 0, 30, 0, 0, 0, 59, 0, 4, 0, 31, 0, 0, 0, 32, 0, 0, 0, 9,
-0, 0, 0, 21, 0, 4, 0, 33, 0, 0, 0, 32, 0, 0, 0, 1, 0, 0, 0, 43, 0, 4, 0, 33, 0, 0, 0, 34, 0, 0, 0, 1,
-0, 0, 0, 32, 0, 4, 0, 35, 0, 0, 0, 9, 0, 0, 0, 27, 0, 0, 0, 30, 0, 3, 0, 38, 0, 0, 0, 7, 0, 0, 0, 32,
-0, 4, 0, 39, 0, 0, 0, 3, 0, 0, 0, 38, 0, 0, 0, 59, 0, 4, 0, 39, 0, 0, 0, 40, 0, 0, 0, 3, 0, 0, 0, 43,
-0, 4, 0, 33, 0, 0, 0, 41, 0, 0, 0, 0, 0, 0, 0, 32, 0, 4, 0, 48, 0, 0, 0, 3, 0, 0, 0, 7, 0, 0, 0, 32,
-0, 4, 0, 50, 0, 0, 0, 3, 0, 0, 0, 10, 0, 0, 0, 59, 0, 4, 0, 50, 0, 0, 0, 51, 0, 0, 0, 3, 0, 0, 0, 59,
-0, 4, 0, 50, 0, 0, 0, 56, 0, 0, 0, 3, 0, 0, 0, 59, 0, 4, 0, 50, 0, 0, 0, 62, 0, 0, 0, 3, 0, 0, 0, 59,
-0, 4, 0, 48, 0, 0, 0, 67, 0, 0, 0, 3, 0, 0, 0, 32, 0, 4, 0, 68, 0, 0, 0, 1, 0, 0, 0, 7, 0, 0, 0, 59,
-0, 4, 0, 68, 0, 0, 0, 69, 0, 0, 0, 1, 0, 0, 0, 23, 0, 4, 0, 71, 0, 0, 0, 6, 0, 0, 0, 2, 0, 0, 0, 32,
-0, 4, 0, 72, 0, 0, 0, 3, 0, 0, 0, 71, 0, 0, 0, 59, 0, 4, 0, 72, 0, 0, 0, 73, 0, 0, 0, 3, 0, 0, 0, 32,
-0, 4, 0, 74, 0, 0, 0, 1, 0, 0, 0, 71, 0, 0, 0, 59, 0, 4, 0, 74, 0, 0, 0, 75, 0, 0, 0, 1, 0, 0, 0, 54,
-0, 5, 0, 2, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 248, 0, 2, 0, 5, 0, 0, 0, 59, 0, 4, 0, 8,
-0, 0, 0, 9, 0, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 8, 0, 0, 0, 19, 0, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 28,
-0, 0, 0, 29, 0, 0, 0, 7, 0, 0, 0, 61, 0, 4, 0, 10, 0, 0, 0, 13, 0, 0, 0, 12, 0, 0, 0, 81, 0, 5, 0, 6,
-0, 0, 0, 15, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 81, 0, 5, 0, 6, 0, 0, 0, 16, 0, 0, 0, 13, 0, 0, 0, 1,
-0, 0, 0, 81, 0, 5, 0, 6, 0, 0, 0, 17, 0, 0, 0, 13, 0, 0, 0, 2, 0, 0, 0, 80, 0, 7, 0, 7, 0, 0, 0, 18,
-0, 0, 0, 15, 0, 0, 0, 16, 0, 0, 0, 17, 0, 0, 0, 14, 0, 0, 0, 62, 0, 3, 0, 9, 0, 0, 0, 18, 0, 0, 0, 61,
-0, 4, 0, 10, 0, 0, 0, 21, 0, 0, 0, 20, 0, 0, 0, 81, 0, 5, 0, 6, 0, 0, 0, 23, 0, 0, 0, 21, 0, 0, 0, 0,
-0, 0, 0, 81, 0, 5, 0, 6, 0, 0, 0, 24, 0, 0, 0, 21, 0, 0, 0, 1, 0, 0, 0, 81, 0, 5, 0, 6, 0, 0, 0, 25,
-0, 0, 0, 21, 0, 0, 0, 2, 0, 0, 0, 80, 0, 7, 0, 7, 0, 0, 0, 26, 0, 0, 0, 23, 0, 0, 0, 24, 0, 0, 0, 25,
-0, 0, 0, 22, 0, 0, 0, 62, 0, 3, 0, 19, 0, 0, 0, 26, 0, 0, 0, 65, 0, 5, 0, 35, 0, 0, 0, 36, 0, 0, 0, 32,
-0, 0, 0, 34, 0, 0, 0, 61, 0, 4, 0, 27, 0, 0, 0, 37, 0, 0, 0, 36, 0, 0, 0, 62, 0, 3, 0, 29, 0, 0, 0, 37,
-0, 0, 0, 65, 0, 5, 0, 35, 0, 0, 0, 42, 0, 0, 0, 32, 0, 0, 0, 41, 0, 0, 0, 61, 0, 4, 0, 27, 0, 0, 0, 43,
-0, 0, 0, 42, 0, 0, 0, 61, 0, 4, 0, 27, 0, 0, 0, 44, 0, 0, 0, 29, 0, 0, 0, 146, 0, 5, 0, 27, 0, 0, 0, 45,
-0, 0, 0, 43, 0, 0, 0, 44, 0, 0, 0, 61, 0, 4, 0, 7, 0, 0, 0, 46, 0, 0, 0, 9, 0, 0, 0, 145, 0, 5, 0, 7,
-0, 0, 0, 47, 0, 0, 0, 45, 0, 0, 0, 46, 0, 0, 0, 65, 0, 5, 0, 48, 0, 0, 0, 49, 0, 0, 0, 40, 0, 0, 0, 41,
-0, 0, 0, 62, 0, 3, 0, 49, 0, 0, 0, 47, 0, 0, 0, 61, 0, 4, 0, 27, 0, 0, 0, 52, 0, 0, 0, 29, 0, 0, 0, 61,
-0, 4, 0, 7, 0, 0, 0, 53, 0, 0, 0, 9, 0, 0, 0, 145, 0, 5, 0, 7, 0, 0, 0, 54, 0, 0, 0, 52, 0, 0, 0, 53,
-0, 0, 0, 79, 0, 8, 0, 10, 0, 0, 0, 55, 0, 0, 0, 54, 0, 0, 0, 54, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 2,
-0, 0, 0, 62, 0, 3, 0, 51, 0, 0, 0, 55, 0, 0, 0, 61, 0, 4, 0, 27, 0, 0, 0, 57, 0, 0, 0, 29, 0, 0, 0, 61,
-0, 4, 0, 7, 0, 0, 0, 58, 0, 0, 0, 9, 0, 0, 0, 145, 0, 5, 0, 7, 0, 0, 0, 59, 0, 0, 0, 57, 0, 0, 0, 58,
-0, 0, 0, 79, 0, 8, 0, 10, 0, 0, 0, 60, 0, 0, 0, 59, 0, 0, 0, 59, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 2,
-0, 0, 0, 127, 0, 4, 0, 10, 0, 0, 0, 61, 0, 0, 0, 60, 0, 0, 0, 62, 0, 3, 0, 56, 0, 0, 0, 61, 0, 0, 0, 61,
-0, 4, 0, 27, 0, 0, 0, 63, 0, 0, 0, 29, 0, 0, 0, 61, 0, 4, 0, 7, 0, 0, 0, 64, 0, 0, 0, 19, 0, 0, 0, 145,
-0, 5, 0, 7, 0, 0, 0, 65, 0, 0, 0, 63, 0, 0, 0, 64, 0, 0, 0, 79, 0, 8, 0, 10, 0, 0, 0, 66, 0, 0, 0, 65,
-0, 0, 0, 65, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0, 62, 0, 3, 0, 62, 0, 0, 0, 66, 0, 0, 0, 61,
-0, 4, 0, 7, 0, 0, 0, 70, 0, 0, 0, 69, 0, 0, 0, 62, 0, 3, 0, 67, 0, 0, 0, 70, 0, 0, 0, 61, 0, 4, 0, 71,
-0, 0, 0, 76, 0, 0, 0, 75, 0, 0, 0, 62, 0, 3, 0, 73, 0, 0, 0, 76, 0, 0, 0, 253, 0, 1, 0, 56, 0, 1, 0, 0,
-0, 0, 0, 28, 0, 0, 0, 16, 0, 0, 0, 118, 115, 103, 58, 58, 83, 104, 97, 100, 101, 114, 83, 116, 97, 103, 101, 0, 0, 0, 0, 255,
-255, 255, 255, 255, 255, 255, 255, 16, 0, 0, 0, 4, 0, 0, 0, 109, 97, 105, 110, 29, 0, 0, 0, 17, 0, 0, 0, 118, 115, 103, 58, 58,
-83, 104, 97, 100, 101, 114, 77, 111, 100, 117, 108, 101, 0, 0, 0, 0, 25, 0, 0, 0, 0, 0, 0, 0, 38, 1, 0, 0, 3, 2, 35, 7,
-0, 0, 1, 0, 11, 0, 8, 0, 28, 0, 0, 0, 0, 0, 0, 0, 17, 0, 2, 0, 1, 0, 0, 0, 11, 0, 6, 0, 1, 0, 0, 0,
-71, 76, 83, 76, 46, 115, 116, 100, 46, 52, 53, 48, 0, 0, 0, 0, 14, 0, 3, 0, 0, 0, 0, 0, 1, 0, 0, 0, 15, 0, 8, 0,
-4, 0, 0, 0, 4, 0, 0, 0, 109, 97, 105, 110, 0, 0, 0, 0, 11, 0, 0, 0, 23, 0, 0, 0, 27, 0, 0, 0, 16, 0, 3, 0,
-4, 0, 0, 0, 7, 0, 0, 0, 3, 0, 3, 0, 2, 0, 0, 0, 194, 1, 0, 0, 4, 0, 9, 0, 71, 76, 95, 65, 82, 66, 95, 115,
-101, 112, 97, 114, 97, 116, 101, 95, 115, 104, 97, 100, 101, 114, 95, 111, 98, 106, 101, 99, 116, 115, 0, 0, 5, 0, 4, 0, 4, 0, 0, 0,
-109, 97, 105, 110, 0, 0, 0, 0, 5, 0, 6, 0, 9, 0, 0, 0, 100, 105, 102, 102, 117, 115, 101, 67, 111, 108, 111, 114, 0, 0, 0, 0,
-5, 0, 5, 0, 11, 0, 0, 0, 118, 101, 114, 116, 101, 120, 67, 111, 108, 111, 114, 0, 5, 0, 6, 0, 13, 0, 0, 0, 77, 97, 116, 101,
-114, 105, 97, 108, 68, 97, 116, 97, 0, 0, 0, 0, 6, 0, 7, 0, 13, 0, 0, 0, 0, 0, 0, 0, 97, 109, 98, 105, 101, 110, 116, 67,
-111, 108, 111, 114, 0, 0, 0, 0, 6, 0, 7, 0, 13, 0, 0, 0, 1, 0, 0, 0, 100, 105, 102, 102, 117, 115, 101, 67, 111, 108, 111, 114,
-0, 0, 0, 0, 6, 0, 7, 0, 13, 0, 0, 0, 2, 0, 0, 0, 115, 112, 101, 99, 117, 108, 97, 114, 67, 111, 108, 111, 114, 0, 0, 0,
-6, 0, 7, 0, 13, 0, 0, 0, 3, 0, 0, 0, 101, 109, 105, 115, 115, 105, 118, 101, 67, 111, 108, 111, 114, 0, 0, 0, 6, 0, 6, 0,
-13, 0, 0, 0, 4, 0, 0, 0, 115, 104, 105, 110, 105, 110, 101, 115, 115, 0, 0, 0, 6, 0, 6, 0, 13, 0, 0, 0, 5, 0, 0, 0,
-97, 108, 112, 104, 97, 77, 97, 115, 107, 0, 0, 0, 6, 0, 7, 0, 13, 0, 0, 0, 6, 0, 0, 0, 97, 108, 112, 104, 97, 77, 97, 115,
-107, 67, 117, 116, 111, 102, 102, 0, 5, 0, 5, 0, 15, 0, 0, 0, 109, 97, 116, 101, 114, 105, 97, 108, 0, 0, 0, 0, 5, 0, 5, 0,
-23, 0, 0, 0, 111, 117, 116, 67, 111, 108, 111, 114, 0, 0, 0, 0, 5, 0, 5, 0, 27, 0, 0, 0, 116, 101, 120, 67, 111, 111, 114, 100,
-48, 0, 0, 0, 71, 0, 4, 0, 11, 0, 0, 0, 30, 0, 0, 0, 2, 0, 0, 0, 72, 0, 5, 0, 13, 0, 0, 0, 0, 0, 0, 0,
-35, 0, 0, 0, 0, 0, 0, 0, 72, 0, 5, 0, 13, 0, 0, 0, 1, 0, 0, 0, 35, 0, 0, 0, 16, 0, 0, 0, 72, 0, 5, 0,
-13, 0, 0, 0, 2, 0, 0, 0, 35, 0, 0, 0, 32, 0, 0, 0, 72, 0, 5, 0, 13, 0, 0, 0, 3, 0, 0, 0, 35, 0, 0, 0,
-48, 0, 0, 0, 72, 0, 5, 0, 13, 0, 0, 0, 4, 0, 0, 0, 35, 0, 0, 0, 64, 0, 0, 0, 72, 0, 5, 0, 13, 0, 0, 0,
-5, 0, 0, 0, 35, 0, 0, 0, 68, 0, 0, 0, 72, 0, 5, 0, 13, 0, 0, 0, 6, 0, 0, 0, 35, 0, 0, 0, 72, 0, 0, 0,
-71, 0, 3, 0, 13, 0, 0, 0, 2, 0, 0, 0, 71, 0, 4, 0, 15, 0, 0, 0, 34, 0, 0, 0, 1, 0, 0, 0, 71, 0, 4, 0,
-15, 0, 0, 0, 33, 0, 0, 0, 10, 0, 0, 0, 71, 0, 4, 0, 23, 0, 0, 0, 30, 0, 0, 0, 0, 0, 0, 0, 71, 0, 4, 0,
-27, 0, 0, 0, 30, 0, 0, 0, 3, 0, 0, 0, 19, 0, 2, 0, 2, 0, 0, 0, 33, 0, 3, 0, 3, 0, 0, 0, 2, 0, 0, 0,
-22, 0, 3, 0, 6, 0, 0, 0, 32, 0, 0, 0, 23, 0, 4, 0, 7, 0, 0, 0, 6, 0, 0, 0, 4, 0, 0, 0, 32, 0, 4, 0,
-8, 0, 0, 0, 7, 0, 0, 0, 7, 0, 0, 0, 32, 0, 4, 0, 10, 0, 0, 0, 1, 0, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0,
-10, 0, 0, 0, 11, 0, 0, 0, 1, 0, 0, 0, 30, 0, 9, 0, 13, 0, 0, 0, 7, 0, 0, 0, 7, 0, 0, 0, 7, 0, 0, 0,
-7, 0, 0, 0, 6, 0, 0, 0, 6, 0, 0, 0, 6, 0, 0, 0, 32, 0, 4, 0, 14, 0, 0, 0, 2, 0, 0, 0, 13, 0, 0, 0,
-59, 0, 4, 0, 14, 0, 0, 0, 15, 0, 0, 0, 2, 0, 0, 0, 21, 0, 4, 0, 16, 0, 0, 0, 32, 0, 0, 0, 1, 0, 0, 0,
-43, 0, 4, 0, 16, 0, 0, 0, 17, 0, 0, 0, 1, 0, 0, 0, 32, 0, 4, 0, 18, 0, 0, 0, 2, 0, 0, 0, 7, 0, 0, 0,
-32, 0, 4, 0, 22, 0, 0, 0, 3, 0, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 22, 0, 0, 0, 23, 0, 0, 0, 3, 0, 0, 0,
-23, 0, 4, 0, 25, 0, 0, 0, 6, 0, 0, 0, 2, 0, 0, 0, 32, 0, 4, 0, 26, 0, 0, 0, 1, 0, 0, 0, 25, 0, 0, 0,
-59, 0, 4, 0, 26, 0, 0, 0, 27, 0, 0, 0, 1, 0, 0, 0, 54, 0, 5, 0, 2, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0,
-3, 0, 0, 0, 248, 0, 2, 0, 5, 0, 0, 0, 59, 0, 4, 0, 8, 0, 0, 0, 9, 0, 0, 0, 7, 0, 0, 0, 61, 0, 4, 0,
-7, 0, 0, 0, 12, 0, 0, 0, 11, 0, 0, 0, 65, 0, 5, 0, 18, 0, 0, 0, 19, 0, 0, 0, 15, 0, 0, 0, 17, 0, 0, 0,
-61, 0, 4, 0, 7, 0, 0, 0, 20, 0, 0, 0, 19, 0, 0, 0, 133, 0, 5, 0, 7, 0, 0, 0, 21, 0, 0, 0, 12, 0, 0, 0,
-20, 0, 0, 0, 62, 0, 3, 0, 9, 0, 0, 0, 21, 0, 0, 0, 61, 0, 4, 0, 7, 0, 0, 0, 24, 0, 0, 0, 9, 0, 0, 0,
-62, 0, 3, 0, 23, 0, 0, 0, 24, 0, 0, 0, 253, 0, 1, 0, 56, 0, 1, 0, 0, 0, 0, 0, 30, 0, 0, 0, 26, 0, 0, 0,
-118, 115, 103, 58, 58, 83, 104, 97, 100, 101, 114, 67, 111, 109, 112, 105, 108, 101, 83, 101, 116, 116, 105, 110, 103, 115, 0, 0, 64, 0, 100, 0,
-0, 0, 0, 0, 0, 0, 194, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 13, 0, 0, 0, 86, 83, 71, 95, 66, 73, 76, 76,
-66, 79, 65, 82, 68, 2, 0, 0, 0, 31, 0, 0, 0, 16, 0, 0, 0, 118, 115, 103, 58, 58, 83, 104, 97, 100, 101, 114, 83, 116, 97, 103,
-101, 0, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 1, 0, 0, 0, 4, 0, 0, 0, 109, 97, 105, 110, 32, 0, 0, 0, 17, 0, 0,
-0, 118, 115, 103, 58, 58, 83, 104, 97, 100, 101, 114, 77, 111, 100, 117, 108, 101, 0, 0, 0, 0, 30, 0, 0, 0, 0, 0, 0, 0, 202, 3,
-0, 0, 3, 2, 35, 7, 0, 0, 1, 0, 11, 0, 8, 0, 145, 0, 0, 0, 0, 0, 0, 0, 17, 0, 2, 0, 1, 0, 0, 0, 11, 0,
-6, 0, 1, 0, 0, 0, 71, 76, 83, 76, 46, 115, 116, 100, 46, 52, 53, 48, 0, 0, 0, 0, 14, 0, 3, 0, 0, 0, 0, 0, 1, 0,
-0, 0, 15, 0, 16, 0, 0, 0, 0, 0, 4, 0, 0, 0, 109, 97, 105, 110, 0, 0, 0, 0, 69, 0, 0, 0, 76, 0, 0, 0, 92, 0,
-0, 0, 109, 0, 0, 0, 120, 0, 0, 0, 125, 0, 0, 0, 131, 0, 0, 0, 136, 0, 0, 0, 137, 0, 0, 0, 141, 0, 0, 0, 143, 0,
-0, 0, 3, 0, 3, 0, 2, 0, 0, 0, 194, 1, 0, 0, 4, 0, 9, 0, 71, 76, 95, 65, 82, 66, 95, 115, 101, 112, 97, 114, 97, 116,
-101, 95, 115, 104, 97, 100, 101, 114, 95, 111, 98, 106, 101, 99, 116, 115, 0, 0, 5, 0, 4, 0, 4, 0, 0, 0, 109, 97, 105, 110, 0, 0,
-0, 0, 5, 0, 10, 0, 14, 0, 0, 0, 99, 111, 109, 112, 117, 116, 101, 66, 105, 108, 108, 98, 111, 97, 100, 77, 97, 116, 114, 105, 120, 40,
-118, 102, 52, 59, 102, 49, 59, 0, 0, 0, 5, 0, 5, 0, 12, 0, 0, 0, 99, 101, 110, 116, 101, 114, 95, 101, 121, 101, 0, 0, 5, 0,
-7, 0, 13, 0, 0, 0, 97, 117, 116, 111, 83, 99, 97, 108, 101, 68, 105, 115, 116, 97, 110, 99, 101, 0, 0, 0, 5, 0, 5, 0, 16, 0,
-0, 0, 100, 105, 115, 116, 97, 110, 99, 101, 0, 0, 0, 0, 5, 0, 4, 0, 22, 0, 0, 0, 115, 99, 97, 108, 101, 0, 0, 0, 5, 0,
-3, 0, 37, 0, 0, 0, 83, 0, 0, 0, 5, 0, 3, 0, 47, 0, 0, 0, 84, 0, 0, 0, 5, 0, 4, 0, 66, 0, 0, 0, 118, 101,
-114, 116, 101, 120, 0, 0, 5, 0, 5, 0, 69, 0, 0, 0, 118, 115, 103, 95, 86, 101, 114, 116, 101, 120, 0, 0, 5, 0, 4, 0, 75, 0,
-0, 0, 110, 111, 114, 109, 97, 108, 0, 0, 5, 0, 5, 0, 76, 0, 0, 0, 118, 115, 103, 95, 78, 111, 114, 109, 97, 108, 0, 0, 5, 0,
-3, 0, 82, 0, 0, 0, 109, 118, 0, 0, 5, 0, 6, 0, 83, 0, 0, 0, 80, 117, 115, 104, 67, 111, 110, 115, 116, 97, 110, 116, 115, 0,
-0, 0, 6, 0, 6, 0, 83, 0, 0, 0, 0, 0, 0, 0, 112, 114, 111, 106, 101, 99, 116, 105, 111, 110, 0, 0, 6, 0, 6, 0, 83, 0,
-0, 0, 1, 0, 0, 0, 109, 111, 100, 101, 108, 86, 105, 101, 119, 0, 0, 0, 5, 0, 3, 0, 85, 0, 0, 0, 112, 99, 0, 0, 5, 0,
-9, 0, 92, 0, 0, 0, 118, 115, 103, 95, 112, 111, 115, 105, 116, 105, 111, 110, 95, 115, 99, 97, 108, 101, 68, 105, 115, 116, 97, 110, 99, 101,
-0, 0, 5, 0, 4, 0, 100, 0, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 101, 0, 0, 0, 112, 97, 114, 97, 109, 0,
-0, 0, 5, 0, 6, 0, 107, 0, 0, 0, 103, 108, 95, 80, 101, 114, 86, 101, 114, 116, 101, 120, 0, 0, 0, 0, 6, 0, 6, 0, 107, 0,
-0, 0, 0, 0, 0, 0, 103, 108, 95, 80, 111, 115, 105, 116, 105, 111, 110, 0, 5, 0, 3, 0, 109, 0, 0, 0, 0, 0, 0, 0, 5, 0,
-4, 0, 120, 0, 0, 0, 101, 121, 101, 80, 111, 115, 0, 0, 5, 0, 4, 0, 125, 0, 0, 0, 118, 105, 101, 119, 68, 105, 114, 0, 5, 0,
-5, 0, 131, 0, 0, 0, 110, 111, 114, 109, 97, 108, 68, 105, 114, 0, 0, 0, 5, 0, 5, 0, 136, 0, 0, 0, 118, 101, 114, 116, 101, 120,
-67, 111, 108, 111, 114, 0, 5, 0, 5, 0, 137, 0, 0, 0, 118, 115, 103, 95, 67, 111, 108, 111, 114, 0, 0, 0, 5, 0, 5, 0, 141, 0,
-0, 0, 116, 101, 120, 67, 111, 111, 114, 100, 48, 0, 0, 0, 5, 0, 6, 0, 143, 0, 0, 0, 118, 115, 103, 95, 84, 101, 120, 67, 111, 111,
-114, 100, 48, 0, 0, 0, 71, 0, 4, 0, 69, 0, 0, 0, 30, 0, 0, 0, 0, 0, 0, 0, 71, 0, 4, 0, 76, 0, 0, 0, 30, 0,
-0, 0, 1, 0, 0, 0, 72, 0, 4, 0, 83, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 72, 0, 5, 0, 83, 0, 0, 0, 0, 0,
-0, 0, 35, 0, 0, 0, 0, 0, 0, 0, 72, 0, 5, 0, 83, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 16, 0, 0, 0, 72, 0,
-4, 0, 83, 0, 0, 0, 1, 0, 0, 0, 5, 0, 0, 0, 72, 0, 5, 0, 83, 0, 0, 0, 1, 0, 0, 0, 35, 0, 0, 0, 64, 0,
-0, 0, 72, 0, 5, 0, 83, 0, 0, 0, 1, 0, 0, 0, 7, 0, 0, 0, 16, 0, 0, 0, 71, 0, 3, 0, 83, 0, 0, 0, 2, 0,
-0, 0, 71, 0, 4, 0, 92, 0, 0, 0, 30, 0, 0, 0, 4, 0, 0, 0, 72, 0, 5, 0, 107, 0, 0, 0, 0, 0, 0, 0, 11, 0,
-0, 0, 0, 0, 0, 0, 71, 0, 3, 0, 107, 0, 0, 0, 2, 0, 0, 0, 71, 0, 4, 0, 120, 0, 0, 0, 30, 0, 0, 0, 0, 0,
-0, 0, 71, 0, 4, 0, 125, 0, 0, 0, 30, 0, 0, 0, 5, 0, 0, 0, 71, 0, 4, 0, 131, 0, 0, 0, 30, 0, 0, 0, 1, 0,
-0, 0, 71, 0, 4, 0, 136, 0, 0, 0, 30, 0, 0, 0, 2, 0, 0, 0, 71, 0, 4, 0, 137, 0, 0, 0, 30, 0, 0, 0, 3, 0,
-0, 0, 71, 0, 4, 0, 141, 0, 0, 0, 30, 0, 0, 0, 3, 0, 0, 0, 71, 0, 4, 0, 143, 0, 0, 0, 30, 0, 0, 0, 2, 0,
-0, 0, 19, 0, 2, 0, 2, 0, 0, 0, 33, 0, 3, 0, 3, 0, 0, 0, 2, 0, 0, 0, 22, 0, 3, 0, 6, 0, 0, 0, 32, 0,
-0, 0, 23, 0, 4, 0, 7, 0, 0, 0, 6, 0, 0, 0, 4, 0, 0, 0, 32, 0, 4, 0, 8, 0, 0, 0, 7, 0, 0, 0, 7, 0,
-0, 0, 32, 0, 4, 0, 9, 0, 0, 0, 7, 0, 0, 0, 6, 0, 0, 0, 24, 0, 4, 0, 10, 0, 0, 0, 7, 0, 0, 0, 4, 0,
-0, 0, 33, 0, 5, 0, 11, 0, 0, 0, 10, 0, 0, 0, 8, 0, 0, 0, 9, 0, 0, 0, 21, 0, 4, 0, 17, 0, 0, 0, 32, 0,
-0, 0, 0, 0, 0, 0, 43, 0, 4, 0, 17, 0, 0, 0, 18, 0, 0, 0, 2, 0, 0, 0, 20, 0, 2, 0, 25, 0, 0, 0, 43, 0,
-4, 0, 6, 0, 0, 0, 34, 0, 0, 0, 0, 0, 128, 63, 32, 0, 4, 0, 36, 0, 0, 0, 7, 0, 0, 0, 10, 0, 0, 0, 43, 0,
-4, 0, 6, 0, 0, 0, 39, 0, 0, 0, 0, 0, 0, 0, 43, 0, 4, 0, 17, 0, 0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 43, 0,
-4, 0, 17, 0, 0, 0, 51, 0, 0, 0, 1, 0, 0, 0, 23, 0, 4, 0, 67, 0, 0, 0, 6, 0, 0, 0, 3, 0, 0, 0, 32, 0,
-4, 0, 68, 0, 0, 0, 1, 0, 0, 0, 67, 0, 0, 0, 59, 0, 4, 0, 68, 0, 0, 0, 69, 0, 0, 0, 1, 0, 0, 0, 59, 0,
-4, 0, 68, 0, 0, 0, 76, 0, 0, 0, 1, 0, 0, 0, 30, 0, 4, 0, 83, 0, 0, 0, 10, 0, 0, 0, 10, 0, 0, 0, 32, 0,
-4, 0, 84, 0, 0, 0, 9, 0, 0, 0, 83, 0, 0, 0, 59, 0, 4, 0, 84, 0, 0, 0, 85, 0, 0, 0, 9, 0, 0, 0, 21, 0,
-4, 0, 86, 0, 0, 0, 32, 0, 0, 0, 1, 0, 0, 0, 43, 0, 4, 0, 86, 0, 0, 0, 87, 0, 0, 0, 1, 0, 0, 0, 32, 0,
-4, 0, 88, 0, 0, 0, 9, 0, 0, 0, 10, 0, 0, 0, 32, 0, 4, 0, 91, 0, 0, 0, 1, 0, 0, 0, 7, 0, 0, 0, 59, 0,
-4, 0, 91, 0, 0, 0, 92, 0, 0, 0, 1, 0, 0, 0, 43, 0, 4, 0, 17, 0, 0, 0, 102, 0, 0, 0, 3, 0, 0, 0, 32, 0,
-4, 0, 103, 0, 0, 0, 1, 0, 0, 0, 6, 0, 0, 0, 30, 0, 3, 0, 107, 0, 0, 0, 7, 0, 0, 0, 32, 0, 4, 0, 108, 0,
-0, 0, 3, 0, 0, 0, 107, 0, 0, 0, 59, 0, 4, 0, 108, 0, 0, 0, 109, 0, 0, 0, 3, 0, 0, 0, 43, 0, 4, 0, 86, 0,
-0, 0, 110, 0, 0, 0, 0, 0, 0, 0, 32, 0, 4, 0, 117, 0, 0, 0, 3, 0, 0, 0, 7, 0, 0, 0, 32, 0, 4, 0, 119, 0,
-0, 0, 3, 0, 0, 0, 67, 0, 0, 0, 59, 0, 4, 0, 119, 0, 0, 0, 120, 0, 0, 0, 3, 0, 0, 0, 59, 0, 4, 0, 119, 0,
-0, 0, 125, 0, 0, 0, 3, 0, 0, 0, 59, 0, 4, 0, 119, 0, 0, 0, 131, 0, 0, 0, 3, 0, 0, 0, 59, 0, 4, 0, 117, 0,
-0, 0, 136, 0, 0, 0, 3, 0, 0, 0, 59, 0, 4, 0, 91, 0, 0, 0, 137, 0, 0, 0, 1, 0, 0, 0, 23, 0, 4, 0, 139, 0,
-0, 0, 6, 0, 0, 0, 2, 0, 0, 0, 32, 0, 4, 0, 140, 0, 0, 0, 3, 0, 0, 0, 139, 0, 0, 0, 59, 0, 4, 0, 140, 0,
-0, 0, 141, 0, 0, 0, 3, 0, 0, 0, 32, 0, 4, 0, 142, 0, 0, 0, 1, 0, 0, 0, 139, 0, 0, 0, 59, 0, 4, 0, 142, 0,
-0, 0, 143, 0, 0, 0, 1, 0, 0, 0, 54, 0, 5, 0, 2, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 248, 0,
-2, 0, 5, 0, 0, 0, 59, 0, 4, 0, 8, 0, 0, 0, 66, 0, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 8, 0, 0, 0, 75, 0,
-0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 36, 0, 0, 0, 82, 0, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 8, 0, 0, 0, 100, 0,
-0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 9, 0, 0, 0, 101, 0, 0, 0, 7, 0, 0, 0, 61, 0, 4, 0, 67, 0, 0, 0, 70, 0,
-0, 0, 69, 0, 0, 0, 81, 0, 5, 0, 6, 0, 0, 0, 71, 0, 0, 0, 70, 0, 0, 0, 0, 0, 0, 0, 81, 0, 5, 0, 6, 0,
-0, 0, 72, 0, 0, 0, 70, 0, 0, 0, 1, 0, 0, 0, 81, 0, 5, 0, 6, 0, 0, 0, 73, 0, 0, 0, 70, 0, 0, 0, 2, 0,
-0, 0, 80, 0, 7, 0, 7, 0, 0, 0, 74, 0, 0, 0, 71, 0, 0, 0, 72, 0, 0, 0, 73, 0, 0, 0, 34, 0, 0, 0, 62, 0,
-3, 0, 66, 0, 0, 0, 74, 0, 0, 0, 61, 0, 4, 0, 67, 0, 0, 0, 77, 0, 0, 0, 76, 0, 0, 0, 81, 0, 5, 0, 6, 0,
-0, 0, 78, 0, 0, 0, 77, 0, 0, 0, 0, 0, 0, 0, 81, 0, 5, 0, 6, 0, 0, 0, 79, 0, 0, 0, 77, 0, 0, 0, 1, 0,
-0, 0, 81, 0, 5, 0, 6, 0, 0, 0, 80, 0, 0, 0, 77, 0, 0, 0, 2, 0, 0, 0, 80, 0, 7, 0, 7, 0, 0, 0, 81, 0,
-0, 0, 78, 0, 0, 0, 79, 0, 0, 0, 80, 0, 0, 0, 39, 0, 0, 0, 62, 0, 3, 0, 75, 0, 0, 0, 81, 0, 0, 0, 65, 0,
-5, 0, 88, 0, 0, 0, 89, 0, 0, 0, 85, 0, 0, 0, 87, 0, 0, 0, 61, 0, 4, 0, 10, 0, 0, 0, 90, 0, 0, 0, 89, 0,
-0, 0, 61, 0, 4, 0, 7, 0, 0, 0, 93, 0, 0, 0, 92, 0, 0, 0, 79, 0, 8, 0, 67, 0, 0, 0, 94, 0, 0, 0, 93, 0,
-0, 0, 93, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0, 81, 0, 5, 0, 6, 0, 0, 0, 95, 0, 0, 0, 94, 0,
-0, 0, 0, 0, 0, 0, 81, 0, 5, 0, 6, 0, 0, 0, 96, 0, 0, 0, 94, 0, 0, 0, 1, 0, 0, 0, 81, 0, 5, 0, 6, 0,
-0, 0, 97, 0, 0, 0, 94, 0, 0, 0, 2, 0, 0, 0, 80, 0, 7, 0, 7, 0, 0, 0, 98, 0, 0, 0, 95, 0, 0, 0, 96, 0,
-0, 0, 97, 0, 0, 0, 34, 0, 0, 0, 145, 0, 5, 0, 7, 0, 0, 0, 99, 0, 0, 0, 90, 0, 0, 0, 98, 0, 0, 0, 62, 0,
-3, 0, 100, 0, 0, 0, 99, 0, 0, 0, 65, 0, 5, 0, 103, 0, 0, 0, 104, 0, 0, 0, 92, 0, 0, 0, 102, 0, 0, 0, 61, 0,
-4, 0, 6, 0, 0, 0, 105, 0, 0, 0, 104, 0, 0, 0, 62, 0, 3, 0, 101, 0, 0, 0, 105, 0, 0, 0, 57, 0, 6, 0, 10, 0,
-0, 0, 106, 0, 0, 0, 14, 0, 0, 0, 100, 0, 0, 0, 101, 0, 0, 0, 62, 0, 3, 0, 82, 0, 0, 0, 106, 0, 0, 0, 65, 0,
-5, 0, 88, 0, 0, 0, 111, 0, 0, 0, 85, 0, 0, 0, 110, 0, 0, 0, 61, 0, 4, 0, 10, 0, 0, 0, 112, 0, 0, 0, 111, 0,
-0, 0, 61, 0, 4, 0, 10, 0, 0, 0, 113, 0, 0, 0, 82, 0, 0, 0, 146, 0, 5, 0, 10, 0, 0, 0, 114, 0, 0, 0, 112, 0,
-0, 0, 113, 0, 0, 0, 61, 0, 4, 0, 7, 0, 0, 0, 115, 0, 0, 0, 66, 0, 0, 0, 145, 0, 5, 0, 7, 0, 0, 0, 116, 0,
-0, 0, 114, 0, 0, 0, 115, 0, 0, 0, 65, 0, 5, 0, 117, 0, 0, 0, 118, 0, 0, 0, 109, 0, 0, 0, 110, 0, 0, 0, 62, 0,
-3, 0, 118, 0, 0, 0, 116, 0, 0, 0, 61, 0, 4, 0, 10, 0, 0, 0, 121, 0, 0, 0, 82, 0, 0, 0, 61, 0, 4, 0, 7, 0,
-0, 0, 122, 0, 0, 0, 66, 0, 0, 0, 145, 0, 5, 0, 7, 0, 0, 0, 123, 0, 0, 0, 121, 0, 0, 0, 122, 0, 0, 0, 79, 0,
-8, 0, 67, 0, 0, 0, 124, 0, 0, 0, 123, 0, 0, 0, 123, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0, 62, 0,
-3, 0, 120, 0, 0, 0, 124, 0, 0, 0, 61, 0, 4, 0, 10, 0, 0, 0, 126, 0, 0, 0, 82, 0, 0, 0, 61, 0, 4, 0, 7, 0,
-0, 0, 127, 0, 0, 0, 66, 0, 0, 0, 145, 0, 5, 0, 7, 0, 0, 0, 128, 0, 0, 0, 126, 0, 0, 0, 127, 0, 0, 0, 79, 0,
-8, 0, 67, 0, 0, 0, 129, 0, 0, 0, 128, 0, 0, 0, 128, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0, 127, 0,
-4, 0, 67, 0, 0, 0, 130, 0, 0, 0, 129, 0, 0, 0, 62, 0, 3, 0, 125, 0, 0, 0, 130, 0, 0, 0, 61, 0, 4, 0, 10, 0,
-0, 0, 132, 0, 0, 0, 82, 0, 0, 0, 61, 0, 4, 0, 7, 0, 0, 0, 133, 0, 0, 0, 75, 0, 0, 0, 145, 0, 5, 0, 7, 0,
-0, 0, 134, 0, 0, 0, 132, 0, 0, 0, 133, 0, 0, 0, 79, 0, 8, 0, 67, 0, 0, 0, 135, 0, 0, 0, 134, 0, 0, 0, 134, 0,
-0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0, 62, 0, 3, 0, 131, 0, 0, 0, 135, 0, 0, 0, 61, 0, 4, 0, 7, 0,
-0, 0, 138, 0, 0, 0, 137, 0, 0, 0, 62, 0, 3, 0, 136, 0, 0, 0, 138, 0, 0, 0, 61, 0, 4, 0, 139, 0, 0, 0, 144, 0,
-0, 0, 143, 0, 0, 0, 62, 0, 3, 0, 141, 0, 0, 0, 144, 0, 0, 0, 253, 0, 1, 0, 56, 0, 1, 0, 54, 0, 5, 0, 10, 0,
-0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 11, 0, 0, 0, 55, 0, 3, 0, 8, 0, 0, 0, 12, 0, 0, 0, 55, 0, 3, 0, 9, 0,
-0, 0, 13, 0, 0, 0, 248, 0, 2, 0, 15, 0, 0, 0, 59, 0, 4, 0, 9, 0, 0, 0, 16, 0, 0, 0, 7, 0, 0, 0, 59, 0,
-4, 0, 9, 0, 0, 0, 22, 0, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 9, 0, 0, 0, 27, 0, 0, 0, 7, 0, 0, 0, 59, 0,
-4, 0, 36, 0, 0, 0, 37, 0, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 36, 0, 0, 0, 47, 0, 0, 0, 7, 0, 0, 0, 65, 0,
-5, 0, 9, 0, 0, 0, 19, 0, 0, 0, 12, 0, 0, 0, 18, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 20, 0, 0, 0, 19, 0,
-0, 0, 127, 0, 4, 0, 6, 0, 0, 0, 21, 0, 0, 0, 20, 0, 0, 0, 62, 0, 3, 0, 16, 0, 0, 0, 21, 0, 0, 0, 61, 0,
-4, 0, 6, 0, 0, 0, 23, 0, 0, 0, 16, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 24, 0, 0, 0, 13, 0, 0, 0, 184, 0,
-5, 0, 25, 0, 0, 0, 26, 0, 0, 0, 23, 0, 0, 0, 24, 0, 0, 0, 247, 0, 3, 0, 29, 0, 0, 0, 0, 0, 0, 0, 250, 0,
-4, 0, 26, 0, 0, 0, 28, 0, 0, 0, 33, 0, 0, 0, 248, 0, 2, 0, 28, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 30, 0,
-0, 0, 16, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 31, 0, 0, 0, 13, 0, 0, 0, 136, 0, 5, 0, 6, 0, 0, 0, 32, 0,
-0, 0, 30, 0, 0, 0, 31, 0, 0, 0, 62, 0, 3, 0, 27, 0, 0, 0, 32, 0, 0, 0, 249, 0, 2, 0, 29, 0, 0, 0, 248, 0,
-2, 0, 33, 0, 0, 0, 62, 0, 3, 0, 27, 0, 0, 0, 34, 0, 0, 0, 249, 0, 2, 0, 29, 0, 0, 0, 248, 0, 2, 0, 29, 0,
-0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 35, 0, 0, 0, 27, 0, 0, 0, 62, 0, 3, 0, 22, 0, 0, 0, 35, 0, 0, 0, 61, 0,
-4, 0, 6, 0, 0, 0, 38, 0, 0, 0, 22, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 40, 0, 0, 0, 22, 0, 0, 0, 61, 0,
-4, 0, 6, 0, 0, 0, 41, 0, 0, 0, 22, 0, 0, 0, 80, 0, 7, 0, 7, 0, 0, 0, 42, 0, 0, 0, 38, 0, 0, 0, 39, 0,
-0, 0, 39, 0, 0, 0, 39, 0, 0, 0, 80, 0, 7, 0, 7, 0, 0, 0, 43, 0, 0, 0, 39, 0, 0, 0, 40, 0, 0, 0, 39, 0,
-0, 0, 39, 0, 0, 0, 80, 0, 7, 0, 7, 0, 0, 0, 44, 0, 0, 0, 39, 0, 0, 0, 39, 0, 0, 0, 41, 0, 0, 0, 39, 0,
-0, 0, 80, 0, 7, 0, 7, 0, 0, 0, 45, 0, 0, 0, 39, 0, 0, 0, 39, 0, 0, 0, 39, 0, 0, 0, 34, 0, 0, 0, 80, 0,
-7, 0, 10, 0, 0, 0, 46, 0, 0, 0, 42, 0, 0, 0, 43, 0, 0, 0, 44, 0, 0, 0, 45, 0, 0, 0, 62, 0, 3, 0, 37, 0,
-0, 0, 46, 0, 0, 0, 65, 0, 5, 0, 9, 0, 0, 0, 49, 0, 0, 0, 12, 0, 0, 0, 48, 0, 0, 0, 61, 0, 4, 0, 6, 0,
-0, 0, 50, 0, 0, 0, 49, 0, 0, 0, 65, 0, 5, 0, 9, 0, 0, 0, 52, 0, 0, 0, 12, 0, 0, 0, 51, 0, 0, 0, 61, 0,
-4, 0, 6, 0, 0, 0, 53, 0, 0, 0, 52, 0, 0, 0, 65, 0, 5, 0, 9, 0, 0, 0, 54, 0, 0, 0, 12, 0, 0, 0, 18, 0,
-0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 55, 0, 0, 0, 54, 0, 0, 0, 80, 0, 7, 0, 7, 0, 0, 0, 56, 0, 0, 0, 34, 0,
-0, 0, 39, 0, 0, 0, 39, 0, 0, 0, 39, 0, 0, 0, 80, 0, 7, 0, 7, 0, 0, 0, 57, 0, 0, 0, 39, 0, 0, 0, 34, 0,
-0, 0, 39, 0, 0, 0, 39, 0, 0, 0, 80, 0, 7, 0, 7, 0, 0, 0, 58, 0, 0, 0, 39, 0, 0, 0, 39, 0, 0, 0, 34, 0,
-0, 0, 39, 0, 0, 0, 80, 0, 7, 0, 7, 0, 0, 0, 59, 0, 0, 0, 50, 0, 0, 0, 53, 0, 0, 0, 55, 0, 0, 0, 34, 0,
-0, 0, 80, 0, 7, 0, 10, 0, 0, 0, 60, 0, 0, 0, 56, 0, 0, 0, 57, 0, 0, 0, 58, 0, 0, 0, 59, 0, 0, 0, 62, 0,
-3, 0, 47, 0, 0, 0, 60, 0, 0, 0, 61, 0, 4, 0, 10, 0, 0, 0, 61, 0, 0, 0, 47, 0, 0, 0, 61, 0, 4, 0, 10, 0,
-0, 0, 62, 0, 0, 0, 37, 0, 0, 0, 146, 0, 5, 0, 10, 0, 0, 0, 63, 0, 0, 0, 61, 0, 0, 0, 62, 0, 0, 0, 254, 0,
-2, 0, 63, 0, 0, 0, 56, 0, 1, 0, 0, 0, 0, 0, 28, 0, 0, 0, 33, 0, 0, 0, 26, 0, 0, 0, 118, 115, 103, 58, 58, 83,
-104, 97, 100, 101, 114, 67, 111, 109, 112, 105, 108, 101, 83, 101, 116, 116, 105, 110, 103, 115, 0, 0, 64, 0, 100, 0, 0, 0, 0, 0, 0, 0,
-194, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 15, 0, 0, 0, 86, 83, 71, 95, 68, 73, 70, 70, 85, 83, 69, 95, 77, 65,
-80, 2, 0, 0, 0, 26, 0, 0, 0, 34, 0, 0, 0, 16, 0, 0, 0, 118, 115, 103, 58, 58, 83, 104, 97, 100, 101, 114, 83, 116, 97, 103,
-101, 0, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 16, 0, 0, 0, 4, 0, 0, 0, 109, 97, 105, 110, 35, 0, 0, 0, 17, 0, 0,
-0, 118, 115, 103, 58, 58, 83, 104, 97, 100, 101, 114, 77, 111, 100, 117, 108, 101, 0, 0, 0, 0, 33, 0, 0, 0, 0, 0, 0, 0, 96, 1,
-0, 0, 3, 2, 35, 7, 0, 0, 1, 0, 11, 0, 8, 0, 37, 0, 0, 0, 0, 0, 0, 0, 17, 0, 2, 0, 1, 0, 0, 0, 11, 0,
-6, 0, 1, 0, 0, 0, 71, 76, 83, 76, 46, 115, 116, 100, 46, 52, 53, 48, 0, 0, 0, 0, 14, 0, 3, 0, 0, 0, 0, 0, 1, 0,
-0, 0, 15, 0, 8, 0, 4, 0, 0, 0, 4, 0, 0, 0, 109, 97, 105, 110, 0, 0, 0, 0, 11, 0, 0, 0, 29, 0, 0, 0, 35, 0,
-0, 0, 16, 0, 3, 0, 4, 0, 0, 0, 7, 0, 0, 0, 3, 0, 3, 0, 2, 0, 0, 0, 194, 1, 0, 0, 4, 0, 9, 0, 71, 76,
-95, 65, 82, 66, 95, 115, 101, 112, 97, 114, 97, 116, 101, 95, 115, 104, 97, 100, 101, 114, 95, 111, 98, 106, 101, 99, 116, 115, 0, 0, 5, 0,
-4, 0, 4, 0, 0, 0, 109, 97, 105, 110, 0, 0, 0, 0, 5, 0, 6, 0, 9, 0, 0, 0, 100, 105, 102, 102, 117, 115, 101, 67, 111, 108,
-111, 114, 0, 0, 0, 0, 5, 0, 5, 0, 11, 0, 0, 0, 118, 101, 114, 116, 101, 120, 67, 111, 108, 111, 114, 0, 5, 0, 6, 0, 13, 0,
-0, 0, 77, 97, 116, 101, 114, 105, 97, 108, 68, 97, 116, 97, 0, 0, 0, 0, 6, 0, 7, 0, 13, 0, 0, 0, 0, 0, 0, 0, 97, 109,
-98, 105, 101, 110, 116, 67, 111, 108, 111, 114, 0, 0, 0, 0, 6, 0, 7, 0, 13, 0, 0, 0, 1, 0, 0, 0, 100, 105, 102, 102, 117, 115,
-101, 67, 111, 108, 111, 114, 0, 0, 0, 0, 6, 0, 7, 0, 13, 0, 0, 0, 2, 0, 0, 0, 115, 112, 101, 99, 117, 108, 97, 114, 67, 111,
-108, 111, 114, 0, 0, 0, 6, 0, 7, 0, 13, 0, 0, 0, 3, 0, 0, 0, 101, 109, 105, 115, 115, 105, 118, 101, 67, 111, 108, 111, 114, 0,
-0, 0, 6, 0, 6, 0, 13, 0, 0, 0, 4, 0, 0, 0, 115, 104, 105, 110, 105, 110, 101, 115, 115, 0, 0, 0, 6, 0, 6, 0, 13, 0,
-0, 0, 5, 0, 0, 0, 97, 108, 112, 104, 97, 77, 97, 115, 107, 0, 0, 0, 6, 0, 7, 0, 13, 0, 0, 0, 6, 0, 0, 0, 97, 108,
-112, 104, 97, 77, 97, 115, 107, 67, 117, 116, 111, 102, 102, 0, 5, 0, 5, 0, 15, 0, 0, 0, 109, 97, 116, 101, 114, 105, 97, 108, 0, 0,
-0, 0, 5, 0, 5, 0, 25, 0, 0, 0, 100, 105, 102, 102, 117, 115, 101, 77, 97, 112, 0, 0, 5, 0, 5, 0, 29, 0, 0, 0, 116, 101,
-120, 67, 111, 111, 114, 100, 48, 0, 0, 0, 5, 0, 5, 0, 35, 0, 0, 0, 111, 117, 116, 67, 111, 108, 111, 114, 0, 0, 0, 0, 71, 0,
-4, 0, 11, 0, 0, 0, 30, 0, 0, 0, 2, 0, 0, 0, 72, 0, 5, 0, 13, 0, 0, 0, 0, 0, 0, 0, 35, 0, 0, 0, 0, 0,
-0, 0, 72, 0, 5, 0, 13, 0, 0, 0, 1, 0, 0, 0, 35, 0, 0, 0, 16, 0, 0, 0, 72, 0, 5, 0, 13, 0, 0, 0, 2, 0,
-0, 0, 35, 0, 0, 0, 32, 0, 0, 0, 72, 0, 5, 0, 13, 0, 0, 0, 3, 0, 0, 0, 35, 0, 0, 0, 48, 0, 0, 0, 72, 0,
-5, 0, 13, 0, 0, 0, 4, 0, 0, 0, 35, 0, 0, 0, 64, 0, 0, 0, 72, 0, 5, 0, 13, 0, 0, 0, 5, 0, 0, 0, 35, 0,
-0, 0, 68, 0, 0, 0, 72, 0, 5, 0, 13, 0, 0, 0, 6, 0, 0, 0, 35, 0, 0, 0, 72, 0, 0, 0, 71, 0, 3, 0, 13, 0,
-0, 0, 2, 0, 0, 0, 71, 0, 4, 0, 15, 0, 0, 0, 34, 0, 0, 0, 1, 0, 0, 0, 71, 0, 4, 0, 15, 0, 0, 0, 33, 0,
-0, 0, 10, 0, 0, 0, 71, 0, 4, 0, 25, 0, 0, 0, 34, 0, 0, 0, 1, 0, 0, 0, 71, 0, 4, 0, 25, 0, 0, 0, 33, 0,
-0, 0, 0, 0, 0, 0, 71, 0, 4, 0, 29, 0, 0, 0, 30, 0, 0, 0, 3, 0, 0, 0, 71, 0, 4, 0, 35, 0, 0, 0, 30, 0,
-0, 0, 0, 0, 0, 0, 19, 0, 2, 0, 2, 0, 0, 0, 33, 0, 3, 0, 3, 0, 0, 0, 2, 0, 0, 0, 22, 0, 3, 0, 6, 0,
-0, 0, 32, 0, 0, 0, 23, 0, 4, 0, 7, 0, 0, 0, 6, 0, 0, 0, 4, 0, 0, 0, 32, 0, 4, 0, 8, 0, 0, 0, 7, 0,
-0, 0, 7, 0, 0, 0, 32, 0, 4, 0, 10, 0, 0, 0, 1, 0, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 10, 0, 0, 0, 11, 0,
-0, 0, 1, 0, 0, 0, 30, 0, 9, 0, 13, 0, 0, 0, 7, 0, 0, 0, 7, 0, 0, 0, 7, 0, 0, 0, 7, 0, 0, 0, 6, 0,
-0, 0, 6, 0, 0, 0, 6, 0, 0, 0, 32, 0, 4, 0, 14, 0, 0, 0, 2, 0, 0, 0, 13, 0, 0, 0, 59, 0, 4, 0, 14, 0,
-0, 0, 15, 0, 0, 0, 2, 0, 0, 0, 21, 0, 4, 0, 16, 0, 0, 0, 32, 0, 0, 0, 1, 0, 0, 0, 43, 0, 4, 0, 16, 0,
-0, 0, 17, 0, 0, 0, 1, 0, 0, 0, 32, 0, 4, 0, 18, 0, 0, 0, 2, 0, 0, 0, 7, 0, 0, 0, 25, 0, 9, 0, 22, 0,
-0, 0, 6, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 27, 0,
-3, 0, 23, 0, 0, 0, 22, 0, 0, 0, 32, 0, 4, 0, 24, 0, 0, 0, 0, 0, 0, 0, 23, 0, 0, 0, 59, 0, 4, 0, 24, 0,
-0, 0, 25, 0, 0, 0, 0, 0, 0, 0, 23, 0, 4, 0, 27, 0, 0, 0, 6, 0, 0, 0, 2, 0, 0, 0, 32, 0, 4, 0, 28, 0,
-0, 0, 1, 0, 0, 0, 27, 0, 0, 0, 59, 0, 4, 0, 28, 0, 0, 0, 29, 0, 0, 0, 1, 0, 0, 0, 32, 0, 4, 0, 34, 0,
-0, 0, 3, 0, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 34, 0, 0, 0, 35, 0, 0, 0, 3, 0, 0, 0, 54, 0, 5, 0, 2, 0,
-0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 248, 0, 2, 0, 5, 0, 0, 0, 59, 0, 4, 0, 8, 0, 0, 0, 9, 0,
-0, 0, 7, 0, 0, 0, 61, 0, 4, 0, 7, 0, 0, 0, 12, 0, 0, 0, 11, 0, 0, 0, 65, 0, 5, 0, 18, 0, 0, 0, 19, 0,
-0, 0, 15, 0, 0, 0, 17, 0, 0, 0, 61, 0, 4, 0, 7, 0, 0, 0, 20, 0, 0, 0, 19, 0, 0, 0, 133, 0, 5, 0, 7, 0,
-0, 0, 21, 0, 0, 0, 12, 0, 0, 0, 20, 0, 0, 0, 62, 0, 3, 0, 9, 0, 0, 0, 21, 0, 0, 0, 61, 0, 4, 0, 23, 0,
-0, 0, 26, 0, 0, 0, 25, 0, 0, 0, 61, 0, 4, 0, 27, 0, 0, 0, 30, 0, 0, 0, 29, 0, 0, 0, 87, 0, 5, 0, 7, 0,
-0, 0, 31, 0, 0, 0, 26, 0, 0, 0, 30, 0, 0, 0, 61, 0, 4, 0, 7, 0, 0, 0, 32, 0, 0, 0, 9, 0, 0, 0, 133, 0,
-5, 0, 7, 0, 0, 0, 33, 0, 0, 0, 32, 0, 0, 0, 31, 0, 0, 0, 62, 0, 3, 0, 9, 0, 0, 0, 33, 0, 0, 0, 61, 0,
-4, 0, 7, 0, 0, 0, 36, 0, 0, 0, 9, 0, 0, 0, 62, 0, 3, 0, 35, 0, 0, 0, 36, 0, 0, 0, 253, 0, 1, 0, 56, 0,
-1, 0, 0, 0, 0, 0, 36, 0, 0, 0, 26, 0, 0, 0, 118, 115, 103, 58, 58, 83, 104, 97, 100, 101, 114, 67, 111, 109, 112, 105, 108, 101,
-83, 101, 116, 116, 105, 110, 103, 115, 0, 0, 64, 0, 100, 0, 0, 0, 0, 0, 0, 0, 194, 1, 0, 0, 0, 0, 1, 0, 0, 0, 2, 0,
-0, 0, 13, 0, 0, 0, 86, 83, 71, 95, 66, 73, 76, 76, 66, 79, 65, 82, 68, 15, 0, 0, 0, 86, 83, 71, 95, 68, 73, 70, 70, 85,
-83, 69, 95, 77, 65, 80, 2, 0, 0, 0, 31, 0, 0, 0, 34, 0, 0, 0, 1, 0, 0, 0, 37, 0, 0, 0, 30, 0, 0, 0, 118, 115,
-103, 58, 58, 86, 105, 101, 119, 68, 101, 112, 101, 110, 100, 101, 110, 116, 83, 116, 97, 116, 101, 66, 105, 110, 100, 105, 110, 103, 0, 0, 0, 0,
-0, 0, 0, 0 };
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 0, 0, 0, 118, 115, 103, 95, 112, 111, 115, 105, 116,
+105, 111, 110, 22, 0, 0, 0, 86, 83, 71, 95, 73, 78, 83, 84, 65, 78, 67, 69, 95, 80, 79, 83, 73, 84, 73, 79, 78, 83, 4, 0, 0,
+0, 106, 0, 0, 0, 10, 0, 0, 0, 14, 0, 0, 0, 118, 115, 103, 58, 58, 118, 101, 99, 51, 65, 114, 114, 97, 121, 0, 0, 0, 0, 0,
+0, 0, 0, 12, 0, 0, 0, 0, 1, 1, 1, 0, 255, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 26, 0, 0, 0, 118, 115, 103, 95, 112, 111, 115, 105, 116, 105, 111, 110, 95, 115, 99, 97, 108, 101, 68, 105, 115, 116, 97, 110, 99, 101,
+13, 0, 0, 0, 86, 83, 71, 95, 66, 73, 76, 76, 66, 79, 65, 82, 68, 4, 0, 0, 0, 109, 0, 0, 0, 11, 0, 0, 0, 14, 0, 0,
+0, 118, 115, 103, 58, 58, 118, 101, 99, 52, 65, 114, 114, 97, 121, 0, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0, 1, 1, 1, 0,
+255, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 118, 115,
+103, 95, 74, 111, 105, 110, 116, 73, 110, 100, 105, 99, 101, 115, 12, 0, 0, 0, 86, 83, 71, 95, 83, 75, 73, 78, 78, 73, 78, 71, 5, 0,
+0, 0, 108, 0, 0, 0, 12, 0, 0, 0, 15, 0, 0, 0, 118, 115, 103, 58, 58, 105, 118, 101, 99, 52, 65, 114, 114, 97, 121, 0, 0, 0,
+0, 0, 0, 0, 0, 16, 0, 0, 0, 0, 1, 1, 1, 0, 255, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 118, 115, 103, 95, 74, 111, 105, 110, 116, 87, 101, 105, 103, 104, 116, 115, 12, 0, 0, 0,
+86, 83, 71, 95, 83, 75, 73, 78, 78, 73, 78, 71, 6, 0, 0, 0, 109, 0, 0, 0, 13, 0, 0, 0, 14, 0, 0, 0, 118, 115, 103, 58,
+58, 118, 101, 99, 52, 65, 114, 114, 97, 121, 0, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0, 1, 1, 1, 0, 255, 0, 1, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 15, 0, 0, 0, 100, 105, 115,
+112, 108, 97, 99, 101, 109, 101, 110, 116, 77, 97, 112, 20, 0, 0, 0, 86, 83, 71, 95, 68, 73, 83, 80, 76, 65, 67, 69, 77, 69, 78, 84,
+95, 77, 65, 80, 1, 0, 0, 0, 6, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 14, 0, 0, 0, 17, 0, 0, 0,
+118, 115, 103, 58, 58, 102, 108, 111, 97, 116, 65, 114, 114, 97, 121, 50, 68, 0, 0, 0, 0, 100, 0, 0, 0, 4, 0, 0, 0, 0, 1, 1,
+1, 0, 255, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 0, 0, 0, 100, 105, 102, 102, 117, 115, 101, 77,
+97, 112, 15, 0, 0, 0, 86, 83, 71, 95, 68, 73, 70, 70, 85, 83, 69, 95, 77, 65, 80, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0,
+0, 1, 0, 0, 0, 16, 0, 0, 0, 15, 0, 0, 0, 18, 0, 0, 0, 118, 115, 103, 58, 58, 117, 98, 118, 101, 99, 52, 65, 114, 114, 97,
+121, 50, 68, 0, 0, 0, 0, 37, 0, 0, 0, 4, 0, 0, 0, 0, 1, 1, 1, 0, 255, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 109, 97, 116, 101, 114, 105, 97, 108, 0, 0, 0, 0, 1, 0, 0, 0, 10, 0, 0, 0, 6, 0,
+0, 0, 1, 0, 0, 0, 16, 0, 0, 0, 16, 0, 0, 0, 23, 0, 0, 0, 118, 115, 103, 58, 58, 80, 104, 111, 110, 103, 77, 97, 116, 101,
+114, 105, 97, 108, 86, 97, 108, 117, 101, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 255, 0, 0, 0, 128, 63,
+0, 0, 128, 63, 0, 0, 128, 63, 0, 0, 128, 63, 102, 102, 102, 63, 102, 102, 102, 63, 102, 102, 102, 63, 0, 0, 128, 63, 205, 204, 76, 62,
+205, 204, 76, 62, 205, 204, 76, 62, 0, 0, 128, 63, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 200, 66,
+0, 0, 128, 63, 0, 0, 0, 63, 13, 0, 0, 0, 106, 111, 105, 110, 116, 77, 97, 116, 114, 105, 99, 101, 115, 12, 0, 0, 0, 86, 83, 71,
+95, 83, 75, 73, 78, 78, 73, 78, 71, 1, 0, 0, 0, 11, 0, 0, 0, 7, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 17, 0, 0,
+0, 14, 0, 0, 0, 118, 115, 103, 58, 58, 109, 97, 116, 52, 86, 97, 108, 117, 101, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+1, 1, 1, 0, 255, 0, 0, 0, 128, 63, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 63, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 63, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 128, 63, 9, 0, 0, 0, 108, 105, 103, 104, 116, 68, 97, 116, 97, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6,
+0, 0, 0, 1, 0, 0, 0, 17, 0, 0, 0, 18, 0, 0, 0, 14, 0, 0, 0, 118, 115, 103, 58, 58, 118, 101, 99, 52, 65, 114, 114, 97,
+121, 0, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0, 1, 1, 1, 0, 255, 0, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 0, 0, 0,
+118, 105, 101, 119, 112, 111, 114, 116, 68, 97, 116, 97, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 7, 0, 0, 0, 1, 0, 0, 0,
+17, 0, 0, 0, 19, 0, 0, 0, 14, 0, 0, 0, 118, 115, 103, 58, 58, 118, 101, 99, 52, 86, 97, 108, 117, 101, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 160, 68, 0, 0, 128, 68, 10, 0, 0,
+0, 115, 104, 97, 100, 111, 119, 77, 97, 112, 115, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 16,
+0, 0, 0, 20, 0, 0, 0, 17, 0, 0, 0, 118, 115, 103, 58, 58, 102, 108, 111, 97, 116, 65, 114, 114, 97, 121, 51, 68, 0, 0, 0, 0,
+100, 0, 0, 0, 4, 0, 0, 0, 0, 1, 1, 1, 0, 255, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 13, 0, 0, 0, 116, 114, 97, 110, 115, 102, 111, 114, 109, 68, 97, 116, 97, 18, 0, 0, 0, 86, 83, 71, 95, 84, 82, 65, 78,
+83, 70, 79, 82, 77, 95, 68, 65, 84, 65, 0, 0, 0, 0, 5, 0, 0, 0, 7, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 21, 0,
+0, 0, 14, 0, 0, 0, 118, 115, 103, 58, 58, 109, 97, 116, 52, 65, 114, 114, 97, 121, 0, 0, 0, 0, 48, 0, 0, 0, 64, 0, 0, 0,
+0, 1, 1, 1, 0, 255, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 63, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 128, 63, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 63, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 63, 1, 0, 0, 0, 2, 0, 0, 0, 112, 99, 0, 0, 0, 0, 1, 0, 0,
+0, 0, 0, 0, 0, 128, 0, 0, 0, 4, 0, 0, 0, 2, 0, 0, 0, 20, 0, 0, 0, 86, 83, 71, 95, 68, 73, 83, 80, 76, 65, 67,
+69, 77, 69, 78, 84, 95, 77, 65, 80, 22, 0, 0, 0, 86, 83, 71, 95, 73, 78, 83, 84, 65, 78, 67, 69, 95, 80, 79, 83, 73, 84, 73,
+79, 78, 83, 22, 0, 0, 0, 41, 0, 0, 0, 118, 115, 103, 58, 58, 80, 111, 115, 105, 116, 105, 111, 110, 65, 110, 100, 68, 105, 115, 112, 108,
+97, 99, 101, 109, 101, 110, 116, 77, 97, 112, 65, 114, 114, 97, 121, 83, 116, 97, 116, 101, 0, 0, 0, 0, 1, 0, 0, 0, 22, 0, 0, 0,
+86, 83, 71, 95, 73, 78, 83, 84, 65, 78, 67, 69, 95, 80, 79, 83, 73, 84, 73, 79, 78, 83, 23, 0, 0, 0, 23, 0, 0, 0, 118, 115,
+103, 58, 58, 80, 111, 115, 105, 116, 105, 111, 110, 65, 114, 114, 97, 121, 83, 116, 97, 116, 101, 0, 0, 0, 0, 1, 0, 0, 0, 20, 0, 0,
+0, 86, 83, 71, 95, 68, 73, 83, 80, 76, 65, 67, 69, 77, 69, 78, 84, 95, 77, 65, 80, 24, 0, 0, 0, 30, 0, 0, 0, 118, 115, 103,
+58, 58, 68, 105, 115, 112, 108, 97, 99, 101, 109, 101, 110, 116, 77, 97, 112, 65, 114, 114, 97, 121, 83, 116, 97, 116, 101, 0, 0, 0, 0, 1,
+0, 0, 0, 13, 0, 0, 0, 86, 83, 71, 95, 66, 73, 76, 76, 66, 79, 65, 82, 68, 25, 0, 0, 0, 24, 0, 0, 0, 118, 115, 103, 58,
+58, 66, 105, 108, 108, 98, 111, 97, 114, 100, 65, 114, 114, 97, 121, 83, 116, 97, 116, 101, 0, 0, 0, 0, 4, 0, 0, 0, 14, 0, 0, 0,
+86, 83, 71, 95, 65, 76, 80, 72, 65, 95, 84, 69, 83, 84, 25, 0, 0, 0, 86, 83, 71, 95, 71, 82, 69, 89, 83, 67, 65, 76, 69, 95,
+68, 73, 70, 70, 85, 83, 69, 95, 77, 65, 80, 16, 0, 0, 0, 86, 83, 71, 95, 80, 79, 73, 78, 84, 95, 83, 80, 82, 73, 84, 69, 18,
+0, 0, 0, 86, 83, 71, 95, 84, 82, 65, 78, 83, 70, 79, 82, 77, 95, 68, 65, 84, 65, 0, 0, 0, 0, 4, 0, 0, 0, 26, 0, 0,
+0, 26, 0, 0, 0, 118, 115, 103, 58, 58, 83, 104, 97, 100, 101, 114, 67, 111, 109, 112, 105, 108, 101, 83, 101, 116, 116, 105, 110, 103, 115, 0,
+0, 64, 0, 100, 0, 0, 0, 0, 0, 0, 0, 194, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 27, 0, 0,
+0, 16, 0, 0, 0, 118, 115, 103, 58, 58, 83, 104, 97, 100, 101, 114, 83, 116, 97, 103, 101, 0, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255,
+255, 1, 0, 0, 0, 4, 0, 0, 0, 109, 97, 105, 110, 28, 0, 0, 0, 17, 0, 0, 0, 118, 115, 103, 58, 58, 83, 104, 97, 100, 101, 114,
+77, 111, 100, 117, 108, 101, 0, 0, 0, 0, 26, 0, 0, 0, 0, 0, 0, 0, 56, 2, 0, 0, 3, 2, 35, 7, 0, 0, 1, 0, 11, 0,
+8, 0, 77, 0, 0, 0, 0, 0, 0, 0, 17, 0, 2, 0, 1, 0, 0, 0, 11, 0, 6, 0, 1, 0, 0, 0, 71, 76, 83, 76, 46, 115,
+116, 100, 46, 52, 53, 48, 0, 0, 0, 0, 14, 0, 3, 0, 0, 0, 0, 0, 1, 0, 0, 0, 15, 0, 15, 0, 0, 0, 0, 0, 4, 0,
+0, 0, 109, 97, 105, 110, 0, 0, 0, 0, 12, 0, 0, 0, 20, 0, 0, 0, 40, 0, 0, 0, 51, 0, 0, 0, 56, 0, 0, 0, 62, 0,
+0, 0, 67, 0, 0, 0, 69, 0, 0, 0, 73, 0, 0, 0, 75, 0, 0, 0, 3, 0, 3, 0, 2, 0, 0, 0, 194, 1, 0, 0, 4, 0,
+9, 0, 71, 76, 95, 65, 82, 66, 95, 115, 101, 112, 97, 114, 97, 116, 101, 95, 115, 104, 97, 100, 101, 114, 95, 111, 98, 106, 101, 99, 116, 115,
+0, 0, 5, 0, 4, 0, 4, 0, 0, 0, 109, 97, 105, 110, 0, 0, 0, 0, 5, 0, 4, 0, 9, 0, 0, 0, 118, 101, 114, 116, 101, 120,
+0, 0, 5, 0, 5, 0, 12, 0, 0, 0, 118, 115, 103, 95, 86, 101, 114, 116, 101, 120, 0, 0, 5, 0, 4, 0, 19, 0, 0, 0, 110, 111,
+114, 109, 97, 108, 0, 0, 5, 0, 5, 0, 20, 0, 0, 0, 118, 115, 103, 95, 78, 111, 114, 109, 97, 108, 0, 0, 5, 0, 3, 0, 29, 0,
+0, 0, 109, 118, 0, 0, 5, 0, 6, 0, 30, 0, 0, 0, 80, 117, 115, 104, 67, 111, 110, 115, 116, 97, 110, 116, 115, 0, 0, 0, 6, 0,
+6, 0, 30, 0, 0, 0, 0, 0, 0, 0, 112, 114, 111, 106, 101, 99, 116, 105, 111, 110, 0, 0, 6, 0, 6, 0, 30, 0, 0, 0, 1, 0,
+0, 0, 109, 111, 100, 101, 108, 86, 105, 101, 119, 0, 0, 0, 5, 0, 3, 0, 32, 0, 0, 0, 112, 99, 0, 0, 5, 0, 6, 0, 38, 0,
+0, 0, 103, 108, 95, 80, 101, 114, 86, 101, 114, 116, 101, 120, 0, 0, 0, 0, 6, 0, 6, 0, 38, 0, 0, 0, 0, 0, 0, 0, 103, 108,
+95, 80, 111, 115, 105, 116, 105, 111, 110, 0, 5, 0, 3, 0, 40, 0, 0, 0, 0, 0, 0, 0, 5, 0, 4, 0, 51, 0, 0, 0, 101, 121,
+101, 80, 111, 115, 0, 0, 5, 0, 4, 0, 56, 0, 0, 0, 118, 105, 101, 119, 68, 105, 114, 0, 5, 0, 5, 0, 62, 0, 0, 0, 110, 111,
+114, 109, 97, 108, 68, 105, 114, 0, 0, 0, 5, 0, 5, 0, 67, 0, 0, 0, 118, 101, 114, 116, 101, 120, 67, 111, 108, 111, 114, 0, 5, 0,
+5, 0, 69, 0, 0, 0, 118, 115, 103, 95, 67, 111, 108, 111, 114, 0, 0, 0, 5, 0, 5, 0, 73, 0, 0, 0, 116, 101, 120, 67, 111, 111,
+114, 100, 48, 0, 0, 0, 5, 0, 6, 0, 75, 0, 0, 0, 118, 115, 103, 95, 84, 101, 120, 67, 111, 111, 114, 100, 48, 0, 0, 0, 71, 0,
+4, 0, 12, 0, 0, 0, 30, 0, 0, 0, 0, 0, 0, 0, 71, 0, 4, 0, 20, 0, 0, 0, 30, 0, 0, 0, 1, 0, 0, 0, 72, 0,
+4, 0, 30, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 72, 0, 5, 0, 30, 0, 0, 0, 0, 0, 0, 0, 35, 0, 0, 0, 0, 0,
+0, 0, 72, 0, 5, 0, 30, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 16, 0, 0, 0, 72, 0, 4, 0, 30, 0, 0, 0, 1, 0,
+0, 0, 5, 0, 0, 0, 72, 0, 5, 0, 30, 0, 0, 0, 1, 0, 0, 0, 35, 0, 0, 0, 64, 0, 0, 0, 72, 0, 5, 0, 30, 0,
+0, 0, 1, 0, 0, 0, 7, 0, 0, 0, 16, 0, 0, 0, 71, 0, 3, 0, 30, 0, 0, 0, 2, 0, 0, 0, 72, 0, 5, 0, 38, 0,
+0, 0, 0, 0, 0, 0, 11, 0, 0, 0, 0, 0, 0, 0, 71, 0, 3, 0, 38, 0, 0, 0, 2, 0, 0, 0, 71, 0, 4, 0, 51, 0,
+0, 0, 30, 0, 0, 0, 0, 0, 0, 0, 71, 0, 4, 0, 56, 0, 0, 0, 30, 0, 0, 0, 5, 0, 0, 0, 71, 0, 4, 0, 62, 0,
+0, 0, 30, 0, 0, 0, 1, 0, 0, 0, 71, 0, 4, 0, 67, 0, 0, 0, 30, 0, 0, 0, 2, 0, 0, 0, 71, 0, 4, 0, 69, 0,
+0, 0, 30, 0, 0, 0, 3, 0, 0, 0, 71, 0, 4, 0, 73, 0, 0, 0, 30, 0, 0, 0, 3, 0, 0, 0, 71, 0, 4, 0, 75, 0,
+0, 0, 30, 0, 0, 0, 2, 0, 0, 0, 19, 0, 2, 0, 2, 0, 0, 0, 33, 0, 3, 0, 3, 0, 0, 0, 2, 0, 0, 0, 22, 0,
+3, 0, 6, 0, 0, 0, 32, 0, 0, 0, 23, 0, 4, 0, 7, 0, 0, 0, 6, 0, 0, 0, 4, 0, 0, 0, 32, 0, 4, 0, 8, 0,
+0, 0, 7, 0, 0, 0, 7, 0, 0, 0, 23, 0, 4, 0, 10, 0, 0, 0, 6, 0, 0, 0, 3, 0, 0, 0, 32, 0, 4, 0, 11, 0,
+0, 0, 1, 0, 0, 0, 10, 0, 0, 0, 59, 0, 4, 0, 11, 0, 0, 0, 12, 0, 0, 0, 1, 0, 0, 0, 43, 0, 4, 0, 6, 0,
+0, 0, 14, 0, 0, 0, 0, 0, 128, 63, 59, 0, 4, 0, 11, 0, 0, 0, 20, 0, 0, 0, 1, 0, 0, 0, 43, 0, 4, 0, 6, 0,
+0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 24, 0, 4, 0, 27, 0, 0, 0, 7, 0, 0, 0, 4, 0, 0, 0, 32, 0, 4, 0, 28, 0,
+0, 0, 7, 0, 0, 0, 27, 0, 0, 0, 30, 0, 4, 0, 30, 0, 0, 0, 27, 0, 0, 0, 27, 0, 0, 0, 32, 0, 4, 0, 31, 0,
+0, 0, 9, 0, 0, 0, 30, 0, 0, 0, 59, 0, 4, 0, 31, 0, 0, 0, 32, 0, 0, 0, 9, 0, 0, 0, 21, 0, 4, 0, 33, 0,
+0, 0, 32, 0, 0, 0, 1, 0, 0, 0, 43, 0, 4, 0, 33, 0, 0, 0, 34, 0, 0, 0, 1, 0, 0, 0, 32, 0, 4, 0, 35, 0,
+0, 0, 9, 0, 0, 0, 27, 0, 0, 0, 30, 0, 3, 0, 38, 0, 0, 0, 7, 0, 0, 0, 32, 0, 4, 0, 39, 0, 0, 0, 3, 0,
+0, 0, 38, 0, 0, 0, 59, 0, 4, 0, 39, 0, 0, 0, 40, 0, 0, 0, 3, 0, 0, 0, 43, 0, 4, 0, 33, 0, 0, 0, 41, 0,
+0, 0, 0, 0, 0, 0, 32, 0, 4, 0, 48, 0, 0, 0, 3, 0, 0, 0, 7, 0, 0, 0, 32, 0, 4, 0, 50, 0, 0, 0, 3, 0,
+0, 0, 10, 0, 0, 0, 59, 0, 4, 0, 50, 0, 0, 0, 51, 0, 0, 0, 3, 0, 0, 0, 59, 0, 4, 0, 50, 0, 0, 0, 56, 0,
+0, 0, 3, 0, 0, 0, 59, 0, 4, 0, 50, 0, 0, 0, 62, 0, 0, 0, 3, 0, 0, 0, 59, 0, 4, 0, 48, 0, 0, 0, 67, 0,
+0, 0, 3, 0, 0, 0, 32, 0, 4, 0, 68, 0, 0, 0, 1, 0, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 68, 0, 0, 0, 69, 0,
+0, 0, 1, 0, 0, 0, 23, 0, 4, 0, 71, 0, 0, 0, 6, 0, 0, 0, 2, 0, 0, 0, 32, 0, 4, 0, 72, 0, 0, 0, 3, 0,
+0, 0, 71, 0, 0, 0, 59, 0, 4, 0, 72, 0, 0, 0, 73, 0, 0, 0, 3, 0, 0, 0, 32, 0, 4, 0, 74, 0, 0, 0, 1, 0,
+0, 0, 71, 0, 0, 0, 59, 0, 4, 0, 74, 0, 0, 0, 75, 0, 0, 0, 1, 0, 0, 0, 54, 0, 5, 0, 2, 0, 0, 0, 4, 0,
+0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 248, 0, 2, 0, 5, 0, 0, 0, 59, 0, 4, 0, 8, 0, 0, 0, 9, 0, 0, 0, 7, 0,
+0, 0, 59, 0, 4, 0, 8, 0, 0, 0, 19, 0, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 28, 0, 0, 0, 29, 0, 0, 0, 7, 0,
+0, 0, 61, 0, 4, 0, 10, 0, 0, 0, 13, 0, 0, 0, 12, 0, 0, 0, 81, 0, 5, 0, 6, 0, 0, 0, 15, 0, 0, 0, 13, 0,
+0, 0, 0, 0, 0, 0, 81, 0, 5, 0, 6, 0, 0, 0, 16, 0, 0, 0, 13, 0, 0, 0, 1, 0, 0, 0, 81, 0, 5, 0, 6, 0,
+0, 0, 17, 0, 0, 0, 13, 0, 0, 0, 2, 0, 0, 0, 80, 0, 7, 0, 7, 0, 0, 0, 18, 0, 0, 0, 15, 0, 0, 0, 16, 0,
+0, 0, 17, 0, 0, 0, 14, 0, 0, 0, 62, 0, 3, 0, 9, 0, 0, 0, 18, 0, 0, 0, 61, 0, 4, 0, 10, 0, 0, 0, 21, 0,
+0, 0, 20, 0, 0, 0, 81, 0, 5, 0, 6, 0, 0, 0, 23, 0, 0, 0, 21, 0, 0, 0, 0, 0, 0, 0, 81, 0, 5, 0, 6, 0,
+0, 0, 24, 0, 0, 0, 21, 0, 0, 0, 1, 0, 0, 0, 81, 0, 5, 0, 6, 0, 0, 0, 25, 0, 0, 0, 21, 0, 0, 0, 2, 0,
+0, 0, 80, 0, 7, 0, 7, 0, 0, 0, 26, 0, 0, 0, 23, 0, 0, 0, 24, 0, 0, 0, 25, 0, 0, 0, 22, 0, 0, 0, 62, 0,
+3, 0, 19, 0, 0, 0, 26, 0, 0, 0, 65, 0, 5, 0, 35, 0, 0, 0, 36, 0, 0, 0, 32, 0, 0, 0, 34, 0, 0, 0, 61, 0,
+4, 0, 27, 0, 0, 0, 37, 0, 0, 0, 36, 0, 0, 0, 62, 0, 3, 0, 29, 0, 0, 0, 37, 0, 0, 0, 65, 0, 5, 0, 35, 0,
+0, 0, 42, 0, 0, 0, 32, 0, 0, 0, 41, 0, 0, 0, 61, 0, 4, 0, 27, 0, 0, 0, 43, 0, 0, 0, 42, 0, 0, 0, 61, 0,
+4, 0, 27, 0, 0, 0, 44, 0, 0, 0, 29, 0, 0, 0, 146, 0, 5, 0, 27, 0, 0, 0, 45, 0, 0, 0, 43, 0, 0, 0, 44, 0,
+0, 0, 61, 0, 4, 0, 7, 0, 0, 0, 46, 0, 0, 0, 9, 0, 0, 0, 145, 0, 5, 0, 7, 0, 0, 0, 47, 0, 0, 0, 45, 0,
+0, 0, 46, 0, 0, 0, 65, 0, 5, 0, 48, 0, 0, 0, 49, 0, 0, 0, 40, 0, 0, 0, 41, 0, 0, 0, 62, 0, 3, 0, 49, 0,
+0, 0, 47, 0, 0, 0, 61, 0, 4, 0, 27, 0, 0, 0, 52, 0, 0, 0, 29, 0, 0, 0, 61, 0, 4, 0, 7, 0, 0, 0, 53, 0,
+0, 0, 9, 0, 0, 0, 145, 0, 5, 0, 7, 0, 0, 0, 54, 0, 0, 0, 52, 0, 0, 0, 53, 0, 0, 0, 79, 0, 8, 0, 10, 0,
+0, 0, 55, 0, 0, 0, 54, 0, 0, 0, 54, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0, 62, 0, 3, 0, 51, 0,
+0, 0, 55, 0, 0, 0, 61, 0, 4, 0, 27, 0, 0, 0, 57, 0, 0, 0, 29, 0, 0, 0, 61, 0, 4, 0, 7, 0, 0, 0, 58, 0,
+0, 0, 9, 0, 0, 0, 145, 0, 5, 0, 7, 0, 0, 0, 59, 0, 0, 0, 57, 0, 0, 0, 58, 0, 0, 0, 79, 0, 8, 0, 10, 0,
+0, 0, 60, 0, 0, 0, 59, 0, 0, 0, 59, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0, 127, 0, 4, 0, 10, 0,
+0, 0, 61, 0, 0, 0, 60, 0, 0, 0, 62, 0, 3, 0, 56, 0, 0, 0, 61, 0, 0, 0, 61, 0, 4, 0, 27, 0, 0, 0, 63, 0,
+0, 0, 29, 0, 0, 0, 61, 0, 4, 0, 7, 0, 0, 0, 64, 0, 0, 0, 19, 0, 0, 0, 145, 0, 5, 0, 7, 0, 0, 0, 65, 0,
+0, 0, 63, 0, 0, 0, 64, 0, 0, 0, 79, 0, 8, 0, 10, 0, 0, 0, 66, 0, 0, 0, 65, 0, 0, 0, 65, 0, 0, 0, 0, 0,
+0, 0, 1, 0, 0, 0, 2, 0, 0, 0, 62, 0, 3, 0, 62, 0, 0, 0, 66, 0, 0, 0, 61, 0, 4, 0, 7, 0, 0, 0, 70, 0,
+0, 0, 69, 0, 0, 0, 62, 0, 3, 0, 67, 0, 0, 0, 70, 0, 0, 0, 61, 0, 4, 0, 71, 0, 0, 0, 76, 0, 0, 0, 75, 0,
+0, 0, 62, 0, 3, 0, 73, 0, 0, 0, 76, 0, 0, 0, 253, 0, 1, 0, 56, 0, 1, 0, 0, 0, 0, 0, 29, 0, 0, 0, 16, 0,
+0, 0, 118, 115, 103, 58, 58, 83, 104, 97, 100, 101, 114, 83, 116, 97, 103, 101, 0, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 16, 0,
+0, 0, 4, 0, 0, 0, 109, 97, 105, 110, 30, 0, 0, 0, 17, 0, 0, 0, 118, 115, 103, 58, 58, 83, 104, 97, 100, 101, 114, 77, 111, 100,
+117, 108, 101, 0, 0, 0, 0, 26, 0, 0, 0, 0, 0, 0, 0, 38, 1, 0, 0, 3, 2, 35, 7, 0, 0, 1, 0, 11, 0, 8, 0, 28,
+0, 0, 0, 0, 0, 0, 0, 17, 0, 2, 0, 1, 0, 0, 0, 11, 0, 6, 0, 1, 0, 0, 0, 71, 76, 83, 76, 46, 115, 116, 100, 46,
+52, 53, 48, 0, 0, 0, 0, 14, 0, 3, 0, 0, 0, 0, 0, 1, 0, 0, 0, 15, 0, 8, 0, 4, 0, 0, 0, 4, 0, 0, 0, 109,
+97, 105, 110, 0, 0, 0, 0, 11, 0, 0, 0, 23, 0, 0, 0, 27, 0, 0, 0, 16, 0, 3, 0, 4, 0, 0, 0, 7, 0, 0, 0, 3,
+0, 3, 0, 2, 0, 0, 0, 194, 1, 0, 0, 4, 0, 9, 0, 71, 76, 95, 65, 82, 66, 95, 115, 101, 112, 97, 114, 97, 116, 101, 95, 115,
+104, 97, 100, 101, 114, 95, 111, 98, 106, 101, 99, 116, 115, 0, 0, 5, 0, 4, 0, 4, 0, 0, 0, 109, 97, 105, 110, 0, 0, 0, 0, 5,
+0, 6, 0, 9, 0, 0, 0, 100, 105, 102, 102, 117, 115, 101, 67, 111, 108, 111, 114, 0, 0, 0, 0, 5, 0, 5, 0, 11, 0, 0, 0, 118,
+101, 114, 116, 101, 120, 67, 111, 108, 111, 114, 0, 5, 0, 6, 0, 13, 0, 0, 0, 77, 97, 116, 101, 114, 105, 97, 108, 68, 97, 116, 97, 0,
+0, 0, 0, 6, 0, 7, 0, 13, 0, 0, 0, 0, 0, 0, 0, 97, 109, 98, 105, 101, 110, 116, 67, 111, 108, 111, 114, 0, 0, 0, 0, 6,
+0, 7, 0, 13, 0, 0, 0, 1, 0, 0, 0, 100, 105, 102, 102, 117, 115, 101, 67, 111, 108, 111, 114, 0, 0, 0, 0, 6, 0, 7, 0, 13,
+0, 0, 0, 2, 0, 0, 0, 115, 112, 101, 99, 117, 108, 97, 114, 67, 111, 108, 111, 114, 0, 0, 0, 6, 0, 7, 0, 13, 0, 0, 0, 3,
+0, 0, 0, 101, 109, 105, 115, 115, 105, 118, 101, 67, 111, 108, 111, 114, 0, 0, 0, 6, 0, 6, 0, 13, 0, 0, 0, 4, 0, 0, 0, 115,
+104, 105, 110, 105, 110, 101, 115, 115, 0, 0, 0, 6, 0, 6, 0, 13, 0, 0, 0, 5, 0, 0, 0, 97, 108, 112, 104, 97, 77, 97, 115, 107,
+0, 0, 0, 6, 0, 7, 0, 13, 0, 0, 0, 6, 0, 0, 0, 97, 108, 112, 104, 97, 77, 97, 115, 107, 67, 117, 116, 111, 102, 102, 0, 5,
+0, 5, 0, 15, 0, 0, 0, 109, 97, 116, 101, 114, 105, 97, 108, 0, 0, 0, 0, 5, 0, 5, 0, 23, 0, 0, 0, 111, 117, 116, 67, 111,
+108, 111, 114, 0, 0, 0, 0, 5, 0, 5, 0, 27, 0, 0, 0, 116, 101, 120, 67, 111, 111, 114, 100, 48, 0, 0, 0, 71, 0, 4, 0, 11,
+0, 0, 0, 30, 0, 0, 0, 2, 0, 0, 0, 72, 0, 5, 0, 13, 0, 0, 0, 0, 0, 0, 0, 35, 0, 0, 0, 0, 0, 0, 0, 72,
+0, 5, 0, 13, 0, 0, 0, 1, 0, 0, 0, 35, 0, 0, 0, 16, 0, 0, 0, 72, 0, 5, 0, 13, 0, 0, 0, 2, 0, 0, 0, 35,
+0, 0, 0, 32, 0, 0, 0, 72, 0, 5, 0, 13, 0, 0, 0, 3, 0, 0, 0, 35, 0, 0, 0, 48, 0, 0, 0, 72, 0, 5, 0, 13,
+0, 0, 0, 4, 0, 0, 0, 35, 0, 0, 0, 64, 0, 0, 0, 72, 0, 5, 0, 13, 0, 0, 0, 5, 0, 0, 0, 35, 0, 0, 0, 68,
+0, 0, 0, 72, 0, 5, 0, 13, 0, 0, 0, 6, 0, 0, 0, 35, 0, 0, 0, 72, 0, 0, 0, 71, 0, 3, 0, 13, 0, 0, 0, 2,
+0, 0, 0, 71, 0, 4, 0, 15, 0, 0, 0, 34, 0, 0, 0, 1, 0, 0, 0, 71, 0, 4, 0, 15, 0, 0, 0, 33, 0, 0, 0, 10,
+0, 0, 0, 71, 0, 4, 0, 23, 0, 0, 0, 30, 0, 0, 0, 0, 0, 0, 0, 71, 0, 4, 0, 27, 0, 0, 0, 30, 0, 0, 0, 3,
+0, 0, 0, 19, 0, 2, 0, 2, 0, 0, 0, 33, 0, 3, 0, 3, 0, 0, 0, 2, 0, 0, 0, 22, 0, 3, 0, 6, 0, 0, 0, 32,
+0, 0, 0, 23, 0, 4, 0, 7, 0, 0, 0, 6, 0, 0, 0, 4, 0, 0, 0, 32, 0, 4, 0, 8, 0, 0, 0, 7, 0, 0, 0, 7,
+0, 0, 0, 32, 0, 4, 0, 10, 0, 0, 0, 1, 0, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 10, 0, 0, 0, 11, 0, 0, 0, 1,
+0, 0, 0, 30, 0, 9, 0, 13, 0, 0, 0, 7, 0, 0, 0, 7, 0, 0, 0, 7, 0, 0, 0, 7, 0, 0, 0, 6, 0, 0, 0, 6,
+0, 0, 0, 6, 0, 0, 0, 32, 0, 4, 0, 14, 0, 0, 0, 2, 0, 0, 0, 13, 0, 0, 0, 59, 0, 4, 0, 14, 0, 0, 0, 15,
+0, 0, 0, 2, 0, 0, 0, 21, 0, 4, 0, 16, 0, 0, 0, 32, 0, 0, 0, 1, 0, 0, 0, 43, 0, 4, 0, 16, 0, 0, 0, 17,
+0, 0, 0, 1, 0, 0, 0, 32, 0, 4, 0, 18, 0, 0, 0, 2, 0, 0, 0, 7, 0, 0, 0, 32, 0, 4, 0, 22, 0, 0, 0, 3,
+0, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 22, 0, 0, 0, 23, 0, 0, 0, 3, 0, 0, 0, 23, 0, 4, 0, 25, 0, 0, 0, 6,
+0, 0, 0, 2, 0, 0, 0, 32, 0, 4, 0, 26, 0, 0, 0, 1, 0, 0, 0, 25, 0, 0, 0, 59, 0, 4, 0, 26, 0, 0, 0, 27,
+0, 0, 0, 1, 0, 0, 0, 54, 0, 5, 0, 2, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 248, 0, 2, 0, 5,
+0, 0, 0, 59, 0, 4, 0, 8, 0, 0, 0, 9, 0, 0, 0, 7, 0, 0, 0, 61, 0, 4, 0, 7, 0, 0, 0, 12, 0, 0, 0, 11,
+0, 0, 0, 65, 0, 5, 0, 18, 0, 0, 0, 19, 0, 0, 0, 15, 0, 0, 0, 17, 0, 0, 0, 61, 0, 4, 0, 7, 0, 0, 0, 20,
+0, 0, 0, 19, 0, 0, 0, 133, 0, 5, 0, 7, 0, 0, 0, 21, 0, 0, 0, 12, 0, 0, 0, 20, 0, 0, 0, 62, 0, 3, 0, 9,
+0, 0, 0, 21, 0, 0, 0, 61, 0, 4, 0, 7, 0, 0, 0, 24, 0, 0, 0, 9, 0, 0, 0, 62, 0, 3, 0, 23, 0, 0, 0, 24,
+0, 0, 0, 253, 0, 1, 0, 56, 0, 1, 0, 0, 0, 0, 0, 31, 0, 0, 0, 26, 0, 0, 0, 118, 115, 103, 58, 58, 83, 104, 97, 100,
+101, 114, 67, 111, 109, 112, 105, 108, 101, 83, 101, 116, 116, 105, 110, 103, 115, 0, 0, 64, 0, 100, 0, 0, 0, 0, 0, 0, 0, 194, 1, 0,
+0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 13, 0, 0, 0, 86, 83, 71, 95, 66, 73, 76, 76, 66, 79, 65, 82, 68, 2, 0, 0, 0,
+32, 0, 0, 0, 16, 0, 0, 0, 118, 115, 103, 58, 58, 83, 104, 97, 100, 101, 114, 83, 116, 97, 103, 101, 0, 0, 0, 0, 255, 255, 255, 255,
+255, 255, 255, 255, 1, 0, 0, 0, 4, 0, 0, 0, 109, 97, 105, 110, 33, 0, 0, 0, 17, 0, 0, 0, 118, 115, 103, 58, 58, 83, 104, 97,
+100, 101, 114, 77, 111, 100, 117, 108, 101, 0, 0, 0, 0, 31, 0, 0, 0, 0, 0, 0, 0, 202, 3, 0, 0, 3, 2, 35, 7, 0, 0, 1,
+0, 11, 0, 8, 0, 145, 0, 0, 0, 0, 0, 0, 0, 17, 0, 2, 0, 1, 0, 0, 0, 11, 0, 6, 0, 1, 0, 0, 0, 71, 76, 83,
+76, 46, 115, 116, 100, 46, 52, 53, 48, 0, 0, 0, 0, 14, 0, 3, 0, 0, 0, 0, 0, 1, 0, 0, 0, 15, 0, 16, 0, 0, 0, 0,
+0, 4, 0, 0, 0, 109, 97, 105, 110, 0, 0, 0, 0, 69, 0, 0, 0, 76, 0, 0, 0, 92, 0, 0, 0, 109, 0, 0, 0, 120, 0, 0,
+0, 125, 0, 0, 0, 131, 0, 0, 0, 136, 0, 0, 0, 137, 0, 0, 0, 141, 0, 0, 0, 143, 0, 0, 0, 3, 0, 3, 0, 2, 0, 0,
+0, 194, 1, 0, 0, 4, 0, 9, 0, 71, 76, 95, 65, 82, 66, 95, 115, 101, 112, 97, 114, 97, 116, 101, 95, 115, 104, 97, 100, 101, 114, 95,
+111, 98, 106, 101, 99, 116, 115, 0, 0, 5, 0, 4, 0, 4, 0, 0, 0, 109, 97, 105, 110, 0, 0, 0, 0, 5, 0, 10, 0, 14, 0, 0,
+0, 99, 111, 109, 112, 117, 116, 101, 66, 105, 108, 108, 98, 111, 97, 100, 77, 97, 116, 114, 105, 120, 40, 118, 102, 52, 59, 102, 49, 59, 0, 0,
+0, 5, 0, 5, 0, 12, 0, 0, 0, 99, 101, 110, 116, 101, 114, 95, 101, 121, 101, 0, 0, 5, 0, 7, 0, 13, 0, 0, 0, 97, 117, 116,
+111, 83, 99, 97, 108, 101, 68, 105, 115, 116, 97, 110, 99, 101, 0, 0, 0, 5, 0, 5, 0, 16, 0, 0, 0, 100, 105, 115, 116, 97, 110, 99,
+101, 0, 0, 0, 0, 5, 0, 4, 0, 22, 0, 0, 0, 115, 99, 97, 108, 101, 0, 0, 0, 5, 0, 3, 0, 37, 0, 0, 0, 83, 0, 0,
+0, 5, 0, 3, 0, 47, 0, 0, 0, 84, 0, 0, 0, 5, 0, 4, 0, 66, 0, 0, 0, 118, 101, 114, 116, 101, 120, 0, 0, 5, 0, 5,
+0, 69, 0, 0, 0, 118, 115, 103, 95, 86, 101, 114, 116, 101, 120, 0, 0, 5, 0, 4, 0, 75, 0, 0, 0, 110, 111, 114, 109, 97, 108, 0,
+0, 5, 0, 5, 0, 76, 0, 0, 0, 118, 115, 103, 95, 78, 111, 114, 109, 97, 108, 0, 0, 5, 0, 3, 0, 82, 0, 0, 0, 109, 118, 0,
+0, 5, 0, 6, 0, 83, 0, 0, 0, 80, 117, 115, 104, 67, 111, 110, 115, 116, 97, 110, 116, 115, 0, 0, 0, 6, 0, 6, 0, 83, 0, 0,
+0, 0, 0, 0, 0, 112, 114, 111, 106, 101, 99, 116, 105, 111, 110, 0, 0, 6, 0, 6, 0, 83, 0, 0, 0, 1, 0, 0, 0, 109, 111, 100,
+101, 108, 86, 105, 101, 119, 0, 0, 0, 5, 0, 3, 0, 85, 0, 0, 0, 112, 99, 0, 0, 5, 0, 9, 0, 92, 0, 0, 0, 118, 115, 103,
+95, 112, 111, 115, 105, 116, 105, 111, 110, 95, 115, 99, 97, 108, 101, 68, 105, 115, 116, 97, 110, 99, 101, 0, 0, 5, 0, 4, 0, 100, 0, 0,
+0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 101, 0, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 6, 0, 107, 0, 0,
+0, 103, 108, 95, 80, 101, 114, 86, 101, 114, 116, 101, 120, 0, 0, 0, 0, 6, 0, 6, 0, 107, 0, 0, 0, 0, 0, 0, 0, 103, 108, 95,
+80, 111, 115, 105, 116, 105, 111, 110, 0, 5, 0, 3, 0, 109, 0, 0, 0, 0, 0, 0, 0, 5, 0, 4, 0, 120, 0, 0, 0, 101, 121, 101,
+80, 111, 115, 0, 0, 5, 0, 4, 0, 125, 0, 0, 0, 118, 105, 101, 119, 68, 105, 114, 0, 5, 0, 5, 0, 131, 0, 0, 0, 110, 111, 114,
+109, 97, 108, 68, 105, 114, 0, 0, 0, 5, 0, 5, 0, 136, 0, 0, 0, 118, 101, 114, 116, 101, 120, 67, 111, 108, 111, 114, 0, 5, 0, 5,
+0, 137, 0, 0, 0, 118, 115, 103, 95, 67, 111, 108, 111, 114, 0, 0, 0, 5, 0, 5, 0, 141, 0, 0, 0, 116, 101, 120, 67, 111, 111, 114,
+100, 48, 0, 0, 0, 5, 0, 6, 0, 143, 0, 0, 0, 118, 115, 103, 95, 84, 101, 120, 67, 111, 111, 114, 100, 48, 0, 0, 0, 71, 0, 4,
+0, 69, 0, 0, 0, 30, 0, 0, 0, 0, 0, 0, 0, 71, 0, 4, 0, 76, 0, 0, 0, 30, 0, 0, 0, 1, 0, 0, 0, 72, 0, 4,
+0, 83, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 72, 0, 5, 0, 83, 0, 0, 0, 0, 0, 0, 0, 35, 0, 0, 0, 0, 0, 0,
+0, 72, 0, 5, 0, 83, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 16, 0, 0, 0, 72, 0, 4, 0, 83, 0, 0, 0, 1, 0, 0,
+0, 5, 0, 0, 0, 72, 0, 5, 0, 83, 0, 0, 0, 1, 0, 0, 0, 35, 0, 0, 0, 64, 0, 0, 0, 72, 0, 5, 0, 83, 0, 0,
+0, 1, 0, 0, 0, 7, 0, 0, 0, 16, 0, 0, 0, 71, 0, 3, 0, 83, 0, 0, 0, 2, 0, 0, 0, 71, 0, 4, 0, 92, 0, 0,
+0, 30, 0, 0, 0, 4, 0, 0, 0, 72, 0, 5, 0, 107, 0, 0, 0, 0, 0, 0, 0, 11, 0, 0, 0, 0, 0, 0, 0, 71, 0, 3,
+0, 107, 0, 0, 0, 2, 0, 0, 0, 71, 0, 4, 0, 120, 0, 0, 0, 30, 0, 0, 0, 0, 0, 0, 0, 71, 0, 4, 0, 125, 0, 0,
+0, 30, 0, 0, 0, 5, 0, 0, 0, 71, 0, 4, 0, 131, 0, 0, 0, 30, 0, 0, 0, 1, 0, 0, 0, 71, 0, 4, 0, 136, 0, 0,
+0, 30, 0, 0, 0, 2, 0, 0, 0, 71, 0, 4, 0, 137, 0, 0, 0, 30, 0, 0, 0, 3, 0, 0, 0, 71, 0, 4, 0, 141, 0, 0,
+0, 30, 0, 0, 0, 3, 0, 0, 0, 71, 0, 4, 0, 143, 0, 0, 0, 30, 0, 0, 0, 2, 0, 0, 0, 19, 0, 2, 0, 2, 0, 0,
+0, 33, 0, 3, 0, 3, 0, 0, 0, 2, 0, 0, 0, 22, 0, 3, 0, 6, 0, 0, 0, 32, 0, 0, 0, 23, 0, 4, 0, 7, 0, 0,
+0, 6, 0, 0, 0, 4, 0, 0, 0, 32, 0, 4, 0, 8, 0, 0, 0, 7, 0, 0, 0, 7, 0, 0, 0, 32, 0, 4, 0, 9, 0, 0,
+0, 7, 0, 0, 0, 6, 0, 0, 0, 24, 0, 4, 0, 10, 0, 0, 0, 7, 0, 0, 0, 4, 0, 0, 0, 33, 0, 5, 0, 11, 0, 0,
+0, 10, 0, 0, 0, 8, 0, 0, 0, 9, 0, 0, 0, 21, 0, 4, 0, 17, 0, 0, 0, 32, 0, 0, 0, 0, 0, 0, 0, 43, 0, 4,
+0, 17, 0, 0, 0, 18, 0, 0, 0, 2, 0, 0, 0, 20, 0, 2, 0, 25, 0, 0, 0, 43, 0, 4, 0, 6, 0, 0, 0, 34, 0, 0,
+0, 0, 0, 128, 63, 32, 0, 4, 0, 36, 0, 0, 0, 7, 0, 0, 0, 10, 0, 0, 0, 43, 0, 4, 0, 6, 0, 0, 0, 39, 0, 0,
+0, 0, 0, 0, 0, 43, 0, 4, 0, 17, 0, 0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 43, 0, 4, 0, 17, 0, 0, 0, 51, 0, 0,
+0, 1, 0, 0, 0, 23, 0, 4, 0, 67, 0, 0, 0, 6, 0, 0, 0, 3, 0, 0, 0, 32, 0, 4, 0, 68, 0, 0, 0, 1, 0, 0,
+0, 67, 0, 0, 0, 59, 0, 4, 0, 68, 0, 0, 0, 69, 0, 0, 0, 1, 0, 0, 0, 59, 0, 4, 0, 68, 0, 0, 0, 76, 0, 0,
+0, 1, 0, 0, 0, 30, 0, 4, 0, 83, 0, 0, 0, 10, 0, 0, 0, 10, 0, 0, 0, 32, 0, 4, 0, 84, 0, 0, 0, 9, 0, 0,
+0, 83, 0, 0, 0, 59, 0, 4, 0, 84, 0, 0, 0, 85, 0, 0, 0, 9, 0, 0, 0, 21, 0, 4, 0, 86, 0, 0, 0, 32, 0, 0,
+0, 1, 0, 0, 0, 43, 0, 4, 0, 86, 0, 0, 0, 87, 0, 0, 0, 1, 0, 0, 0, 32, 0, 4, 0, 88, 0, 0, 0, 9, 0, 0,
+0, 10, 0, 0, 0, 32, 0, 4, 0, 91, 0, 0, 0, 1, 0, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 91, 0, 0, 0, 92, 0, 0,
+0, 1, 0, 0, 0, 43, 0, 4, 0, 17, 0, 0, 0, 102, 0, 0, 0, 3, 0, 0, 0, 32, 0, 4, 0, 103, 0, 0, 0, 1, 0, 0,
+0, 6, 0, 0, 0, 30, 0, 3, 0, 107, 0, 0, 0, 7, 0, 0, 0, 32, 0, 4, 0, 108, 0, 0, 0, 3, 0, 0, 0, 107, 0, 0,
+0, 59, 0, 4, 0, 108, 0, 0, 0, 109, 0, 0, 0, 3, 0, 0, 0, 43, 0, 4, 0, 86, 0, 0, 0, 110, 0, 0, 0, 0, 0, 0,
+0, 32, 0, 4, 0, 117, 0, 0, 0, 3, 0, 0, 0, 7, 0, 0, 0, 32, 0, 4, 0, 119, 0, 0, 0, 3, 0, 0, 0, 67, 0, 0,
+0, 59, 0, 4, 0, 119, 0, 0, 0, 120, 0, 0, 0, 3, 0, 0, 0, 59, 0, 4, 0, 119, 0, 0, 0, 125, 0, 0, 0, 3, 0, 0,
+0, 59, 0, 4, 0, 119, 0, 0, 0, 131, 0, 0, 0, 3, 0, 0, 0, 59, 0, 4, 0, 117, 0, 0, 0, 136, 0, 0, 0, 3, 0, 0,
+0, 59, 0, 4, 0, 91, 0, 0, 0, 137, 0, 0, 0, 1, 0, 0, 0, 23, 0, 4, 0, 139, 0, 0, 0, 6, 0, 0, 0, 2, 0, 0,
+0, 32, 0, 4, 0, 140, 0, 0, 0, 3, 0, 0, 0, 139, 0, 0, 0, 59, 0, 4, 0, 140, 0, 0, 0, 141, 0, 0, 0, 3, 0, 0,
+0, 32, 0, 4, 0, 142, 0, 0, 0, 1, 0, 0, 0, 139, 0, 0, 0, 59, 0, 4, 0, 142, 0, 0, 0, 143, 0, 0, 0, 1, 0, 0,
+0, 54, 0, 5, 0, 2, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 248, 0, 2, 0, 5, 0, 0, 0, 59, 0, 4,
+0, 8, 0, 0, 0, 66, 0, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 8, 0, 0, 0, 75, 0, 0, 0, 7, 0, 0, 0, 59, 0, 4,
+0, 36, 0, 0, 0, 82, 0, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 8, 0, 0, 0, 100, 0, 0, 0, 7, 0, 0, 0, 59, 0, 4,
+0, 9, 0, 0, 0, 101, 0, 0, 0, 7, 0, 0, 0, 61, 0, 4, 0, 67, 0, 0, 0, 70, 0, 0, 0, 69, 0, 0, 0, 81, 0, 5,
+0, 6, 0, 0, 0, 71, 0, 0, 0, 70, 0, 0, 0, 0, 0, 0, 0, 81, 0, 5, 0, 6, 0, 0, 0, 72, 0, 0, 0, 70, 0, 0,
+0, 1, 0, 0, 0, 81, 0, 5, 0, 6, 0, 0, 0, 73, 0, 0, 0, 70, 0, 0, 0, 2, 0, 0, 0, 80, 0, 7, 0, 7, 0, 0,
+0, 74, 0, 0, 0, 71, 0, 0, 0, 72, 0, 0, 0, 73, 0, 0, 0, 34, 0, 0, 0, 62, 0, 3, 0, 66, 0, 0, 0, 74, 0, 0,
+0, 61, 0, 4, 0, 67, 0, 0, 0, 77, 0, 0, 0, 76, 0, 0, 0, 81, 0, 5, 0, 6, 0, 0, 0, 78, 0, 0, 0, 77, 0, 0,
+0, 0, 0, 0, 0, 81, 0, 5, 0, 6, 0, 0, 0, 79, 0, 0, 0, 77, 0, 0, 0, 1, 0, 0, 0, 81, 0, 5, 0, 6, 0, 0,
+0, 80, 0, 0, 0, 77, 0, 0, 0, 2, 0, 0, 0, 80, 0, 7, 0, 7, 0, 0, 0, 81, 0, 0, 0, 78, 0, 0, 0, 79, 0, 0,
+0, 80, 0, 0, 0, 39, 0, 0, 0, 62, 0, 3, 0, 75, 0, 0, 0, 81, 0, 0, 0, 65, 0, 5, 0, 88, 0, 0, 0, 89, 0, 0,
+0, 85, 0, 0, 0, 87, 0, 0, 0, 61, 0, 4, 0, 10, 0, 0, 0, 90, 0, 0, 0, 89, 0, 0, 0, 61, 0, 4, 0, 7, 0, 0,
+0, 93, 0, 0, 0, 92, 0, 0, 0, 79, 0, 8, 0, 67, 0, 0, 0, 94, 0, 0, 0, 93, 0, 0, 0, 93, 0, 0, 0, 0, 0, 0,
+0, 1, 0, 0, 0, 2, 0, 0, 0, 81, 0, 5, 0, 6, 0, 0, 0, 95, 0, 0, 0, 94, 0, 0, 0, 0, 0, 0, 0, 81, 0, 5,
+0, 6, 0, 0, 0, 96, 0, 0, 0, 94, 0, 0, 0, 1, 0, 0, 0, 81, 0, 5, 0, 6, 0, 0, 0, 97, 0, 0, 0, 94, 0, 0,
+0, 2, 0, 0, 0, 80, 0, 7, 0, 7, 0, 0, 0, 98, 0, 0, 0, 95, 0, 0, 0, 96, 0, 0, 0, 97, 0, 0, 0, 34, 0, 0,
+0, 145, 0, 5, 0, 7, 0, 0, 0, 99, 0, 0, 0, 90, 0, 0, 0, 98, 0, 0, 0, 62, 0, 3, 0, 100, 0, 0, 0, 99, 0, 0,
+0, 65, 0, 5, 0, 103, 0, 0, 0, 104, 0, 0, 0, 92, 0, 0, 0, 102, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 105, 0, 0,
+0, 104, 0, 0, 0, 62, 0, 3, 0, 101, 0, 0, 0, 105, 0, 0, 0, 57, 0, 6, 0, 10, 0, 0, 0, 106, 0, 0, 0, 14, 0, 0,
+0, 100, 0, 0, 0, 101, 0, 0, 0, 62, 0, 3, 0, 82, 0, 0, 0, 106, 0, 0, 0, 65, 0, 5, 0, 88, 0, 0, 0, 111, 0, 0,
+0, 85, 0, 0, 0, 110, 0, 0, 0, 61, 0, 4, 0, 10, 0, 0, 0, 112, 0, 0, 0, 111, 0, 0, 0, 61, 0, 4, 0, 10, 0, 0,
+0, 113, 0, 0, 0, 82, 0, 0, 0, 146, 0, 5, 0, 10, 0, 0, 0, 114, 0, 0, 0, 112, 0, 0, 0, 113, 0, 0, 0, 61, 0, 4,
+0, 7, 0, 0, 0, 115, 0, 0, 0, 66, 0, 0, 0, 145, 0, 5, 0, 7, 0, 0, 0, 116, 0, 0, 0, 114, 0, 0, 0, 115, 0, 0,
+0, 65, 0, 5, 0, 117, 0, 0, 0, 118, 0, 0, 0, 109, 0, 0, 0, 110, 0, 0, 0, 62, 0, 3, 0, 118, 0, 0, 0, 116, 0, 0,
+0, 61, 0, 4, 0, 10, 0, 0, 0, 121, 0, 0, 0, 82, 0, 0, 0, 61, 0, 4, 0, 7, 0, 0, 0, 122, 0, 0, 0, 66, 0, 0,
+0, 145, 0, 5, 0, 7, 0, 0, 0, 123, 0, 0, 0, 121, 0, 0, 0, 122, 0, 0, 0, 79, 0, 8, 0, 67, 0, 0, 0, 124, 0, 0,
+0, 123, 0, 0, 0, 123, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0, 62, 0, 3, 0, 120, 0, 0, 0, 124, 0, 0,
+0, 61, 0, 4, 0, 10, 0, 0, 0, 126, 0, 0, 0, 82, 0, 0, 0, 61, 0, 4, 0, 7, 0, 0, 0, 127, 0, 0, 0, 66, 0, 0,
+0, 145, 0, 5, 0, 7, 0, 0, 0, 128, 0, 0, 0, 126, 0, 0, 0, 127, 0, 0, 0, 79, 0, 8, 0, 67, 0, 0, 0, 129, 0, 0,
+0, 128, 0, 0, 0, 128, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0, 127, 0, 4, 0, 67, 0, 0, 0, 130, 0, 0,
+0, 129, 0, 0, 0, 62, 0, 3, 0, 125, 0, 0, 0, 130, 0, 0, 0, 61, 0, 4, 0, 10, 0, 0, 0, 132, 0, 0, 0, 82, 0, 0,
+0, 61, 0, 4, 0, 7, 0, 0, 0, 133, 0, 0, 0, 75, 0, 0, 0, 145, 0, 5, 0, 7, 0, 0, 0, 134, 0, 0, 0, 132, 0, 0,
+0, 133, 0, 0, 0, 79, 0, 8, 0, 67, 0, 0, 0, 135, 0, 0, 0, 134, 0, 0, 0, 134, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0,
+0, 2, 0, 0, 0, 62, 0, 3, 0, 131, 0, 0, 0, 135, 0, 0, 0, 61, 0, 4, 0, 7, 0, 0, 0, 138, 0, 0, 0, 137, 0, 0,
+0, 62, 0, 3, 0, 136, 0, 0, 0, 138, 0, 0, 0, 61, 0, 4, 0, 139, 0, 0, 0, 144, 0, 0, 0, 143, 0, 0, 0, 62, 0, 3,
+0, 141, 0, 0, 0, 144, 0, 0, 0, 253, 0, 1, 0, 56, 0, 1, 0, 54, 0, 5, 0, 10, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0,
+0, 11, 0, 0, 0, 55, 0, 3, 0, 8, 0, 0, 0, 12, 0, 0, 0, 55, 0, 3, 0, 9, 0, 0, 0, 13, 0, 0, 0, 248, 0, 2,
+0, 15, 0, 0, 0, 59, 0, 4, 0, 9, 0, 0, 0, 16, 0, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 9, 0, 0, 0, 22, 0, 0,
+0, 7, 0, 0, 0, 59, 0, 4, 0, 9, 0, 0, 0, 27, 0, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 36, 0, 0, 0, 37, 0, 0,
+0, 7, 0, 0, 0, 59, 0, 4, 0, 36, 0, 0, 0, 47, 0, 0, 0, 7, 0, 0, 0, 65, 0, 5, 0, 9, 0, 0, 0, 19, 0, 0,
+0, 12, 0, 0, 0, 18, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 20, 0, 0, 0, 19, 0, 0, 0, 127, 0, 4, 0, 6, 0, 0,
+0, 21, 0, 0, 0, 20, 0, 0, 0, 62, 0, 3, 0, 16, 0, 0, 0, 21, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 23, 0, 0,
+0, 16, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 24, 0, 0, 0, 13, 0, 0, 0, 184, 0, 5, 0, 25, 0, 0, 0, 26, 0, 0,
+0, 23, 0, 0, 0, 24, 0, 0, 0, 247, 0, 3, 0, 29, 0, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 26, 0, 0, 0, 28, 0, 0,
+0, 33, 0, 0, 0, 248, 0, 2, 0, 28, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 30, 0, 0, 0, 16, 0, 0, 0, 61, 0, 4,
+0, 6, 0, 0, 0, 31, 0, 0, 0, 13, 0, 0, 0, 136, 0, 5, 0, 6, 0, 0, 0, 32, 0, 0, 0, 30, 0, 0, 0, 31, 0, 0,
+0, 62, 0, 3, 0, 27, 0, 0, 0, 32, 0, 0, 0, 249, 0, 2, 0, 29, 0, 0, 0, 248, 0, 2, 0, 33, 0, 0, 0, 62, 0, 3,
+0, 27, 0, 0, 0, 34, 0, 0, 0, 249, 0, 2, 0, 29, 0, 0, 0, 248, 0, 2, 0, 29, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0,
+0, 35, 0, 0, 0, 27, 0, 0, 0, 62, 0, 3, 0, 22, 0, 0, 0, 35, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 38, 0, 0,
+0, 22, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 40, 0, 0, 0, 22, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 41, 0, 0,
+0, 22, 0, 0, 0, 80, 0, 7, 0, 7, 0, 0, 0, 42, 0, 0, 0, 38, 0, 0, 0, 39, 0, 0, 0, 39, 0, 0, 0, 39, 0, 0,
+0, 80, 0, 7, 0, 7, 0, 0, 0, 43, 0, 0, 0, 39, 0, 0, 0, 40, 0, 0, 0, 39, 0, 0, 0, 39, 0, 0, 0, 80, 0, 7,
+0, 7, 0, 0, 0, 44, 0, 0, 0, 39, 0, 0, 0, 39, 0, 0, 0, 41, 0, 0, 0, 39, 0, 0, 0, 80, 0, 7, 0, 7, 0, 0,
+0, 45, 0, 0, 0, 39, 0, 0, 0, 39, 0, 0, 0, 39, 0, 0, 0, 34, 0, 0, 0, 80, 0, 7, 0, 10, 0, 0, 0, 46, 0, 0,
+0, 42, 0, 0, 0, 43, 0, 0, 0, 44, 0, 0, 0, 45, 0, 0, 0, 62, 0, 3, 0, 37, 0, 0, 0, 46, 0, 0, 0, 65, 0, 5,
+0, 9, 0, 0, 0, 49, 0, 0, 0, 12, 0, 0, 0, 48, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 50, 0, 0, 0, 49, 0, 0,
+0, 65, 0, 5, 0, 9, 0, 0, 0, 52, 0, 0, 0, 12, 0, 0, 0, 51, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 53, 0, 0,
+0, 52, 0, 0, 0, 65, 0, 5, 0, 9, 0, 0, 0, 54, 0, 0, 0, 12, 0, 0, 0, 18, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0,
+0, 55, 0, 0, 0, 54, 0, 0, 0, 80, 0, 7, 0, 7, 0, 0, 0, 56, 0, 0, 0, 34, 0, 0, 0, 39, 0, 0, 0, 39, 0, 0,
+0, 39, 0, 0, 0, 80, 0, 7, 0, 7, 0, 0, 0, 57, 0, 0, 0, 39, 0, 0, 0, 34, 0, 0, 0, 39, 0, 0, 0, 39, 0, 0,
+0, 80, 0, 7, 0, 7, 0, 0, 0, 58, 0, 0, 0, 39, 0, 0, 0, 39, 0, 0, 0, 34, 0, 0, 0, 39, 0, 0, 0, 80, 0, 7,
+0, 7, 0, 0, 0, 59, 0, 0, 0, 50, 0, 0, 0, 53, 0, 0, 0, 55, 0, 0, 0, 34, 0, 0, 0, 80, 0, 7, 0, 10, 0, 0,
+0, 60, 0, 0, 0, 56, 0, 0, 0, 57, 0, 0, 0, 58, 0, 0, 0, 59, 0, 0, 0, 62, 0, 3, 0, 47, 0, 0, 0, 60, 0, 0,
+0, 61, 0, 4, 0, 10, 0, 0, 0, 61, 0, 0, 0, 47, 0, 0, 0, 61, 0, 4, 0, 10, 0, 0, 0, 62, 0, 0, 0, 37, 0, 0,
+0, 146, 0, 5, 0, 10, 0, 0, 0, 63, 0, 0, 0, 61, 0, 0, 0, 62, 0, 0, 0, 254, 0, 2, 0, 63, 0, 0, 0, 56, 0, 1,
+0, 0, 0, 0, 0, 29, 0, 0, 0, 34, 0, 0, 0, 26, 0, 0, 0, 118, 115, 103, 58, 58, 83, 104, 97, 100, 101, 114, 67, 111, 109, 112,
+105, 108, 101, 83, 101, 116, 116, 105, 110, 103, 115, 0, 0, 64, 0, 100, 0, 0, 0, 0, 0, 0, 0, 194, 1, 0, 0, 0, 0, 1, 0, 0,
+0, 1, 0, 0, 0, 15, 0, 0, 0, 86, 83, 71, 95, 68, 73, 70, 70, 85, 83, 69, 95, 77, 65, 80, 2, 0, 0, 0, 27, 0, 0, 0,
+35, 0, 0, 0, 16, 0, 0, 0, 118, 115, 103, 58, 58, 83, 104, 97, 100, 101, 114, 83, 116, 97, 103, 101, 0, 0, 0, 0, 255, 255, 255, 255,
+255, 255, 255, 255, 16, 0, 0, 0, 4, 0, 0, 0, 109, 97, 105, 110, 36, 0, 0, 0, 17, 0, 0, 0, 118, 115, 103, 58, 58, 83, 104, 97,
+100, 101, 114, 77, 111, 100, 117, 108, 101, 0, 0, 0, 0, 34, 0, 0, 0, 0, 0, 0, 0, 96, 1, 0, 0, 3, 2, 35, 7, 0, 0, 1,
+0, 11, 0, 8, 0, 37, 0, 0, 0, 0, 0, 0, 0, 17, 0, 2, 0, 1, 0, 0, 0, 11, 0, 6, 0, 1, 0, 0, 0, 71, 76, 83,
+76, 46, 115, 116, 100, 46, 52, 53, 48, 0, 0, 0, 0, 14, 0, 3, 0, 0, 0, 0, 0, 1, 0, 0, 0, 15, 0, 8, 0, 4, 0, 0,
+0, 4, 0, 0, 0, 109, 97, 105, 110, 0, 0, 0, 0, 11, 0, 0, 0, 29, 0, 0, 0, 35, 0, 0, 0, 16, 0, 3, 0, 4, 0, 0,
+0, 7, 0, 0, 0, 3, 0, 3, 0, 2, 0, 0, 0, 194, 1, 0, 0, 4, 0, 9, 0, 71, 76, 95, 65, 82, 66, 95, 115, 101, 112, 97,
+114, 97, 116, 101, 95, 115, 104, 97, 100, 101, 114, 95, 111, 98, 106, 101, 99, 116, 115, 0, 0, 5, 0, 4, 0, 4, 0, 0, 0, 109, 97, 105,
+110, 0, 0, 0, 0, 5, 0, 6, 0, 9, 0, 0, 0, 100, 105, 102, 102, 117, 115, 101, 67, 111, 108, 111, 114, 0, 0, 0, 0, 5, 0, 5,
+0, 11, 0, 0, 0, 118, 101, 114, 116, 101, 120, 67, 111, 108, 111, 114, 0, 5, 0, 6, 0, 13, 0, 0, 0, 77, 97, 116, 101, 114, 105, 97,
+108, 68, 97, 116, 97, 0, 0, 0, 0, 6, 0, 7, 0, 13, 0, 0, 0, 0, 0, 0, 0, 97, 109, 98, 105, 101, 110, 116, 67, 111, 108, 111,
+114, 0, 0, 0, 0, 6, 0, 7, 0, 13, 0, 0, 0, 1, 0, 0, 0, 100, 105, 102, 102, 117, 115, 101, 67, 111, 108, 111, 114, 0, 0, 0,
+0, 6, 0, 7, 0, 13, 0, 0, 0, 2, 0, 0, 0, 115, 112, 101, 99, 117, 108, 97, 114, 67, 111, 108, 111, 114, 0, 0, 0, 6, 0, 7,
+0, 13, 0, 0, 0, 3, 0, 0, 0, 101, 109, 105, 115, 115, 105, 118, 101, 67, 111, 108, 111, 114, 0, 0, 0, 6, 0, 6, 0, 13, 0, 0,
+0, 4, 0, 0, 0, 115, 104, 105, 110, 105, 110, 101, 115, 115, 0, 0, 0, 6, 0, 6, 0, 13, 0, 0, 0, 5, 0, 0, 0, 97, 108, 112,
+104, 97, 77, 97, 115, 107, 0, 0, 0, 6, 0, 7, 0, 13, 0, 0, 0, 6, 0, 0, 0, 97, 108, 112, 104, 97, 77, 97, 115, 107, 67, 117,
+116, 111, 102, 102, 0, 5, 0, 5, 0, 15, 0, 0, 0, 109, 97, 116, 101, 114, 105, 97, 108, 0, 0, 0, 0, 5, 0, 5, 0, 25, 0, 0,
+0, 100, 105, 102, 102, 117, 115, 101, 77, 97, 112, 0, 0, 5, 0, 5, 0, 29, 0, 0, 0, 116, 101, 120, 67, 111, 111, 114, 100, 48, 0, 0,
+0, 5, 0, 5, 0, 35, 0, 0, 0, 111, 117, 116, 67, 111, 108, 111, 114, 0, 0, 0, 0, 71, 0, 4, 0, 11, 0, 0, 0, 30, 0, 0,
+0, 2, 0, 0, 0, 72, 0, 5, 0, 13, 0, 0, 0, 0, 0, 0, 0, 35, 0, 0, 0, 0, 0, 0, 0, 72, 0, 5, 0, 13, 0, 0,
+0, 1, 0, 0, 0, 35, 0, 0, 0, 16, 0, 0, 0, 72, 0, 5, 0, 13, 0, 0, 0, 2, 0, 0, 0, 35, 0, 0, 0, 32, 0, 0,
+0, 72, 0, 5, 0, 13, 0, 0, 0, 3, 0, 0, 0, 35, 0, 0, 0, 48, 0, 0, 0, 72, 0, 5, 0, 13, 0, 0, 0, 4, 0, 0,
+0, 35, 0, 0, 0, 64, 0, 0, 0, 72, 0, 5, 0, 13, 0, 0, 0, 5, 0, 0, 0, 35, 0, 0, 0, 68, 0, 0, 0, 72, 0, 5,
+0, 13, 0, 0, 0, 6, 0, 0, 0, 35, 0, 0, 0, 72, 0, 0, 0, 71, 0, 3, 0, 13, 0, 0, 0, 2, 0, 0, 0, 71, 0, 4,
+0, 15, 0, 0, 0, 34, 0, 0, 0, 1, 0, 0, 0, 71, 0, 4, 0, 15, 0, 0, 0, 33, 0, 0, 0, 10, 0, 0, 0, 71, 0, 4,
+0, 25, 0, 0, 0, 34, 0, 0, 0, 1, 0, 0, 0, 71, 0, 4, 0, 25, 0, 0, 0, 33, 0, 0, 0, 0, 0, 0, 0, 71, 0, 4,
+0, 29, 0, 0, 0, 30, 0, 0, 0, 3, 0, 0, 0, 71, 0, 4, 0, 35, 0, 0, 0, 30, 0, 0, 0, 0, 0, 0, 0, 19, 0, 2,
+0, 2, 0, 0, 0, 33, 0, 3, 0, 3, 0, 0, 0, 2, 0, 0, 0, 22, 0, 3, 0, 6, 0, 0, 0, 32, 0, 0, 0, 23, 0, 4,
+0, 7, 0, 0, 0, 6, 0, 0, 0, 4, 0, 0, 0, 32, 0, 4, 0, 8, 0, 0, 0, 7, 0, 0, 0, 7, 0, 0, 0, 32, 0, 4,
+0, 10, 0, 0, 0, 1, 0, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 10, 0, 0, 0, 11, 0, 0, 0, 1, 0, 0, 0, 30, 0, 9,
+0, 13, 0, 0, 0, 7, 0, 0, 0, 7, 0, 0, 0, 7, 0, 0, 0, 7, 0, 0, 0, 6, 0, 0, 0, 6, 0, 0, 0, 6, 0, 0,
+0, 32, 0, 4, 0, 14, 0, 0, 0, 2, 0, 0, 0, 13, 0, 0, 0, 59, 0, 4, 0, 14, 0, 0, 0, 15, 0, 0, 0, 2, 0, 0,
+0, 21, 0, 4, 0, 16, 0, 0, 0, 32, 0, 0, 0, 1, 0, 0, 0, 43, 0, 4, 0, 16, 0, 0, 0, 17, 0, 0, 0, 1, 0, 0,
+0, 32, 0, 4, 0, 18, 0, 0, 0, 2, 0, 0, 0, 7, 0, 0, 0, 25, 0, 9, 0, 22, 0, 0, 0, 6, 0, 0, 0, 1, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 27, 0, 3, 0, 23, 0, 0, 0, 22, 0, 0,
+0, 32, 0, 4, 0, 24, 0, 0, 0, 0, 0, 0, 0, 23, 0, 0, 0, 59, 0, 4, 0, 24, 0, 0, 0, 25, 0, 0, 0, 0, 0, 0,
+0, 23, 0, 4, 0, 27, 0, 0, 0, 6, 0, 0, 0, 2, 0, 0, 0, 32, 0, 4, 0, 28, 0, 0, 0, 1, 0, 0, 0, 27, 0, 0,
+0, 59, 0, 4, 0, 28, 0, 0, 0, 29, 0, 0, 0, 1, 0, 0, 0, 32, 0, 4, 0, 34, 0, 0, 0, 3, 0, 0, 0, 7, 0, 0,
+0, 59, 0, 4, 0, 34, 0, 0, 0, 35, 0, 0, 0, 3, 0, 0, 0, 54, 0, 5, 0, 2, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0,
+0, 3, 0, 0, 0, 248, 0, 2, 0, 5, 0, 0, 0, 59, 0, 4, 0, 8, 0, 0, 0, 9, 0, 0, 0, 7, 0, 0, 0, 61, 0, 4,
+0, 7, 0, 0, 0, 12, 0, 0, 0, 11, 0, 0, 0, 65, 0, 5, 0, 18, 0, 0, 0, 19, 0, 0, 0, 15, 0, 0, 0, 17, 0, 0,
+0, 61, 0, 4, 0, 7, 0, 0, 0, 20, 0, 0, 0, 19, 0, 0, 0, 133, 0, 5, 0, 7, 0, 0, 0, 21, 0, 0, 0, 12, 0, 0,
+0, 20, 0, 0, 0, 62, 0, 3, 0, 9, 0, 0, 0, 21, 0, 0, 0, 61, 0, 4, 0, 23, 0, 0, 0, 26, 0, 0, 0, 25, 0, 0,
+0, 61, 0, 4, 0, 27, 0, 0, 0, 30, 0, 0, 0, 29, 0, 0, 0, 87, 0, 5, 0, 7, 0, 0, 0, 31, 0, 0, 0, 26, 0, 0,
+0, 30, 0, 0, 0, 61, 0, 4, 0, 7, 0, 0, 0, 32, 0, 0, 0, 9, 0, 0, 0, 133, 0, 5, 0, 7, 0, 0, 0, 33, 0, 0,
+0, 32, 0, 0, 0, 31, 0, 0, 0, 62, 0, 3, 0, 9, 0, 0, 0, 33, 0, 0, 0, 61, 0, 4, 0, 7, 0, 0, 0, 36, 0, 0,
+0, 9, 0, 0, 0, 62, 0, 3, 0, 35, 0, 0, 0, 36, 0, 0, 0, 253, 0, 1, 0, 56, 0, 1, 0, 0, 0, 0, 0, 37, 0, 0,
+0, 26, 0, 0, 0, 118, 115, 103, 58, 58, 83, 104, 97, 100, 101, 114, 67, 111, 109, 112, 105, 108, 101, 83, 101, 116, 116, 105, 110, 103, 115, 0,
+0, 64, 0, 100, 0, 0, 0, 0, 0, 0, 0, 194, 1, 0, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0, 13, 0, 0, 0, 86, 83, 71,
+95, 66, 73, 76, 76, 66, 79, 65, 82, 68, 15, 0, 0, 0, 86, 83, 71, 95, 68, 73, 70, 70, 85, 83, 69, 95, 77, 65, 80, 2, 0, 0,
+0, 32, 0, 0, 0, 35, 0, 0, 0, 1, 0, 0, 0, 38, 0, 0, 0, 30, 0, 0, 0, 118, 115, 103, 58, 58, 86, 105, 101, 119, 68, 101,
+112, 101, 110, 100, 101, 110, 116, 83, 116, 97, 116, 101, 66, 105, 110, 100, 105, 110, 103, 0, 0, 0, 0, 0, 0, 0, 0 };
 vsg::VSG io;
 return io.read_cast<vsg::ShaderSet>(data, sizeof(data));
 };
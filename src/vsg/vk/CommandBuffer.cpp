@@ -45,6 +45,11 @@ void CommandBuffer::reset()
 {
     _currentPipelineLayout = VK_NULL_HANDLE;
     _currentPushConstantStageFlags = 0;
+    _currentTransformIndexing = false;
+
+    renderPass = VK_NULL_HANDLE;
+    subpass = 0;
+    subpassContents = VK_SUBPASS_CONTENTS_INLINE;
 
     _commandPool->reset();
 }
@@ -113,6 +113,7 @@ Context::Context(const Context& context) :
     renderPass(context.renderPass),
     defaultPipelineStates(context.defaultPipelineStates),
     overridePipelineStates(context.overridePipelineStates),
+    pipelineScheduler(context.pipelineScheduler),
     descriptorPools(context.descriptorPools),
     graphicsQueue(context.graphicsQueue),
     commandPool(context.commandPool),
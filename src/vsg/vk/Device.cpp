@@ -162,6 +162,8 @@ Device::Device(PhysicalDevice* physicalDevice, const QueueSettings& queueSetting
     }
 
     _extensions = DeviceExtensions::create(this);
+
+    memoryBudget = MemoryBudget::create(physicalDevice, supportsDeviceExtension(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME));
 }
 
 Device::~Device()
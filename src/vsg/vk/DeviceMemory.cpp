@@ -45,7 +45,7 @@ DeviceMemory::DeviceMemory(Device* device, const VkMemoryRequirements& memRequir
     {
         throw Exception{"Error: vsg::DeviceMemory::create(...) failed to create DeviceMemory, no usable memory type found.", VK_ERROR_FORMAT_NOT_SUPPORTED};
     }
-    uint32_t memoryTypeIndex = i;
+    _memoryTypeIndex = i;
 
 #if DO_CHECK
     if (properties & VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT)
@@ -65,13 +65,15 @@ DeviceMemory::DeviceMemory(Device* device, const VkMemoryRequirements& memRequir
     VkMemoryAllocateInfo allocateInfo = {};
     allocateInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
     allocateInfo.allocationSize = memRequirements.size;
-    allocateInfo.memoryTypeIndex = memoryTypeIndex;
+    allocateInfo.memoryTypeIndex = _memoryTypeIndex;
     allocateInfo.pNext = pNextAllocInfo;
 
     if (VkResult result = vkAllocateMemory(*device, &allocateInfo, _device->getAllocationCallbacks(), &_deviceMemory); result != VK_SUCCESS)
     {
         throw Exception{"Error: Failed to allocate DeviceMemory.", result};
     }
+
+    if (_device->memoryBudget) _device->memoryBudget->allocated(_memoryTypeIndex, memRequirements.size);
 }
 
 DeviceMemory::~DeviceMemory()
@@ -83,6 +85,8 @@ DeviceMemory::~DeviceMemory()
 #endif
 
         vkFreeMemory(*_device, _deviceMemory, _device->getAllocationCallbacks());
+
+        if (_device->memoryBudget) _device->memoryBudget->released(_memoryTypeIndex, _memoryRequirements.size);
     }
 }
 
@@ -148,3 +152,9 @@ size_t DeviceMemory::totalReservedSize() const
     std::scoped_lock<std::mutex> lock(_mutex);
     return _memorySlots.totalReservedSize();
 }
+
+MemorySlots DeviceMemory::getMemorySlots() const
+{
+    std::scoped_lock<std::mutex> lock(_mutex);
+    return _memorySlots;
+}
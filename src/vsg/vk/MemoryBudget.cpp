@@ -0,0 +1,261 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2025 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+
+#include <vsg/io/Logger.h>
+#include <vsg/vk/MemoryBudget.h>
+#include <vsg/vk/PhysicalDevice.h>
+
+#include <algorithm>
+
+using namespace vsg;
+
+MemoryBudget::MemoryBudget()
+{
+}
+
+MemoryBudget::MemoryBudget(PhysicalDevice* in_physicalDevice, bool in_useMemoryBudgetExtension) :
+    _physicalDevice(in_physicalDevice),
+    _useMemoryBudgetExtension(in_useMemoryBudgetExtension)
+{
+    auto memoryProperties = _physicalDevice->getMemoryProperties();
+
+    std::vector<Heap> heaps(memoryProperties.memoryHeapCount);
+    for (uint32_t i = 0; i < memoryProperties.memoryHeapCount; ++i)
+    {
+        heaps[i].size = memoryProperties.memoryHeaps[i].size;
+        heaps[i].flags = memoryProperties.memoryHeaps[i].flags;
+    }
+
+    std::vector<VkMemoryType> memoryTypes(memoryProperties.memoryTypes, memoryProperties.memoryTypes + memoryProperties.memoryTypeCount);
+
+    assignHeaps(heaps, memoryTypes);
+}
+
+MemoryBudget::~MemoryBudget()
+{
+}
+
+void MemoryBudget::assignHeaps(const std::vector<Heap>& in_heaps, const std::vector<VkMemoryType>& in_memoryTypes)
+{
+    Changes changes;
+    {
+        std::scoped_lock<std::mutex> lock(_mutex);
+
+        _heaps = in_heaps;
+        _memoryTypes = in_memoryTypes;
+
+        for (auto& heap : _heaps)
+        {
+            if (heap.budget == 0) heap.budget = static_cast<VkDeviceSize>(static_cast<double>(heap.size) * defaultBudgetRatio);
+            heap.usage = heap.allocated;
+        }
+
+        _updatePressure(changes);
+    }
+    _invokeCallbacks(changes);
+}
+
+uint32_t MemoryBudget::memoryTypeIndex(uint32_t typeBits, VkMemoryPropertyFlags properties) const
+{
+    std::scoped_lock<std::mutex> lock(_mutex);
+    for (uint32_t i = 0; i < static_cast<uint32_t>(_memoryTypes.size()); ++i)
+    {
+        if ((typeBits & (1 << i)) && (_memoryTypes[i].propertyFlags & properties) == properties) return i;
+    }
+    return ~0u;
+}
+
+uint32_t MemoryBudget::heapIndex(uint32_t memoryTypeIndex) const
+{
+    std::scoped_lock<std::mutex> lock(_mutex);
+    return memoryTypeIndex < _memoryTypes.size() ? _memoryTypes[memoryTypeIndex].heapIndex : 0;
+}
+
+void MemoryBudget::allocated(uint32_t memoryTypeIndex, VkDeviceSize size)
+{
+    Changes changes;
+    {
+        std::scoped_lock<std::mutex> lock(_mutex);
+
+        if (memoryTypeIndex >= _memoryTypes.size()) return;
+
+        uint32_t index = _memoryTypes[memoryTypeIndex].heapIndex;
+        if (index >= _heaps.size()) return;
+
+        auto& heap = _heaps[index];
+        heap.allocated += size;
+        ++heap.numAllocations;
+        heap.usage += size;
+
+        _updatePressure(changes);
+    }
+    _invokeCallbacks(changes);
+}
+
+void MemoryBudget::released(uint32_t memoryTypeIndex, VkDeviceSize size)
+{
+    Changes changes;
+    {
+        std::scoped_lock<std::mutex> lock(_mutex);
+
+        if (memoryTypeIndex >= _memoryTypes.size()) return;
+
+        uint32_t index = _memoryTypes[memoryTypeIndex].heapIndex;
+        if (index >= _heaps.size()) return;
+
+        auto& heap = _heaps[index];
+        heap.allocated -= std::min(size, heap.allocated);
+        if (heap.numAllocations > 0) --heap.numAllocations;
+        heap.usage -= std::min(size, heap.usage);
+
+        _updatePressure(changes);
+    }
+    _invokeCallbacks(changes);
+}
+
+bool MemoryBudget::available(uint32_t memoryTypeIndex, VkDeviceSize size) const
+{
+    std::scoped_lock<std::mutex> lock(_mutex);
+
+    if (memoryTypeIndex >= _memoryTypes.size()) return true;
+
+    uint32_t index = _memoryTypes[memoryTypeIndex].heapIndex;
+    if (index >= _heaps.size()) return true;
+
+    auto& heap = _heaps[index];
+    return (heap.usage + size) <= heap.budget;
+}
+
+void MemoryBudget::update()
+{
+    if (_useMemoryBudgetExtension && _physicalDevice)
+    {
+        VkPhysicalDeviceMemoryBudgetPropertiesEXT budgetProperties = {};
+        budgetProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_BUDGET_PROPERTIES_EXT;
+
+        auto memoryProperties = _physicalDevice->getMemoryProperties(&budgetProperties);
+
+        std::vector<VkDeviceSize> budgets(memoryProperties.memoryHeapCount);
+        std::vector<VkDeviceSize> usages(memoryProperties.memoryHeapCount);
+        for (uint32_t i = 0; i < memoryProperties.memoryHeapCount; ++i)
+        {
+            budgets[i] = budgetProperties.heapBudget[i];
+            usages[i] = budgetProperties.heapUsage[i];
+        }
+
+        update(budgets, usages);
+    }
+    else
+    {
+        // no driver reported values so use our own accounting against the default budget.
+        update({}, {});
+    }
+}
+
+void MemoryBudget::update(const std::vector<VkDeviceSize>& budgets, const std::vector<VkDeviceSize>& usages)
+{
+    Changes changes;
+    {
+        std::scoped_lock<std::mutex> lock(_mutex);
+
+        for (size_t i = 0; i < _heaps.size(); ++i)
+        {
+            auto& heap = _heaps[i];
+
+            if (i < budgets.size() && budgets[i] > 0)
+                heap.budget = budgets[i];
+            else
+                heap.budget = static_cast<VkDeviceSize>(static_cast<double>(heap.size) * defaultBudgetRatio);
+
+            // reported usage includes other processes, allocations made after this update are added on by allocated()/released().
+            if (i < usages.size())
+                heap.usage = std::max(usages[i], heap.allocated);
+            else
+                heap.usage = heap.allocated;
+        }
+
+        _updatePressure(changes);
+    }
+    _invokeCallbacks(changes);
+}
+
+MemoryPressure MemoryBudget::pressure(uint32_t heapIndex) const
+{
+    std::scoped_lock<std::mutex> lock(_mutex);
+    return heapIndex < _heaps.size() ? _heaps[heapIndex].pressure : MEMORY_PRESSURE_NONE;
+}
+
+std::vector<MemoryBudget::Heap> MemoryBudget::getHeaps() const
+{
+    std::scoped_lock<std::mutex> lock(_mutex);
+    return _heaps;
+}
+
+void MemoryBudget::addPressureCallback(PressureCallback callback)
+{
+    std::scoped_lock<std::mutex> lock(_callbacksMutex);
+    _callbacks.push_back(callback);
+}
+
+MemoryPressure MemoryBudget::_computePressure(const Heap& heap) const
+{
+    double utilization = heap.utilization();
+    if (utilization >= criticalThreshold) return MEMORY_PRESSURE_CRITICAL;
+    if (utilization >= highThreshold) return MEMORY_PRESSURE_HIGH;
+    if (utilization >= lowThreshold) return MEMORY_PRESSURE_LOW;
+    return MEMORY_PRESSURE_NONE;
+}
+
+void MemoryBudget::_updatePressure(Changes& changes)
+{
+    MemoryPressure maxPressure = MEMORY_PRESSURE_NONE;
+    for (uint32_t i = 0; i < static_cast<uint32_t>(_heaps.size()); ++i)
+    {
+        auto& heap = _heaps[i];
+        auto current = _computePressure(heap);
+        if (current != heap.pressure)
+        {
+            changes.push_back(Change{i, heap.pressure, current});
+            heap.pressure = current;
+        }
+        maxPressure = std::max(maxPressure, current);
+    }
+    _pressure = maxPressure;
+}
+
+void MemoryBudget::_invokeCallbacks(const Changes& changes)
+{
+    if (changes.empty()) return;
+
+    for (auto& change : changes)
+    {
+        if (change.current > change.previous)
+            debug("MemoryBudget heap ", change.heapIndex, " pressure raised from ", change.previous, " to ", change.current);
+        else
+            debug("MemoryBudget heap ", change.heapIndex, " pressure lowered from ", change.previous, " to ", change.current);
+    }
+
+    std::vector<PressureCallback> callbacks;
+    {
+        std::scoped_lock<std::mutex> lock(_callbacksMutex);
+        callbacks = _callbacks;
+    }
+
+    for (auto& change : changes)
+    {
+        for (auto& callback : callbacks)
+        {
+            callback(*this, change.heapIndex, change.previous, change.current);
+        }
+    }
+}
@@ -75,24 +75,118 @@ VkDeviceSize MemoryBufferPools::computeBufferTotalReserved() const
     return totalReservedSize;
 }
 
+template<class T>
+static void accumulate(MemoryBufferPools::FragmentationStats& stats, const T& block)
+{
+    auto memorySlots = block.getMemorySlots();
+
+    ++stats.numBlocks;
+    if (memorySlots.empty()) ++stats.numEmptyBlocks;
+    stats.numAvailableSlots += memorySlots.numAvailableSlots();
+    stats.totalSize += memorySlots.totalMemorySize();
+    stats.totalReserved += memorySlots.totalReservedSize();
+    stats.totalAvailable += memorySlots.totalAvailableSize();
+    stats.largestAvailable = std::max(stats.largestAvailable, static_cast<VkDeviceSize>(memorySlots.maximumAvailableSpace()));
+}
+
+MemoryBufferPools::FragmentationStats MemoryBufferPools::computeMemoryFragmentationStats() const
+{
+    std::scoped_lock<std::mutex> lock(_mutex);
+
+    FragmentationStats stats;
+    for (auto& deviceMemory : memoryPools)
+    {
+        accumulate(stats, *deviceMemory);
+    }
+    return stats;
+}
+
+MemoryBufferPools::FragmentationStats MemoryBufferPools::computeBufferFragmentationStats() const
+{
+    std::scoped_lock<std::mutex> lock(_mutex);
+
+    FragmentationStats stats;
+    for (auto& buffer : bufferPools)
+    {
+        accumulate(stats, *buffer);
+    }
+    return stats;
+}
+
+std::vector<MemorySlots> MemoryBufferPools::getMemorySlots() const
+{
+    std::scoped_lock<std::mutex> lock(_mutex);
+
+    std::vector<MemorySlots> memorySlots;
+    for (auto& deviceMemory : memoryPools)
+    {
+        memorySlots.push_back(deviceMemory->getMemorySlots());
+    }
+    return memorySlots;
+}
+
+std::vector<MemorySlots> MemoryBufferPools::getBufferMemorySlots(VkBufferUsageFlags bufferUsageFlags) const
+{
+    std::scoped_lock<std::mutex> lock(_mutex);
+
+    std::vector<MemorySlots> memorySlots;
+    for (auto& buffer : bufferPools)
+    {
+        if (buffer->usage == bufferUsageFlags) memorySlots.push_back(buffer->getMemorySlots());
+    }
+    return memorySlots;
+}
+
+VkDeviceSize MemoryBufferPools::releaseUnusedMemory()
+{
+    std::scoped_lock<std::mutex> lock(_mutex);
+    return _releaseUnusedMemory();
+}
+
+VkDeviceSize MemoryBufferPools::_releaseUnusedMemory()
+{
+    // Buffer that are only referenced by the pool have no BufferInfo using them, releasing them returns their slots to the DeviceMemory
+    bufferPools.erase(std::remove_if(bufferPools.begin(), bufferPools.end(), [](const ref_ptr<Buffer>& buffer) { return buffer->referenceCount() == 1 && buffer->totalReservedSize() == 0; }), bufferPools.end());
+
+    VkDeviceSize releasedSize = 0;
+    memoryPools.erase(std::remove_if(memoryPools.begin(), memoryPools.end(), [&releasedSize](const ref_ptr<DeviceMemory>& deviceMemory) {
+                          if (deviceMemory->referenceCount() != 1 || deviceMemory->totalReservedSize() != 0) return false;
+                          releasedSize += deviceMemory->getMemoryRequirements().size;
+                          return true;
+                      }),
+                      memoryPools.end());
+
+    return releasedSize;
+}
+
 ref_ptr<BufferInfo> MemoryBufferPools::reserveBuffer(VkDeviceSize totalSize, VkDeviceSize alignment, VkBufferUsageFlags bufferUsageFlags, VkSharingMode sharingMode, VkMemoryPropertyFlags memoryProperties)
 {
     ref_ptr<BufferInfo> bufferInfo = BufferInfo::create();
 
     {
         std::scoped_lock<std::mutex> lock(_mutex);
+
+        // try the buffers with the least available space first so that allocations are packed into the fullest buffers, leaving sparse buffers to drain so they can be released
+        std::vector<std::pair<size_t, Buffer*>> candidates;
         for (auto& bufferFromPool : bufferPools)
         {
             if (bufferFromPool->usage == bufferUsageFlags && bufferFromPool->size >= totalSize)
             {
-                MemorySlots::OptionalOffset reservedBufferSlot = bufferFromPool->reserve(totalSize, alignment);
-                if (reservedBufferSlot.first)
-                {
-                    bufferInfo->buffer = bufferFromPool;
-                    bufferInfo->offset = reservedBufferSlot.second;
-                    bufferInfo->range = totalSize;
-                    return bufferInfo;
-                }
+                auto available = bufferFromPool->maximumAvailableSpace();
+                if (available >= totalSize) candidates.emplace_back(bufferFromPool->totalAvailableSize(), bufferFromPool.get());
+            }
+        }
+        std::sort(candidates.begin(), candidates.end());
+
+        for (auto& [available, bufferFromPool] : candidates)
+        {
+            MemorySlots::OptionalOffset reservedBufferSlot = bufferFromPool->reserve(totalSize, alignment);
+            if (reservedBufferSlot.first)
+            {
+                bufferInfo->buffer = bufferFromPool;
+                bufferInfo->offset = reservedBufferSlot.second;
+                bufferInfo->range = totalSize;
+                return bufferInfo;
             }
         }
     }
@@ -111,6 +205,7 @@ ref_ptr<BufferInfo> MemoryBufferPools::reserveBuffer(VkDeviceSize totalSize, VkD
     if (!bufferInfo->buffer->full())
     {
         //debug(name, "  inserting new Buffer into Context.bufferPools");
+        std::scoped_lock<std::mutex> lock(_mutex);
         bufferPools.push_back(bufferInfo->buffer);
     }
 
@@ -141,18 +236,26 @@ MemoryBufferPools::DeviceMemoryOffset MemoryBufferPools::reserveMemory(VkMemoryR
     VkDeviceSize totalSize = memRequirements.size;
     MemorySlots::OptionalOffset reservedSlot(false, 0);
 
+    // try the blocks with the least available space first so that allocations are packed into the fullest blocks, leaving sparse blocks to drain so they can be released
+    std::vector<std::pair<size_t, DeviceMemory*>> candidates;
     for (auto& memoryPool : memoryPools)
     {
         if (memoryPool->getMemoryRequirements().memoryTypeBits == memRequirements.memoryTypeBits &&
             memoryPool->getMemoryRequirements().alignment == memRequirements.alignment &&
             memoryPool->maximumAvailableSpace() >= totalSize)
         {
-            reservedSlot = memoryPool->reserve(totalSize);
-            if (reservedSlot.first)
-            {
-                deviceMemory = memoryPool;
-                break;
-            }
+            candidates.emplace_back(memoryPool->totalAvailableSize(), memoryPool.get());
+        }
+    }
+    std::sort(candidates.begin(), candidates.end());
+
+    for (auto& [available, memoryPool] : candidates)
+    {
+        reservedSlot = memoryPool->reserve(totalSize);
+        if (reservedSlot.first)
+        {
+            deviceMemory = memoryPool;
+            break;
         }
     }
 
@@ -166,6 +269,17 @@ MemoryBufferPools::DeviceMemoryOffset MemoryBufferPools::reserveMemory(VkMemoryR
         //debug("Creating new local DeviceMemory");
         if (memRequirements.size < deviceMemorySize) memRequirements.size = deviceMemorySize;
 
+        // when the new allocation would take the heap over budget, free up any unused pooled memory first so the driver has the most headroom
+        if (auto& memoryBudget = device->memoryBudget)
+        {
+            uint32_t memoryTypeIndex = memoryBudget->memoryTypeIndex(memRequirements.memoryTypeBits, memoryProperties);
+            if (!memoryBudget->available(memoryTypeIndex, memRequirements.size))
+            {
+                auto releasedSize = _releaseUnusedMemory();
+                debug("MemoryBufferPools::reserveMemory() heap over budget, released ", releasedSize, " bytes of unused DeviceMemory.");
+            }
+        }
+
         deviceMemory = vsg::DeviceMemory::create(device, memRequirements, memoryProperties, pNextAllocInfo);
         if (deviceMemory)
         {
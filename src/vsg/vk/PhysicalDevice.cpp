@@ -34,12 +34,31 @@ PhysicalDevice::PhysicalDevice(Instance* instance, VkPhysicalDevice device) :
     /// get function pointers
     instance->getProcAddr(_vkGetPhysicalDeviceFeatures2, "vkGetPhysicalDeviceFeatures2", "vkGetPhysicalDeviceFeatures2KHR");
     instance->getProcAddr(_vkGetPhysicalDeviceProperties2, "vkGetPhysicalDeviceProperties2", "vkGetPhysicalDeviceProperties2KHR");
+    instance->getProcAddr(_vkGetPhysicalDeviceMemoryProperties2, "vkGetPhysicalDeviceMemoryProperties2", "vkGetPhysicalDeviceMemoryProperties2KHR");
 }
 
 PhysicalDevice::~PhysicalDevice()
 {
 }
 
+VkPhysicalDeviceMemoryProperties PhysicalDevice::getMemoryProperties(void* pNext) const
+{
+    if (_vkGetPhysicalDeviceMemoryProperties2)
+    {
+        VkPhysicalDeviceMemoryProperties2 memoryProperties2 = {};
+        memoryProperties2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PROPERTIES_2;
+        memoryProperties2.pNext = pNext;
+
+        _vkGetPhysicalDeviceMemoryProperties2(_device, &memoryProperties2);
+
+        return memoryProperties2.memoryProperties;
+    }
+
+    VkPhysicalDeviceMemoryProperties memoryProperties;
+    vkGetPhysicalDeviceMemoryProperties(_device, &memoryProperties);
+    return memoryProperties;
+}
+
 int PhysicalDevice::getQueueFamily(VkQueueFlags queueFlags) const
 {
     int bestFamily = -1;